@@ -84,8 +84,15 @@ void CI_Lab_AppMain(void)
     {
         CFE_ES_PerfLogExit(CI_LAB_MAIN_TASK_PERF_ID);
 
+        if (CI_LAB_Global.UseSelect)
+        {
+            /* Pend on both the command pipe and the uplink socket */
+            CI_LAB_WaitForInput();
+            continue;
+        }
+
         /* Pend on receipt of command packet -- timeout set to 500 millisecs */
-        status = CFE_SB_ReceiveBuffer(&SBBufPtr, CI_LAB_Global.CommandPipe, 500);
+        status = CFE_SB_ReceiveBuffer(&SBBufPtr, CI_LAB_Global.CommandPipe, CI_LAB_WAIT_TIMEOUT);
 
         CFE_ES_PerfLogEntry(CI_LAB_MAIN_TASK_PERF_ID);
 
@@ -125,9 +132,17 @@ void CI_LAB_TaskInit(void)
 {
     int32  status;
     uint16 DefaultListenPort;
+    uint32 i;
 
     memset(&CI_LAB_Global, 0, sizeof(CI_LAB_Global));
 
+    /* The sender address of uplink packets is not used, so it is not collected */
+    for (i = 0; i < CI_LAB_INGEST_BATCH_SIZE; ++i)
+    {
+        CI_LAB_Global.IngestMsg[i].Buffer     = CI_LAB_Global.NetworkBuffer[i];
+        CI_LAB_Global.IngestMsg[i].BufferSize = sizeof(CI_LAB_Global.NetworkBuffer[i]);
+    }
+
     CFE_EVS_Register(CI_LAB_EventFilters, sizeof(CI_LAB_EventFilters) / sizeof(CFE_EVS_BinFilter_t),
                      CFE_EVS_EventFilter_BINARY);
 
@@ -135,6 +150,13 @@ void CI_LAB_TaskInit(void)
     CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CI_LAB_CMD_MID), CI_LAB_Global.CommandPipe);
     CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CI_LAB_SEND_HK_MID), CI_LAB_Global.CommandPipe);
 
+    /*
+     * If the pipe can be waited on together with the socket then the main loop
+     * blocks until either has input, otherwise it alternates between them
+     */
+    CI_LAB_Global.UseSelect =
+        (CFE_SB_GetPipeSelectId(CI_LAB_Global.CommandPipe, &CI_LAB_Global.PipeSelectId) == CFE_SUCCESS);
+
     status = OS_SocketOpen(&CI_LAB_Global.SocketID, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
     if (status != OS_SUCCESS)
     {
@@ -247,6 +269,59 @@ void CI_LAB_ResetCounters_Internal(void)
 
 } /* End of CI_LAB_ResetCounters() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_LAB_WaitForInput() -- wait on the command pipe and uplink socket        */
+/*                           together, and service whichever has input        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_LAB_WaitForInput(void)
+{
+    OS_FdSet         ReadSet;
+    int32            status;
+    uint32           i;
+    CFE_SB_Buffer_t *SBBufPtr;
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, CI_LAB_Global.PipeSelectId);
+    if (CI_LAB_Global.SocketConnected)
+    {
+        OS_SelectFdAdd(&ReadSet, CI_LAB_Global.SocketID);
+    }
+
+    status = OS_SelectMultiple(&ReadSet, NULL, CI_LAB_WAIT_TIMEOUT);
+
+    CFE_ES_PerfLogEntry(CI_LAB_MAIN_TASK_PERF_ID);
+
+    if (status == OS_SUCCESS)
+    {
+        if (OS_SelectFdIsSet(&ReadSet, CI_LAB_Global.PipeSelectId))
+        {
+            for (i = 0; i < CI_LAB_PIPE_DEPTH; ++i)
+            {
+                if (CFE_SB_ReceiveBuffer(&SBBufPtr, CI_LAB_Global.CommandPipe, CFE_SB_POLL) != CFE_SUCCESS)
+                {
+                    break;
+                }
+
+                CI_LAB_ProcessCommandPacket(SBBufPtr);
+            }
+        }
+
+        if (CI_LAB_Global.SocketConnected && OS_SelectFdIsSet(&ReadSet, CI_LAB_Global.SocketID))
+        {
+            CI_LAB_ReadUpLink();
+        }
+    }
+    else if (status != OS_ERROR_TIMEOUT)
+    {
+        /* Not every OS can wait on a pipe and a socket together */
+        CFE_ES_WriteToSysLog("CI_LAB: select on pipe and socket failed (%d), polling uplink instead\n", (int)status);
+        CI_LAB_Global.UseSelect = false;
+    }
+
+} /* End of CI_LAB_WaitForInput() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* CI_LAB_ReadUpLink() --                                                     */
@@ -254,15 +329,14 @@ void CI_LAB_ResetCounters_Internal(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 void CI_LAB_ReadUpLink(void)
 {
-    int                                   i;
-    int32                                 status;
-    uint32                                BitSize;
-    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
-    CFE_SB_Listener_Component_t           ListenerParams;
-    EdsLib_DataTypeDB_TypeInfo_t          CmdHdrInfo;
-    EdsLib_DataTypeDB_TypeInfo_t          FullCmdInfo;
-    EdsLib_Id_t                           EdsId;
-    CFE_SB_Buffer_t *                     NextIngestBufPtr;
+    uint32                       i;
+    uint32                       MsgCount;
+    uint32                       Total;
+    int32                        status;
+    uint32                       BitSize;
+    EdsLib_DataTypeDB_TypeInfo_t CmdHdrInfo;
+    EdsLib_Id_t                  EdsId;
+    CFE_SB_Buffer_t *            NextIngestBufPtr;
 
     const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
 
@@ -275,113 +349,141 @@ void CI_LAB_ReadUpLink(void)
         return;
     }
 
-    for (i = 0; i <= 10; i++)
+    /*
+     * Drain whatever is queued on the socket a batch at a time, stopping
+     * once a batch comes back short (nothing more pending) or the limit
+     * per wakeup is reached.
+     */
+    MsgCount = CI_LAB_INGEST_BATCH_SIZE;
+    for (Total = 0; Total < CI_LAB_MAX_INGEST && MsgCount == CI_LAB_INGEST_BATCH_SIZE; Total += MsgCount)
     {
-        status = OS_SocketRecvFrom(CI_LAB_Global.SocketID, CI_LAB_Global.NetworkBuffer,
-                                   sizeof(CI_LAB_Global.NetworkBuffer), &CI_LAB_Global.SocketAddress, OS_CHECK);
-
-        if (status >= 0)
-        {
-            BitSize = status;
-            BitSize *= 8;
-        }
-        else
+        status = OS_SocketRecvMulti(CI_LAB_Global.SocketID, CI_LAB_Global.IngestMsg, CI_LAB_INGEST_BATCH_SIZE,
+                                    OS_CHECK);
+        if (status <= 0)
         {
-            BitSize = 0;
+            break;
         }
 
-        if (BitSize >= CmdHdrInfo.Size.Bits)
+        MsgCount = status;
+        for (i = 0; i < MsgCount; ++i)
         {
-            if (NextIngestBufPtr == NULL)
+            BitSize = CI_LAB_Global.IngestMsg[i].ActualLength * 8;
+
+            if (BitSize >= CmdHdrInfo.Size.Bits)
             {
-                NextIngestBufPtr = CFE_SB_AllocateMessageBuffer(sizeof(CFE_HDR_CommandHeader_Buffer_t));
                 if (NextIngestBufPtr == NULL)
                 {
-                    CFE_EVS_SendEvent(CI_LAB_INGEST_ALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "CI: L%d, buffer allocation failed\n", __LINE__);
-                    break;
+                    NextIngestBufPtr = CFE_SB_AllocateMessageBuffer(sizeof(CFE_HDR_CommandHeader_Buffer_t));
+                    if (NextIngestBufPtr == NULL)
+                    {
+                        CFE_EVS_SendEvent(CI_LAB_INGEST_ALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "CI: L%d, buffer allocation failed\n", __LINE__);
+                        continue;
+                    }
                 }
-            }
 
-            /* Packet is in external wire-format byte order - unpack it and copy */
-            EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_CommandHeader_DATADICTIONARY);
-            status =
-                EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, NextIngestBufPtr, CI_LAB_Global.NetworkBuffer,
-                                                      sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize, 0);
-            if (status != EDSLIB_SUCCESS)
+                if (CI_LAB_IngestPacket(NextIngestBufPtr, CI_LAB_Global.NetworkBuffer[i], BitSize))
+                {
+                    /* Set NULL so a new buffer will be obtained next time around */
+                    NextIngestBufPtr = NULL;
+                }
+            }
+            else if (BitSize > 0)
             {
-                OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(1): %d\n", (int)status);
-                break;
+                /* bad size, report as ingest error */
+                CI_LAB_Global.HkTlm.Payload.IngestErrors++;
+
+                CFE_EVS_SendEvent(CI_LAB_INGEST_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CI: L%d, cmd dropped, bad length=%u bits\n", __LINE__, (unsigned int)BitSize);
             }
+        }
+    }
 
-            /* Header decoded successfully - Now need to determine the type for the rest of the payload */
-            CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &NextIngestBufPtr->Msg.BaseMsg);
-            CFE_MissionLib_UnmapListenerComponent(&ListenerParams, &PubSubParams);
+    if (NextIngestBufPtr != NULL)
+    {
+        CFE_SB_ReleaseMessageBuffer(NextIngestBufPtr);
+    }
 
-            status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telecommand_Interface_ID,
-                                                    ListenerParams.Telecommand.TopicId, 1, 1, &EdsId);
-            if (status != CFE_MISSIONLIB_SUCCESS)
-            {
-                OS_printf("CFE_MissionLib_GetArgumentType(): %d\n", (int)status);
-                break;
-            }
+    return;
 
-            status = EdsLib_DataTypeDB_UnpackPartialObject(
-                EDS_DB, &EdsId, NextIngestBufPtr, CI_LAB_Global.NetworkBuffer, sizeof(CFE_HDR_CommandHeader_Buffer_t),
-                BitSize, sizeof(CFE_HDR_CommandHeader_t));
-            if (status != EDSLIB_SUCCESS)
-            {
-                OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(2): %d\n", (int)status);
-                break;
-            }
+} /* End of CI_LAB_ReadUpLink() */
 
-            /* Verify that the checksum and basic fields are correct, and recompute the length entry */
-            status = EdsLib_DataTypeDB_VerifyUnpackedObject(
-                EDS_DB, EdsId, NextIngestBufPtr, CI_LAB_Global.NetworkBuffer, EDSLIB_DATATYPEDB_RECOMPUTE_LENGTH);
-            if (status != EDSLIB_SUCCESS)
-            {
-                OS_printf("EdsLib_DataTypeDB_VerifyUnpackedObject(): %d\n", (int)status);
-                break;
-            }
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_LAB_IngestPacket() -- decode one uplink packet and send it on the SB    */
+/*                                                                            */
+/* Returns true if the SB buffer was sent (and so is no longer owned here)    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool CI_LAB_IngestPacket(CFE_SB_Buffer_t *IngestBufPtr, const void *NetworkBuffer, uint32 BitSize)
+{
+    int32                                 status;
+    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
+    CFE_SB_Listener_Component_t           ListenerParams;
+    EdsLib_DataTypeDB_TypeInfo_t          FullCmdInfo;
+    EdsLib_Id_t                           EdsId;
 
-            status = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &FullCmdInfo);
-            if (status != EDSLIB_SUCCESS)
-            {
-                OS_printf("EdsLib_DataTypeDB_GetTypeInfo(): %d\n", (int)status);
-                return;
-            }
+    const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
 
-            CFE_ES_PerfLogEntry(CI_LAB_SOCKET_RCV_PERF_ID);
-            CI_LAB_Global.HkTlm.Payload.IngestPackets++;
-            status = CFE_SB_TransmitBuffer(NextIngestBufPtr, false);
-            CFE_ES_PerfLogExit(CI_LAB_SOCKET_RCV_PERF_ID);
+    /* Packet is in external wire-format byte order - unpack it and copy */
+    EdsId  = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_CommandHeader_DATADICTIONARY);
+    status = EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, IngestBufPtr, NetworkBuffer,
+                                                   sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize, 0);
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(1): %d\n", (int)status);
+        return false;
+    }
 
-            if (status == CFE_SUCCESS)
-            {
-                /* Set NULL so a new buffer will be obtained next time around */
-                NextIngestBufPtr = NULL;
-            }
-            else
-            {
-                CFE_EVS_SendEvent(CI_LAB_INGEST_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CI: L%d, CFE_SB_TransmitBuffer() failed, status=%d\n", __LINE__, (int)status);
-            }
-        }
-        else if (status > 0)
-        {
-            /* bad size, report as ingest error */
-            CI_LAB_Global.HkTlm.Payload.IngestErrors++;
+    /* Header decoded successfully - Now need to determine the type for the rest of the payload */
+    CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &IngestBufPtr->Msg.BaseMsg);
+    CFE_MissionLib_UnmapListenerComponent(&ListenerParams, &PubSubParams);
 
-            CFE_EVS_SendEvent(CI_LAB_INGEST_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CI: L%d, cmd dropped, bad length=%u bits\n", __LINE__, (unsigned int)BitSize);
-        }
+    status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telecommand_Interface_ID,
+                                            ListenerParams.Telecommand.TopicId, 1, 1, &EdsId);
+    if (status != CFE_MISSIONLIB_SUCCESS)
+    {
+        OS_printf("CFE_MissionLib_GetArgumentType(): %d\n", (int)status);
+        return false;
     }
 
-    if (NextIngestBufPtr != NULL)
+    status = EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, IngestBufPtr, NetworkBuffer,
+                                                   sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize,
+                                                   sizeof(CFE_HDR_CommandHeader_t));
+    if (status != EDSLIB_SUCCESS)
     {
-        CFE_SB_ReleaseMessageBuffer(NextIngestBufPtr);
+        OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(2): %d\n", (int)status);
+        return false;
     }
 
-    return;
+    /* Verify that the checksum and basic fields are correct, and recompute the length entry */
+    status = EdsLib_DataTypeDB_VerifyUnpackedObject(EDS_DB, EdsId, IngestBufPtr, NetworkBuffer,
+                                                    EDSLIB_DATATYPEDB_RECOMPUTE_LENGTH);
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_VerifyUnpackedObject(): %d\n", (int)status);
+        return false;
+    }
 
-} /* End of CI_LAB_ReadUpLink() */
+    status = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &FullCmdInfo);
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_GetTypeInfo(): %d\n", (int)status);
+        return false;
+    }
+
+    CFE_ES_PerfLogEntry(CI_LAB_SOCKET_RCV_PERF_ID);
+    CI_LAB_Global.HkTlm.Payload.IngestPackets++;
+    status = CFE_SB_TransmitBuffer(IngestBufPtr, false);
+    CFE_ES_PerfLogExit(CI_LAB_SOCKET_RCV_PERF_ID);
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CI_LAB_INGEST_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CI: L%d, CFE_SB_TransmitBuffer() failed, status=%d\n", __LINE__, (int)status);
+        return false;
+    }
+
+    return true;
+
+} /* End of CI_LAB_IngestPacket() */
@@ -47,19 +47,35 @@
 #define CI_LAB_BASE_UDP_PORT 1234
 #define CI_LAB_PIPE_DEPTH    32
 
+/*
+ * Longest time (in milliseconds) to block waiting for commands
+ * or uplink packets before checking the run status again
+ */
+#define CI_LAB_WAIT_TIMEOUT 500
+
+/*
+ * Uplink datagrams are read from the socket in batches of
+ * CI_LAB_INGEST_BATCH_SIZE per call, up to CI_LAB_MAX_INGEST per wakeup
+ */
+#define CI_LAB_INGEST_BATCH_SIZE 4
+#define CI_LAB_MAX_INGEST        12
+
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
 typedef struct
 {
     bool            SocketConnected;
+    bool            UseSelect;
     CFE_SB_PipeId_t CommandPipe;
+    osal_id_t       PipeSelectId;
     osal_id_t       SocketID;
     OS_SockAddr_t   SocketAddress;
 
     CI_LAB_HkTlm_t HkTlm;
 
-    CFE_HDR_Message_PackedBuffer_t NetworkBuffer;
+    CFE_HDR_Message_PackedBuffer_t NetworkBuffer[CI_LAB_INGEST_BATCH_SIZE];
+    OS_SockMsg_t                   IngestMsg[CI_LAB_INGEST_BATCH_SIZE];
 
 } CI_LAB_GlobalData_t;
 
@@ -76,7 +92,9 @@ void CI_Lab_AppMain(void);
 void CI_LAB_TaskInit(void);
 void CI_LAB_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
 void CI_LAB_ResetCounters_Internal(void);
+void CI_LAB_WaitForInput(void);
 void CI_LAB_ReadUpLink(void);
+bool CI_LAB_IngestPacket(CFE_SB_Buffer_t *IngestBufPtr, const void *NetworkBuffer, uint32 BitSize);
 
 /*
  * Individual message handler function prototypes
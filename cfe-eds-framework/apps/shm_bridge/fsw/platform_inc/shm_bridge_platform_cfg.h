@@ -0,0 +1,70 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_platform_cfg.h
+**
+** Purpose:
+**  SHM Bridge platform configuration
+**
+** Notes:
+**
+*************************************************************************/
+#ifndef _shm_bridge_platform_cfg_h_
+#define _shm_bridge_platform_cfg_h_
+
+/**
+ * Encoding of messages in both rings, SHM_BRIDGE_FORMAT_PACKED or SHM_BRIDGE_FORMAT_NATIVE.
+ *
+ * Packed frames are the same EDS wire format CI_LAB and TO_LAB use over UDP,
+ * which is what the test executive expects.  Native frames skip the encoding
+ * and are only useful to clients built against the same headers as the target.
+ */
+#define SHM_BRIDGE_FRAME_FORMAT SHM_BRIDGE_FORMAT_PACKED
+
+/**
+ * Size in bytes of the command ring into cFS, must be a power of two
+ */
+#define SHM_BRIDGE_UPLINK_RING_SIZE 0x10000
+
+/**
+ * Size in bytes of the telemetry ring out of cFS, must be a power of two.
+ *
+ * The bridge never blocks on a full ring, it drops the message instead, so
+ * this should cover the largest telemetry burst the client may fall behind on.
+ */
+#define SHM_BRIDGE_DOWNLINK_RING_SIZE 0x100000
+
+/**
+ * Pipe depth limit for the event message subscription made at startup, so
+ * clients always see events such as the subscription acknowledgements
+ */
+#define SHM_BRIDGE_EVENT_MSG_LIMIT 32
+
+/**
+ * Priority and stack size of the child task that services the uplink ring
+ */
+#define SHM_BRIDGE_UPLINK_TASK_PRIORITY   60
+#define SHM_BRIDGE_UPLINK_TASK_STACK_SIZE 16384
+
+#endif /* _shm_bridge_platform_cfg_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
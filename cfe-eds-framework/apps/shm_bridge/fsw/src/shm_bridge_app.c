@@ -0,0 +1,346 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_app.c
+**
+** Purpose:
+**   This file contains the main task of the shared memory bridge, which
+**   forwards subscribed software bus messages to the downlink ring.  The
+**   uplink ring is serviced by a child task, see shm_bridge_uplink.c.
+**
+*******************************************************************************/
+
+/*
+**   Include Files:
+*/
+
+#include "shm_bridge_app.h"
+#include "shm_bridge_perfids.h"
+#include "shm_bridge_events.h"
+#include "shm_bridge_version.h"
+
+#include "cfe_msgids.h"
+#include "cfe_config.h"
+
+#include "edslib_datatypedb.h"
+#include "cfe_hdr_eds_typedefs.h"
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+
+/*
+** SHM Bridge global data...
+*/
+SHM_BRIDGE_GlobalData_t SHM_BRIDGE_Global;
+
+static CFE_EVS_BinFilter_t SHM_BRIDGE_EventFilters[] =
+    {/* Event ID    mask */
+     {SHM_BRIDGE_STARTUP_INF_EID, 0x0000},     {SHM_BRIDGE_RING_CREATE_ERR_EID, 0x0000},
+     {SHM_BRIDGE_INIT_ERR_EID, 0x0000},        {SHM_BRIDGE_SUBSCRIBE_INF_EID, 0x0000},
+     {SHM_BRIDGE_UNSUBSCRIBE_INF_EID, 0x0000}, {SHM_BRIDGE_SUBSCRIBE_ERR_EID, 0x0000},
+     {SHM_BRIDGE_UPLINK_ERR_EID, CFE_EVS_FIRST_16_STOP}, {SHM_BRIDGE_INGEST_ERR_EID, CFE_EVS_FIRST_16_STOP},
+     {SHM_BRIDGE_DOWNLINK_ERR_EID, CFE_EVS_FIRST_16_STOP}, {SHM_BRIDGE_PIPE_ERR_EID, 0x0000}};
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* SHM_BRIDGE_AppMain() -- Application entry point and main process loop      */
+/* Purpose: This is the main task event loop for the SHM Bridge.  It pends    */
+/*            on the telemetry pipe and copies every message it receives      */
+/*            to the downlink ring, for the client at the other end.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
+void SHM_BRIDGE_AppMain(void)
+{
+    int32            status;
+    uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
+    CFE_SB_Buffer_t *SBBufPtrs[SHM_BRIDGE_DOWNLINK_BATCH_SIZE];
+    size_t           NumMsgs;
+    size_t           i;
+
+    CFE_ES_PerfLogEntry(SHM_BRIDGE_MAIN_TASK_PERF_ID);
+
+    if (SHM_BRIDGE_TaskInit() != CFE_SUCCESS)
+    {
+        RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    /*
+    ** SHM Bridge Runloop
+    */
+    while (CFE_ES_RunLoop(&RunStatus) == true)
+    {
+        CFE_ES_PerfLogExit(SHM_BRIDGE_MAIN_TASK_PERF_ID);
+
+        status = CFE_SB_ReceiveBufferBatch(SBBufPtrs, SHM_BRIDGE_DOWNLINK_BATCH_SIZE, &NumMsgs,
+                                           SHM_BRIDGE_Global.TlmPipe, SHM_BRIDGE_WAIT_TIMEOUT);
+
+        CFE_ES_PerfLogEntry(SHM_BRIDGE_MAIN_TASK_PERF_ID);
+
+        if (status == CFE_SUCCESS)
+        {
+            for (i = 0; i < NumMsgs; ++i)
+            {
+                SHM_BRIDGE_ForwardDownlink(SBBufPtrs[i]);
+            }
+
+            CFE_SB_ReleaseBufferBatch(SBBufPtrs, NumMsgs, SHM_BRIDGE_Global.TlmPipe);
+        }
+        else if (status != CFE_SB_TIME_OUT && status != CFE_SB_NO_MESSAGE)
+        {
+            CFE_EVS_SendEvent(SHM_BRIDGE_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SHM_BRIDGE: SB pipe read error (0x%08x), app will exit", (unsigned int)status);
+            RunStatus = CFE_ES_RunStatus_APP_ERROR;
+        }
+    }
+
+    CFE_ES_PerfLogExit(SHM_BRIDGE_MAIN_TASK_PERF_ID);
+
+    SHM_BRIDGE_Cleanup();
+
+    CFE_ES_ExitApp(RunStatus);
+
+} /* End of SHM_BRIDGE_AppMain() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
+/*                                                                            */
+/* SHM_BRIDGE_TaskInit() -- SHM Bridge initialization                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 SHM_BRIDGE_TaskInit(void)
+{
+    int32                        status;
+    uint32                       ProcessorId;
+    EdsLib_DataTypeDB_TypeInfo_t CmdHdrInfo;
+    EdsLib_Id_t                  EdsId;
+
+    const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
+
+    memset(&SHM_BRIDGE_Global, 0, sizeof(SHM_BRIDGE_Global));
+
+    CFE_EVS_Register(SHM_BRIDGE_EventFilters, sizeof(SHM_BRIDGE_EventFilters) / sizeof(CFE_EVS_BinFilter_t),
+                     CFE_EVS_EventFilter_BINARY);
+
+    /* Uplink frames shorter than a command header are rejected before decoding */
+    EdsId  = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_CommandHeader_DATADICTIONARY);
+    status = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &CmdHdrInfo);
+    if (status != EDSLIB_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: EdsLib_DataTypeDB_GetTypeInfo() failed, status=%d", (int)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+    SHM_BRIDGE_Global.CmdHdrBits = CmdHdrInfo.Size.Bits;
+
+    status = CFE_SB_CreatePipe(&SHM_BRIDGE_Global.TlmPipe, SHM_BRIDGE_PIPE_DEPTH, "SHM_BRIDGE_TLM_PIPE");
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: CFE_SB_CreatePipe() failed, status=0x%08x", (unsigned int)status);
+        return status;
+    }
+
+    /* Events are always forwarded, anything else is up to the client */
+    CFE_SB_SubscribeEx(CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), SHM_BRIDGE_Global.TlmPipe,
+                       CFE_SB_DEFAULT_QOS, SHM_BRIDGE_EVENT_MSG_LIMIT);
+
+    /*
+     * The rings are named after the processor ID, in the same way CI_LAB and
+     * TO_LAB offset their UDP ports, so several targets can share a host
+     */
+    ProcessorId = CFE_PSP_GetProcessorId();
+    ShmBridge_RingGetName(SHM_BRIDGE_Global.UplinkName, ProcessorId, SHM_BRIDGE_RING_UPLINK_NAME);
+    ShmBridge_RingGetName(SHM_BRIDGE_Global.DownlinkName, ProcessorId, SHM_BRIDGE_RING_DOWNLINK_NAME);
+
+    status = ShmBridge_RingCreate(&SHM_BRIDGE_Global.Downlink, SHM_BRIDGE_Global.DownlinkName,
+                                  SHM_BRIDGE_DOWNLINK_RING_SIZE, SHM_BRIDGE_FRAME_FORMAT);
+    if (status == SHM_BRIDGE_RING_SUCCESS)
+    {
+        status = ShmBridge_RingCreate(&SHM_BRIDGE_Global.Uplink, SHM_BRIDGE_Global.UplinkName,
+                                      SHM_BRIDGE_UPLINK_RING_SIZE, SHM_BRIDGE_FRAME_FORMAT);
+    }
+    if (status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_RING_CREATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: cannot create shared memory rings, status=%d, errno=%d", (int)status,
+                          (int)errno);
+        SHM_BRIDGE_Cleanup();
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = OS_BinSemCreate(&SHM_BRIDGE_Global.UplinkDoneSem, "SHM_BRIDGE_UPL", 0, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: OS_BinSemCreate() failed, status=%d", (int)status);
+        SHM_BRIDGE_Cleanup();
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    SHM_BRIDGE_Global.UplinkRunning = true;
+    status = CFE_ES_CreateChildTask(&SHM_BRIDGE_Global.UplinkTaskId, "SHM_BRIDGE_UPLINK", SHM_BRIDGE_UplinkTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE, SHM_BRIDGE_UPLINK_TASK_STACK_SIZE,
+                                    SHM_BRIDGE_UPLINK_TASK_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: cannot create uplink task, status=0x%08x", (unsigned int)status);
+        SHM_BRIDGE_Global.UplinkRunning = false;
+        SHM_BRIDGE_Cleanup();
+        return status;
+    }
+
+    CFE_EVS_SendEvent(SHM_BRIDGE_STARTUP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SHM Bridge Initialized on %s and %s.%s", SHM_BRIDGE_Global.UplinkName,
+                      SHM_BRIDGE_Global.DownlinkName, SHM_BRIDGE_VERSION_STRING);
+
+    return CFE_SUCCESS;
+
+} /* End of SHM_BRIDGE_TaskInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_Cleanup() -- stop the uplink task and remove the rings          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SHM_BRIDGE_Cleanup(void)
+{
+    /*
+     * The uplink task may be asleep inside the ring, so it has to be told to
+     * stop and seen to have stopped before the ring can be unmapped.
+     */
+    if (SHM_BRIDGE_Global.UplinkRunning)
+    {
+        SHM_BRIDGE_Global.UplinkRunning = false;
+        ShmBridge_RingWake(&SHM_BRIDGE_Global.Uplink);
+
+        if (OS_BinSemTimedWait(SHM_BRIDGE_Global.UplinkDoneSem, 2 * SHM_BRIDGE_WAIT_TIMEOUT) != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("SHM_BRIDGE: uplink task did not stop, leaving rings mapped\n");
+            return;
+        }
+    }
+
+    if (OS_ObjectIdDefined(SHM_BRIDGE_Global.UplinkDoneSem))
+    {
+        OS_BinSemDelete(SHM_BRIDGE_Global.UplinkDoneSem);
+        SHM_BRIDGE_Global.UplinkDoneSem = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    ShmBridge_RingDestroy(&SHM_BRIDGE_Global.Uplink, SHM_BRIDGE_Global.UplinkName);
+    ShmBridge_RingDestroy(&SHM_BRIDGE_Global.Downlink, SHM_BRIDGE_Global.DownlinkName);
+
+} /* End of SHM_BRIDGE_Cleanup() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_ForwardDownlink() -- copy one message to the downlink ring      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SHM_BRIDGE_ForwardDownlink(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    void * DataPtr;
+    size_t DataSize;
+    int32  status;
+
+    if (SHM_BRIDGE_FRAME_FORMAT == SHM_BRIDGE_FORMAT_PACKED)
+    {
+        DataSize = sizeof(CFE_HDR_TelemetryHeader_PackedBuffer_t);
+    }
+    else
+    {
+        CFE_MSG_GetSize(&SBBufPtr->Msg, &DataSize);
+    }
+
+    /*
+     * Never wait for the client - when the ring is full the message is
+     * dropped, and the ring keeps the count for the client to see
+     */
+    if (ShmBridge_RingReserve(&SHM_BRIDGE_Global.Downlink, DataSize, &DataPtr) != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return;
+    }
+
+    /* Either way the message goes straight into the ring, without an intermediate copy */
+    if (SHM_BRIDGE_FRAME_FORMAT == SHM_BRIDGE_FORMAT_PACKED)
+    {
+        status = SHM_BRIDGE_PackDownlinkMessage(DataPtr, &SBBufPtr->Msg, &DataSize);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SHM_BRIDGE_DOWNLINK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SHM_BRIDGE: error packing output: %d", (int)status);
+            return;
+        }
+    }
+    else
+    {
+        memcpy(DataPtr, SBBufPtr, DataSize);
+    }
+
+    ShmBridge_RingCommit(&SHM_BRIDGE_Global.Downlink, SHM_BRIDGE_FRAME_MESSAGE, DataSize);
+
+} /* End of SHM_BRIDGE_ForwardDownlink() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_PackDownlinkMessage() -- encode a message to EDS wire format    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 SHM_BRIDGE_PackDownlinkMessage(void *DestBuffer, const CFE_MSG_Message_t *SourceBuffer, size_t *DestBufferSize)
+{
+    EdsLib_Id_t                           EdsId;
+    EdsLib_DataTypeDB_TypeInfo_t          TypeInfo;
+    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
+    CFE_SB_Publisher_Component_t          PublisherParams;
+    uint16                                TopicId;
+    int32                                 Status;
+    size_t                                SourceBufferSize;
+
+    const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
+
+    CFE_MSG_GetSize(SourceBuffer, &SourceBufferSize);
+
+    CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &SourceBuffer->BaseMsg);
+    CFE_MissionLib_UnmapPublisherComponent(&PublisherParams, &PubSubParams);
+    TopicId = PublisherParams.Telemetry.TopicId;
+
+    Status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telemetry_Interface_ID, TopicId, 1, 1,
+                                            &EdsId);
+    if (Status != CFE_MISSIONLIB_SUCCESS)
+    {
+        return CFE_STATUS_UNKNOWN_MSG_ID;
+    }
+
+    Status = EdsLib_DataTypeDB_PackCompleteObject(EDS_DB, &EdsId, DestBuffer, SourceBuffer, 8 * *DestBufferSize,
+                                                  SourceBufferSize);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return CFE_SB_INTERNAL_ERR;
+    }
+
+    Status = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &TypeInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return CFE_SB_INTERNAL_ERR;
+    }
+
+    *DestBufferSize = (TypeInfo.Size.Bits + 7) / 8;
+    return CFE_SUCCESS;
+
+} /* End of SHM_BRIDGE_PackDownlinkMessage() */
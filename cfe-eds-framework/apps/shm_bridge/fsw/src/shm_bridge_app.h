@@ -0,0 +1,108 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_app.h
+**
+** Purpose:
+**   This file is main hdr file for the shared memory bridge application.
+**
+*******************************************************************************/
+
+#ifndef _shm_bridge_app_h_
+#define _shm_bridge_app_h_
+
+/*
+** Required header files...
+*/
+#include "common_types.h"
+#include "cfe.h"
+
+#include "osapi.h"
+
+#include "shm_bridge_ring.h"
+#include "shm_bridge_platform_cfg.h"
+
+#include <string.h>
+#include <errno.h>
+
+/****************************************************************************/
+
+/*
+ * Depth of the pipe for messages forwarded to the downlink ring
+ */
+#define SHM_BRIDGE_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
+
+/*
+ * Maximum number of messages read from the pipe per SB call
+ */
+#define SHM_BRIDGE_DOWNLINK_BATCH_SIZE 32
+
+/*
+ * Maximum number of uplink frames handled per wakeup of the uplink task
+ */
+#define SHM_BRIDGE_MAX_INGEST 32
+
+/*
+ * Longest time (in milliseconds) either task blocks before checking
+ * whether it should still be running
+ */
+#define SHM_BRIDGE_WAIT_TIMEOUT 500
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+typedef struct
+{
+    CFE_SB_PipeId_t TlmPipe;
+    CFE_ES_TaskId_t UplinkTaskId;
+    osal_id_t       UplinkDoneSem;
+    volatile bool   UplinkRunning;
+    uint32          CmdHdrBits;
+
+    ShmBridge_Ring_t Uplink;
+    ShmBridge_Ring_t Downlink;
+    char             UplinkName[SHM_BRIDGE_RING_NAME_MAXLEN];
+    char             DownlinkName[SHM_BRIDGE_RING_NAME_MAXLEN];
+
+} SHM_BRIDGE_GlobalData_t;
+
+extern SHM_BRIDGE_GlobalData_t SHM_BRIDGE_Global;
+
+/****************************************************************************/
+/*
+** Local function prototypes...
+**
+** Note: Except for the entry point (SHM_BRIDGE_AppMain), these
+**       functions are not called from any other source module.
+*/
+void  SHM_BRIDGE_AppMain(void);
+int32 SHM_BRIDGE_TaskInit(void);
+void  SHM_BRIDGE_Cleanup(void);
+void  SHM_BRIDGE_ForwardDownlink(const CFE_SB_Buffer_t *SBBufPtr);
+int32 SHM_BRIDGE_PackDownlinkMessage(void *DestBuffer, const CFE_MSG_Message_t *SourceBuffer, size_t *DestBufferSize);
+
+/* Uplink child task, in shm_bridge_uplink.c */
+void SHM_BRIDGE_UplinkTask(void);
+void SHM_BRIDGE_ReadUplink(void);
+void SHM_BRIDGE_ProcessSubscription(uint16 Type, const void *Data, uint32 Length);
+void SHM_BRIDGE_IngestMessage(const void *Data, uint32 Length);
+bool SHM_BRIDGE_UnpackUplinkMessage(CFE_SB_Buffer_t *IngestBufPtr, const void *Data, uint32 BitSize);
+
+#endif /* _shm_bridge_app_h_ */
@@ -0,0 +1,48 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_events.h
+**
+** Purpose:
+**  Define SHM Bridge Events IDs
+**
+** Notes:
+**
+*************************************************************************/
+#ifndef _shm_bridge_events_h_
+#define _shm_bridge_events_h_
+
+#define SHM_BRIDGE_RESERVED_EID        0
+#define SHM_BRIDGE_STARTUP_INF_EID     1
+#define SHM_BRIDGE_RING_CREATE_ERR_EID 2
+#define SHM_BRIDGE_INIT_ERR_EID        3
+#define SHM_BRIDGE_SUBSCRIBE_INF_EID   4
+#define SHM_BRIDGE_UNSUBSCRIBE_INF_EID 5
+#define SHM_BRIDGE_SUBSCRIBE_ERR_EID   6
+#define SHM_BRIDGE_UPLINK_ERR_EID      7
+#define SHM_BRIDGE_INGEST_ERR_EID      8
+#define SHM_BRIDGE_DOWNLINK_ERR_EID    9
+#define SHM_BRIDGE_PIPE_ERR_EID        10
+
+#endif /* _shm_bridge_events_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
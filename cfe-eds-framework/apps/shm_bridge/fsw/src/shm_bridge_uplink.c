@@ -0,0 +1,300 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_uplink.c
+**
+** Purpose:
+**   This file contains the uplink child task of the shared memory bridge,
+**   which puts messages from the uplink ring on the software bus and
+**   applies the subscription requests made by the client.
+**
+*******************************************************************************/
+
+/*
+**   Include Files:
+*/
+
+#include "shm_bridge_app.h"
+#include "shm_bridge_perfids.h"
+#include "shm_bridge_events.h"
+
+#include "cfe_config.h"
+
+#include "edslib_datatypedb.h"
+#include "cfe_hdr_eds_typedefs.h"
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_UplinkTask() -- child task entry point                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SHM_BRIDGE_UplinkTask(void)
+{
+    while (SHM_BRIDGE_Global.UplinkRunning)
+    {
+        /* Sleeps in the kernel until the client commits a frame, no polling */
+        if (ShmBridge_RingWait(&SHM_BRIDGE_Global.Uplink, SHM_BRIDGE_WAIT_TIMEOUT) == SHM_BRIDGE_RING_SUCCESS)
+        {
+            CFE_ES_PerfLogEntry(SHM_BRIDGE_UPLINK_TASK_PERF_ID);
+            SHM_BRIDGE_ReadUplink();
+            CFE_ES_PerfLogExit(SHM_BRIDGE_UPLINK_TASK_PERF_ID);
+        }
+    }
+
+    /* Tell the main task the ring is no longer in use */
+    OS_BinSemGive(SHM_BRIDGE_Global.UplinkDoneSem);
+
+    CFE_ES_ExitChildTask();
+
+} /* End of SHM_BRIDGE_UplinkTask() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_ReadUplink() -- handle the frames waiting in the uplink ring    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SHM_BRIDGE_ReadUplink(void)
+{
+    uint32      i;
+    int         status;
+    uint16_t    Type;
+    const void *Data;
+    uint32_t    Length;
+
+    for (i = 0; i < SHM_BRIDGE_MAX_INGEST; ++i)
+    {
+        status = ShmBridge_RingPeek(&SHM_BRIDGE_Global.Uplink, &Type, &Data, &Length);
+        if (status == SHM_BRIDGE_RING_EMPTY)
+        {
+            break;
+        }
+
+        if (status != SHM_BRIDGE_RING_SUCCESS)
+        {
+            /* The client wrote something inconsistent, there is no way to find the next frame */
+            CFE_EVS_SendEvent(SHM_BRIDGE_UPLINK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SHM_BRIDGE: uplink ring is corrupt, discarding its contents");
+            ShmBridge_RingFlush(&SHM_BRIDGE_Global.Uplink);
+            break;
+        }
+
+        switch (Type)
+        {
+            case SHM_BRIDGE_FRAME_MESSAGE:
+                SHM_BRIDGE_IngestMessage(Data, Length);
+                break;
+
+            case SHM_BRIDGE_FRAME_SUBSCRIBE:
+            case SHM_BRIDGE_FRAME_UNSUBSCRIBE:
+                SHM_BRIDGE_ProcessSubscription(Type, Data, Length);
+                break;
+
+            default:
+                CFE_EVS_SendEvent(SHM_BRIDGE_UPLINK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SHM_BRIDGE: unknown uplink frame type %u", (unsigned int)Type);
+                break;
+        }
+
+        ShmBridge_RingRelease(&SHM_BRIDGE_Global.Uplink);
+    }
+
+} /* End of SHM_BRIDGE_ReadUplink() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_ProcessSubscription() -- add or remove a downlink MsgId         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SHM_BRIDGE_ProcessSubscription(uint16 Type, const void *Data, uint32 Length)
+{
+    ShmBridge_SubscribeFrame_t Sub;
+    CFE_SB_MsgId_t             MsgId;
+    int32                      status;
+
+    if (Length != sizeof(Sub))
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: bad subscription frame length %u", (unsigned int)Length);
+        return;
+    }
+
+    /* Take a private copy, the client can still write to the ring */
+    memcpy(&Sub, Data, sizeof(Sub));
+    MsgId = CFE_SB_ValueToMsgId(Sub.MsgId);
+
+    if (Type == SHM_BRIDGE_FRAME_SUBSCRIBE)
+    {
+        if (Sub.BufLimit == 0)
+        {
+            status = CFE_SB_Subscribe(MsgId, SHM_BRIDGE_Global.TlmPipe);
+        }
+        else
+        {
+            status = CFE_SB_SubscribeEx(MsgId, SHM_BRIDGE_Global.TlmPipe, CFE_SB_DEFAULT_QOS, Sub.BufLimit);
+        }
+
+        if (status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SHM_BRIDGE_SUBSCRIBE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "SHM_BRIDGE: subscribed to MsgId 0x%08lx", (unsigned long)Sub.MsgId);
+        }
+    }
+    else
+    {
+        status = CFE_SB_Unsubscribe(MsgId, SHM_BRIDGE_Global.TlmPipe);
+        if (status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SHM_BRIDGE_UNSUBSCRIBE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "SHM_BRIDGE: unsubscribed from MsgId 0x%08lx", (unsigned long)Sub.MsgId);
+        }
+    }
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: (un)subscribe of MsgId 0x%08lx failed, status=0x%08x",
+                          (unsigned long)Sub.MsgId, (unsigned int)status);
+    }
+
+} /* End of SHM_BRIDGE_ProcessSubscription() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_IngestMessage() -- put one uplink message on the software bus   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SHM_BRIDGE_IngestMessage(const void *Data, uint32 Length)
+{
+    CFE_SB_Buffer_t *IngestBufPtr;
+    CFE_MSG_Size_t   MsgSize;
+    bool             Valid;
+    int32            status;
+
+    if (SHM_BRIDGE_FRAME_FORMAT == SHM_BRIDGE_FORMAT_PACKED)
+    {
+        if (8 * Length < SHM_BRIDGE_Global.CmdHdrBits || Length > sizeof(CFE_HDR_Message_PackedBuffer_t))
+        {
+            CFE_EVS_SendEvent(SHM_BRIDGE_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SHM_BRIDGE: uplink message dropped, bad length=%u", (unsigned int)Length);
+            return;
+        }
+
+        IngestBufPtr = CFE_SB_AllocateMessageBuffer(sizeof(CFE_HDR_CommandHeader_Buffer_t));
+    }
+    else
+    {
+        if (Length < sizeof(CFE_MSG_CommandHeader_t) || Length > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        {
+            CFE_EVS_SendEvent(SHM_BRIDGE_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SHM_BRIDGE: uplink message dropped, bad length=%u", (unsigned int)Length);
+            return;
+        }
+
+        IngestBufPtr = CFE_SB_AllocateMessageBuffer(Length);
+    }
+
+    if (IngestBufPtr == NULL)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: L%d, buffer allocation failed", __LINE__);
+        return;
+    }
+
+    if (SHM_BRIDGE_FRAME_FORMAT == SHM_BRIDGE_FORMAT_PACKED)
+    {
+        Valid = SHM_BRIDGE_UnpackUplinkMessage(IngestBufPtr, Data, 8 * Length);
+    }
+    else
+    {
+        /* Copy first, then check the copy - the ring contents could still change */
+        memcpy(IngestBufPtr, Data, Length);
+        Valid = (CFE_MSG_GetSize(&IngestBufPtr->Msg, &MsgSize) == CFE_SUCCESS && MsgSize == Length);
+    }
+
+    if (!Valid)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: uplink message of %u bytes could not be decoded", (unsigned int)Length);
+        CFE_SB_ReleaseMessageBuffer(IngestBufPtr);
+        return;
+    }
+
+    status = CFE_SB_TransmitBuffer(IngestBufPtr, false);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SHM_BRIDGE_INGEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SHM_BRIDGE: L%d, CFE_SB_TransmitBuffer() failed, status=%d", __LINE__, (int)status);
+        CFE_SB_ReleaseMessageBuffer(IngestBufPtr);
+    }
+
+} /* End of SHM_BRIDGE_IngestMessage() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SHM_BRIDGE_UnpackUplinkMessage() -- decode a command from EDS wire format  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool SHM_BRIDGE_UnpackUplinkMessage(CFE_SB_Buffer_t *IngestBufPtr, const void *Data, uint32 BitSize)
+{
+    int32                                 status;
+    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
+    CFE_SB_Listener_Component_t           ListenerParams;
+    EdsLib_Id_t                           EdsId;
+
+    const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
+
+    /* Decode the header first, it determines the type of the rest of the payload */
+    EdsId  = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_CommandHeader_DATADICTIONARY);
+    status = EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, IngestBufPtr, Data,
+                                                   sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize, 0);
+    if (status != EDSLIB_SUCCESS)
+    {
+        return false;
+    }
+
+    CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &IngestBufPtr->Msg.BaseMsg);
+    CFE_MissionLib_UnmapListenerComponent(&ListenerParams, &PubSubParams);
+
+    status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telecommand_Interface_ID,
+                                            ListenerParams.Telecommand.TopicId, 1, 1, &EdsId);
+    if (status != CFE_MISSIONLIB_SUCCESS)
+    {
+        return false;
+    }
+
+    status = EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, IngestBufPtr, Data,
+                                                   sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize,
+                                                   sizeof(CFE_HDR_CommandHeader_t));
+    if (status != EDSLIB_SUCCESS)
+    {
+        return false;
+    }
+
+    /* Verify that the checksum and basic fields are correct, and recompute the length entry */
+    status = EdsLib_DataTypeDB_VerifyUnpackedObject(EDS_DB, EdsId, IngestBufPtr, Data,
+                                                    EDSLIB_DATATYPEDB_RECOMPUTE_LENGTH);
+
+    return (status == EDSLIB_SUCCESS);
+
+} /* End of SHM_BRIDGE_UnpackUplinkMessage() */
@@ -0,0 +1,135 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_client.c
+**
+** Purpose:
+**   Client side of the SHM bridge.
+**
+*******************************************************************************/
+
+#include <string.h>
+
+#include "shm_bridge_client.h"
+
+int ShmBridge_ClientConnect(ShmBridge_Client_t *Client, uint32_t InstanceNum)
+{
+    char Name[SHM_BRIDGE_RING_NAME_MAXLEN];
+    int  Status;
+
+    memset(Client, 0, sizeof(*Client));
+
+    ShmBridge_RingGetName(Name, InstanceNum, SHM_BRIDGE_RING_UPLINK_NAME);
+    Status = ShmBridge_RingAttach(&Client->Uplink, Name);
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return Status;
+    }
+
+    ShmBridge_RingGetName(Name, InstanceNum, SHM_BRIDGE_RING_DOWNLINK_NAME);
+    Status = ShmBridge_RingAttach(&Client->Downlink, Name);
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        ShmBridge_RingDetach(&Client->Uplink);
+        return Status;
+    }
+
+    /* Only messages that arrive from now on are of interest */
+    ShmBridge_RingFlush(&Client->Downlink);
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+void ShmBridge_ClientDisconnect(ShmBridge_Client_t *Client)
+{
+    ShmBridge_RingDetach(&Client->Uplink);
+    ShmBridge_RingDetach(&Client->Downlink);
+}
+
+uint32_t ShmBridge_ClientGetFormat(const ShmBridge_Client_t *Client)
+{
+    return Client->Downlink.Header->Format;
+}
+
+int ShmBridge_ClientSend(ShmBridge_Client_t *Client, const void *Msg, uint32_t Length)
+{
+    return ShmBridge_RingPut(&Client->Uplink, SHM_BRIDGE_FRAME_MESSAGE, Msg, Length);
+}
+
+int ShmBridge_ClientSubscribe(ShmBridge_Client_t *Client, uint32_t MsgId, uint16_t BufLimit)
+{
+    ShmBridge_SubscribeFrame_t Sub;
+
+    memset(&Sub, 0, sizeof(Sub));
+    Sub.MsgId    = MsgId;
+    Sub.BufLimit = BufLimit;
+
+    return ShmBridge_RingPut(&Client->Uplink, SHM_BRIDGE_FRAME_SUBSCRIBE, &Sub, sizeof(Sub));
+}
+
+int ShmBridge_ClientUnsubscribe(ShmBridge_Client_t *Client, uint32_t MsgId)
+{
+    ShmBridge_SubscribeFrame_t Sub;
+
+    memset(&Sub, 0, sizeof(Sub));
+    Sub.MsgId = MsgId;
+
+    return ShmBridge_RingPut(&Client->Uplink, SHM_BRIDGE_FRAME_UNSUBSCRIBE, &Sub, sizeof(Sub));
+}
+
+int ShmBridge_ClientReceive(ShmBridge_Client_t *Client, void *Buffer, uint32_t BufferSize, uint32_t *Length,
+                            int32_t TimeoutMs)
+{
+    const void *Data;
+    uint16_t    Type;
+    int         Status;
+
+    Status = ShmBridge_RingPeek(&Client->Downlink, &Type, &Data, Length);
+    if (Status == SHM_BRIDGE_RING_EMPTY && TimeoutMs != 0)
+    {
+        ShmBridge_RingWait(&Client->Downlink, TimeoutMs);
+        Status = ShmBridge_RingPeek(&Client->Downlink, &Type, &Data, Length);
+    }
+
+    if (Status == SHM_BRIDGE_RING_INVALID)
+    {
+        /* The producer is in the other process and cannot be fixed from here, resynchronize */
+        ShmBridge_RingFlush(&Client->Downlink);
+        *Length = 0;
+    }
+
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return Status;
+    }
+
+    if (Type != SHM_BRIDGE_FRAME_MESSAGE || *Length > BufferSize)
+    {
+        Status = SHM_BRIDGE_RING_INVALID;
+    }
+    else
+    {
+        memcpy(Buffer, Data, *Length);
+    }
+
+    ShmBridge_RingRelease(&Client->Downlink);
+
+    return Status;
+}
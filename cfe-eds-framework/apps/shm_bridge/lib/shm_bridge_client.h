@@ -0,0 +1,80 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_client.h
+**
+** Purpose:
+**   Client side of the SHM bridge, for ground tools and test harnesses
+**   running on the same host as the cFS target.
+**
+** Notes:
+**   The SHM_BRIDGE application creates both rings when it starts, so the
+**   client only ever attaches.  The client is the producer of the uplink
+**   ring and the consumer of the downlink ring, and like the rings themselves
+**   a connection must only be used from one thread at a time.
+**
+**   All functions return one of the SHM_BRIDGE_RING_ status codes.
+**
+*******************************************************************************/
+
+#ifndef _shm_bridge_client_h_
+#define _shm_bridge_client_h_
+
+#include "shm_bridge_ring.h"
+
+typedef struct
+{
+    ShmBridge_Ring_t Uplink;
+    ShmBridge_Ring_t Downlink;
+} ShmBridge_Client_t;
+
+/*
+ * Attach to the rings of the bridge running on the given cFS processor ID
+ */
+int  ShmBridge_ClientConnect(ShmBridge_Client_t *Client, uint32_t InstanceNum);
+void ShmBridge_ClientDisconnect(ShmBridge_Client_t *Client);
+
+/*
+ * Frame format used in both directions, one of the SHM_BRIDGE_FORMAT_ values
+ */
+uint32_t ShmBridge_ClientGetFormat(const ShmBridge_Client_t *Client);
+
+/*
+ * Queue a message for the bridge to put on the software bus.  Returns
+ * SHM_BRIDGE_RING_FULL if the bridge has fallen behind; the caller may retry.
+ */
+int ShmBridge_ClientSend(ShmBridge_Client_t *Client, const void *Msg, uint32_t Length);
+
+/*
+ * Ask the bridge to start or stop forwarding a MsgId to the downlink ring.
+ * These are queued in order with the messages sent via ShmBridge_ClientSend.
+ */
+int ShmBridge_ClientSubscribe(ShmBridge_Client_t *Client, uint32_t MsgId, uint16_t BufLimit);
+int ShmBridge_ClientUnsubscribe(ShmBridge_Client_t *Client, uint32_t MsgId);
+
+/*
+ * Wait (milliseconds, negative for forever) for a downlink message and copy
+ * it out.  Messages longer than BufferSize are dropped and reported as
+ * SHM_BRIDGE_RING_INVALID, with the full length still returned in Length.
+ */
+int ShmBridge_ClientReceive(ShmBridge_Client_t *Client, void *Buffer, uint32_t BufferSize, uint32_t *Length,
+                            int32_t TimeoutMs);
+
+#endif /* _shm_bridge_client_h_ */
@@ -0,0 +1,423 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_ring.c
+**
+** Purpose:
+**   Shared memory SPSC frame ring used by both ends of the SHM bridge.
+**
+** Notes:
+**   Ordering follows the usual SPSC rules: the producer publishes Head with
+**   release semantics after the frame is written, the consumer publishes Tail
+**   with release semantics after it is done reading.  The sleep/wakeup
+**   handshake on Waiting and Head is sequentially consistent on both sides,
+**   so either the consumer sees the new Head before sleeping or the producer
+**   sees Waiting and issues the wakeup.  FUTEX_WAIT re-checks Head in the
+**   kernel, so a wakeup between the two is not lost either.
+**
+*******************************************************************************/
+
+/* needed for syscall() with -std=c99 */
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "shm_bridge_ring.h"
+
+#define SHM_BRIDGE_RING_MIN_SIZE 0x100
+#define SHM_BRIDGE_RING_MAX_SIZE 0x40000000
+
+/*
+ * The futex is always the process-shared kind, as the two ends of the
+ * ring are in different processes by design
+ */
+static void ShmBridge_FutexWait(uint32_t *Addr, uint32_t Expected, int32_t TimeoutMs)
+{
+    struct timespec Timeout;
+
+    if (TimeoutMs < 0)
+    {
+        syscall(SYS_futex, Addr, FUTEX_WAIT, Expected, NULL, NULL, 0);
+    }
+    else
+    {
+        Timeout.tv_sec  = TimeoutMs / 1000;
+        Timeout.tv_nsec = (TimeoutMs % 1000) * 1000000;
+        syscall(SYS_futex, Addr, FUTEX_WAIT, Expected, &Timeout, NULL, 0);
+    }
+
+    /* EINTR, EAGAIN and ETIMEDOUT all just mean the caller should look again */
+}
+
+static void ShmBridge_FutexWake(uint32_t *Addr)
+{
+    syscall(SYS_futex, Addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static int ShmBridge_RingMap(ShmBridge_Ring_t *Ring, int fd, size_t MapSize)
+{
+    void *Addr;
+
+    Addr = mmap(NULL, MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (Addr == MAP_FAILED)
+    {
+        return SHM_BRIDGE_RING_ERROR;
+    }
+
+    memset(Ring, 0, sizeof(*Ring));
+    Ring->Header  = Addr;
+    Ring->Data    = (uint8_t *)Addr + sizeof(ShmBridge_RingHeader_t);
+    Ring->MapSize = MapSize;
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+void ShmBridge_RingGetName(char *Buffer, uint32_t InstanceNum, const char *Direction)
+{
+    snprintf(Buffer, SHM_BRIDGE_RING_NAME_MAXLEN, SHM_BRIDGE_RING_NAME_FORMAT, (unsigned int)InstanceNum, Direction);
+}
+
+int ShmBridge_RingCreate(ShmBridge_Ring_t *Ring, const char *Name, uint32_t DataSize, uint32_t Format)
+{
+    int    fd;
+    int    Status;
+    size_t MapSize;
+
+    if (DataSize < SHM_BRIDGE_RING_MIN_SIZE || DataSize > SHM_BRIDGE_RING_MAX_SIZE || (DataSize & (DataSize - 1)) != 0)
+    {
+        return SHM_BRIDGE_RING_INVALID;
+    }
+
+    /*
+     * Always start from a fresh object, so a client still mapping a ring left
+     * over from a previous run can never see it change size underneath it
+     */
+    shm_unlink(Name);
+
+    fd = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, 0660);
+    if (fd < 0)
+    {
+        return SHM_BRIDGE_RING_ERROR;
+    }
+
+    MapSize = sizeof(ShmBridge_RingHeader_t) + DataSize;
+    if (ftruncate(fd, MapSize) < 0)
+    {
+        Status = SHM_BRIDGE_RING_ERROR;
+    }
+    else
+    {
+        Status = ShmBridge_RingMap(Ring, fd, MapSize);
+    }
+
+    close(fd);
+
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        shm_unlink(Name);
+        return Status;
+    }
+
+    /* ftruncate() zero fills, so only the constant fields need setting; Magic goes last */
+    Ring->Mask             = DataSize - 1;
+    Ring->Header->Version  = SHM_BRIDGE_RING_VERSION;
+    Ring->Header->Format   = Format;
+    Ring->Header->DataSize = DataSize;
+    __atomic_store_n(&Ring->Header->Magic, SHM_BRIDGE_RING_MAGIC, __ATOMIC_RELEASE);
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+int ShmBridge_RingAttach(ShmBridge_Ring_t *Ring, const char *Name)
+{
+    int         fd;
+    int         Status;
+    uint32_t    DataSize;
+    struct stat st;
+
+    fd = shm_open(Name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        return SHM_BRIDGE_RING_ERROR;
+    }
+
+    if (fstat(fd, &st) < 0)
+    {
+        Status = SHM_BRIDGE_RING_ERROR;
+    }
+    else if ((size_t)st.st_size < sizeof(ShmBridge_RingHeader_t) + SHM_BRIDGE_RING_MIN_SIZE)
+    {
+        Status = SHM_BRIDGE_RING_INVALID;
+    }
+    else
+    {
+        Status = ShmBridge_RingMap(Ring, fd, st.st_size);
+    }
+
+    close(fd);
+
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return Status;
+    }
+
+    DataSize = Ring->Header->DataSize;
+    if (__atomic_load_n(&Ring->Header->Magic, __ATOMIC_ACQUIRE) != SHM_BRIDGE_RING_MAGIC ||
+        Ring->Header->Version != SHM_BRIDGE_RING_VERSION || DataSize < SHM_BRIDGE_RING_MIN_SIZE ||
+        (DataSize & (DataSize - 1)) != 0 || DataSize > Ring->MapSize - sizeof(ShmBridge_RingHeader_t))
+    {
+        ShmBridge_RingDetach(Ring);
+        return SHM_BRIDGE_RING_INVALID;
+    }
+
+    Ring->Mask = DataSize - 1;
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+void ShmBridge_RingDetach(ShmBridge_Ring_t *Ring)
+{
+    if (Ring->Header != NULL)
+    {
+        munmap(Ring->Header, Ring->MapSize);
+    }
+
+    memset(Ring, 0, sizeof(*Ring));
+}
+
+void ShmBridge_RingDestroy(ShmBridge_Ring_t *Ring, const char *Name)
+{
+    ShmBridge_RingDetach(Ring);
+    shm_unlink(Name);
+}
+
+int ShmBridge_RingReserve(ShmBridge_Ring_t *Ring, uint32_t MaxLength, void **DataPtr)
+{
+    ShmBridge_RingHeader_t * Hdr = Ring->Header;
+    ShmBridge_FrameHeader_t *Pad;
+    uint32_t                 DataSize = Ring->Mask + 1;
+    uint32_t                 Head;
+    uint32_t                 Tail;
+    uint32_t                 Offset;
+    uint32_t                 Contig;
+    uint32_t                 FrameSize;
+    uint32_t                 Needed;
+
+    /* Frames up to half the ring (header included) fit an empty ring at any offset */
+    if (MaxLength > SHM_BRIDGE_RING_MAX_LENGTH(DataSize))
+    {
+        return SHM_BRIDGE_RING_INVALID;
+    }
+
+    FrameSize = SHM_BRIDGE_FRAME_ALIGN(sizeof(ShmBridge_FrameHeader_t) + MaxLength);
+    Head      = __atomic_load_n(&Hdr->Head, __ATOMIC_RELAXED);
+    Tail      = __atomic_load_n(&Hdr->Tail, __ATOMIC_ACQUIRE);
+    Offset    = Head & Ring->Mask;
+    Contig    = DataSize - Offset;
+
+    Needed = FrameSize;
+    if (Contig < FrameSize)
+    {
+        Needed += Contig;
+    }
+
+    if (DataSize - (Head - Tail) < Needed)
+    {
+        __atomic_store_n(&Hdr->Dropped, Hdr->Dropped + 1, __ATOMIC_RELAXED);
+        return SHM_BRIDGE_RING_FULL;
+    }
+
+    if (Contig < FrameSize)
+    {
+        /* Offsets are always 8 byte aligned so there is room for at least the pad header */
+        Pad         = (ShmBridge_FrameHeader_t *)(Ring->Data + Offset);
+        Pad->Length = Contig - sizeof(ShmBridge_FrameHeader_t);
+        Pad->Type   = SHM_BRIDGE_FRAME_PAD;
+        Pad->Spare  = 0;
+        Head += Contig;
+        Offset = 0;
+    }
+
+    Ring->PendingHead = Head;
+    Ring->PendingSize = FrameSize;
+    *DataPtr          = Ring->Data + Offset + sizeof(ShmBridge_FrameHeader_t);
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+int ShmBridge_RingCommit(ShmBridge_Ring_t *Ring, uint16_t Type, uint32_t Length)
+{
+    ShmBridge_RingHeader_t * Hdr = Ring->Header;
+    ShmBridge_FrameHeader_t *Frame;
+    uint32_t                 FrameSize;
+
+    FrameSize = SHM_BRIDGE_FRAME_ALIGN(sizeof(ShmBridge_FrameHeader_t) + Length);
+    if (Ring->PendingSize == 0 || FrameSize > Ring->PendingSize)
+    {
+        return SHM_BRIDGE_RING_INVALID;
+    }
+
+    Frame         = (ShmBridge_FrameHeader_t *)(Ring->Data + (Ring->PendingHead & Ring->Mask));
+    Frame->Length = Length;
+    Frame->Type   = Type;
+    Frame->Spare  = 0;
+
+    Ring->PendingSize = 0;
+    __atomic_store_n(&Hdr->Head, Ring->PendingHead + FrameSize, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&Hdr->Waiting, __ATOMIC_SEQ_CST) != 0)
+    {
+        ShmBridge_FutexWake(&Hdr->Head);
+    }
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+int ShmBridge_RingPut(ShmBridge_Ring_t *Ring, uint16_t Type, const void *Data, uint32_t Length)
+{
+    void *DataPtr;
+    int   Status;
+
+    Status = ShmBridge_RingReserve(Ring, Length, &DataPtr);
+    if (Status == SHM_BRIDGE_RING_SUCCESS)
+    {
+        memcpy(DataPtr, Data, Length);
+        Status = ShmBridge_RingCommit(Ring, Type, Length);
+    }
+
+    return Status;
+}
+
+int ShmBridge_RingPeek(ShmBridge_Ring_t *Ring, uint16_t *Type, const void **DataPtr, uint32_t *Length)
+{
+    ShmBridge_RingHeader_t * Hdr = Ring->Header;
+    ShmBridge_FrameHeader_t *Frame;
+    uint32_t                 DataSize = Ring->Mask + 1;
+    uint32_t                 Head;
+    uint32_t                 Tail;
+    uint32_t                 Avail;
+    uint32_t                 Contig;
+    uint32_t                 FrameLength;
+    uint16_t                 FrameType;
+    uint32_t                 FrameSize;
+
+    Tail = __atomic_load_n(&Hdr->Tail, __ATOMIC_RELAXED);
+    while (1)
+    {
+        Head = __atomic_load_n(&Hdr->Head, __ATOMIC_ACQUIRE);
+        if (Head == Tail)
+        {
+            return SHM_BRIDGE_RING_EMPTY;
+        }
+
+        Avail       = Head - Tail;
+        Contig      = DataSize - (Tail & Ring->Mask);
+        Frame       = (ShmBridge_FrameHeader_t *)(Ring->Data + (Tail & Ring->Mask));
+        FrameLength = Frame->Length;
+        FrameType   = Frame->Type;
+
+        /* Never trust sizes coming from the other process beyond what the ring can hold */
+        if (Avail > DataSize || FrameLength > Contig - sizeof(ShmBridge_FrameHeader_t))
+        {
+            return SHM_BRIDGE_RING_INVALID;
+        }
+
+        FrameSize = SHM_BRIDGE_FRAME_ALIGN(sizeof(ShmBridge_FrameHeader_t) + FrameLength);
+        if (FrameSize > Avail)
+        {
+            return SHM_BRIDGE_RING_INVALID;
+        }
+
+        if (FrameType != SHM_BRIDGE_FRAME_PAD)
+        {
+            break;
+        }
+
+        Tail += FrameSize;
+        __atomic_store_n(&Hdr->Tail, Tail, __ATOMIC_RELEASE);
+    }
+
+    Ring->PendingSize = FrameSize;
+    *Type             = FrameType;
+    *DataPtr          = Frame + 1;
+    *Length           = FrameLength;
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+void ShmBridge_RingRelease(ShmBridge_Ring_t *Ring)
+{
+    ShmBridge_RingHeader_t *Hdr = Ring->Header;
+
+    __atomic_store_n(&Hdr->Tail, __atomic_load_n(&Hdr->Tail, __ATOMIC_RELAXED) + Ring->PendingSize,
+                     __ATOMIC_RELEASE);
+    Ring->PendingSize = 0;
+}
+
+void ShmBridge_RingFlush(ShmBridge_Ring_t *Ring)
+{
+    ShmBridge_RingHeader_t *Hdr = Ring->Header;
+
+    __atomic_store_n(&Hdr->Tail, __atomic_load_n(&Hdr->Head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    Ring->PendingSize = 0;
+}
+
+int ShmBridge_RingWait(ShmBridge_Ring_t *Ring, int32_t TimeoutMs)
+{
+    ShmBridge_RingHeader_t *Hdr = Ring->Header;
+    uint32_t                Head;
+    uint32_t                Tail;
+
+    Tail = __atomic_load_n(&Hdr->Tail, __ATOMIC_RELAXED);
+    Head = __atomic_load_n(&Hdr->Head, __ATOMIC_ACQUIRE);
+
+    if (Head == Tail && TimeoutMs != 0)
+    {
+        __atomic_store_n(&Hdr->Waiting, 1, __ATOMIC_SEQ_CST);
+        Head = __atomic_load_n(&Hdr->Head, __ATOMIC_SEQ_CST);
+        if (Head == Tail)
+        {
+            ShmBridge_FutexWait(&Hdr->Head, Head, TimeoutMs);
+            Head = __atomic_load_n(&Hdr->Head, __ATOMIC_ACQUIRE);
+        }
+        __atomic_store_n(&Hdr->Waiting, 0, __ATOMIC_RELAXED);
+    }
+
+    if (Head == Tail)
+    {
+        return SHM_BRIDGE_RING_EMPTY;
+    }
+
+    return SHM_BRIDGE_RING_SUCCESS;
+}
+
+void ShmBridge_RingWake(ShmBridge_Ring_t *Ring)
+{
+    ShmBridge_FutexWake(&Ring->Header->Head);
+}
@@ -0,0 +1,197 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: shm_bridge_ring.h
+**
+** Purpose:
+**   Single producer / single consumer frame ring kept in POSIX shared memory.
+**
+** Notes:
+**   This is used by both ends of the bridge - the SHM_BRIDGE application
+**   inside cFS and the client library on the ground/test side - so it
+**   deliberately depends on nothing but the C library.
+**
+**   Each ring carries frames in one direction only.  A frame is an 8 byte
+**   header followed by its data, padded to a multiple of 8 bytes.  Frames
+**   are never split across the end of the ring; the producer fills the
+**   remainder with a pad frame and continues at the start instead.
+**
+**   The producer owns Head and the consumer owns Tail, each on its own
+**   cache line.  An idle consumer sleeps on Head with a shared futex and
+**   the producer only issues a wakeup when the consumer said it is waiting.
+**
+*******************************************************************************/
+
+#ifndef _shm_bridge_ring_h_
+#define _shm_bridge_ring_h_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Names of the rings in /dev/shm.  The instance number is the processor ID of
+ * the cFS target, so several targets can run on one host at the same time.
+ */
+#define SHM_BRIDGE_RING_NAME_FORMAT  "/cfs_shm_bridge.%u.%s"
+#define SHM_BRIDGE_RING_NAME_MAXLEN  64
+#define SHM_BRIDGE_RING_UPLINK_NAME   "uplink"
+#define SHM_BRIDGE_RING_DOWNLINK_NAME "downlink"
+
+#define SHM_BRIDGE_RING_MAGIC   0x53484d42 /* "SHMB" */
+#define SHM_BRIDGE_RING_VERSION 1
+
+/*
+ * Encoding of the message frames in a ring, fixed by whoever created it
+ */
+#define SHM_BRIDGE_FORMAT_NATIVE 1 /**< Messages are copied as they appear on the software bus */
+#define SHM_BRIDGE_FORMAT_PACKED 2 /**< Messages are packed to the EDS-defined wire format */
+
+/*
+ * Frame types
+ */
+#define SHM_BRIDGE_FRAME_PAD         0 /**< Filler up to the end of the ring, skipped by the consumer */
+#define SHM_BRIDGE_FRAME_MESSAGE     1 /**< A complete software bus message */
+#define SHM_BRIDGE_FRAME_SUBSCRIBE   2 /**< Uplink only: ShmBridge_SubscribeFrame_t */
+#define SHM_BRIDGE_FRAME_UNSUBSCRIBE 3 /**< Uplink only: ShmBridge_SubscribeFrame_t */
+
+/*
+ * Status codes
+ */
+#define SHM_BRIDGE_RING_SUCCESS 0
+#define SHM_BRIDGE_RING_ERROR   -1 /**< System call failed, see errno */
+#define SHM_BRIDGE_RING_EMPTY   -2 /**< Nothing to read, or the wait timed out */
+#define SHM_BRIDGE_RING_FULL    -3 /**< Not enough free space for the frame */
+#define SHM_BRIDGE_RING_INVALID -4 /**< Bad size or argument, or the ring contents are inconsistent */
+
+#define SHM_BRIDGE_FRAME_ALIGN(x) (((x) + 7) & ~((uint32_t)7))
+
+typedef struct
+{
+    uint32_t Length; /**< Length of the data that follows, excluding padding */
+    uint16_t Type;   /**< One of the SHM_BRIDGE_FRAME_ values */
+    uint16_t Spare;
+} ShmBridge_FrameHeader_t;
+
+/*
+ * Largest frame payload a ring of DataSize bytes accepts.  Keeping the whole
+ * frame within half the ring means it always fits an empty ring, whatever
+ * the write offset and pad frame in front of it.
+ */
+#define SHM_BRIDGE_RING_MAX_LENGTH(DataSize) ((uint32_t)((DataSize) / 2 - sizeof(ShmBridge_FrameHeader_t)))
+
+typedef struct
+{
+    uint32_t MsgId;    /**< Software bus MsgId value */
+    uint16_t BufLimit; /**< Pipe depth limit for the subscription, 0 for the default */
+    uint16_t Spare;
+} ShmBridge_SubscribeFrame_t;
+
+/*
+ * Layout of the start of the shared memory object, the frame data follows it.
+ * All fields are in host byte order, both ends always run on the same host.
+ */
+typedef struct
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Format;
+    uint32_t DataSize; /**< Size of the frame data area, a power of two */
+    uint32_t Spare0[12];
+
+    /* Written only by the producer */
+    uint32_t Head;     /**< Free running write position, also the futex word */
+    uint32_t Dropped;  /**< Reservations refused because the ring was full */
+    uint32_t Spare1[14];
+
+    /* Written only by the consumer */
+    uint32_t Tail;     /**< Free running read position */
+    uint32_t Waiting;  /**< Nonzero while the consumer is asleep on Head */
+    uint32_t Spare2[14];
+} ShmBridge_RingHeader_t;
+
+/*
+ * Process-local handle for one end of a ring
+ */
+typedef struct
+{
+    ShmBridge_RingHeader_t *Header;
+    uint8_t *               Data;
+    size_t                  MapSize;
+    uint32_t                Mask;
+    uint32_t                PendingHead; /**< Producer: write position of the reserved frame */
+    uint32_t                PendingSize; /**< Producer: space reserved, Consumer: size of the peeked frame */
+} ShmBridge_Ring_t;
+
+/*
+ * Create (or re-create) a ring and map it.  Any existing ring with the same
+ * name is unlinked first; clients still attached to it must re-attach.
+ */
+int ShmBridge_RingCreate(ShmBridge_Ring_t *Ring, const char *Name, uint32_t DataSize, uint32_t Format);
+
+/*
+ * Map an existing ring created by the other end
+ */
+int ShmBridge_RingAttach(ShmBridge_Ring_t *Ring, const char *Name);
+
+/*
+ * Unmap the ring.  ShmBridge_RingDestroy also removes the name from /dev/shm.
+ */
+void ShmBridge_RingDetach(ShmBridge_Ring_t *Ring);
+void ShmBridge_RingDestroy(ShmBridge_Ring_t *Ring, const char *Name);
+
+/*
+ * Format the /dev/shm name of a ring into Buffer (SHM_BRIDGE_RING_NAME_MAXLEN bytes)
+ */
+void ShmBridge_RingGetName(char *Buffer, uint32_t InstanceNum, const char *Direction);
+
+/*
+ * Producer side.
+ *
+ * ShmBridge_RingReserve returns a pointer to at least MaxLength bytes of
+ * frame data that can be filled in place; ShmBridge_RingCommit then publishes
+ * the first Length bytes of it as a frame of the given type.
+ * ShmBridge_RingPut does both for data that is already in a buffer.
+ * Lengths over SHM_BRIDGE_RING_MAX_LENGTH are rejected as INVALID, so FULL
+ * always means the consumer has to catch up.
+ */
+int ShmBridge_RingReserve(ShmBridge_Ring_t *Ring, uint32_t MaxLength, void **DataPtr);
+int ShmBridge_RingCommit(ShmBridge_Ring_t *Ring, uint16_t Type, uint32_t Length);
+int ShmBridge_RingPut(ShmBridge_Ring_t *Ring, uint16_t Type, const void *Data, uint32_t Length);
+
+/*
+ * Consumer side.
+ *
+ * ShmBridge_RingPeek returns the next frame in place, it stays valid until
+ * ShmBridge_RingRelease.  The type and length it returns have been checked
+ * against the ring bounds and should be used instead of re-reading the
+ * frame header, which the other process could still scribble on.
+ *
+ * ShmBridge_RingWait blocks until the ring is not empty, the timeout
+ * (milliseconds, negative for none) expires or another thread calls
+ * ShmBridge_RingWake; callers should re-check and loop.
+ * ShmBridge_RingFlush discards everything, to recover from a corrupt ring.
+ */
+int  ShmBridge_RingPeek(ShmBridge_Ring_t *Ring, uint16_t *Type, const void **DataPtr, uint32_t *Length);
+void ShmBridge_RingRelease(ShmBridge_Ring_t *Ring);
+int  ShmBridge_RingWait(ShmBridge_Ring_t *Ring, int32_t TimeoutMs);
+void ShmBridge_RingWake(ShmBridge_Ring_t *Ring);
+void ShmBridge_RingFlush(ShmBridge_Ring_t *Ring);
+
+#endif /* _shm_bridge_ring_h_ */
@@ -0,0 +1,160 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: shm_bridge_ring_test.c
+**
+** Purpose:
+** Unit tests for the SHM bridge frame ring
+**
+** Notes:
+** Both ends of the ring are driven from the test task, using a real
+** ring in /dev/shm named after the test process.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "utassert.h"
+#include "uttest.h"
+#include "shm_bridge_ring.h"
+
+#define UT_RING_SIZE 0x100
+
+static ShmBridge_Ring_t UT_Ring;
+static char             UT_RingName[SHM_BRIDGE_RING_NAME_MAXLEN];
+
+/*
+ * Set both counters so the next frame is written at Offset on an empty ring
+ */
+static void UT_RingSetOffset(uint32_t Offset)
+{
+    UT_Ring.Header->Head = Offset;
+    UT_Ring.Header->Tail = Offset;
+}
+
+void Test_ShmBridge_RingAttach(void)
+{
+    ShmBridge_Ring_t Client;
+
+    UtAssert_INT32_EQ(ShmBridge_RingAttach(&Client, UT_RingName), SHM_BRIDGE_RING_SUCCESS);
+    UtAssert_UINT32_EQ(Client.Header->Format, SHM_BRIDGE_FORMAT_PACKED);
+    UtAssert_UINT32_EQ(Client.Mask, UT_RING_SIZE - 1);
+    ShmBridge_RingDetach(&Client);
+}
+
+void Test_ShmBridge_RingReserveLimit(void)
+{
+    void *DataPtr;
+
+    UtAssert_INT32_EQ(ShmBridge_RingReserve(&UT_Ring, UT_RING_SIZE / 2, &DataPtr), SHM_BRIDGE_RING_INVALID);
+    UtAssert_INT32_EQ(ShmBridge_RingReserve(&UT_Ring, SHM_BRIDGE_RING_MAX_LENGTH(UT_RING_SIZE) + 1, &DataPtr),
+                      SHM_BRIDGE_RING_INVALID);
+    UtAssert_UINT32_EQ(UT_Ring.Header->Dropped, 0);
+}
+
+void Test_ShmBridge_RingReserveBoundary(void)
+{
+    uint32_t    MaxLength = SHM_BRIDGE_RING_MAX_LENGTH(UT_RING_SIZE);
+    uint32_t    Offset;
+    uint32_t    Length;
+    uint16_t    Type;
+    void *      DataPtr;
+    const void *FramePtr;
+
+    /*
+     * The largest accepted frame must fit an empty ring at every offset,
+     * including the midpoint where it only just needs a pad frame in front.
+     * The final pass also takes the counters across the 32 bit wrap.
+     */
+    for (Offset = 0; Offset <= UT_RING_SIZE; Offset += sizeof(ShmBridge_FrameHeader_t))
+    {
+        UT_RingSetOffset((Offset == UT_RING_SIZE) ? (0 - (uint32_t)UT_RING_SIZE / 2) : Offset);
+
+        UtAssert_INT32_EQ(ShmBridge_RingReserve(&UT_Ring, MaxLength, &DataPtr), SHM_BRIDGE_RING_SUCCESS);
+        memset(DataPtr, (int)Offset, MaxLength);
+        UtAssert_INT32_EQ(ShmBridge_RingCommit(&UT_Ring, SHM_BRIDGE_FRAME_MESSAGE, MaxLength),
+                          SHM_BRIDGE_RING_SUCCESS);
+
+        UtAssert_INT32_EQ(ShmBridge_RingPeek(&UT_Ring, &Type, &FramePtr, &Length), SHM_BRIDGE_RING_SUCCESS);
+        UtAssert_UINT32_EQ(Type, SHM_BRIDGE_FRAME_MESSAGE);
+        UtAssert_UINT32_EQ(Length, MaxLength);
+        UtAssert_MemCmpValue(FramePtr, (uint8_t)Offset, MaxLength, "Frame data at offset 0x%x", (unsigned int)Offset);
+        ShmBridge_RingRelease(&UT_Ring);
+
+        UtAssert_INT32_EQ(ShmBridge_RingPeek(&UT_Ring, &Type, &FramePtr, &Length), SHM_BRIDGE_RING_EMPTY);
+    }
+
+    UtAssert_UINT32_EQ(UT_Ring.Header->Dropped, 0);
+}
+
+void Test_ShmBridge_RingFull(void)
+{
+    uint8_t     Data[24] = {0};
+    uint32_t    Count    = 0;
+    uint32_t    Length;
+    uint16_t    Type;
+    const void *FramePtr;
+
+    UT_RingSetOffset(0);
+
+    while (ShmBridge_RingPut(&UT_Ring, SHM_BRIDGE_FRAME_MESSAGE, Data, sizeof(Data)) == SHM_BRIDGE_RING_SUCCESS)
+    {
+        ++Count;
+    }
+
+    /* 32 byte frames exactly fill the ring */
+    UtAssert_UINT32_EQ(Count, UT_RING_SIZE / 32);
+    UtAssert_UINT32_EQ(UT_Ring.Header->Dropped, 1);
+
+    /* Releasing one frame makes room for exactly one more */
+    UtAssert_INT32_EQ(ShmBridge_RingPeek(&UT_Ring, &Type, &FramePtr, &Length), SHM_BRIDGE_RING_SUCCESS);
+    ShmBridge_RingRelease(&UT_Ring);
+    UtAssert_INT32_EQ(ShmBridge_RingPut(&UT_Ring, SHM_BRIDGE_FRAME_MESSAGE, Data, sizeof(Data)),
+                      SHM_BRIDGE_RING_SUCCESS);
+    UtAssert_INT32_EQ(ShmBridge_RingPut(&UT_Ring, SHM_BRIDGE_FRAME_MESSAGE, Data, sizeof(Data)),
+                      SHM_BRIDGE_RING_FULL);
+
+    ShmBridge_RingFlush(&UT_Ring);
+    UtAssert_INT32_EQ(ShmBridge_RingPeek(&UT_Ring, &Type, &FramePtr, &Length), SHM_BRIDGE_RING_EMPTY);
+}
+
+void ShmBridge_UT_Setup(void)
+{
+    ShmBridge_RingGetName(UT_RingName, (uint32_t)getpid(), "ut");
+    UtAssert_INT32_EQ(ShmBridge_RingCreate(&UT_Ring, UT_RingName, UT_RING_SIZE, SHM_BRIDGE_FORMAT_PACKED),
+                      SHM_BRIDGE_RING_SUCCESS);
+}
+
+void ShmBridge_UT_TearDown(void)
+{
+    ShmBridge_RingDestroy(&UT_Ring, UT_RingName);
+}
+
+#define ADD_TEST(test) UtTest_Add((Test_##test), ShmBridge_UT_Setup, ShmBridge_UT_TearDown, #test)
+
+void UtTest_Setup(void)
+{
+    ADD_TEST(ShmBridge_RingAttach);
+    ADD_TEST(ShmBridge_RingReserveLimit);
+    ADD_TEST(ShmBridge_RingReserveBoundary);
+    ADD_TEST(ShmBridge_RingFull);
+}
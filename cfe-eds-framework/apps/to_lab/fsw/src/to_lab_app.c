@@ -70,7 +70,8 @@ typedef struct
     TO_LAB_HkTlm_t        HkTlm;
     TO_LAB_DataTypesTlm_t DataTypesTlm;
 
-    CFE_HDR_TelemetryHeader_PackedBuffer_t NetworkBuffer;
+    CFE_HDR_TelemetryHeader_PackedBuffer_t NetworkBuffer[TO_LAB_TLM_SEND_BATCH_SIZE];
+    OS_SockMsg_t                           SendMsg[TO_LAB_TLM_SEND_BATCH_SIZE];
 } TO_LAB_GlobalData_t;
 
 TO_LAB_GlobalData_t TO_LAB_Global;
@@ -94,6 +95,7 @@ int32 TO_LAB_init(void);
 void  TO_LAB_exec_local_command(CFE_SB_Buffer_t *SBBufPtr);
 void  TO_LAB_process_commands(void);
 void  TO_LAB_forward_telemetry(void);
+void  TO_LAB_send_telemetry_batch(size_t NumMsgs);
 
 /*
  * Individual Command Handler prototypes
@@ -615,54 +617,89 @@ int32 TO_LAB_EDS_PackOutputMessage(void *DestBuffer, const CFE_MSG_Message_t *So
 void TO_LAB_forward_telemetry(void)
 {
     OS_SockAddr_t    d_addr;
-    int32            status;
     int32            CFE_SB_status;
-    CFE_SB_Buffer_t *SBBufPtr;
+    int32            PackStatus;
+    CFE_SB_Buffer_t *SBBufPtrs[TO_LAB_TLM_BATCH_SIZE];
+    size_t           NumPkts;
+    size_t           NumPending;
+    size_t           i;
     size_t           DataSize;
 
     OS_SocketAddrInit(&d_addr, OS_SocketDomain_INET);
     OS_SocketAddrSetPort(&d_addr, cfgTLM_PORT);
     OS_SocketAddrFromString(&d_addr, TO_LAB_Global.tlm_dest_IP);
-    status = 0;
+    NumPending = 0;
 
     do
     {
-        CFE_SB_status = CFE_SB_ReceiveBuffer(&SBBufPtr, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
+        CFE_SB_status =
+            CFE_SB_ReceiveBufferBatch(SBBufPtrs, TO_LAB_TLM_BATCH_SIZE, &NumPkts, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
 
-        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false))
+        /* If CFE_SB_status != CFE_SUCCESS, then NumPkts is zero */
+        for (i = 0; i < NumPkts && TO_LAB_Global.suppress_sendto == false; ++i)
         {
             if (TO_LAB_Global.downlink_on == true)
             {
-                CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
-
-                DataSize      = sizeof(TO_LAB_Global.NetworkBuffer);
-                CFE_SB_status = TO_LAB_EDS_PackOutputMessage(TO_LAB_Global.NetworkBuffer, &SBBufPtr->Msg, &DataSize);
+                DataSize   = sizeof(TO_LAB_Global.NetworkBuffer[NumPending]);
+                PackStatus = TO_LAB_EDS_PackOutputMessage(TO_LAB_Global.NetworkBuffer[NumPending], &SBBufPtrs[i]->Msg,
+                                                          &DataSize);
 
-                if (CFE_SB_status != CFE_SUCCESS)
+                if (PackStatus != CFE_SUCCESS)
                 {
                     CFE_EVS_SendEvent(TO_MSGID_ERR_EID, CFE_EVS_EventType_ERROR, "Error packing output: %d\n",
-                                      (int)CFE_SB_status);
+                                      (int)PackStatus);
                 }
                 else
                 {
-                    status = OS_SocketSendTo(TO_LAB_Global.TLMsockid, TO_LAB_Global.NetworkBuffer, DataSize, &d_addr);
+                    /* packed output is queued and sent a batch at a time */
+                    TO_LAB_Global.SendMsg[NumPending].Buffer     = TO_LAB_Global.NetworkBuffer[NumPending];
+                    TO_LAB_Global.SendMsg[NumPending].BufferSize = DataSize;
+                    TO_LAB_Global.SendMsg[NumPending].RemoteAddr = &d_addr;
+                    ++NumPending;
                 }
-
-                CFE_ES_PerfLogExit(TO_SOCKET_SEND_PERF_ID);
             }
-            else
-            {
-                status = 0;
-            }
-            if (status < 0)
+
+            if (NumPending == TO_LAB_TLM_SEND_BATCH_SIZE)
             {
-                CFE_EVS_SendEvent(TO_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "L%d TO sendto error %d. Tlm output suppressed\n", __LINE__, (int)status);
-                TO_LAB_Global.suppress_sendto = true;
+                TO_LAB_send_telemetry_batch(NumPending);
+                NumPending = 0;
             }
         }
-        /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
+
+        /* the packets were packed into the network buffers, so the SB buffers are done */
+        CFE_SB_ReleaseBufferBatch(SBBufPtrs, NumPkts, TO_LAB_Global.Tlm_pipe);
     } while (CFE_SB_status == CFE_SUCCESS);
+
+    /* the pipe is empty, send whatever is left over */
+    if (NumPending > 0 && TO_LAB_Global.suppress_sendto == false)
+    {
+        TO_LAB_send_telemetry_batch(NumPending);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_send_telemetry_batch() -- Send queued telemetry packets  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_send_telemetry_batch(size_t NumMsgs)
+{
+    int32 status;
+
+    CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
+    status = OS_SocketSendMulti(TO_LAB_Global.TLMsockid, TO_LAB_Global.SendMsg, NumMsgs);
+    CFE_ES_PerfLogExit(TO_SOCKET_SEND_PERF_ID);
+
+    /*
+     * A short count only means the socket buffer filled up, and the rest of the
+     * batch is dropped like any other lost datagram.  Only an error stops output.
+     */
+    if (status < 0)
+    {
+        CFE_EVS_SendEvent(TO_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO sendto error %d. Tlm output suppressed\n", __LINE__, (int)status);
+        TO_LAB_Global.suppress_sendto = true;
+    }
 }
 
 /************************/
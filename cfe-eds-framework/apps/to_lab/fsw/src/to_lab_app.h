@@ -54,6 +54,16 @@
  */
 #define TO_LAB_TLM_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
 
+/**
+ * Maximum number of telemetry packets read from the pipe per SB call
+ */
+#define TO_LAB_TLM_BATCH_SIZE 32
+
+/**
+ * Maximum number of packed telemetry packets sent per socket call
+ */
+#define TO_LAB_TLM_SEND_BATCH_SIZE 8
+
 #define cfgTLM_ADDR        "192.168.1.81"
 #define cfgTLM_PORT        1235
 #define TO_LAB_VERSION_NUM "5.1.0"
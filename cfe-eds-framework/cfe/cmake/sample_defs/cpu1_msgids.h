@@ -130,5 +130,6 @@
 #define CFE_SB_ALLSUBS_TLM_MID      CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_ALLSUBS_TLM_TOPICID)
 #define CFE_SB_ONESUB_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_ONESUB_TLM_TOPICID)
 #define CFE_ES_MEMSTATS_TLM_MID     CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_MEMSTATS_TLM_TOPICID)
+#define CFE_ES_PERF_STREAM_TLM_MID  CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_PERF_STREAM_TLM_TOPICID)
 
 #endif /* CPU1_MSGIDS_H */
@@ -38,6 +38,12 @@ void TestCalculateCRC(void)
     const char *Data     = "Random Stuff";
     uint32      inputCrc = 345353;
     uint32      Result;
+    uint32      PieceCrc;
+    uint8       LargeData[4096];
+    size_t      Offset;
+    size_t      PieceSize;
+    size_t      i;
+    uint32      CrcTypes[] = {CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32, CFE_MISSION_ES_CRC_32C};
 
     UtPrintf("Testing: CFE_ES_CalculateCRC");
 
@@ -55,6 +61,37 @@ void TestCalculateCRC(void)
     UtAssert_VOIDCALL(Result = CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_32));
     UtAssert_MIR("Confirm CRC32 of \"%s\" is %lu", Data, (unsigned long)Result);
 
+    UtAssert_VOIDCALL(Result = CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_32C));
+    UtAssert_MIR("Confirm CRC32C of \"%s\" is %lu", Data, (unsigned long)Result);
+
+    /* The 32 bit CRCs are standard algorithms, so check against the published check values */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
+
+    /*
+     * Large blocks may use CRC instructions where small blocks do not, so a CRC
+     * done in one call must match the same CRC done in small pieces
+     */
+    for (i = 0; i < sizeof(LargeData); ++i)
+    {
+        LargeData[i] = (uint8)(i * 7 + (i >> 8));
+    }
+    for (i = 0; i < sizeof(CrcTypes) / sizeof(CrcTypes[0]); ++i)
+    {
+        Result   = CFE_ES_CalculateCRC(LargeData, sizeof(LargeData), inputCrc, CrcTypes[i]);
+        PieceCrc = inputCrc;
+        for (Offset = 0; Offset < sizeof(LargeData); Offset += PieceSize)
+        {
+            PieceSize = sizeof(LargeData) - Offset;
+            if (PieceSize > 37)
+            {
+                PieceSize = 37;
+            }
+            PieceCrc = CFE_ES_CalculateCRC(&LargeData[Offset], PieceSize, PieceCrc, CrcTypes[i]);
+        }
+        UtAssert_UINT32_EQ(Result, PieceCrc);
+    }
+
     /* NULL input or 0 size returns input crc */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(NULL, sizeof(Data), inputCrc, CFE_MISSION_ES_CRC_16), inputCrc);
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(Data, 0, inputCrc, CFE_MISSION_ES_CRC_16), inputCrc);
@@ -66,9 +66,21 @@ void TestSendTimedEvent(void)
     UtAssert_INT32_EQ(CFE_EVS_SendTimedEvent(Time, 0, CFE_EVS_EventType_INFORMATION, NULL), CFE_EVS_INVALID_PARAMETER);
 }
 
+void TestSendDeferredEvent(void)
+{
+    UtPrintf("Testing: CFE_EVS_SendDeferredEvent");
+
+    UtAssert_INT32_EQ(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "OK Deferred %s %d", "Event", 1),
+                      CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "OK Immediate %*d", 2, 1),
+                      CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, NULL), CFE_EVS_INVALID_PARAMETER);
+}
+
 void EVSSendTestSetup(void)
 {
     UtTest_Add(TestSendEvent, NULL, NULL, "Test Send Event");
     UtTest_Add(TestSendEventAppID, NULL, NULL, "Test Send Event with App ID");
     UtTest_Add(TestSendTimedEvent, NULL, NULL, "Test Send Timed Event");
+    UtTest_Add(TestSendDeferredEvent, NULL, NULL, "Test Send Deferred Event");
 }
@@ -159,9 +159,58 @@ void TestGetReleaseAddresses(void)
     }
 }
 
+void TestPinUnpinAddress(void)
+{
+    UtPrintf("Testing: CFE_TBL_PinAddress, CFE_TBL_UnpinAddress");
+    CFE_TBL_Handle_t  DblTblHandle;
+    void *            TblPtr;
+    TBL_TEST_Table_t *TestTblPtr;
+    TBL_TEST_Table_t  TestTable = {1, 2};
+
+    UtAssert_INT32_EQ(CFE_TBL_Register(&DblTblHandle, "DblTable", sizeof(TBL_TEST_Table_t), CFE_TBL_OPT_DBL_BUFFER,
+                                       NULL),
+                      CFE_SUCCESS);
+
+    /* Invalid arguments and single buffered table */
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(NULL, DblTblHandle), CFE_TBL_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, CFE_FT_Global.TblHandle), CFE_TBL_ERR_NOT_DOUBLE_BUFFERED);
+    UtAssert_INT32_EQ(CFE_TBL_UnpinAddress(CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+
+    /* Never loaded */
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, DblTblHandle), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_INT32_EQ(CFE_TBL_UnpinAddress(DblTblHandle), CFE_SUCCESS);
+
+    /* Returns CFE_TBL_INFO_UPDATED once after each load */
+    UtAssert_INT32_EQ(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, DblTblHandle), CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, DblTblHandle), CFE_SUCCESS);
+    TestTblPtr = (TBL_TEST_Table_t *)TblPtr;
+    UtAssert_INT32_EQ(TestTblPtr->Int1, TestTable.Int1);
+    UtAssert_INT32_EQ(TestTblPtr->Int2, TestTable.Int2);
+
+    /* A load is published while the buffer is pinned, and the pinned buffer is left unchanged */
+    TestTable.Int1 = 3;
+    UtAssert_INT32_EQ(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable), CFE_SUCCESS);
+    UtAssert_INT32_EQ(TestTblPtr->Int1, 1);
+
+    /* The next load needs the pinned buffer */
+    UtAssert_INT32_EQ(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+
+    /* Pinning again moves to the updated buffer */
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, DblTblHandle), CFE_TBL_INFO_UPDATED);
+    TestTblPtr = (TBL_TEST_Table_t *)TblPtr;
+    UtAssert_INT32_EQ(TestTblPtr->Int1, 3);
+    UtAssert_INT32_EQ(CFE_TBL_UnpinAddress(DblTblHandle), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable), CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(CFE_TBL_Unregister(DblTblHandle), CFE_SUCCESS);
+}
+
 void TBLContentAccessTestSetup(void)
 {
     UtTest_Add(TestGetAddress, RegisterTestTable, NULL, "Test Table Get Address");
     UtTest_Add(TestReleaseAddress, RegisterTestTable, NULL, "Test Table Release Address");
     UtTest_Add(TestGetReleaseAddresses, NULL, NULL, "Test Table Get and Release Addresses");
+    UtTest_Add(TestPinUnpinAddress, RegisterTestTable, UnregisterTestTable, "Test Table Pin and Unpin Address");
 }
\ No newline at end of file
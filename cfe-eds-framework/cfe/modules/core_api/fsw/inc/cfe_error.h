@@ -1221,6 +1221,15 @@ typedef int32 CFE_Status_t;
  */
 #define CFE_TBL_BAD_ARGUMENT ((CFE_Status_t)0xcc00002d)
 
+/**
+ * @brief Not Double Buffered
+ *
+ *  The calling Application attempted to pin the address of a table that
+ *  was not registered with the #CFE_TBL_OPT_DBL_BUFFER option.
+ *
+ */
+#define CFE_TBL_ERR_NOT_DOUBLE_BUFFERED ((CFE_Status_t)0xcc00002e)
+
 /**
  * @brief Not Implemented
  *
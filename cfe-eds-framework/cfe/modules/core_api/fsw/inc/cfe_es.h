@@ -990,7 +990,7 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 **        used is determined by the last parameter.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        The 32 bit algorithms use CRC instructions on processors that provide them.
 **
 ** \param[in]   DataPtr     Pointer to the base of the memory block.
 **
@@ -998,7 +998,8 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 **
 ** \param[in]   InputCRC    A starting value for use in the CRC calculation.  This parameter
 **                          allows the user to calculate the CRC of non-contiguous blocks as
-**                          a single value.  Nominally, the user should set this value to zero.
+**                          a single value, by passing the result of the previous call.
+**                          Nominally, the user should set this value to zero.
 **
 ** \param[in]   TypeCRC     One of the following CRC algorithm selections:
 **                          \arg \c CFE_MISSION_ES_CRC_8 -  (Not currently implemented)
@@ -1007,7 +1008,16 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 **                                  Initialization: 0x0000 <BR>
 **                                  Reflect Input/Output: true <BR>
 **                                  XorOut: 0x0000
-**                          \arg \c CFE_MISSION_ES_CRC_32 - (not currently implemented)
+**                          \arg \c CFE_MISSION_ES_CRC_32 - CRC-32/ISO-HDLC <BR>
+**                                  Polynomial: 0x04C11DB7 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
+**                          \arg \c CFE_MISSION_ES_CRC_32C - CRC-32C <BR>
+**                                  Polynomial: 0x1EDC6F41 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
 **
 ** \return The result of the CRC calculation on the specified memory block.
 **         If the TypeCRC is unimplemented will return 0.
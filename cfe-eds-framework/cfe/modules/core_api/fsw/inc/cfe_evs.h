@@ -65,8 +65,9 @@
 **          the internal data structures used to support this application's events.  An application
 **          may not send events unless it has called this routine.  The routine also accepts a filter
 **          array structure for applications requiring event filtering.  In the current implementation
-**          of the EVS, only the binary filtering scheme is supported.  See section TBD of the cFE
-**          Application Programmer's Guide for a description of the behavior of binary filters.
+**          of the EVS, only the binary filtering scheme is supported, optionally with a rate limit
+**          per event.  See section TBD of the cFE Application Programmer's Guide for a description of
+**          the behavior of binary filters.
 **          Applications may call #CFE_EVS_Register more than once, but each call will wipe out all
 **          filters registered by previous calls (filter registration is NOT cumulative).
 **
@@ -85,6 +86,20 @@
 **                     } CFE_EVS_BinFilter_t;
 **          \endcode
 **
+**          <b> Filter Scheme: </b> Binary with a rate limit <BR>
+**          <b> Code: </b> CFE_EVS_EventFilter_BINARY_RATE <BR>
+**          <b> Filter Structure: </b>
+**          \code
+**                     typedef struct CFE_EVS_BinRateFilter {
+**                           uint16  EventID,
+**                           uint16  Mask,
+**                           uint16  Rate,
+**                           uint16  Burst ;
+**                     } CFE_EVS_BinRateFilter_t;
+**          \endcode
+**          Events that pass the binary filter are sent at most \c Burst at once, and after that
+**          at most \c Rate per second.  Events over the limit are discarded before they are formatted.
+**
 ** \param[in] Filters            Pointer to an array of event message filters, or NULL if no filtering is desired.
 **                               The structure of an event message filter depends on the FilterScheme selected.
 **                               (see Filter Schemes mentioned above)
@@ -93,9 +108,8 @@
 **                               or equal to the maximum number of events allowed per application
 **                               (#CFE_PLATFORM_EVS_MAX_EVENT_FILTERS).
 **
-** \param[in] FilterScheme       The event filtering scheme that this application will use.  For the first
-**                               implementation of the event services, only filter type #CFE_EVS_EventFilter_BINARY
-**                               will be supported.
+** \param[in] FilterScheme       The event filtering scheme that this application will use, either
+**                               #CFE_EVS_EventFilter_BINARY or #CFE_EVS_EventFilter_BINARY_RATE.
 **
 ** \return Execution status below or from #CFE_ES_GetAppID, see \ref CFEReturnCodes
 ** \retval #CFE_SUCCESS                 \copybrief CFE_SUCCESS
@@ -255,6 +269,51 @@ CFE_Status_t CFE_EVS_SendEventWithAppID(uint16 EventID, uint16 EventType, CFE_ES
 **/
 CFE_Status_t CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType, const char *Spec, ...)
     OS_PRINTF(4, 5);
+
+/****************************************************************************************/
+/**
+** \brief Generate a software event formatted later by Event Services
+**
+** \par Description
+**          This routine is the same as #CFE_EVS_SendEvent except that the text of the event is
+**          not expanded in the caller's context.  The event ID, time, format string pointer and
+**          argument values are placed in a per-application queue and the Event Services task
+**          formats, logs and sends the event shortly afterwards.  This keeps the cost of
+**          formatting and output out of time critical loops that generate many events.
+**
+** \par Assumptions, External Events, and Notes:
+**          This API only works within the context of a registered application or core service.
+**          The \c Spec string and string arguments are copied.  Events whose format is longer
+**          than #CFE_MISSION_EVS_MAX_MESSAGE_LENGTH or uses a '*' width or precision, a \%n
+**          conversion, more than #CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS conversions, or more
+**          string data than #CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE, and events sent while
+**          the application's queue is full, are formatted immediately as by #CFE_EVS_SendEvent.
+**          Deferred events may therefore be sent after later immediate events; the time stamp
+**          is always the time of this call.  Pending events are discarded if the application
+**          is deleted.
+**
+** \param[in] EventID            A numeric literal used to uniquely identify an application event.
+**                               The \c EventID is defined and supplied by the application sending the event.
+**
+** \param[in] EventType          A numeric literal used to classify an event, one of:
+**                                   \arg #CFE_EVS_EventType_DEBUG
+**                                   \arg #CFE_EVS_EventType_INFORMATION
+**                                   \arg #CFE_EVS_EventType_ERROR
+**                                   \arg #CFE_EVS_EventType_CRITICAL
+**
+** \param[in] Spec               A pointer to a null terminated text string @nonnull describing the output format
+**                               for the event, with the same rules as for #CFE_EVS_SendEvent.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                \copybrief CFE_SUCCESS
+** \retval #CFE_EVS_APP_NOT_REGISTERED \copybrief CFE_EVS_APP_NOT_REGISTERED
+** \retval #CFE_EVS_APP_ILLEGAL_APP_ID \copybrief CFE_EVS_APP_ILLEGAL_APP_ID
+** \retval #CFE_EVS_INVALID_PARAMETER  \copybrief CFE_EVS_INVALID_PARAMETER
+**
+** \sa #CFE_EVS_SendEvent, #CFE_EVS_SendTimedEvent
+**
+**/
+CFE_Status_t CFE_EVS_SendDeferredEvent(uint16 EventID, uint16 EventType, const char *Spec, ...) OS_PRINTF(3, 4);
 /**@}*/
 
 /** @defgroup CFEAPIEVSResetFilter cFE Reset Event Filter APIs
@@ -66,4 +66,18 @@ typedef struct CFE_EVS_BinFilter
 
 } CFE_EVS_BinFilter_t;
 
+/** \brief Event message filter definition structure with a rate limit
+ *
+ * Used with the #CFE_EVS_EventFilter_BINARY_RATE filter scheme.  Events that pass
+ * the binary filter are sent at most \c Burst at once, and after that \c Rate per second.
+ */
+typedef struct CFE_EVS_BinRateFilter
+{
+    uint16 EventID; /**< \brief Numerical event identifier */
+    uint16 Mask;    /**< \brief Binary filter mask value */
+    uint16 Rate;    /**< \brief Events per second, 0 for no limit */
+    uint16 Burst;   /**< \brief Events that can be sent at once, 0 is the same as 1 */
+
+} CFE_EVS_BinRateFilter_t;
+
 #endif /* CFE_EVS_API_TYPEDEFS_H */
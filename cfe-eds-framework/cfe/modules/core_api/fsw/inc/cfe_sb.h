@@ -222,6 +222,32 @@ CFE_Status_t CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_P
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_SetPipeOpts #CFE_SB_PIPEOPTS_IGNOREMINE
 **/
 CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
+
+/*****************************************************************************/
+/**
+** \brief Get an ID that can be used to wait on a pipe with OS_SelectMultiple.
+**
+** \par Description
+**          This routine gets the OSAL ID of the queue underlying a pipe, which
+**          can be added to an OS_FdSet so a task can block until either the
+**          pipe or one of its sockets has data, rather than polling each in turn.
+**
+** \par Assumptions, External Events, and Notes:
+**          The ID is only meant for OS_SelectFdAdd and related calls.  Messages
+**          must still be read from the pipe with #CFE_SB_ReceiveBuffer, using
+**          #CFE_SB_POLL once the pipe is reported as readable.
+**
+** \param[in]  PipeId       The pipe ID of the pipe to wait on.
+**
+** \param[out] SelectIdPtr  The ID to add to the OS_FdSet @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_ReceiveBuffer
+**/
+CFE_Status_t CFE_SB_GetPipeSelectId(CFE_SB_PipeId_t PipeId, osal_id_t *SelectIdPtr);
 /**@}*/
 
 /** @defgroup CFEAPISBSubscription cFE Message Subscription Control APIs
@@ -425,6 +451,47 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 **/
 CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a batch of messages
+**
+** \par Description
+**          This routine is equivalent to calling #CFE_SB_TransmitMsg for each
+**          message in the array, in order, but the caller's app/task identity
+**          is only resolved once and events are only sent once for the whole
+**          batch, and the software bus lock is taken once for a group of
+**          messages rather than once per message.  This is intended for
+**          applications that publish many messages at the same time.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Each message is handled independently, so a failure to send one
+**            message does not prevent sending the rest of the batch.
+**          - As with #CFE_SB_TransmitMsg, messages are copied without holding
+**            the software bus lock, so other tasks are not delayed by the
+**            size of the batch.  The lock is only held to put the copied
+**            buffers of each group in transit.
+**          - The counters in SB housekeeping are updated for every message,
+**            but at most one validation event is sent per batch.
+**
+** \param[in]  MsgPtrArray  Array of pointers to the messages to be sent @nonnull.  Each must
+**                          point to the first byte of the message header.
+** \param[in]  Count        Number of messages in MsgPtrArray
+** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
+**                                   sequence count and update the message if the
+**                                   buffer contains a telemetry message
+** \param[out] StatusArray  Optional array of Count entries that is set to the status of
+**                          each individual message, may be NULL
+**
+** \return Execution status, see \ref CFEReturnCodes.  If any message in the batch failed
+**         to send, this is the status of the first one that failed.
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \covtest \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_TransmitMsgBatch(const CFE_MSG_Message_t *const *MsgPtrArray, size_t Count,
+                                     bool IncrementSequenceCount, CFE_Status_t *StatusArray);
+
 /*****************************************************************************/
 /**
 ** \brief Receive a message from a software bus pipe
@@ -465,6 +532,88 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
 ** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a batch of messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to MaxCount messages from the specified
+**          pipe in a single call.  If the pipe is empty, this routine will block
+**          until either a new message comes in or the timeout value is reached,
+**          and then returns that message along with any others that are already
+**          waiting on the pipe, without blocking again.
+**
+** \par Assumptions, External Events, and Notes:
+**          This is intended for apps which drain a pipe by calling
+**          #CFE_SB_ReceiveBuffer with #CFE_SB_POLL in a loop.  The SB shared data
+**          is only locked twice per batch rather than twice per message, and the
+**          pipe queue is read once.
+**
+**          Unlike #CFE_SB_ReceiveBuffer, the returned buffers are not released on
+**          the next receive call.  They remain valid until the caller passes them
+**          to #CFE_SB_ReleaseBufferBatch, which must be done once the caller is
+**          finished with them, or until the pipe is deleted.
+**
+**          At most #CFE_PLATFORM_SB_MAX_RECEIVE_BATCH buffers from a pipe may be
+**          held at a time, across all batches received from it and regardless of
+**          MaxCount.  A call made while that many are held is rejected with
+**          #CFE_SB_BAD_ARGUMENT.
+**
+** \param[out] BufPtrArray  An array of at least MaxCount buffer pointers @nonnull.  On
+**                          success the first *CountPtr entries point to the received
+**                          software bus buffers, in the order they were received.
+**                          These should be used as read-only pointers.
+**
+** \param[in]  MaxCount     The maximum number of messages to receive @nonzero
+**
+** \param[out] CountPtr     Set to the number of messages received @nonnull.  Set to
+**                          zero if this function does not return #CFE_SUCCESS.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, size_t MaxCount, size_t *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Release buffers returned by #CFE_SB_ReceiveBufferBatch
+**
+** \par Description
+**          This routine drops the reference held on each buffer on behalf of the
+**          caller since it was received.  A buffer is returned to the software bus
+**          once all of its recipients have released it.
+**
+** \par Assumptions, External Events, and Notes:
+**          The buffers must not be accessed after this call.  Buffers that are still
+**          held when the pipe is deleted, including when the app is cleaned up,
+**          are released by the software bus.
+**
+** \param[in]  BufPtrArray  The buffer pointers set by #CFE_SB_ReceiveBufferBatch @nonnull
+**
+** \param[in]  Count        The number of entries in BufPtrArray to release, i.e. the
+**                          count that was returned by #CFE_SB_ReceiveBufferBatch.
+**
+** \param[in]  PipeId       The pipe ID the buffers were received from.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**/
+CFE_Status_t CFE_SB_ReleaseBufferBatch(CFE_SB_Buffer_t *const *BufPtrArray, size_t Count, CFE_SB_PipeId_t PipeId);
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -633,6 +633,72 @@ CFE_Status_t CFE_TBL_GetAddresses(void **TblPtrs[], uint16 NumTables, const CFE_
 **
 ******************************************************************************/
 CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t TblHandles[]);
+
+/*****************************************************************************/
+/**
+** \brief Pin the active buffer of a double buffered table and obtain its address
+**
+** \par Description
+**        This is a lower cost alternative to #CFE_TBL_GetAddress for double buffered
+**        tables that are read at high rates.  The active buffer is pinned with an atomic
+**        reader count rather than by locking the access descriptor, so the call does
+**        not look up the calling application.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The table must have been registered with the #CFE_TBL_OPT_DBL_BUFFER option.
+**        -# The handle must have been obtained by the calling application.  Unlike
+**           #CFE_TBL_GetAddress, the calling application is not verified.
+**        -# The pinned buffer remains valid until it is released with #CFE_TBL_UnpinAddress
+**           or pinned again through the same handle.  An update to the table is published
+**           while buffers are pinned, but the next load of the table fails with
+**           #CFE_TBL_ERR_NO_BUFFER_AVAIL until all pins of the previous buffer are released.
+**        -# #CFE_TBL_INFO_UPDATED is returned by the first pin after each update of the table.
+**        -# #CFE_TBL_ERR_NEVER_LOADED will be returned if the table has never been
+**           loaded, but the buffer is still pinned and its address returned.
+**
+** \param[out] TblPtr    The address of a pointer @nonnull that will be loaded with the address of
+**                        the first byte of the active table buffer.
+**
+** \param[in]  TblHandle Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                        identifies the Table whose address is to be returned.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_INFO_UPDATED            \copybrief CFE_TBL_INFO_UPDATED
+** \retval #CFE_TBL_ERR_INVALID_HANDLE      \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_UNREGISTERED        \copybrief CFE_TBL_ERR_UNREGISTERED
+** \retval #CFE_TBL_ERR_NEVER_LOADED        \copybrief CFE_TBL_ERR_NEVER_LOADED
+** \retval #CFE_TBL_ERR_NOT_DOUBLE_BUFFERED \copybrief CFE_TBL_ERR_NOT_DOUBLE_BUFFERED
+** \retval #CFE_TBL_BAD_ARGUMENT            \copybrief CFE_TBL_BAD_ARGUMENT
+**
+** \sa #CFE_TBL_UnpinAddress, #CFE_TBL_GetAddress
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_PinAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle);
+
+/*****************************************************************************/
+/**
+** \brief Release a table buffer pinned with #CFE_TBL_PinAddress
+**
+** \par Description
+**        Releases the buffer pinned through the handle, if any, so that it can
+**        be reused for the next load of the table.
+**
+** \par Assumptions, External Events, and Notes:
+**        As with #CFE_TBL_ReleaseAddress, a pinned buffer should be released prior
+**        to any blocking call.
+**
+** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                       identifies the Table whose buffer is to be released.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_ERR_INVALID_HANDLE      \copybrief CFE_TBL_ERR_INVALID_HANDLE
+**
+** \sa #CFE_TBL_PinAddress
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_UnpinAddress(CFE_TBL_Handle_t TblHandle);
 /**@}*/
 
 /** @defgroup CFEAPITBLInfo cFE Get Table Information APIs
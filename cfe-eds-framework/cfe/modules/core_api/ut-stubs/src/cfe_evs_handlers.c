@@ -110,3 +110,26 @@ void UT_DefaultHandler_CFE_EVS_SendEventWithAppID(void *UserObj, UT_EntryKey_t F
         UT_Stub_CopyFromLocal(UT_KEY(CFE_EVS_SendEventWithAppID), (uint8 *)&EventID, sizeof(EventID));
     }
 }
+
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_EVS_SendDeferredEvent coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_EVS_SendDeferredEvent(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context,
+                                                 va_list va)
+{
+    uint16      EventID = UT_Hook_GetArgValueByName(Context, "EventID", uint16);
+    const char *Spec    = UT_Hook_GetArgValueByName(Context, "Spec", const char *);
+
+    int32 status;
+
+    UtDebug("CFE_EVS_SendDeferredEvent: %u - %s", EventID, Spec);
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyFromLocal(UT_KEY(CFE_EVS_SendDeferredEvent), (uint8 *)&EventID, sizeof(EventID));
+    }
+}
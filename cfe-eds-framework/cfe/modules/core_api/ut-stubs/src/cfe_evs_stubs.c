@@ -29,6 +29,7 @@
 #include "cfe_evs.h"
 #include "utgenstub.h"
 
+extern void UT_DefaultHandler_CFE_EVS_SendDeferredEvent(void *, UT_EntryKey_t, const UT_StubContext_t *, va_list);
 extern void UT_DefaultHandler_CFE_EVS_SendEvent(void *, UT_EntryKey_t, const UT_StubContext_t *, va_list);
 extern void UT_DefaultHandler_CFE_EVS_SendEventWithAppID(void *, UT_EntryKey_t, const UT_StubContext_t *, va_list);
 extern void UT_DefaultHandler_CFE_EVS_SendTimedEvent(void *, UT_EntryKey_t, const UT_StubContext_t *, va_list);
@@ -81,6 +82,28 @@ CFE_Status_t CFE_EVS_ResetFilter(uint16 EventID)
     return UT_GenStub_GetReturnValue(CFE_EVS_ResetFilter, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_EVS_SendDeferredEvent()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_EVS_SendDeferredEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    va_list UtStub_ArgList;
+
+    UT_GenStub_SetupReturnBuffer(CFE_EVS_SendDeferredEvent, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_EVS_SendDeferredEvent, uint16, EventID);
+    UT_GenStub_AddParam(CFE_EVS_SendDeferredEvent, uint16, EventType);
+    UT_GenStub_AddParam(CFE_EVS_SendDeferredEvent, const char *, Spec);
+
+    va_start(UtStub_ArgList, Spec);
+    UT_GenStub_Execute(CFE_EVS_SendDeferredEvent, Va, UT_DefaultHandler_CFE_EVS_SendDeferredEvent, UtStub_ArgList);
+    va_end(UtStub_ArgList);
+
+    return UT_GenStub_GetReturnValue(CFE_EVS_SendDeferredEvent, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_EVS_SendEvent()
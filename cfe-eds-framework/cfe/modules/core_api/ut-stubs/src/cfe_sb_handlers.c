@@ -213,6 +213,31 @@ void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *UserObj, UT_EntryKey_t FuncKey
     }
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_SB_ReceiveBufferBatch coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_SB_ReceiveBufferBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtrArray = UT_Hook_GetArgValueByName(Context, "BufPtrArray", CFE_SB_Buffer_t **);
+    size_t            MaxCount    = UT_Hook_GetArgValueByName(Context, "MaxCount", size_t);
+    size_t *          CountPtr    = UT_Hook_GetArgValueByName(Context, "CountPtr", size_t *);
+
+    int32 status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    *CountPtr = 0;
+    if (status >= 0)
+    {
+        /* Each buffer pointer in the data buffer is returned as one message in the batch */
+        *CountPtr = UT_Stub_CopyToLocal(UT_KEY(CFE_SB_ReceiveBufferBatch), BufPtrArray,
+                                        MaxCount * sizeof(*BufPtrArray)) /
+                    sizeof(*BufPtrArray);
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_SB_TransmitMsg coverage stub function
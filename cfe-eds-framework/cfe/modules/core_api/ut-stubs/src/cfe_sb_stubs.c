@@ -38,6 +38,7 @@ extern void UT_DefaultHandler_CFE_SB_IsValidMsgId(void *, UT_EntryKey_t, const U
 extern void UT_DefaultHandler_CFE_SB_MessageStringGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_MessageStringSet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_CFE_SB_ReceiveBufferBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_SetUserDataLength(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_TimeStampMsg(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_TransmitBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -145,6 +146,23 @@ CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_GetPipeOpts, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetPipeSelectId()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_GetPipeSelectId(CFE_SB_PipeId_t PipeId, osal_id_t *SelectIdPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetPipeSelectId, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_GetPipeSelectId, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_GetPipeSelectId, osal_id_t *, SelectIdPtr);
+
+    UT_GenStub_Execute(CFE_SB_GetPipeSelectId, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetPipeSelectId, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_GetUserData()
@@ -269,6 +287,45 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, size_t MaxCount, size_t *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, CFE_SB_Buffer_t **, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, size_t, MaxCount);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, size_t *, CountPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBufferBatch, Basic, UT_DefaultHandler_CFE_SB_ReceiveBufferBatch);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBufferBatch, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReleaseBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReleaseBufferBatch(CFE_SB_Buffer_t *const *BufPtrArray, size_t Count, CFE_SB_PipeId_t PipeId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReleaseBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReleaseBufferBatch, CFE_SB_Buffer_t *const *, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_ReleaseBufferBatch, size_t, Count);
+    UT_GenStub_AddParam(CFE_SB_ReleaseBufferBatch, CFE_SB_PipeId_t, PipeId);
+
+    UT_GenStub_Execute(CFE_SB_ReleaseBufferBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReleaseBufferBatch, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
@@ -415,6 +472,26 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsg, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitMsgBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitMsgBatch(const CFE_MSG_Message_t *const *MsgPtrArray, size_t Count,
+                                     bool IncrementSequenceCount, CFE_Status_t *StatusArray)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitMsgBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, const CFE_MSG_Message_t *const *, MsgPtrArray);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, size_t, Count);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, bool, IncrementSequenceCount);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgBatch, CFE_Status_t *, StatusArray);
+
+    UT_GenStub_Execute(CFE_SB_TransmitMsgBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsgBatch, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_Unsubscribe()
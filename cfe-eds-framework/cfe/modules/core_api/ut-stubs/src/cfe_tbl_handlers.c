@@ -66,6 +66,24 @@ void UT_DefaultHandler_CFE_TBL_GetAddress(void *UserObj, UT_EntryKey_t FuncKey,
     }
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_TBL_PinAddress coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_TBL_PinAddress(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **TblPtr = UT_Hook_GetArgValueByName(Context, "TblPtr", void **);
+
+    int32 status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_TBL_PinAddress), (uint8 *)TblPtr, sizeof(void *));
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_TBL_GetInfo coverage stub function
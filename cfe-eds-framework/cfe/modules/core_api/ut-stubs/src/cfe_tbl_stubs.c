@@ -29,6 +29,7 @@
 
 extern void UT_DefaultHandler_CFE_TBL_GetAddress(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_TBL_GetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_CFE_TBL_PinAddress(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_TBL_Register(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -183,6 +184,23 @@ CFE_Status_t CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t
     return UT_GenStub_GetReturnValue(CFE_TBL_NotifyByMessage, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_PinAddress()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_PinAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_PinAddress, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_PinAddress, void **, TblPtr);
+    UT_GenStub_AddParam(CFE_TBL_PinAddress, CFE_TBL_Handle_t, TblHandle);
+
+    UT_GenStub_Execute(CFE_TBL_PinAddress, Basic, UT_DefaultHandler_CFE_TBL_PinAddress);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_PinAddress, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_Register()
@@ -253,6 +271,22 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
     return UT_GenStub_GetReturnValue(CFE_TBL_Share, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_UnpinAddress()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_UnpinAddress(CFE_TBL_Handle_t TblHandle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_UnpinAddress, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_UnpinAddress, CFE_TBL_Handle_t, TblHandle);
+
+    UT_GenStub_Execute(CFE_TBL_UnpinAddress, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_UnpinAddress, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_Unregister()
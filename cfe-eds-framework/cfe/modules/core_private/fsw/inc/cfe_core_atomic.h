@@ -0,0 +1,118 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ * Atomic access primitives for data shared between CFE core tasks
+ * outside of a module lock.
+ *
+ * These map onto the compiler atomic builtins, which are supported by all
+ * toolchains used with CFE (GCC and clang).  Only naturally aligned objects
+ * of 1, 2 or 4 bytes and pointers should be passed, so that no library
+ * support is required on 32-bit targets.
+ */
+
+#ifndef CFE_CORE_ATOMIC_H
+#define CFE_CORE_ATOMIC_H
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "cfe_core_atomic.h requires a toolchain with __atomic builtins"
+#endif
+
+/**
+ * \brief Load a value that may be concurrently written by another task
+ */
+#define CFE_ATOMIC_LOAD(Ptr) __atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+
+/**
+ * \brief Store a value that may be concurrently read by another task
+ *
+ * All writes done before this store are visible to a task that observes
+ * the stored value via CFE_ATOMIC_LOAD()
+ */
+#define CFE_ATOMIC_STORE(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_RELEASE)
+
+/**
+ * \brief Load a value without ordering
+ *
+ * For data that is published or validated by a separate
+ * CFE_ATOMIC_LOAD()/CFE_ATOMIC_STORE() of another value
+ */
+#define CFE_ATOMIC_LOAD_RELAXED(Ptr) __atomic_load_n((Ptr), __ATOMIC_RELAXED)
+
+/**
+ * \brief Store a value without ordering
+ *
+ * For data that is published or validated by a separate
+ * CFE_ATOMIC_LOAD()/CFE_ATOMIC_STORE() of another value
+ */
+#define CFE_ATOMIC_STORE_RELAXED(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_RELAXED)
+
+/**
+ * \brief Add to a value and return the result
+ */
+#define CFE_ATOMIC_ADD(Ptr, Val) __atomic_add_fetch((Ptr), (Val), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Subtract from a value and return the result
+ */
+#define CFE_ATOMIC_SUB(Ptr, Val) __atomic_sub_fetch((Ptr), (Val), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Increment a statistics counter
+ *
+ * Counters wrap like the non-atomic increment they replace
+ */
+#define CFE_ATOMIC_INCR(Ptr) ((void)__atomic_add_fetch((Ptr), 1, __ATOMIC_RELAXED))
+
+/**
+ * \brief Compare and swap
+ *
+ * If the value at Ptr equals the value at ExpPtr, Val is stored and true is returned.
+ * Otherwise the current value is written to ExpPtr and false is returned.
+ */
+#define CFE_ATOMIC_CAS(Ptr, ExpPtr, Val) \
+    __atomic_compare_exchange_n((Ptr), (ExpPtr), (Val), false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)
+
+/**
+ * \brief Full memory barrier
+ *
+ * Orders all earlier loads and stores before all later ones, including a
+ * store followed by a load of another location, which acquire and release
+ * ordering alone do not
+ */
+#define CFE_ATOMIC_FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/**
+ * \brief Cache line size assumed when laying out data read by many tasks
+ *
+ * Only affects placement, so a wrong value costs performance but not correctness.
+ */
+#ifndef CFE_CACHE_LINE_SIZE
+#define CFE_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * \brief Align a type or object on a cache line boundary
+ */
+#define CFE_CACHE_ALIGNED __attribute__((aligned(CFE_CACHE_LINE_SIZE)))
+
+#endif /* CFE_CORE_ATOMIC_H */
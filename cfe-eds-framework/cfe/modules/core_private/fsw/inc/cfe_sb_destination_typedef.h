@@ -51,4 +51,19 @@ typedef struct CFE_SB_DestinationD
     struct CFE_SB_DestinationD *Next;
 } CFE_SB_DestinationD_t;
 
+/******************************************************************************
+ * This structure defines one entry of the flat destination array that each
+ * route keeps for message delivery.  It is a copy of an active destination
+ * with the pipe descriptor already looked up, so the transmit path does not
+ * need to walk the destination list or search the pipe table.
+ *
+ * The pipe descriptor type is private to SB, only its tag is needed here.
+ */
+typedef struct CFE_SB_DestinationEntry
+{
+    struct CFE_SB_PipeD *  PipeDscPtr; /**< Descriptor of PipeId when the entry was built */
+    CFE_SB_DestinationD_t *DestPtr;    /**< Destination holding the limit and counters */
+    CFE_SB_PipeId_t        PipeId;     /**< Pipe the message is delivered to */
+} CFE_SB_DestinationEntry_t;
+
 #endif /* CFE_SB_DESTINATION_TYPEDEF_H */
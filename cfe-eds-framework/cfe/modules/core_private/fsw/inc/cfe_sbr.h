@@ -40,6 +40,20 @@
 
 #include "cfe_platform_cfg.h"
 
+/******************************************************************************
+ * Type Definitions
+ */
+
+/** \brief Flat destination array of a route, see CFE_SBR_SetDestArray() */
+typedef struct
+{
+    uint32                    NumDests;                                 /**< \brief Number of valid entries */
+    CFE_SB_DestinationEntry_t Dests[CFE_PLATFORM_SB_MAX_DEST_PER_PKT]; /**< \brief Active destinations */
+} CFE_SBR_DestArray_t;
+
+/** \brief Release function for a destination no reader can still reference, see CFE_SBR_ReclaimDestArrays() */
+typedef void (*CFE_SBR_ReleaseDestPtr_t)(CFE_SB_DestinationD_t *DestPtr);
+
 /******************************************************************************
  * Function prototypes
  */
@@ -99,12 +113,77 @@ CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId);
  */
 void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
 
+/**
+ * \brief Obtain the destination array used for delivery on the given route
+ *
+ * The array is replaced rather than modified when the destinations change,
+ * so the caller must be inside a CFE_SBR_ReadLock() section and must not
+ * keep the pointer beyond it.
+ *
+ * \param[in] RouteId Route ID
+ *
+ * \returns Destination array, NULL if the route is invalid
+ */
+const CFE_SBR_DestArray_t *CFE_SBR_GetDestArray(CFE_SBR_RouteId_t RouteId);
+
+/**
+ * \brief Replace the destination array of the given route
+ *
+ * Each route has a second array that the entries are copied into, which is
+ * then published to readers.  The previous array becomes the second one
+ * once CFE_SBR_ReclaimDestArrays() finds its readers have all left.
+ *
+ * This never waits for readers.  If the array retired by the previous call
+ * on this route may still be in use, nothing is published and the route is
+ * marked stale: the caller must call again later, with the destinations
+ * current at that time, until CFE_SBR_IsDestArrayStale() is false.
+ * Writers must be serialized by the caller (the SB lock).
+ *
+ * \param[in] RouteId        Route ID
+ * \param[in] Dests          Entries to publish, may be NULL if NumDests is 0
+ * \param[in] NumDests       Number of entries, limited to #CFE_PLATFORM_SB_MAX_DEST_PER_PKT
+ * \param[in] RemovedDestPtr Destination just removed from the route, passed to ReleaseFunc once
+ *                           no array that may reference it is visible to readers.  May be NULL.
+ * \param[in] ReleaseFunc    Function to release removed destinations
+ *
+ * \returns true if published, false if the route is invalid or was left stale
+ */
+bool CFE_SBR_SetDestArray(CFE_SBR_RouteId_t RouteId, const CFE_SB_DestinationEntry_t *Dests, uint32 NumDests,
+                          CFE_SB_DestinationD_t *RemovedDestPtr, CFE_SBR_ReleaseDestPtr_t ReleaseFunc);
+
+/**
+ * \brief Check whether the published destination array of a route is stale
+ *
+ * \param[in] RouteId Route ID
+ *
+ * \returns true if CFE_SBR_SetDestArray() could not publish the latest change to the route
+ */
+bool CFE_SBR_IsDestArrayStale(CFE_SBR_RouteId_t RouteId);
+
+/**
+ * \brief Reclaim the retired destination arrays that readers have finished with
+ *
+ * Does not wait for readers.  Destinations removed from a route are passed
+ * to ReleaseFunc once the array that may reference them is reclaimed.
+ * Writers must be serialized by the caller (the SB lock).
+ *
+ * \param[in] ReleaseFunc Function to release a removed destination
+ *
+ * \returns Number of stale routes, see CFE_SBR_SetDestArray()
+ */
+uint32 CFE_SBR_ReclaimDestArrays(CFE_SBR_ReleaseDestPtr_t ReleaseFunc);
+
 /**
  * \brief Increment the sequence counter associated with the supplied route ID
  *
+ * The increment is atomic, so concurrent publishers on the same route
+ * each get a distinct sequence count.
+ *
  * \param[in] RouteId Route ID
+ *
+ * \returns the incremented sequence counter, 0 if the route is invalid
  */
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
 
 /**
  * \brief Get the sequence counter associated with the supplied route ID
@@ -128,6 +207,49 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId);
  */
 void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE_SBR_Throttle_t *ThrottlePtr);
 
+/**
+ * \brief Enter a routing table read-side critical section
+ *
+ * Route lookups and destination array reads may be done without the SB lock
+ * between this call and CFE_SBR_ReadUnlock().  Anything a writer replaces
+ * stays valid until every reader that could have seen it has left.
+ * This never blocks and may be nested, but the caller must not wait on
+ * anything a writer may hold (e.g. the SB lock) inside the section.
+ *
+ * \returns Token to pass to CFE_SBR_ReadUnlock()
+ */
+uint32 CFE_SBR_ReadLock(void);
+
+/**
+ * \brief Leave a routing table read-side critical section
+ *
+ * \param[in] Token Value returned from the matching CFE_SBR_ReadLock()
+ */
+void CFE_SBR_ReadUnlock(uint32 Token);
+
+/**
+ * \brief Get the current routing table read epoch
+ *
+ * Readers that could see anything published before this call have all
+ * left once CFE_SBR_EpochElapsed() returns true for the value returned.
+ * Writers must be serialized by the caller (the SB lock).
+ *
+ * \returns Read epoch
+ */
+uint32 CFE_SBR_GetReadEpoch(void);
+
+/**
+ * \brief Check, without waiting, whether all readers of an epoch have left
+ *
+ * May advance the read epoch so that new readers are not waited on.
+ * Writers must be serialized by the caller (the SB lock).
+ *
+ * \param[in] Epoch Value returned by CFE_SBR_GetReadEpoch()
+ *
+ * \returns true if every reader that entered during or before Epoch has left
+ */
+bool CFE_SBR_EpochElapsed(uint32 Epoch);
+
 /******************************************************************************
 ** Inline functions
 */
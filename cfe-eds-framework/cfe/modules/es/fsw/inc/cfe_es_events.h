@@ -1059,6 +1059,28 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Start Performance Analyzer Streaming Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_START_PERF_STREAM_CC ES Start Performance Analyzer Streaming Command \endlink success.
+ */
+#define CFE_ES_PERF_STREAM_START_EID 94
+
+/**
+ * \brief ES Stop Performance Analyzer Streaming Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_STOP_PERF_STREAM_CC ES Stop Performance Analyzer Streaming Command \endlink success.
+ */
+#define CFE_ES_PERF_STREAM_STOP_EID 95
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -37,6 +37,7 @@
 ** Includes
 */
 #include "cfe_es_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include "cfe_evs_core_internal.h"
 #include "cfe_sb_core_internal.h"
@@ -51,6 +52,7 @@
 ** Defines
 */
 #define ES_START_BUFF_SIZE 128
+#define ES_START_READ_SIZE 512 /* Bytes of the startup script read at a time */
 
 /*
 **
@@ -75,12 +77,19 @@
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 {
     char        ES_AppLoadBuffer[ES_START_BUFF_SIZE]; /* A buffer of for a line in a file */
+    char        ES_ReadBuffer[ES_START_READ_SIZE];    /* A buffer of data read from the file */
     char        ScriptFileName[OS_MAX_PATH_LEN];
     const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
     uint32      NumTokens;
     uint32      NumLines;
     uint32      BuffLen; /* Length of the current buffer */
+    uint32      ReadLen; /* Length of the data in the read buffer */
+    uint32      ReadPos; /* Position of the next character in the read buffer */
+    uint32      NumStarted;
     osal_id_t   AppFile = OS_OBJECT_ID_UNDEFINED;
+    OS_time_t   StartTime;
+    OS_time_t   ScriptTime;
+    OS_time_t   EndTime;
     int32       Status;
     int32       OsStatus;
     char        c;
@@ -161,10 +170,20 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     {
         CFE_ES_WriteToSysLog("%s: Opened ES App Startup file: %s\n", __func__, ScriptFileName);
 
+        OS_GetLocalTime(&StartTime);
+
+        /*
+        ** Start the workers that load the app modules while the rest
+        ** of the script is processed
+        */
+        CFE_ES_StartupLoadBegin();
+
         memset(ES_AppLoadBuffer, 0x0, ES_START_BUFF_SIZE);
         BuffLen      = 0;
         NumTokens    = 0;
         NumLines     = 0;
+        ReadLen      = 0;
+        ReadPos      = 0;
         TokenList[0] = ES_AppLoadBuffer;
 
         /*
@@ -173,20 +192,30 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         */
         while (1)
         {
-            OsStatus = OS_read(AppFile, &c, 1);
-            if (OsStatus < OS_SUCCESS)
-            {
-                CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = %ld\n", __func__, (long)OsStatus);
-                break;
-            }
-            else if (OsStatus == 0)
+            if (ReadPos >= ReadLen)
             {
-                /*
-                ** EOF Reached
-                */
-                break;
+                OsStatus = OS_read(AppFile, ES_ReadBuffer, sizeof(ES_ReadBuffer));
+                if (OsStatus < OS_SUCCESS)
+                {
+                    CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = %ld\n", __func__, (long)OsStatus);
+                    break;
+                }
+                else if (OsStatus == 0)
+                {
+                    /*
+                    ** EOF Reached
+                    */
+                    break;
+                }
+
+                ReadLen = OsStatus;
+                ReadPos = 0;
             }
-            else if (c != '!')
+
+            c = ES_ReadBuffer[ReadPos];
+            ++ReadPos;
+
+            if (c != '!')
             {
                 if (c <= ' ')
                 {
@@ -278,6 +307,29 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         ** close the file
         */
         OS_close(AppFile);
+
+        OS_GetLocalTime(&ScriptTime);
+
+        /*
+        ** Start the apps once all modules are loaded
+        */
+        if (OS_ObjectIdDefined(CFE_ES_Global.StartupLoad.JobSem))
+        {
+            NumStarted = CFE_ES_StartupLoadFinish();
+            OS_GetLocalTime(&EndTime);
+
+            CFE_ES_WriteToSysLog(
+                "%s: Startup script processed in %lu us, %u of %u apps loaded by %u workers and started in %lu us\n",
+                __func__, (unsigned long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(ScriptTime, StartTime)),
+                (unsigned int)NumStarted, (unsigned int)CFE_ES_Global.StartupLoad.NumJobs,
+                (unsigned int)CFE_ES_Global.StartupLoad.NumWorkers,
+                (unsigned long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, ScriptTime)));
+        }
+        else
+        {
+            CFE_ES_WriteToSysLog("%s: Startup script processed in %lu us\n", __func__,
+                                 (unsigned long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(ScriptTime, StartTime)));
+        }
     }
 }
 
@@ -370,9 +422,17 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         }
 
         /*
-        ** Now create the application
+        ** Now create the application, or leave the module load to
+        ** the startup load workers if they are running
         */
-        Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
+        if (OS_ObjectIdDefined(CFE_ES_Global.StartupLoad.JobSem))
+        {
+            Status = CFE_ES_StartupLoadQueueApp(ModuleName, &ParamBuf);
+        }
+        else
+        {
+            Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
+        }
     }
     else if (strcmp(EntryType, "CFE_LIB") == 0)
     {
@@ -662,13 +722,14 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_ES_AppCreate
+ * Function: CFE_ES_AppCreateReserve
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params)
+int32 CFE_ES_AppCreateReserve(CFE_ES_AppRecord_t **AppRecPtrOut, CFE_ResourceId_t *PendingIdOut, const char *AppName,
+                              const CFE_ES_AppStartParams_t *Params)
 {
     CFE_Status_t        Status;
     CFE_ES_AppRecord_t *AppRecPtr;
@@ -700,10 +761,10 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     ** validation test.  So this function effectively has exclusive access
     ** without holding the global lock.
     **
-    ** IMPORTANT: it must set the ID to something else before leaving
-    ** this function or else the resource will be leaked.  After this
-    ** point, execution must proceed to the end of the function to
-    ** guarantee that the entry is either completed or freed.
+    ** IMPORTANT: the caller must set the ID to something else or else the
+    ** resource will be leaked.  After this point, execution must proceed
+    ** to CFE_ES_AppCreateComplete() to guarantee that the entry is either
+    ** completed or freed.
     */
 
     /*
@@ -762,19 +823,24 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
-    /*
-     * If ID allocation was not successful, return now.
-     * A message regarding the issue should have already been logged
-     */
-    if (Status != CFE_SUCCESS)
-    {
-        return Status;
-    }
+    *AppRecPtrOut = AppRecPtr;
+    *PendingIdOut = PendingResourceId;
 
-    /*
-     * Load the module based on StartParams configured above.
-     */
-    Status = CFE_ES_LoadModule(PendingResourceId, AppName, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->LoadStatus);
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppCreateComplete
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_AppCreateComplete(CFE_ES_AppId_t *ApplicationIdPtr, CFE_ES_AppRecord_t *AppRecPtr,
+                               CFE_ResourceId_t PendingResourceId, int32 LoadStatus)
+{
+    CFE_Status_t Status = LoadStatus;
 
     /*
      * If the Load was OK, then complete the initialization
@@ -783,7 +849,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     {
         Status =
             CFE_ES_StartAppTask(&AppRecPtr->MainTaskId, /* Task ID (output) stored in App Record as main task */
-                                AppName,                /* Main Task name matches app name */
+                                AppRecPtr->AppName,     /* Main Task name matches app name */
                                 (CFE_ES_TaskEntryFuncPtr_t)
                                     AppRecPtr->LoadStatus.InitSymbolAddress, /* Init Symbol is main task entry point */
                                 &AppRecPtr->StartParams.MainTaskInfo,        /* Main task parameters */
@@ -825,6 +891,239 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppCreate
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params)
+{
+    CFE_Status_t        Status;
+    CFE_ES_AppRecord_t *AppRecPtr;
+    CFE_ResourceId_t    PendingResourceId;
+
+    Status = CFE_ES_AppCreateReserve(&AppRecPtr, &PendingResourceId, AppName, Params);
+
+    /*
+     * If ID allocation was not successful, return now.
+     * A message regarding the issue should have already been logged
+     */
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /*
+     * Load the module based on StartParams configured above.
+     */
+    Status = CFE_ES_LoadModule(PendingResourceId, AppName, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->LoadStatus);
+
+    return CFE_ES_AppCreateComplete(ApplicationIdPtr, AppRecPtr, PendingResourceId, Status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadBegin
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadBegin(void)
+{
+    CFE_ES_StartupLoadState_t *State = &CFE_ES_Global.StartupLoad;
+    char                       WorkerName[OS_MAX_API_NAME];
+    osal_id_t                  WorkerId;
+    int32                      OsStatus;
+    uint32                     i;
+
+    memset(State, 0, sizeof(*State));
+    State->JobSem  = OS_OBJECT_ID_UNDEFINED;
+    State->DoneSem = OS_OBJECT_ID_UNDEFINED;
+
+    if (CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS == 0)
+    {
+        return;
+    }
+
+    OsStatus = OS_CountSemCreate(&State->JobSem, "ES_LoadJobs", 0, 0);
+    if (OsStatus == OS_SUCCESS)
+    {
+        OsStatus = OS_CountSemCreate(&State->DoneSem, "ES_LoadDone", 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            OS_CountSemDelete(State->JobSem);
+        }
+    }
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Cannot create load semaphores, loading apps one at a time. EC = %ld\n", __func__,
+                             (long)OsStatus);
+        State->JobSem  = OS_OBJECT_ID_UNDEFINED;
+        State->DoneSem = OS_OBJECT_ID_UNDEFINED;
+        return;
+    }
+
+    for (i = 0; i < CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS; ++i)
+    {
+        snprintf(WorkerName, sizeof(WorkerName), "ES_LOAD%u", (unsigned int)(i + 1));
+        OsStatus = OS_TaskCreate(&WorkerId, WorkerName, CFE_ES_StartupLoadWorker, OSAL_TASK_STACK_ALLOCATE,
+                                 CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            /* The startup task loads whatever the workers do not */
+            CFE_ES_WriteToSysLog("%s: Cannot create load worker %s. EC = %ld\n", __func__, WorkerName,
+                                 (long)OsStatus);
+            break;
+        }
+        ++State->NumWorkers;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadQueueApp
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartupLoadQueueApp(const char *AppName, const CFE_ES_AppStartParams_t *Params)
+{
+    CFE_ES_StartupLoadState_t *State = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadJob_t *  Job;
+    CFE_ES_AppId_t             AppId;
+    int32                      Status;
+
+    /* Every app needs an app record, so this only happens if core apps were not counted */
+    if (State->NumJobs >= CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        return CFE_ES_AppCreate(&AppId, AppName, Params);
+    }
+
+    Job    = &State->Jobs[State->NumJobs];
+    Status = CFE_ES_AppCreateReserve(&Job->AppRecPtr, &Job->PendingAppId, AppName, Params);
+    if (Status == CFE_SUCCESS)
+    {
+        Job->LoadStatus = CFE_ES_ERR_APP_CREATE;
+
+        /* Publish the job before a worker can be woken up to claim it */
+        CFE_ATOMIC_STORE(&State->NumJobs, State->NumJobs + 1);
+        OS_CountSemGive(State->JobSem);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadRunJob
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_StartupLoadRunJob(void)
+{
+    CFE_ES_StartupLoadState_t *State = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadJob_t *  Job;
+    uint32                     JobIdx;
+
+    JobIdx = CFE_ATOMIC_ADD(&State->NextJob, 1) - 1;
+    if (JobIdx >= CFE_ATOMIC_LOAD(&State->NumJobs))
+    {
+        return false;
+    }
+
+    Job = &State->Jobs[JobIdx];
+    Job->LoadStatus =
+        CFE_ES_LoadModule(Job->PendingAppId, Job->AppRecPtr->AppName, &Job->AppRecPtr->StartParams.BasicInfo,
+                          &Job->AppRecPtr->LoadStatus);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadWorker
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadWorker(void)
+{
+    CFE_ES_StartupLoadState_t *State = &CFE_ES_Global.StartupLoad;
+
+    /*
+     * Each count on the job semaphore is either a queued job or,
+     * once the script is done, a request to exit
+     */
+    while (OS_CountSemTake(State->JobSem) == OS_SUCCESS && CFE_ES_StartupLoadRunJob())
+    {
+        /* keep loading */
+    }
+
+    OS_CountSemGive(State->DoneSem);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadFinish
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_StartupLoadFinish(void)
+{
+    CFE_ES_StartupLoadState_t *State = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadJob_t *  Job;
+    CFE_ES_AppId_t             AppId;
+    uint32                     NumStarted;
+    uint32                     i;
+
+    /* Wake every worker one last time so it sees there is nothing left */
+    for (i = 0; i < State->NumWorkers; ++i)
+    {
+        OS_CountSemGive(State->JobSem);
+    }
+
+    /* Help with the loads no worker has claimed yet */
+    while (CFE_ES_StartupLoadRunJob())
+    {
+        /* keep loading */
+    }
+
+    /* After this all loads are complete */
+    for (i = 0; i < State->NumWorkers; ++i)
+    {
+        OS_CountSemTake(State->DoneSem);
+    }
+
+    OS_CountSemDelete(State->JobSem);
+    OS_CountSemDelete(State->DoneSem);
+    State->JobSem  = OS_OBJECT_ID_UNDEFINED;
+    State->DoneSem = OS_OBJECT_ID_UNDEFINED;
+
+    /* Start the apps in the order of the script */
+    NumStarted = 0;
+    for (i = 0; i < State->NumJobs; ++i)
+    {
+        Job = &State->Jobs[i];
+        if (CFE_ES_AppCreateComplete(&AppId, Job->AppRecPtr, Job->PendingAppId, Job->LoadStatus) == CFE_SUCCESS)
+        {
+            ++NumStarted;
+        }
+    }
+
+    return NumStarted;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_LoadLibrary
@@ -1729,6 +2028,12 @@ int32 CFE_ES_CleanupTaskResources(CFE_ES_TaskId_t TaskId)
     OsStatus = OS_TaskDelete(OsalId);
     if (OsStatus == OS_SUCCESS || OsStatus == OS_ERR_INVALID_ID)
     {
+        /*
+        ** Return the memory pool blocks cached by the task, now that it
+        ** cannot use them anymore
+        */
+        CFE_ES_FlushPoolTaskCache(TaskId);
+
         Result = CleanState.OverallStatus;
         if (Result == CFE_SUCCESS && CleanState.FoundObjects > 0)
         {
@@ -172,6 +172,34 @@ typedef struct
 
 } CFE_ES_LibRecord_t;
 
+/*
+** CFE_ES_StartupLoadJob_t is an app of the startup script whose module is loaded
+** by the startup load workers.  The app record is reserved when the job is queued,
+** and the app is started in script order once all modules are loaded.
+*/
+typedef struct
+{
+    CFE_ES_AppRecord_t *AppRecPtr;    /* The reserved app record */
+    CFE_ResourceId_t    PendingAppId; /* The ID of the app once it is started */
+    int32               LoadStatus;   /* Result of loading the module */
+
+} CFE_ES_StartupLoadJob_t;
+
+/*
+** CFE_ES_StartupLoadState_t is an internal structure used to keep state of
+** the app module loads done in parallel while the startup script is processed
+*/
+typedef struct
+{
+    osal_id_t               JobSem;     /* One count per queued job, plus one per worker to exit */
+    osal_id_t               DoneSem;    /* Given by each worker as it exits */
+    uint32                  NumWorkers; /* Number of worker tasks started */
+    uint32                  NumJobs;    /* Number of jobs queued */
+    uint32                  NextJob;    /* Index of the next job to claim */
+    CFE_ES_StartupLoadJob_t Jobs[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+
+} CFE_ES_StartupLoadState_t;
+
 /*
 ** CFE_ES_AppTableScanState_t is an internal structure used to keep state of
 ** the background app table scan/cleanup process
@@ -200,6 +228,43 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
  */
 int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Starts the tasks that load app modules while the startup script is processed.
+ *
+ * Does nothing if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS is 0 or the semaphores cannot
+ * be created, in which case every app is created as its script line is parsed.
+ */
+void CFE_ES_StartupLoadBegin(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Reserves the record of a startup script app and queues the load of its module.
+ */
+int32 CFE_ES_StartupLoadQueueApp(const char *AppName, const CFE_ES_AppStartParams_t *Params);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Claims and loads the next queued app module.
+ *
+ * \return false if there was no job to claim
+ */
+bool CFE_ES_StartupLoadRunJob(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of the startup load worker tasks.
+ */
+void CFE_ES_StartupLoadWorker(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Waits for all queued app modules to be loaded, then starts the apps in script order.
+ *
+ * \return the number of apps started
+ */
+uint32 CFE_ES_StartupLoadFinish(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Helper function to load + configure (but not start) a new app/lib module
@@ -246,6 +311,25 @@ void CFE_ES_TaskEntryPoint(void);
 int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_ES_TaskEntryFuncPtr_t EntryFunc,
                           const CFE_ES_TaskStartParams_t *Params, CFE_ES_AppId_t ParentAppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Helper function to reserve the app record of a new app
+ *
+ * The record is left in the RESERVED state, and must be passed to
+ * CFE_ES_AppCreateComplete() after the module of the app is loaded.
+ */
+int32 CFE_ES_AppCreateReserve(CFE_ES_AppRecord_t **AppRecPtrOut, CFE_ResourceId_t *PendingIdOut, const char *AppName,
+                              const CFE_ES_AppStartParams_t *Params);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Helper function to start the main task of an app reserved by CFE_ES_AppCreateReserve()
+ *
+ * If the module load failed or the task cannot be started, the app record is freed.
+ */
+int32 CFE_ES_AppCreateComplete(CFE_ES_AppId_t *ApplicationIdPtr, CFE_ES_AppRecord_t *AppRecPtr,
+                               CFE_ResourceId_t PendingResourceId, int32 LoadStatus);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function loads and creates a cFE Application.
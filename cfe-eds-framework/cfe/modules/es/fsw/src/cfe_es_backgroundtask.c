@@ -76,6 +76,11 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
      .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
      .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
      .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
+    {/* Performance Log Data Stream to telemetry */
+     .RunFunc      = CFE_ES_RunPerfLogStream,
+     .JobArg       = &CFE_ES_Global.BackgroundPerfStreamState,
+     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
     {/* Check for exceptions stored in the PSP */
      .RunFunc      = CFE_ES_RunExceptionScan,
      .JobArg       = NULL,
@@ -44,6 +44,12 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+/*
+ * Name index of the CDS registry, see CFE_ES_NameHash_t
+ */
+static const CFE_ES_NameHash_t CFE_ES_CDSNameHash =
+    CFE_ES_NAMEHASH_INIT(CFE_ES_Global.CDSVars.NameHash, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES);
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_CDS_EarlyInit
@@ -634,6 +640,7 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        CFE_ES_NameHashClear(&CFE_ES_CDSNameHash);
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -764,33 +771,52 @@ CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
-    uint32                 NumReg;
+    CFE_ES_NameHashIter_t  Iter;
+    uint32                 RegIdx;
 
-    CDSRegRecPtr = CDS->Registry;
-    NumReg       = CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES;
-    while (true)
+    /* The index only returns registry entries with the same name hash */
+    CFE_ES_NameHashIterInit(&CFE_ES_CDSNameHash, &Iter, CDSName);
+    while (CFE_ES_NameHashIterNext(&CFE_ES_CDSNameHash, &Iter, &RegIdx))
     {
-        if (NumReg == 0)
-        {
-            CDSRegRecPtr = NULL; /* not found */
-            break;
-        }
-
+        CDSRegRecPtr = &CDS->Registry[RegIdx];
         if (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr))
         {
             /* Perform a case sensitive name comparison */
             if (strcmp(CDSName, CDSRegRecPtr->Name) == 0)
             {
                 /* If the names match, then stop */
-                break;
+                return CDSRegRecPtr;
             }
         }
-
-        ++CDSRegRecPtr;
-        --NumReg;
     }
 
-    return CDSRegRecPtr;
+    return NULL; /* not found */
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CDSBlockRecordNameHashAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSBlockRecordNameHashAdd(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    CFE_ES_NameHashAdd(&CFE_ES_CDSNameHash, CDSBlockRecPtr - CFE_ES_Global.CDSVars.Registry, CDSBlockRecPtr->Name);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CDSBlockRecordNameHashRemove
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSBlockRecordNameHashRemove(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    CFE_ES_NameHashRemove(&CFE_ES_CDSNameHash, CDSBlockRecPtr - CFE_ES_Global.CDSVars.Registry);
 }
 
 /*----------------------------------------------------------------
@@ -804,8 +830,10 @@ CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName)
 int32 CFE_ES_RebuildCDS(void)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_RegRec_t *  RegRecPtr;
     int32                  Status;
     int32                  PspStatus;
+    uint32                 RegIdx;
 
     /* First, determine if the CDS registry stored in the CDS is smaller or equal */
     /* in size to the CDS registry we are currently configured for                */
@@ -830,6 +858,18 @@ int32 CFE_ES_RebuildCDS(void)
 
     if (PspStatus == CFE_PSP_SUCCESS)
     {
+        /* Index the names of the recovered registry entries */
+        CFE_ES_NameHashClear(&CFE_ES_CDSNameHash);
+        for (RegIdx = 0; RegIdx < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++RegIdx)
+        {
+            RegRecPtr = &CDS->Registry[RegIdx];
+            if (CFE_ES_CDSBlockRecordIsUsed(RegRecPtr))
+            {
+                RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = 0;
+                CFE_ES_CDSBlockRecordNameHashAdd(RegRecPtr);
+            }
+        }
+
         /* Scan the memory pool and identify the created but currently unused memory blocks */
         Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
     }
@@ -41,6 +41,7 @@
 */
 #include "common_types.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_es_namehash.h"
 
 /*
 ** Macro Definitions
@@ -165,6 +166,8 @@ typedef struct
     size_t              DataSize;       /**< \brief Size of actual user data pool */
     CFE_ResourceId_t    LastCDSBlockId; /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief CDS Registry (Local Copy) */
+
+    CFE_ES_NAMEHASH_STORAGE(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES) NameHash; /**< \brief Index of Registry by name */
 } CFE_ES_CDS_Instance_t;
 
 /*
@@ -333,12 +336,39 @@ static inline CFE_ES_CDSHandle_t CFE_ES_CDSBlockRecordGetID(const CFE_ES_CDS_Reg
     return (CDSBlockRecPtr->BlockID);
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a CDS registry table entry to the name index
+ *
+ * The name must be stored in the entry before it is added, and the entry
+ * is added again whenever it is marked as used.
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   CDSBlockRecPtr   pointer to CDS registry table entry
+ */
+void CFE_ES_CDSBlockRecordNameHashAdd(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a CDS registry table entry from the name index
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   CDSBlockRecPtr   pointer to CDS registry table entry
+ */
+void CFE_ES_CDSBlockRecordNameHashRemove(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Marks a Memory Pool table entry as used (not free)
  *
  * This sets the internal field(s) within this entry, and marks
  * it as being associated with the given Pool ID.
+ * The name of the entry must already be stored, as this also
+ * adds the entry to the name index.
  *
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
@@ -349,6 +379,7 @@ static inline CFE_ES_CDSHandle_t CFE_ES_CDSBlockRecordGetID(const CFE_ES_CDS_Reg
 static inline void CFE_ES_CDSBlockRecordSetUsed(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr, CFE_ResourceId_t PendingId)
 {
     CDSBlockRecPtr->BlockID = CFE_ES_CDSHANDLE_C(PendingId);
+    CFE_ES_CDSBlockRecordNameHashAdd(CDSBlockRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -366,6 +397,7 @@ static inline void CFE_ES_CDSBlockRecordSetUsed(CFE_ES_CDS_RegRec_t *CDSBlockRec
 static inline void CFE_ES_CDSBlockRecordSetFree(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
 {
     CDSBlockRecPtr->BlockID = CFE_ES_CDS_BAD_HANDLE;
+    CFE_ES_CDSBlockRecordNameHashRemove(CDSBlockRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
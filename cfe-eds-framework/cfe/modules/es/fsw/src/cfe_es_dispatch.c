@@ -56,6 +56,8 @@ static const CFE_ES_Application_Component_Telecommand_DispatchTable_t CFE_ES_TC_
             .DeleteCDSCmd_indication          = CFE_ES_DeleteCDSCmd,
             .SendMemPoolStatsCmd_indication   = CFE_ES_SendMemPoolStatsCmd,
             .DumpCDSRegistryCmd_indication    = CFE_ES_DumpCDSRegistryCmd,
+            .StartPerfStreamCmd_indication    = CFE_ES_StartPerfStreamCmd,
+            .StopPerfStreamCmd_indication     = CFE_ES_StopPerfStreamCmd,
         },
     .SEND_HK = {.indication = CFE_ES_HousekeepingCmd}};
 
@@ -58,7 +58,11 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start from the first bucket that can fit the smallest size of the size
+     * class, so at most the buckets within the same class are checked.
+     */
+    for (Index = PoolRecPtr->SizeClassMap[CFE_ES_GenPoolSizeClass(ReqSize)]; Index < PoolRecPtr->NumBuckets; ++Index)
     {
         if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
         {
@@ -74,6 +78,63 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
     return (PoolRecPtr->NumBuckets - Index);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolSizeClass
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolSizeClass(size_t Size)
+{
+    uint16 Msb;
+    uint16 Shift;
+
+    /* Find the most significant bit, halving the width searched on each step */
+    Msb = 0;
+    for (Shift = sizeof(size_t) * 4; Shift > 0; Shift >>= 1)
+    {
+        if ((Size >> (Msb + Shift)) != 0)
+        {
+            Msb += Shift;
+        }
+    }
+
+    if (Msb < CFE_ES_GENERIC_POOL_CLASS_BITS)
+    {
+        /* Sizes too small to split each have their own class */
+        return (uint16)Size;
+    }
+
+    /* Classes of larger sizes follow on without gaps, so they keep the order of the sizes */
+    return ((Msb - CFE_ES_GENERIC_POOL_CLASS_BITS + 1) << CFE_ES_GENERIC_POOL_CLASS_BITS) |
+           ((Size >> (Msb - CFE_ES_GENERIC_POOL_CLASS_BITS)) & ((1 << CFE_ES_GENERIC_POOL_CLASS_BITS) - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolClassMinSize
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_GenPoolClassMinSize(uint16 SizeClass)
+{
+    uint16 Msb;
+
+    if (SizeClass < (1 << CFE_ES_GENERIC_POOL_CLASS_BITS))
+    {
+        return SizeClass;
+    }
+
+    Msb = (SizeClass >> CFE_ES_GENERIC_POOL_CLASS_BITS) + CFE_ES_GENERIC_POOL_CLASS_BITS - 1;
+
+    return (size_t)((1 << CFE_ES_GENERIC_POOL_CLASS_BITS) | (SizeClass & ((1 << CFE_ES_GENERIC_POOL_CLASS_BITS) - 1)))
+           << (Msb - CFE_ES_GENERIC_POOL_CLASS_BITS);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_GenPoolGetBucketState
@@ -328,6 +389,20 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Map each size class to the first bucket that can fit the smallest
+     * size in the class.  Buckets are sorted, so this is one pass.
+     */
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_NUM_CLASSES; ++i)
+    {
+        while (j < NumBlockSizes && PoolRecPtr->Buckets[j].BlockSize < CFE_ES_GenPoolClassMinSize(i))
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassMap[i] = j;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -51,6 +51,14 @@
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Block sizes are grouped into size classes so a bucket can be found without
+ * scanning the whole bucket list.  Each power of 2 is split into classes by the
+ * bits just below the most significant bit.
+ */
+#define CFE_ES_GENERIC_POOL_CLASS_BITS  2
+#define CFE_ES_GENERIC_POOL_NUM_CLASSES ((sizeof(size_t) * 8) << CFE_ES_GENERIC_POOL_CLASS_BITS)
+
 /*
 ** Type Definitions
 */
@@ -116,6 +124,8 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    uint8 SizeClassMap[CFE_ES_GENERIC_POOL_NUM_CLASSES]; /**< Index of the first bucket that can fit each size class */
 };
 
 /*****************************************************************************/
@@ -123,6 +133,37 @@ struct CFE_ES_GenPoolRecord
 ** Function prototypes
 */
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the size class of a block size
+ *
+ * \param[in]   Size          Block size
+ *
+ * \return Size class, less than #CFE_ES_GENERIC_POOL_NUM_CLASSES
+ */
+uint16 CFE_ES_GenPoolSizeClass(size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the smallest block size in a size class
+ *
+ * \param[in]   SizeClass     Size class, as returned by CFE_ES_GenPoolSizeClass()
+ *
+ * \return Smallest block size that has this size class
+ */
+size_t CFE_ES_GenPoolClassMinSize(uint16 SizeClass);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the bucket for a requested block size
+ *
+ * \param[in]   PoolRecPtr    Pointer to pool structure
+ * \param[in]   ReqSize       Size of block requested
+ *
+ * \return Bucket ID, or 0 if the size is larger than all blocks of the pool
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Initialize a generic pool structure
@@ -43,6 +43,7 @@
 #include "cfe_es_erlog_typedef.h"
 #include "cfe_es_resetdata_typedef.h"
 #include "cfe_es_cds.h"
+#include "cfe_es_namehash.h"
 
 #include <signal.h> /* for sig_atomic_t */
 
@@ -158,6 +159,7 @@ typedef struct
     */
     uint32              RegisteredTasks;
     CFE_ES_TaskRecord_t TaskTable[OS_MAX_TASKS];
+    CFE_ES_NAMEHASH_STORAGE(OS_MAX_TASKS) TaskNameHash;
 
     /*
     ** ES App Table
@@ -166,6 +168,7 @@ typedef struct
     uint32             RegisteredExternalApps;
     CFE_ResourceId_t   LastAppId;
     CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    CFE_ES_NAMEHASH_STORAGE(CFE_PLATFORM_ES_MAX_APPLICATIONS) AppNameHash;
 
     /*
     ** ES Shared Library Table
@@ -173,12 +176,14 @@ typedef struct
     uint32             RegisteredLibs;
     CFE_ResourceId_t   LastLibId;
     CFE_ES_LibRecord_t LibTable[CFE_PLATFORM_ES_MAX_LIBRARIES];
+    CFE_ES_NAMEHASH_STORAGE(CFE_PLATFORM_ES_MAX_LIBRARIES) LibNameHash;
 
     /*
     ** ES Generic Counters Table
     */
     CFE_ResourceId_t          LastCounterId;
     CFE_ES_GenCounterRecord_t CounterTable[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+    CFE_ES_NAMEHASH_STORAGE(CFE_PLATFORM_ES_MAX_GEN_COUNTERS) CounterNameHash;
 
     /*
     ** Critical Data Store Management Variables
@@ -198,6 +203,16 @@ typedef struct
     CFE_ResourceId_t       LastMemPoolId;
     CFE_ES_MemPoolRecord_t MemPoolTable[CFE_PLATFORM_ES_MAX_MEMORY_POOLS];
 
+    /*
+     * Parallel app module loads of the startup script
+     */
+    CFE_ES_StartupLoadState_t StartupLoad;
+
+    /*
+     * Memory pool block caches, indexed like the OSAL task table
+     */
+    CFE_ES_PoolTaskCache_t PoolTaskCache[OS_MAX_TASKS];
+
     /*
     ** ES Task initialization data (not reported in housekeeping)
     */
@@ -208,6 +223,21 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * Persistent state data associated with performance log streaming
+     */
+    CFE_ES_PerfStreamGlobal_t BackgroundPerfStreamState;
+
+    /*
+     * Performance log entries, one ring per task
+     */
+    CFE_ES_PerfTaskRing_t PerfTaskRing[CFE_ES_PERF_TASK_RING_COUNT];
+
+    /*
+     * Number of times performance data collection was started
+     */
+    uint32 PerfStartCount;
+
     /*
      * Persistent state data associated with background app table scans
      */
@@ -35,6 +35,7 @@
 ** Includes
 */
 #include "cfe_es_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -446,6 +447,16 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
         return (CFE_ES_ERR_RESOURCEID_NOT_VALID);
     }
 
+    /*
+     * A mutex-protected pool first hands out a block from the
+     * cache of the calling task, which does not need the mutex.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && CFE_ES_PoolCacheGet(PoolRecPtr, &DataOffset, Size))
+    {
+        *BufPtr = CFE_ES_MEMPOOLBUF_C(PoolRecPtr->BaseAddr + DataOffset);
+        return (int32)Size;
+    }
+
     /*
      * Real work begins here.
      * If pool is mutex-protected, take the mutex now.
@@ -576,6 +587,17 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         return (CFE_ES_ERR_RESOURCEID_NOT_VALID);
     }
 
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
+    /*
+     * A block of a mutex-protected pool is kept in the
+     * cache of the calling task if there is room.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && CFE_ES_PoolCachePut(PoolRecPtr, &DataSize, DataOffset))
+    {
+        return (int32)DataSize;
+    }
+
     /*
      * Real work begins here.
      * If pool is mutex-protected, take the mutex now.
@@ -585,8 +607,6 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         OS_MutSemTake(PoolRecPtr->MutexId);
     }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
-
     /*
      * Fundamental work is done as a generic routine.
      *
@@ -677,6 +697,12 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
      */
     CFE_ES_GenPoolGetCounts(&PoolRecPtr->Pool, &NumBuckets, &BufPtr->NumBlocksRequested, &BufPtr->CheckErrCtr);
 
+    /*
+     * Blocks in task caches are counted as allocated by the pool
+     */
+    BufPtr->NumCachedBlocks = CFE_ATOMIC_LOAD_RELAXED(&PoolRecPtr->CachedBlocks);
+    BufPtr->CacheHitCount   = CFE_ATOMIC_LOAD_RELAXED(&PoolRecPtr->CacheHitCount);
+
     for (Idx = 0; Idx < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++Idx)
     {
         CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BufPtr->BlockStats[Idx]);
@@ -699,6 +725,241 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PoolCacheReleaseEntry
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Return a block held in a task cache to its pool
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolCacheReleaseEntry(const CFE_ES_PoolCacheEntry_t *EntryPtr)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    size_t                  DataSize;
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(EntryPtr->PoolID);
+
+    /* Blocks of a pool that was deleted are dropped */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, EntryPtr->PoolID))
+    {
+        return;
+    }
+
+    /* Mark the block allocated again so the pool accepts it */
+    CFE_ES_MemPoolDirectRetrieve(&PoolRecPtr->Pool, EntryPtr->DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE,
+                                 &BdPtr);
+    BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED + EntryPtr->BucketId;
+
+    OS_MutSemTake(PoolRecPtr->MutexId);
+    CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, EntryPtr->DataOffset);
+    OS_MutSemGive(PoolRecPtr->MutexId);
+
+    CFE_ATOMIC_SUB(&PoolRecPtr->CachedBlocks, 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PoolCacheRelease
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Return all blocks of a task cache to their pools.  The cache
+ * must be owned by the caller or marked busy.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolCacheRelease(CFE_ES_PoolTaskCache_t *CachePtr)
+{
+    uint32 i;
+
+    for (i = 0; i < CachePtr->NumEntries; ++i)
+    {
+        CFE_ES_PoolCacheReleaseEntry(&CachePtr->Entry[i]);
+    }
+
+    CachePtr->NumEntries = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GetPoolTaskCache
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_PoolTaskCache_t *CFE_ES_GetPoolTaskCache(void)
+{
+    CFE_ES_PoolTaskCache_t *CachePtr;
+    osal_id_t               OsalId;
+    uint32                  Idx;
+    uint32                  Owner;
+
+    if (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH == 0)
+    {
+        return NULL;
+    }
+
+    OsalId = OS_TaskGetId();
+    if (CFE_ES_TaskID_ToIndex(CFE_ES_TaskId_FromOSAL(OsalId), &Idx) != CFE_SUCCESS || Idx >= OS_MAX_TASKS)
+    {
+        return NULL;
+    }
+
+    CachePtr = &CFE_ES_Global.PoolTaskCache[Idx];
+    Owner    = CFE_ATOMIC_LOAD(&CachePtr->OwnerTask);
+
+    if (Owner != OS_ObjectIdToInteger(OsalId))
+    {
+        /* The cache of a deleted task may be in the middle of being returned to the pools */
+        if (Owner == CFE_ES_POOL_TASK_CACHE_BUSY ||
+            !CFE_ATOMIC_CAS(&CachePtr->OwnerTask, &Owner, CFE_ES_POOL_TASK_CACHE_BUSY))
+        {
+            return NULL;
+        }
+
+        /* Blocks left by the previous task with this index go back to their pools */
+        CFE_ES_PoolCacheRelease(CachePtr);
+        CFE_ATOMIC_STORE(&CachePtr->OwnerTask, OS_ObjectIdToInteger(OsalId));
+    }
+
+    return CachePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PoolCacheGet
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PoolCacheGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size)
+{
+    CFE_ES_PoolTaskCache_t * CachePtr;
+    CFE_ES_PoolCacheEntry_t *EntryPtr;
+    CFE_ES_GenPoolBD_t *     BdPtr;
+    uint16                   BucketId;
+    uint32                   i;
+
+    CachePtr = CFE_ES_GetPoolTaskCache();
+    if (CachePtr == NULL)
+    {
+        return false;
+    }
+
+    /* The pool buckets do not change after the pool is created */
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+
+    /* Look for the most recently cached block first */
+    for (i = CachePtr->NumEntries; i > 0; --i)
+    {
+        EntryPtr = &CachePtr->Entry[i - 1];
+        if (EntryPtr->BucketId == BucketId && CFE_RESOURCEID_TEST_EQUAL(EntryPtr->PoolID, PoolRecPtr->PoolID))
+        {
+            CFE_ES_MemPoolDirectRetrieve(&PoolRecPtr->Pool, EntryPtr->DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE,
+                                         &BdPtr);
+            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId;
+            BdPtr->ActualSize = Size;
+            *DataOffsetPtr    = EntryPtr->DataOffset;
+
+            /* Keep the remaining entries in the order they were cached */
+            --CachePtr->NumEntries;
+            memmove(EntryPtr, EntryPtr + 1, (CachePtr->NumEntries - (i - 1)) * sizeof(*EntryPtr));
+
+            CFE_ATOMIC_SUB(&PoolRecPtr->CachedBlocks, 1);
+            CFE_ATOMIC_INCR(&PoolRecPtr->CacheHitCount);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PoolCachePut
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PoolCachePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset)
+{
+    CFE_ES_PoolTaskCache_t * CachePtr;
+    CFE_ES_PoolCacheEntry_t *EntryPtr;
+    CFE_ES_GenPoolBD_t *     BdPtr;
+
+    CachePtr = CFE_ES_GetPoolTaskCache();
+    if (CachePtr == NULL)
+    {
+        return false;
+    }
+
+    /*
+     * The block belongs to the caller, so its descriptor can be checked
+     * without the mutex.  Invalid blocks are left for the pool to reject.
+     */
+    if (CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, DataSizePtr, DataOffset) != CFE_SUCCESS)
+    {
+        return false;
+    }
+
+    /* Make room by returning the oldest block to its pool */
+    if (CachePtr->NumEntries >= CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH)
+    {
+        CFE_ES_PoolCacheReleaseEntry(&CachePtr->Entry[0]);
+        --CachePtr->NumEntries;
+        memmove(&CachePtr->Entry[0], &CachePtr->Entry[1], CachePtr->NumEntries * sizeof(CachePtr->Entry[0]));
+    }
+
+    CFE_ES_MemPoolDirectRetrieve(&PoolRecPtr->Pool, DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+
+    EntryPtr             = &CachePtr->Entry[CachePtr->NumEntries];
+    EntryPtr->PoolID     = PoolRecPtr->PoolID;
+    EntryPtr->BucketId   = BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED;
+    EntryPtr->DataOffset = DataOffset;
+    ++CachePtr->NumEntries;
+
+    /* Further puts or size requests of the block fail until it is handed out again */
+    BdPtr->Allocated = CFE_ES_MEMORY_CACHED + EntryPtr->BucketId;
+
+    CFE_ATOMIC_INCR(&PoolRecPtr->CachedBlocks);
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_FlushPoolTaskCache
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_FlushPoolTaskCache(CFE_ES_TaskId_t TaskId)
+{
+    CFE_ES_PoolTaskCache_t *CachePtr;
+    uint32                  Idx;
+    uint32                  Owner;
+
+    if (CFE_ES_TaskID_ToIndex(TaskId, &Idx) != CFE_SUCCESS || Idx >= OS_MAX_TASKS)
+    {
+        return;
+    }
+
+    CachePtr = &CFE_ES_Global.PoolTaskCache[Idx];
+    Owner    = OS_ObjectIdToInteger(CFE_ES_TaskId_ToOSAL(TaskId));
+
+    /* If another task already claimed the cache, it has returned the blocks */
+    if (CFE_ATOMIC_CAS(&CachePtr->OwnerTask, &Owner, CFE_ES_POOL_TASK_CACHE_BUSY))
+    {
+        CFE_ES_PoolCacheRelease(CachePtr);
+        CFE_ATOMIC_STORE(&CachePtr->OwnerTask, 0);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_ValidateHandle
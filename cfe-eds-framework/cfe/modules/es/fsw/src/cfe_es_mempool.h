@@ -37,6 +37,52 @@
 #include "cfe_resourceid.h"
 #include "cfe_es_generic_pool.h"
 
+/*
+ * Number of entries in a task pool cache, at least one so the
+ * array is valid when the caches are disabled
+ */
+#define CFE_ES_POOL_TASK_CACHE_SLOTS \
+    (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH > 0 ? CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH : 1)
+
+/*
+ * Allocation state of a block held in a task pool cache, stored in the block
+ * descriptor with the bucket ID added like the allocated and deallocated states.
+ * A cached block is neither, so putting it again or asking for its size fails.
+ */
+#define CFE_ES_MEMORY_CACHED ((uint16)0xcccc)
+
+/*
+ * Owner of a task pool cache while its blocks are returned to their pools
+ */
+#define CFE_ES_POOL_TASK_CACHE_BUSY 0xFFFFFFFF
+
+/*
+ * A block held in a task pool cache
+ */
+typedef struct
+{
+    CFE_ES_MemHandle_t PoolID;     /**< Pool the block belongs to */
+    uint16             BucketId;   /**< Bucket of the block in the pool */
+    size_t             DataOffset; /**< Offset of the block data in the pool */
+} CFE_ES_PoolCacheEntry_t;
+
+/*
+ * Per-task cache of memory pool blocks
+ *
+ * Blocks of mutex protected pools that a task puts back are kept here, and
+ * are handed out again on the next get of the same pool and bucket without
+ * taking the pool mutex.  Only the owning task uses the entries.  The owner
+ * is the OSAL task ID, changed with compare and swap so the cache of a task
+ * that was deleted is returned to the pools only once, either by ES when the
+ * task resources are cleaned up or by the next task given the same index.
+ */
+typedef struct
+{
+    uint32                  OwnerTask;  /**< OSAL task ID of the owner, 0 if none */
+    uint32                  NumEntries; /**< Number of blocks in the cache */
+    CFE_ES_PoolCacheEntry_t Entry[CFE_ES_POOL_TASK_CACHE_SLOTS];
+} CFE_ES_PoolTaskCache_t;
+
 typedef struct
 {
     /*
@@ -71,6 +117,13 @@ typedef struct
      * Optional Mutex for serializing get/put operations
      */
     osal_id_t MutexId;
+
+    /**
+     * Blocks of this pool held in task caches, and blocks handed out from them.
+     * Updated atomically by the tasks using the pool.
+     */
+    uint32 CachedBlocks;
+    uint32 CacheHitCount;
 } CFE_ES_MemPoolRecord_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -243,4 +296,72 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return a block held in a task pool cache to its pool
+ *
+ * Blocks of pools that were deleted are dropped.
+ *
+ * @param[in]   EntryPtr     the cache entry of the block
+ */
+void CFE_ES_PoolCacheReleaseEntry(const CFE_ES_PoolCacheEntry_t *EntryPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return all blocks of a task pool cache to their pools
+ *
+ * The caller must own the cache, or have marked it busy.
+ *
+ * @param[inout] CachePtr    the cache to empty
+ */
+void CFE_ES_PoolCacheRelease(CFE_ES_PoolTaskCache_t *CachePtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the pool cache of the calling task
+ *
+ * Claims the cache for the calling task if it last belonged to another task,
+ * returning the blocks that task left to their pools.
+ *
+ * @returns pointer to the cache, or NULL if the caller is not a task or the
+ * cache is being returned to the pools by another task
+ */
+CFE_ES_PoolTaskCache_t *CFE_ES_GetPoolTaskCache(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get a block from the pool cache of the calling task
+ *
+ * @param[inout] PoolRecPtr    pointer to Pool table entry
+ * @param[out]   DataOffsetPtr offset of the block, if one was found
+ * @param[in]    Size          requested size
+ * @returns true if a cached block was handed out
+ */
+bool CFE_ES_PoolCacheGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a block into the pool cache of the calling task
+ *
+ * The block is validated in the same way as a put to the pool.  Invalid
+ * blocks are left for the pool to reject and count.
+ *
+ * @param[inout] PoolRecPtr    pointer to Pool table entry
+ * @param[out]   DataSizePtr   size of the block as it was requested
+ * @param[in]    DataOffset    offset of the block
+ * @returns true if the block was cached
+ */
+bool CFE_ES_PoolCachePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return the blocks in the pool cache of a task to their pools
+ *
+ * Used when the task is deleted.  Nothing is done if the cache has already
+ * been claimed by another task.
+ *
+ * @param[in]   TaskId       ID of the deleted task
+ */
+void CFE_ES_FlushPoolTaskCache(CFE_ES_TaskId_t TaskId);
+
 #endif /* CFE_ES_MEMPOOL_H */
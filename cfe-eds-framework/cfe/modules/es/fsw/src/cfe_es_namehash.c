@@ -0,0 +1,217 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File:
+**  cfe_es_namehash.c
+**
+**  Purpose:
+**  Name hash indexes for looking up ES table entries by name.
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+**
+*/
+
+/*
+** Includes
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+
+/*
+** Defines
+*/
+#define CFE_ES_NAMEHASH_FNV_OFFSET 2166136261U
+#define CFE_ES_NAMEHASH_FNV_PRIME  16777619U
+
+/*****************************************************************************/
+/*
+** Functions
+*/
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NameHashCompute
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_NameHashCompute(const char *Name)
+{
+    uint32 Hash = CFE_ES_NAMEHASH_FNV_OFFSET;
+
+    /* FNV-1a */
+    while (*Name != 0)
+    {
+        Hash ^= (uint8)*Name;
+        Hash *= CFE_ES_NAMEHASH_FNV_PRIME;
+        ++Name;
+    }
+
+    /* 0 marks entries that are not in an index */
+    if (Hash == 0)
+    {
+        Hash = 1;
+    }
+
+    return Hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NameHashAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_NameHashAdd(const CFE_ES_NameHash_t *Index, uint32 EntryIdx, const char *Name)
+{
+    uint32 Hash;
+    uint32 SlotPos;
+
+    CFE_ES_NameHashRemove(Index, EntryIdx);
+
+    Hash                      = CFE_ES_NameHashCompute(Name);
+    Index->EntryHash[EntryIdx] = Hash;
+
+    /* There are more slots than entries, so there is always an empty one */
+    SlotPos = Hash % Index->NumSlots;
+    while (Index->Slots[SlotPos] != 0)
+    {
+        SlotPos = (SlotPos + 1) % Index->NumSlots;
+    }
+
+    Index->Slots[SlotPos] = EntryIdx + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NameHashRemove
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_NameHashRemove(const CFE_ES_NameHash_t *Index, uint32 EntryIdx)
+{
+    uint32 Hole;
+    uint32 SlotPos;
+    uint32 HomePos;
+
+    if (Index->EntryHash[EntryIdx] == 0)
+    {
+        return;
+    }
+
+    Hole = Index->EntryHash[EntryIdx] % Index->NumSlots;
+    while (Index->Slots[Hole] != EntryIdx + 1)
+    {
+        Hole = (Hole + 1) % Index->NumSlots;
+    }
+
+    Index->EntryHash[EntryIdx] = 0;
+
+    /*
+     * Move later entries of the same probe run back into the hole,
+     * unless that would put them before their home slot.
+     */
+    SlotPos = (Hole + 1) % Index->NumSlots;
+    while (Index->Slots[SlotPos] != 0)
+    {
+        HomePos = Index->EntryHash[Index->Slots[SlotPos] - 1] % Index->NumSlots;
+        if ((SlotPos > Hole && (HomePos <= Hole || HomePos > SlotPos)) ||
+            (SlotPos < Hole && HomePos <= Hole && HomePos > SlotPos))
+        {
+            Index->Slots[Hole] = Index->Slots[SlotPos];
+            Hole               = SlotPos;
+        }
+        SlotPos = (SlotPos + 1) % Index->NumSlots;
+    }
+
+    Index->Slots[Hole] = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NameHashClear
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_NameHashClear(const CFE_ES_NameHash_t *Index)
+{
+    memset(Index->Slots, 0, Index->NumSlots * sizeof(Index->Slots[0]));
+    memset(Index->EntryHash, 0, Index->NumEntries * sizeof(Index->EntryHash[0]));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NameHashIterInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_NameHashIterInit(const CFE_ES_NameHash_t *Index, CFE_ES_NameHashIter_t *Iter, const char *Name)
+{
+    Iter->Hash      = CFE_ES_NameHashCompute(Name);
+    Iter->SlotPos   = Iter->Hash % Index->NumSlots;
+    Iter->SlotCount = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NameHashIterNext
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_NameHashIterNext(const CFE_ES_NameHash_t *Index, CFE_ES_NameHashIter_t *Iter, uint32 *EntryIdx)
+{
+    uint32 SlotEntry;
+
+    while (Iter->SlotCount < Index->NumSlots)
+    {
+        SlotEntry = Index->Slots[Iter->SlotPos];
+        if (SlotEntry == 0)
+        {
+            /* End of the probe run, no more entries with this hash */
+            break;
+        }
+
+        Iter->SlotPos = (Iter->SlotPos + 1) % Index->NumSlots;
+        ++Iter->SlotCount;
+
+        if (Index->EntryHash[SlotEntry - 1] == Iter->Hash)
+        {
+            *EntryIdx = SlotEntry - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
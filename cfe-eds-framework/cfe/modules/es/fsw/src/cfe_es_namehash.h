@@ -0,0 +1,172 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ *  Purpose:
+ *  This file contains the Internal interface for the name hash indexes
+ *  used to look up ES table entries by name.
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *     cFE Flight Software Application Developers Guide
+ *
+ *  Notes:
+ *  An index maps the name of each used entry of a fixed size table to the
+ *  position of the entry, using linear probing in twice as many slots as the
+ *  table has entries.  The index only narrows the search, callers still
+ *  compare the name of every entry it returns.  Tables may have at most
+ *  65535 entries.
+ *
+ */
+
+#ifndef CFE_ES_NAMEHASH_H
+#define CFE_ES_NAMEHASH_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Macro Definitions
+*/
+
+/*
+ * Number of slots in the index of a table with the given number of entries
+ */
+#define CFE_ES_NAMEHASH_SLOTS(MaxEntries) (2 * (MaxEntries))
+
+/*
+ * Declares the storage of the index of a table with the given number
+ * of entries.  All zero is an empty index.
+ */
+#define CFE_ES_NAMEHASH_STORAGE(MaxEntries)                  \
+    struct                                                  \
+    {                                                       \
+        uint16 Slots[CFE_ES_NAMEHASH_SLOTS(MaxEntries)];   \
+        uint32 EntryHash[MaxEntries];                       \
+    }
+
+/*
+ * Initializer of a CFE_ES_NameHash_t for storage declared with
+ * CFE_ES_NAMEHASH_STORAGE()
+ */
+#define CFE_ES_NAMEHASH_INIT(Storage, MaxEntries)                                         \
+    {                                                                                     \
+        (Storage).Slots, (Storage).EntryHash, CFE_ES_NAMEHASH_SLOTS(MaxEntries), MaxEntries \
+    }
+
+/*
+** Type Definitions
+*/
+
+/**
+ * Describes the storage of one name hash index
+ */
+typedef struct
+{
+    uint16 *Slots;      /**< Table position of an entry plus one, or 0 if the slot is empty */
+    uint32 *EntryHash;  /**< Name hash of each table entry in the index, or 0 if not in the index */
+    uint32  NumSlots;   /**< Number of slots */
+    uint32  NumEntries; /**< Number of table entries */
+} CFE_ES_NameHash_t;
+
+/**
+ * State of a search of a name hash index
+ */
+typedef struct
+{
+    uint32 Hash;      /**< Hash of the name searched for */
+    uint32 SlotPos;   /**< Next slot to check */
+    uint32 SlotCount; /**< Number of slots checked */
+} CFE_ES_NameHashIter_t;
+
+/*****************************************************************************/
+/*
+** Function prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Compute the hash of a name
+ *
+ * \param[in]   Name    Null terminated name
+ *
+ * \return Hash of the name, never 0
+ */
+uint32 CFE_ES_NameHashCompute(const char *Name);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add a table entry to a name hash index
+ *
+ * If the entry is already in the index, it is first removed, so this
+ * can also be used when the name of an entry changes.
+ *
+ * \param[in]   Index       Index to update
+ * \param[in]   EntryIdx    Table position of the entry
+ * \param[in]   Name        Name of the entry
+ */
+void CFE_ES_NameHashAdd(const CFE_ES_NameHash_t *Index, uint32 EntryIdx, const char *Name);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Remove a table entry from a name hash index
+ *
+ * Nothing is done if the entry is not in the index.
+ *
+ * \param[in]   Index       Index to update
+ * \param[in]   EntryIdx    Table position of the entry
+ */
+void CFE_ES_NameHashRemove(const CFE_ES_NameHash_t *Index, uint32 EntryIdx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Remove all entries from a name hash index
+ *
+ * \param[in]   Index       Index to clear
+ */
+void CFE_ES_NameHashClear(const CFE_ES_NameHash_t *Index);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Start a search of a name hash index
+ *
+ * \param[in]   Index       Index to search
+ * \param[out]  Iter        Search state
+ * \param[in]   Name        Name to search for
+ */
+void CFE_ES_NameHashIterInit(const CFE_ES_NameHash_t *Index, CFE_ES_NameHashIter_t *Iter, const char *Name);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the next table entry whose name has the hash searched for
+ *
+ * \param[in]     Index       Index to search
+ * \param[inout]  Iter        Search state
+ * \param[out]    EntryIdx    Table position of the entry
+ *
+ * \return true if an entry was found, false if there are no more
+ */
+bool CFE_ES_NameHashIterNext(const CFE_ES_NameHash_t *Index, CFE_ES_NameHashIter_t *Iter, uint32 *EntryIdx);
+
+#endif /* CFE_ES_NAMEHASH_H */
@@ -30,9 +30,22 @@
 ** Include Section
 */
 #include "cfe_es_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include <string.h>
 
+/*
+** Index of an entry within a performance data ring
+*/
+#define CFE_ES_PERF_RING_SLOT(Count) ((Count) & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1))
+
+/*
+** True if entry A was logged before entry B
+*/
+#define CFE_ES_PERF_ENTRY_IS_BEFORE(A, B) \
+    ((A)->TimerUpper32 < (B)->TimerUpper32 ||  \
+     ((A)->TimerUpper32 == (B)->TimerUpper32 && (A)->TimerLower32 < (B)->TimerLower32))
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_SetupPerfVariables
@@ -119,7 +132,13 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
      * may change even between checking the state and checking the value.
      * This shouldn't be a big deal, as the result should still be meaningful
      * for a progress report, and the actual 32-bit counters should be atomic */
-    if (CurrentState > CFE_ES_PerfDumpState_IDLE && CurrentState < CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES)
+    if (CurrentState > CFE_ES_PerfDumpState_IDLE && CurrentState < CFE_ES_PerfDumpState_WRITE_FS_HDR)
+    {
+        /* dump is requested but the task rings are not yet merged,
+         * report the entire data count from the rings */
+        Result = CFE_ES_GetPerfLogDataCount();
+    }
+    else if (CurrentState < CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES)
     {
         /* dump is requested but not yet to entry writing state,
          * report the entire data count from perf log */
@@ -140,6 +159,42 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     return Result;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GetPerfLogDataCount
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_GetPerfLogDataCount(void)
+{
+    CFE_ES_PerfTaskRing_t *Ring;
+    uint32                 RingCount;
+    uint32                 Result;
+    uint32                 i;
+
+    Result = 0;
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        Ring      = &CFE_ES_Global.PerfTaskRing[i];
+        RingCount = CFE_ATOMIC_LOAD(&Ring->WriteCount) - Ring->ReadBase;
+        if (RingCount > CFE_PLATFORM_ES_PERF_TASK_RING_SIZE)
+        {
+            RingCount = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE;
+        }
+
+        Result += RingCount;
+    }
+
+    if (Result > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        Result = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    }
+
+    return Result;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_StartPerfDataCmd
@@ -153,6 +208,8 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
     const CFE_ES_StartPerfCmd_Payload_t *CmdPtr        = &data->Payload;
     CFE_ES_PerfDumpGlobal_t *            PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
     CFE_ES_PerfData_t *                  Perf;
+    CFE_ES_PerfTaskRing_t *              Ring;
+    uint32                               i;
 
     /*
     ** Set the pointer to the data area
@@ -179,7 +236,18 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+
+            /* Entries that are already in the task rings are not part of this collection */
+            for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+            {
+                Ring           = &CFE_ES_Global.PerfTaskRing[i];
+                Ring->ReadBase = CFE_ATOMIC_LOAD(&Ring->WriteCount);
+            }
+
+            /* A new trigger position is taken by each ring once this collection is triggered */
+            CFE_ATOMIC_STORE_RELAXED(&CFE_ES_Global.PerfStartCount, CFE_ES_Global.PerfStartCount + 1);
+
+            CFE_ATOMIC_STORE(&Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER); /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -248,7 +316,7 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID, CFE_EVS_EventType_DEBUG,
                               "Perf Stop Cmd Rcvd, will write %d entries.%dmS dly every %d entries",
-                              (int)Perf->MetaData.DataCount, (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                              (int)CFE_ES_GetPerfLogDataCount(), (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
                               (int)CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS);
         }
         else
@@ -270,6 +338,52 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartPerfStreamCmd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartPerfStreamCmd(const CFE_ES_StartPerfStreamCmd_t *data)
+{
+    CFE_ES_PerfStreamGlobal_t *PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
+
+    /* A stream that is already running continues with its counters */
+    CFE_ATOMIC_STORE(&PerfStreamState->RequestedEnable, true);
+    CFE_ES_BackgroundWakeup();
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_START_EID, CFE_EVS_EventType_DEBUG,
+                      "Start streaming performance data cmd received, %d entries per packet",
+                      (int)CFE_MISSION_ES_PERF_STREAM_MAX_ENTRIES);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StopPerfStreamCmd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StopPerfStreamCmd(const CFE_ES_StopPerfStreamCmd_t *data)
+{
+    CFE_ES_PerfStreamGlobal_t *PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
+
+    CFE_ATOMIC_STORE(&PerfStreamState->RequestedEnable, false);
+    CFE_ES_BackgroundWakeup();
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_STOP_EID, CFE_EVS_EventType_DEBUG,
+                      "Stop streaming performance data cmd received");
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_RunPerfLogDump
@@ -358,6 +472,10 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
                     break;
 
+                case CFE_ES_PerfDumpState_MERGE_ENTRIES:
+                    State->StateCounter = CFE_ES_PerfLogMergeInit(State);
+                    break;
+
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
                 case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
                     State->StateCounter = 1;
@@ -437,6 +555,10 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
             BlockSize = 0;
             switch (State->CurrentState)
             {
+                case CFE_ES_PerfDumpState_MERGE_ENTRIES:
+                    CFE_ES_PerfLogMergeNext(State);
+                    break;
+
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
                     /* Zero cFE header, then fill in fields */
                     CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
@@ -499,6 +621,376 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     return (State->CurrentState != CFE_ES_PerfDumpState_IDLE);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_RunPerfLogStream
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Arg;
+    CFE_ES_PerfTaskRing_t *    Ring;
+    bool                       RequestedEnable;
+    uint32                     PacketCount;
+    uint32                     i;
+
+    RequestedEnable = CFE_ATOMIC_LOAD(&State->RequestedEnable);
+    if (RequestedEnable != State->Enabled)
+    {
+        if (RequestedEnable)
+        {
+            CFE_ES_PerfLogStreamInit(State);
+        }
+        else if (State->TlmPkt.Payload.EntryCount > 0)
+        {
+            /* Send what is left, so the last entries before the stop are not lost */
+            CFE_ES_PerfLogStreamSend(State);
+        }
+
+        State->Enabled = RequestedEnable;
+    }
+
+    if (!State->Enabled)
+    {
+        return false;
+    }
+
+    if (State->TlmPkt.Payload.EntryCount > 0)
+    {
+        State->PendingTime += ElapsedTime;
+    }
+
+    /*
+     * Take the range of entries of each ring that tasks have added since
+     * the last run.  If a task has lapped the stream, its entries from
+     * before the oldest one still in its ring are lost.
+     */
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        Ring                = &CFE_ES_Global.PerfTaskRing[i];
+        State->StreamEnd[i] = CFE_ATOMIC_LOAD(&Ring->WriteCount);
+
+        if ((State->StreamEnd[i] - State->StreamPos[i]) >= CFE_PLATFORM_ES_PERF_TASK_RING_SIZE)
+        {
+            State->TlmPkt.Payload.LostEntryCount +=
+                State->StreamEnd[i] - State->StreamPos[i] - CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1;
+            State->StreamPos[i] = State->StreamEnd[i] - CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1;
+        }
+    }
+
+    /*
+     * Send full packets up to the limit for one run.  Anything beyond
+     * that stays in the rings, where tasks may overwrite it if the stream
+     * does not catch up.
+     */
+    for (PacketCount = 0; PacketCount < CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE; ++PacketCount)
+    {
+        CFE_ES_PerfLogStreamFill(State);
+
+        if (State->TlmPkt.Payload.EntryCount < CFE_MISSION_ES_PERF_STREAM_MAX_ENTRIES &&
+            (State->TlmPkt.Payload.EntryCount == 0 || State->PendingTime < CFE_PLATFORM_ES_PERF_STREAM_FLUSH_DELAY))
+        {
+            break;
+        }
+
+        CFE_ES_PerfLogStreamSend(State);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogMergeInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfLogMergeInit(CFE_ES_PerfDumpGlobal_t *State)
+{
+    CFE_ES_PerfTaskRing_t *       Ring;
+    const CFE_ES_PerfDataEntry_t *Oldest;
+    const CFE_ES_PerfDataEntry_t *EntryPtr;
+    CFE_ES_PerfData_t *           Perf;
+    uint32                        Total;
+    uint32                        i;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /*
+     * Take the range of entries of each ring.  Where a ring has
+     * wrapped, its oldest entry is the earliest point from which
+     * every task's entries are all still available.  The oldest slot
+     * of a full ring is the next one its task writes, so it is not used.
+     */
+    Oldest = NULL;
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        Ring               = &CFE_ES_Global.PerfTaskRing[i];
+        State->MergeEnd[i] = CFE_ATOMIC_LOAD(&Ring->WriteCount);
+        State->MergePos[i] = Ring->ReadBase;
+
+        if ((State->MergeEnd[i] - State->MergePos[i]) >= CFE_PLATFORM_ES_PERF_TASK_RING_SIZE)
+        {
+            State->MergePos[i] = State->MergeEnd[i] - CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1;
+            EntryPtr           = &Ring->Entry[CFE_ES_PERF_RING_SLOT(State->MergePos[i])];
+            if (Oldest == NULL || CFE_ES_PERF_ENTRY_IS_BEFORE(Oldest, EntryPtr))
+            {
+                Oldest = EntryPtr;
+            }
+        }
+    }
+
+    /* Entries of a task are in time order, drop those before that point */
+    Total = 0;
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        Ring = &CFE_ES_Global.PerfTaskRing[i];
+        while (Oldest != NULL && State->MergePos[i] != State->MergeEnd[i] &&
+               CFE_ES_PERF_ENTRY_IS_BEFORE(&Ring->Entry[CFE_ES_PERF_RING_SLOT(State->MergePos[i])], Oldest))
+        {
+            ++State->MergePos[i];
+        }
+
+        Total += State->MergeEnd[i] - State->MergePos[i];
+    }
+
+    /*
+     * As with the old single buffer, keep the newest entries if there
+     * are more than fit.  If the rings are empty keep the Perf Log as it
+     * is, it may hold data from before a processor reset.
+     */
+    if (Total > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        State->MergeSkip = Total - CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    }
+    else
+    {
+        State->MergeSkip = 0;
+    }
+
+    if (Total > 0)
+    {
+        Perf->MetaData.DataStart = 0;
+        Perf->MetaData.DataEnd   = 0;
+        Perf->MetaData.DataCount = 0;
+    }
+
+    return Total;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogMergeNext
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogMergeNext(CFE_ES_PerfDumpGlobal_t *State)
+{
+    CFE_ES_PerfDataEntry_t EntryData;
+    CFE_ES_PerfData_t *    Perf;
+    uint32                 OldestIdx;
+    bool                   IsValid;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /* Find the ring with the oldest entry not yet merged */
+    OldestIdx = CFE_ES_PerfRingFindOldest(State->MergePos, State->MergeEnd);
+    if (OldestIdx >= CFE_ES_PERF_TASK_RING_COUNT)
+    {
+        return;
+    }
+
+    /*
+     * A task that passed the state check just before data collection
+     * stopped may still be adding to its ring.  If it has come around
+     * to this slot the entry may be partly overwritten, so drop it.
+     */
+    IsValid = CFE_ES_PerfRingRead(&CFE_ES_Global.PerfTaskRing[OldestIdx], State->MergePos[OldestIdx], &EntryData);
+    ++State->MergePos[OldestIdx];
+    if (!IsValid)
+    {
+        return;
+    }
+
+    if (State->MergeSkip > 0)
+    {
+        --State->MergeSkip;
+    }
+    else if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        Perf->DataBuffer[Perf->MetaData.DataCount] = EntryData;
+        ++Perf->MetaData.DataCount;
+        Perf->MetaData.DataEnd = Perf->MetaData.DataCount;
+        if (Perf->MetaData.DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        {
+            Perf->MetaData.DataEnd = 0;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfRingFindOldest
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfRingFindOldest(const uint32 *Pos, const uint32 *End)
+{
+    const CFE_ES_PerfDataEntry_t *EntryPtr;
+    const CFE_ES_PerfDataEntry_t *OldestPtr;
+    uint32                        OldestIdx;
+    uint32                        i;
+
+    OldestPtr = NULL;
+    OldestIdx = CFE_ES_PERF_TASK_RING_COUNT;
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        if (Pos[i] != End[i])
+        {
+            EntryPtr = &CFE_ES_Global.PerfTaskRing[i].Entry[CFE_ES_PERF_RING_SLOT(Pos[i])];
+            if (OldestPtr == NULL || CFE_ES_PERF_ENTRY_IS_BEFORE(EntryPtr, OldestPtr))
+            {
+                OldestPtr = EntryPtr;
+                OldestIdx = i;
+            }
+        }
+    }
+
+    return OldestIdx;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfRingRead
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfRingRead(const CFE_ES_PerfTaskRing_t *Ring, uint32 Pos, CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    const CFE_ES_PerfDataEntry_t *SlotPtr;
+
+    SlotPtr                = &Ring->Entry[CFE_ES_PERF_RING_SLOT(Pos)];
+    EntryPtr->Data         = CFE_ATOMIC_LOAD_RELAXED(&SlotPtr->Data);
+    EntryPtr->TimerUpper32 = CFE_ATOMIC_LOAD_RELAXED(&SlotPtr->TimerUpper32);
+    EntryPtr->TimerLower32 = CFE_ATOMIC_LOAD_RELAXED(&SlotPtr->TimerLower32);
+
+    /* The copy must be complete before the count is checked */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    return ((CFE_ATOMIC_LOAD(&Ring->WriteCount) - Pos) < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogStreamInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogStreamInit(CFE_ES_PerfStreamGlobal_t *State)
+{
+    uint32 i;
+
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        State->StreamPos[i] = CFE_ATOMIC_LOAD(&CFE_ES_Global.PerfTaskRing[i].WriteCount);
+        State->StreamEnd[i] = State->StreamPos[i];
+    }
+
+    State->PendingTime = 0;
+
+    memset(&State->TlmPkt, 0, sizeof(State->TlmPkt));
+    CFE_MSG_Init(CFE_MSG_PTR(State->TlmPkt.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_ES_PERF_STREAM_TLM_MID),
+                 sizeof(State->TlmPkt));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogStreamFill
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogStreamFill(CFE_ES_PerfStreamGlobal_t *State)
+{
+    CFE_ES_PerfStreamTlm_Payload_t *Payload = &State->TlmPkt.Payload;
+    CFE_ES_PerfDataEntry_t          EntryData;
+    CFE_ES_PerfStreamEntry_t *      StreamEntry;
+    uint32                          OldestIdx;
+
+    while (Payload->EntryCount < CFE_MISSION_ES_PERF_STREAM_MAX_ENTRIES)
+    {
+        OldestIdx = CFE_ES_PerfRingFindOldest(State->StreamPos, State->StreamEnd);
+        if (OldestIdx >= CFE_ES_PERF_TASK_RING_COUNT)
+        {
+            break;
+        }
+
+        if (CFE_ES_PerfRingRead(&CFE_ES_Global.PerfTaskRing[OldestIdx], State->StreamPos[OldestIdx], &EntryData))
+        {
+            StreamEntry               = &Payload->Entries[Payload->EntryCount];
+            StreamEntry->Data         = EntryData.Data;
+            StreamEntry->TimerUpper32 = EntryData.TimerUpper32;
+            StreamEntry->TimerLower32 = EntryData.TimerLower32;
+            ++Payload->EntryCount;
+        }
+        else
+        {
+            ++Payload->LostEntryCount;
+        }
+
+        ++State->StreamPos[OldestIdx];
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogStreamSend
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogStreamSend(CFE_ES_PerfStreamGlobal_t *State)
+{
+    CFE_ES_PerfStreamTlm_Payload_t *Payload = &State->TlmPkt.Payload;
+    CFE_Status_t                    Status;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(State->TlmPkt.TelemetryHeader));
+    Status = CFE_SB_TransmitMsg(CFE_MSG_PTR(State->TlmPkt.TelemetryHeader), true);
+    if (Status == CFE_SUCCESS)
+    {
+        ++Payload->PacketCount;
+    }
+    else
+    {
+        ++Payload->SendErrorCount;
+    }
+
+    /* Unused entries of the next packet keep old data, EntryCount says how many are valid */
+    Payload->EntryCount = 0;
+    State->PendingTime  = 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_SetPerfFilterMaskCmd
@@ -581,6 +1073,88 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GetPerfTaskRingIndex
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_GetPerfTaskRingIndex(void)
+{
+    uint32 RingIdx;
+
+    if (CFE_ES_TaskID_ToIndex(CFE_ES_TaskId_FromOSAL(OS_TaskGetId()), &RingIdx) != CFE_SUCCESS ||
+        RingIdx >= OS_MAX_TASKS)
+    {
+        RingIdx = CFE_ES_PERF_SHARED_RING_IDX;
+    }
+
+    return RingIdx;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfRingWrite
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfRingWrite(CFE_ES_PerfTaskRing_t *Ring, const CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    CFE_ES_PerfDataEntry_t *SlotPtr;
+    uint32                  WriteCount;
+
+    /* Only the writer changes the count, so it does not need to be read atomically here */
+    WriteCount = Ring->WriteCount;
+    SlotPtr    = &Ring->Entry[CFE_ES_PERF_RING_SLOT(WriteCount)];
+
+    CFE_ATOMIC_STORE_RELAXED(&SlotPtr->Data, EntryPtr->Data);
+    CFE_ATOMIC_STORE_RELAXED(&SlotPtr->TimerUpper32, EntryPtr->TimerUpper32);
+    CFE_ATOMIC_STORE_RELAXED(&SlotPtr->TimerLower32, EntryPtr->TimerLower32);
+
+    /* Publish the entry to the merge */
+    CFE_ATOMIC_STORE(&Ring->WriteCount, WriteCount + 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfRingHasRoom
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfRingHasRoom(CFE_ES_PerfTaskRing_t *Ring)
+{
+    CFE_ES_PerfData_t *Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+    uint32             StartCount;
+
+    if (Perf->MetaData.Mode != CFE_ES_PERF_TRIGGER_START ||
+        CFE_ATOMIC_LOAD(&Perf->MetaData.State) != CFE_ES_PERF_TRIGGERED)
+    {
+        return true;
+    }
+
+    /* The first entry after the task sees the trigger is where its part of the log begins */
+    StartCount = CFE_ATOMIC_LOAD_RELAXED(&CFE_ES_Global.PerfStartCount);
+    if (Ring->TriggerStart != StartCount)
+    {
+        Ring->TriggerStart = StartCount;
+        Ring->TriggerBase  = Ring->WriteCount;
+    }
+
+    /*
+     * The merge leaves out the oldest slot of a full ring, and cuts the other
+     * rings at the oldest entry it keeps.  Stopping two short of the ring size
+     * keeps the last entry from before the trigger, so that cut is never
+     * after the trigger.
+     */
+    return (Ring->WriteCount - Ring->TriggerBase) < (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 2);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_PerfLogAdd
@@ -592,8 +1166,11 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
     CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
     CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfTaskRing_t *Ring;
+    uint32                 RingIdx;
+    uint32                 PerfState;
+    uint32                 TriggerCount;
 
     /*
     ** Set the pointer to the data area
@@ -624,7 +1201,7 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
     /*
      * check if this ID is filtered.
-     * This is also done outside the lock -
+     * This is also done without locking -
      * normally masks should NOT be changed while perf log is active / non-idle,
      * so although this is reading a global it should be constant, and this avoids
      * locking (and potential task switch) if the data is ultimately not going to
@@ -636,82 +1213,67 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     }
 
     /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
+     * prepare the entry data (timestamp) before it is added
      */
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
     CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
 
-    /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
-     */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
-
-    /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
-     */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
+    RingIdx = CFE_ES_GetPerfTaskRingIndex();
+    Ring    = &CFE_ES_Global.PerfTaskRing[RingIdx];
+    if (RingIdx != CFE_ES_PERF_SHARED_RING_IDX)
     {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
-
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        /* The calling task is the only writer of its own ring, no lock is needed */
+        if (CFE_ES_PerfRingHasRoom(Ring))
         {
-            DataEnd = 0;
+            CFE_ES_PerfRingWrite(Ring, &EntryData);
         }
-        Perf->MetaData.DataEnd = DataEnd;
+    }
+    else
+    {
+        /*
+         * Acquire the perflog mutex before writing into the shared ring.
+         * Note this lock is held for long periods while a background dump
+         * is taking place, but the dump should never be active at the
+         * same time that a capture/record is taking place.
+         */
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
 
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            Perf->MetaData.DataCount++;
-        }
-        else
+        /*
+         * Confirm that the global is still non-idle after lock
+         * (state could become idle while getting lock)
+         */
+        if (Perf->MetaData.State != CFE_ES_PERF_IDLE && CFE_ES_PerfRingHasRoom(Ring))
         {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+            CFE_ES_PerfRingWrite(Ring, &EntryData);
         }
 
-        /* waiting for trigger */
-        if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    }
+
+    /*
+     * waiting for trigger - only one task makes the transition,
+     * any other one sees the new state from the failed exchange
+     */
+    PerfState = CFE_ATOMIC_LOAD(&Perf->MetaData.State);
+    if (PerfState == CFE_ES_PERF_WAITING_FOR_TRIGGER && CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+    {
+        if (CFE_ATOMIC_CAS(&Perf->MetaData.State, &PerfState, CFE_ES_PERF_TRIGGERED))
         {
-            if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
-            {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-            }
+            PerfState = CFE_ES_PERF_TRIGGERED;
         }
+    }
 
-        /* triggered */
-        if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+    /* triggered */
+    if (PerfState == CFE_ES_PERF_TRIGGERED)
+    {
+        TriggerCount = CFE_ATOMIC_ADD(&Perf->MetaData.TriggerCount, 1);
+        if ((Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START &&
+             TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) ||
+            (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER &&
+             TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2) ||
+            Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)
         {
-            Perf->MetaData.TriggerCount++;
-            if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)
-            {
-                Perf->MetaData.State = CFE_ES_PERF_IDLE;
-            }
+            CFE_ATOMIC_STORE(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
         }
     }
-
-    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 }
@@ -38,11 +38,26 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_perfdata_typedef.h"
+#include "cfe_es_msg.h"
 
 /*
 **  Defines
 */
 
+/*
+ * Number of performance data rings
+ *
+ * There is one ring for each OSAL task, indexed the same as the ES task table,
+ * and one more shared by any caller that is not an OSAL task.
+ */
+#define CFE_ES_PERF_TASK_RING_COUNT (OS_MAX_TASKS + 1)
+
+/*
+ * Index of the ring shared by callers that are not OSAL tasks
+ */
+#define CFE_ES_PERF_SHARED_RING_IDX OS_MAX_TASKS
+
 enum CFE_ES_PerfState_t
 {
     CFE_ES_PERF_IDLE = 0,
@@ -74,6 +89,7 @@ typedef enum
     CFE_ES_PerfDumpState_OPEN_FILE,           /* Opening of the output file */
     CFE_ES_PerfDumpState_DELAY,               /* Wait-state to ensure in-progress writes are finished */
     CFE_ES_PerfDumpState_LOCK_DATA,           /* Locking of the global data structure */
+    CFE_ES_PerfDumpState_MERGE_ENTRIES,       /* Merge the task rings into the Perf Log (throttled) */
     CFE_ES_PerfDumpState_WRITE_FS_HDR,        /* Write the CFE FS file header */
     CFE_ES_PerfDumpState_WRITE_PERF_METADATA, /* Write the Perf global metadata */
     CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES,  /* Write the Perf Log entries (throttled) */
@@ -83,6 +99,30 @@ typedef enum
     CFE_ES_PerfDumpState_MAX                  /* Placeholder for last state, no action, always last */
 } CFE_ES_PerfDumpState_t;
 
+/*
+ * Per-task performance data ring
+ *
+ * Each task adds its performance log entries to its own ring, so adding an
+ * entry does not need a lock.  Only the owning task writes the entries and
+ * WriteCount, which is published after the entry is complete.  The shared
+ * ring is written under the PerfDataMutex instead.
+ *
+ * The entries of all rings are merged in time order into the Perf Log in the
+ * reset area when the log is written to a file.  The rings themselves are not
+ * preserved on a processor reset.
+ *
+ * In START trigger mode a ring stops taking entries once it would overwrite
+ * the ones added after the trigger, see CFE_ES_PerfRingHasRoom().
+ */
+typedef struct
+{
+    uint32                 WriteCount;   /* number of entries ever written, owned by the task */
+    uint32                 ReadBase;     /* WriteCount when data collection was started, owned by ES */
+    uint32                 TriggerBase;  /* WriteCount when the task first saw the trigger, owned by the task */
+    uint32                 TriggerStart; /* PerfStartCount that TriggerBase belongs to, owned by the task */
+    CFE_ES_PerfDataEntry_t Entry[CFE_PLATFORM_ES_PERF_TASK_RING_SIZE];
+} CFE_ES_PerfTaskRing_t;
+
 /*
  * Performance log dump state structure
  *
@@ -110,8 +150,33 @@ typedef struct
     uint32    StateCounter;                  /* number of blocks/items left in current state */
     uint32    DataPos;                       /* last position within the Perf Log */
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
+
+    uint32 MergePos[CFE_ES_PERF_TASK_RING_COUNT]; /* next ring entry to merge into the Perf Log */
+    uint32 MergeEnd[CFE_ES_PERF_TASK_RING_COUNT]; /* ring WriteCount when the merge started */
+    uint32 MergeSkip;                             /* oldest entries left to drop to fit the Perf Log */
 } CFE_ES_PerfDumpGlobal_t;
 
+/*
+ * Performance log stream state structure
+ *
+ * The stream reads the task rings with its own positions, so it does not
+ * interfere with data collection or with a dump of the Perf Log.
+ *
+ * The command processor only sets RequestedEnable.  Everything else is
+ * owned by the background task, which applies the request on its next run.
+ */
+typedef struct
+{
+    bool Enabled;         /* current state, owned by the background task */
+    bool RequestedEnable; /* requested state, set by ES command */
+
+    uint32 StreamPos[CFE_ES_PERF_TASK_RING_COUNT]; /* next ring entry to stream */
+    uint32 StreamEnd[CFE_ES_PERF_TASK_RING_COUNT]; /* ring WriteCount at the start of this run */
+    uint32 PendingTime;                            /* time the partly filled packet has waited, in ms */
+
+    CFE_ES_PerfStreamTlm_t TlmPkt; /* packet being filled, also holds the stream counters */
+} CFE_ES_PerfStreamGlobal_t;
+
 /*
  * Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -126,6 +191,135 @@ typedef struct
  */
 uint32 CFE_ES_GetPerfLogDumpRemaining(void);
 
+/*
+ * Helper function to obtain the number of entries in the performance log
+ *
+ * While data is collected the entries are held in the task rings, so this
+ * is the number that the next merge will start from.  It is an upper bound
+ * of the number that is written, since the merge drops entries that are
+ * older than the point where any one ring has wrapped.
+ */
+uint32 CFE_ES_GetPerfLogDataCount(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the performance data ring of the calling task
+ *
+ * This does not take any lock, it only converts the OSAL task ID
+ * of the caller to the ES task table index.
+ *
+ * @returns Index of the caller's ring, CFE_ES_PERF_SHARED_RING_IDX if not an OSAL task
+ */
+uint32 CFE_ES_GetPerfTaskRingIndex(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Add an entry to a performance data ring
+ *
+ * Must only be called by the task that owns the ring, or with the
+ * PerfDataMutex held for the shared ring.
+ *
+ * @param[inout] Ring      the ring to add the entry to
+ * @param[in]    EntryPtr  the entry to add
+ */
+void CFE_ES_PerfRingWrite(CFE_ES_PerfTaskRing_t *Ring, const CFE_ES_PerfDataEntry_t *EntryPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a performance data ring can take another entry
+ *
+ * In START trigger mode the log holds the entries from the trigger on, so
+ * once triggered a ring must not wrap over them.  A ring that is full stops
+ * taking entries until data collection is started again.  In the other modes
+ * the newest entries are kept and a ring always has room.
+ *
+ * Must only be called by the task that owns the ring, or with the
+ * PerfDataMutex held for the shared ring.
+ *
+ * @param[inout] Ring  the ring to check
+ * @returns true if the entry should be added, false if the ring is full
+ */
+bool CFE_ES_PerfRingHasRoom(CFE_ES_PerfTaskRing_t *Ring);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Prepare to merge the performance data rings
+ *
+ * Sets the range of entries of each ring to merge into the Perf Log.  If
+ * a ring has wrapped, entries of the other rings older than its oldest
+ * entry are excluded, so the merged log has no gaps.
+ *
+ * @param[inout] State the dump state holding the merge positions
+ * @returns Number of entries to merge
+ */
+uint32 CFE_ES_PerfLogMergeInit(CFE_ES_PerfDumpGlobal_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Merge the oldest remaining ring entry into the Perf Log
+ *
+ * The entry is appended to the Perf Log data buffer and the metadata
+ * is updated to match, unless it has to be dropped to fit the buffer.
+ *
+ * @param[inout] State the dump state holding the merge positions
+ */
+void CFE_ES_PerfLogMergeNext(CFE_ES_PerfDumpGlobal_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Find the ring with the oldest entry in a range
+ *
+ * @param[in] Pos  first entry of each ring
+ * @param[in] End  end of the range of each ring
+ * @returns Index of the ring, CFE_ES_PERF_TASK_RING_COUNT if all ranges are empty
+ */
+uint32 CFE_ES_PerfRingFindOldest(const uint32 *Pos, const uint32 *End);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Read an entry from a performance data ring
+ *
+ * The owning task may still be adding entries to the ring, so the entry
+ * is only valid if the task did not come around to its slot while it
+ * was copied.
+ *
+ * @param[in]  Ring      the ring to read
+ * @param[in]  Pos       the count of the entry to read
+ * @param[out] EntryPtr  buffer for the entry
+ * @returns true if the entry is valid, false if it was overwritten
+ */
+bool CFE_ES_PerfRingRead(const CFE_ES_PerfTaskRing_t *Ring, uint32 Pos, CFE_ES_PerfDataEntry_t *EntryPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Start streaming the performance data rings
+ *
+ * Streaming starts with the entries added after this call, the
+ * stream counters and the packet are reset.
+ *
+ * @param[inout] State the stream state
+ */
+void CFE_ES_PerfLogStreamInit(CFE_ES_PerfStreamGlobal_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Fill the stream packet from the performance data rings
+ *
+ * Adds the oldest entries up to StreamEnd to the packet until it is
+ * full.  Entries that were overwritten are counted as lost.
+ *
+ * @param[inout] State the stream state
+ */
+void CFE_ES_PerfLogStreamFill(CFE_ES_PerfStreamGlobal_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send the stream packet and start a new one
+ *
+ * @param[inout] State the stream state
+ */
+void CFE_ES_PerfLogStreamSend(CFE_ES_PerfStreamGlobal_t *State);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Write performance data to a file
@@ -139,4 +333,16 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Stream performance data in telemetry packets
+ *
+ * Implementation of the background job for streaming performance log data.
+ *
+ * Each iteration sends at most CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE
+ * full packets.  A partly filled packet is sent once it has waited for
+ * CFE_PLATFORM_ES_PERF_STREAM_FLUSH_DELAY, or when streaming is stopped.
+ */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg);
+
 #endif /* CFE_ES_PERF_H */
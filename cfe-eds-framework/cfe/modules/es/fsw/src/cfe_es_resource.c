@@ -39,6 +39,17 @@
 #include <string.h>
 #include <stdlib.h>
 
+/*
+ * Name indexes of the ES tables, see CFE_ES_NameHash_t
+ */
+static const CFE_ES_NameHash_t CFE_ES_AppNameHash =
+    CFE_ES_NAMEHASH_INIT(CFE_ES_Global.AppNameHash, CFE_PLATFORM_ES_MAX_APPLICATIONS);
+static const CFE_ES_NameHash_t CFE_ES_LibNameHash =
+    CFE_ES_NAMEHASH_INIT(CFE_ES_Global.LibNameHash, CFE_PLATFORM_ES_MAX_LIBRARIES);
+static const CFE_ES_NameHash_t CFE_ES_TaskNameHash = CFE_ES_NAMEHASH_INIT(CFE_ES_Global.TaskNameHash, OS_MAX_TASKS);
+static const CFE_ES_NameHash_t CFE_ES_CounterNameHash =
+    CFE_ES_NAMEHASH_INIT(CFE_ES_Global.CounterNameHash, CFE_PLATFORM_ES_MAX_GEN_COUNTERS);
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_TaskId_ToOSAL
@@ -87,31 +98,25 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
  *-----------------------------------------------------------------*/
 CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
 {
-    CFE_ES_AppRecord_t *AppRecPtr;
-    uint32              Count;
+    CFE_ES_AppRecord_t    *AppRecPtr;
+    CFE_ES_NameHashIter_t Iter;
+    uint32                EntryIdx;
 
     /*
     ** Search the Application table for an app with a matching name.
+    ** The index only returns entries with the same name hash.
     */
-    AppRecPtr = CFE_ES_Global.AppTable;
-    Count     = CFE_PLATFORM_ES_MAX_APPLICATIONS;
-    while (true)
+    CFE_ES_NameHashIterInit(&CFE_ES_AppNameHash, &Iter, Name);
+    while (CFE_ES_NameHashIterNext(&CFE_ES_AppNameHash, &Iter, &EntryIdx))
     {
-        if (Count == 0)
-        {
-            AppRecPtr = NULL;
-            break;
-        }
+        AppRecPtr = &CFE_ES_Global.AppTable[EntryIdx];
         if (CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0)
         {
-            break;
+            return AppRecPtr;
         }
-
-        ++AppRecPtr;
-        --Count;
     }
 
-    return AppRecPtr;
+    return NULL;
 }
 
 /*----------------------------------------------------------------
@@ -124,31 +129,56 @@ CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
  *-----------------------------------------------------------------*/
 CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name)
 {
-    CFE_ES_LibRecord_t *LibRecPtr;
-    uint32              Count;
+    CFE_ES_LibRecord_t    *LibRecPtr;
+    CFE_ES_NameHashIter_t Iter;
+    uint32                EntryIdx;
 
     /*
     ** Search the Library table for a library with a matching name.
+    ** The index only returns entries with the same name hash.
     */
-    LibRecPtr = CFE_ES_Global.LibTable;
-    Count     = CFE_PLATFORM_ES_MAX_LIBRARIES;
-    while (true)
+    CFE_ES_NameHashIterInit(&CFE_ES_LibNameHash, &Iter, Name);
+    while (CFE_ES_NameHashIterNext(&CFE_ES_LibNameHash, &Iter, &EntryIdx))
     {
-        if (Count == 0)
-        {
-            LibRecPtr = NULL;
-            break;
-        }
+        LibRecPtr = &CFE_ES_Global.LibTable[EntryIdx];
         if (CFE_ES_LibRecordIsUsed(LibRecPtr) && strcmp(Name, CFE_ES_LibRecordGetName(LibRecPtr)) == 0)
         {
-            break;
+            return LibRecPtr;
         }
+    }
 
-        ++LibRecPtr;
-        --Count;
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_LocateTaskRecordByName
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_TaskRecord_t *CFE_ES_LocateTaskRecordByName(const char *Name)
+{
+    CFE_ES_TaskRecord_t   *TaskRecPtr;
+    CFE_ES_NameHashIter_t Iter;
+    uint32                EntryIdx;
+
+    /*
+    ** Search the Task table for a task with a matching name.
+    ** The index only returns entries with the same name hash.
+    */
+    CFE_ES_NameHashIterInit(&CFE_ES_TaskNameHash, &Iter, Name);
+    while (CFE_ES_NameHashIterNext(&CFE_ES_TaskNameHash, &Iter, &EntryIdx))
+    {
+        TaskRecPtr = &CFE_ES_Global.TaskTable[EntryIdx];
+        if (CFE_ES_TaskRecordIsUsed(TaskRecPtr) && strcmp(Name, CFE_ES_TaskRecordGetName(TaskRecPtr)) == 0)
+        {
+            return TaskRecPtr;
+        }
     }
 
-    return LibRecPtr;
+    return NULL;
 }
 
 /*----------------------------------------------------------------
@@ -162,30 +192,128 @@ CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name)
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name)
 {
     CFE_ES_GenCounterRecord_t *CounterRecPtr;
-    uint32                     Count;
+    CFE_ES_NameHashIter_t     Iter;
+    uint32                    EntryIdx;
 
     /*
-    ** Search the Counter table for a matching name.
+    ** Search the Counter table for a counter with a matching name.
+    ** The index only returns entries with the same name hash.
     */
-    CounterRecPtr = CFE_ES_Global.CounterTable;
-    Count         = CFE_PLATFORM_ES_MAX_GEN_COUNTERS;
-    while (true)
+    CFE_ES_NameHashIterInit(&CFE_ES_CounterNameHash, &Iter, Name);
+    while (CFE_ES_NameHashIterNext(&CFE_ES_CounterNameHash, &Iter, &EntryIdx))
     {
-        if (Count == 0)
-        {
-            CounterRecPtr = NULL;
-            break;
-        }
+        CounterRecPtr = &CFE_ES_Global.CounterTable[EntryIdx];
         if (CFE_ES_CounterRecordIsUsed(CounterRecPtr) && strcmp(Name, CFE_ES_CounterRecordGetName(CounterRecPtr)) == 0)
         {
-            break;
+            return CounterRecPtr;
         }
-
-        ++CounterRecPtr;
-        --Count;
     }
 
-    return CounterRecPtr;
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppRecordNameHashAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppRecordNameHashAdd(const CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ES_NameHashAdd(&CFE_ES_AppNameHash, AppRecPtr - CFE_ES_Global.AppTable, CFE_ES_AppRecordGetName(AppRecPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppRecordNameHashRemove
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppRecordNameHashRemove(const CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ES_NameHashRemove(&CFE_ES_AppNameHash, AppRecPtr - CFE_ES_Global.AppTable);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_LibRecordNameHashAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LibRecordNameHashAdd(const CFE_ES_LibRecord_t *LibRecPtr)
+{
+    CFE_ES_NameHashAdd(&CFE_ES_LibNameHash, LibRecPtr - CFE_ES_Global.LibTable, CFE_ES_LibRecordGetName(LibRecPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_LibRecordNameHashRemove
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LibRecordNameHashRemove(const CFE_ES_LibRecord_t *LibRecPtr)
+{
+    CFE_ES_NameHashRemove(&CFE_ES_LibNameHash, LibRecPtr - CFE_ES_Global.LibTable);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_TaskRecordNameHashAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TaskRecordNameHashAdd(const CFE_ES_TaskRecord_t *TaskRecPtr)
+{
+    CFE_ES_NameHashAdd(&CFE_ES_TaskNameHash, TaskRecPtr - CFE_ES_Global.TaskTable, CFE_ES_TaskRecordGetName(TaskRecPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_TaskRecordNameHashRemove
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TaskRecordNameHashRemove(const CFE_ES_TaskRecord_t *TaskRecPtr)
+{
+    CFE_ES_NameHashRemove(&CFE_ES_TaskNameHash, TaskRecPtr - CFE_ES_Global.TaskTable);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CounterRecordNameHashAdd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CounterRecordNameHashAdd(const CFE_ES_GenCounterRecord_t *CounterRecPtr)
+{
+    CFE_ES_NameHashAdd(&CFE_ES_CounterNameHash, CounterRecPtr - CFE_ES_Global.CounterTable, CFE_ES_CounterRecordGetName(CounterRecPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_CounterRecordNameHashRemove
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CounterRecordNameHashRemove(const CFE_ES_GenCounterRecord_t *CounterRecPtr)
+{
+    CFE_ES_NameHashRemove(&CFE_ES_CounterNameHash, CounterRecPtr - CFE_ES_Global.CounterTable);
 }
 
 /*----------------------------------------------------------------
@@ -187,12 +187,39 @@ static inline CFE_ES_AppId_t CFE_ES_AppRecordGetID(const CFE_ES_AppRecord_t *App
     return AppRecPtr->AppId;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a app table entry to the name index
+ *
+ * The name must be stored in the entry before it is added, and the entry
+ * is added again whenever it is marked as used.
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   AppRecPtr   pointer to app table entry
+ */
+void CFE_ES_AppRecordNameHashAdd(const CFE_ES_AppRecord_t *AppRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a app table entry from the name index
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   AppRecPtr   pointer to app table entry
+ */
+void CFE_ES_AppRecordNameHashRemove(const CFE_ES_AppRecord_t *AppRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Marks an app table entry as used (not free)
  *
  * This sets the internal field(s) within this entry, and marks
  * it as being associated with the given app ID.
+ * The name of the entry must already be stored, as this also
+ * adds the entry to the name index.
  *
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
@@ -206,6 +233,7 @@ static inline CFE_ES_AppId_t CFE_ES_AppRecordGetID(const CFE_ES_AppRecord_t *App
 static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_ResourceId_t PendingId)
 {
     AppRecPtr->AppId = CFE_ES_APPID_C(PendingId);
+    CFE_ES_AppRecordNameHashAdd(AppRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -226,6 +254,7 @@ static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_Re
 static inline void CFE_ES_AppRecordSetFree(CFE_ES_AppRecord_t *AppRecPtr)
 {
     AppRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_ES_AppRecordNameHashRemove(AppRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -315,12 +344,39 @@ static inline CFE_ES_LibId_t CFE_ES_LibRecordGetID(const CFE_ES_LibRecord_t *Lib
     return (LibRecPtr->LibId);
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a library table entry to the name index
+ *
+ * The name must be stored in the entry before it is added, and the entry
+ * is added again whenever it is marked as used.
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   LibRecPtr   pointer to library table entry
+ */
+void CFE_ES_LibRecordNameHashAdd(const CFE_ES_LibRecord_t *LibRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a library table entry from the name index
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   LibRecPtr   pointer to library table entry
+ */
+void CFE_ES_LibRecordNameHashRemove(const CFE_ES_LibRecord_t *LibRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Marks a Library table entry as used (not free)
  *
  * This sets the internal field(s) within this entry, and marks
  * it as being associated with the given Lib ID.
+ * The name of the entry must already be stored, as this also
+ * adds the entry to the name index.
  *
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
@@ -331,6 +387,7 @@ static inline CFE_ES_LibId_t CFE_ES_LibRecordGetID(const CFE_ES_LibRecord_t *Lib
 static inline void CFE_ES_LibRecordSetUsed(CFE_ES_LibRecord_t *LibRecPtr, CFE_ResourceId_t PendingId)
 {
     LibRecPtr->LibId = CFE_ES_LIBID_C(PendingId);
+    CFE_ES_LibRecordNameHashAdd(LibRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -348,6 +405,7 @@ static inline void CFE_ES_LibRecordSetUsed(CFE_ES_LibRecord_t *LibRecPtr, CFE_Re
 static inline void CFE_ES_LibRecordSetFree(CFE_ES_LibRecord_t *LibRecPtr)
 {
     LibRecPtr->LibId = CFE_ES_LIBID_UNDEFINED;
+    CFE_ES_LibRecordNameHashRemove(LibRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -436,12 +494,39 @@ static inline bool CFE_ES_TaskRecordIsUsed(const CFE_ES_TaskRecord_t *TaskRecPtr
     return CFE_RESOURCEID_TEST_DEFINED(TaskRecPtr->TaskId);
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a task table entry to the name index
+ *
+ * The name must be stored in the entry before it is added, and the entry
+ * is added again whenever it is marked as used.
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   TaskRecPtr   pointer to task table entry
+ */
+void CFE_ES_TaskRecordNameHashAdd(const CFE_ES_TaskRecord_t *TaskRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a task table entry from the name index
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   TaskRecPtr   pointer to task table entry
+ */
+void CFE_ES_TaskRecordNameHashRemove(const CFE_ES_TaskRecord_t *TaskRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Marks a Task table entry as used (not free)
  *
  * This sets the internal field(s) within this entry, and marks
  * it as being associated with the given Task ID.
+ * The name of the entry must already be stored, as this also
+ * adds the entry to the name index.
  *
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
@@ -455,6 +540,7 @@ static inline bool CFE_ES_TaskRecordIsUsed(const CFE_ES_TaskRecord_t *TaskRecPtr
 static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ResourceId_t PendingId)
 {
     TaskRecPtr->TaskId = CFE_ES_TASKID_C(PendingId);
+    CFE_ES_TaskRecordNameHashAdd(TaskRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -475,6 +561,7 @@ static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE
 static inline void CFE_ES_TaskRecordSetFree(CFE_ES_TaskRecord_t *TaskRecPtr)
 {
     TaskRecPtr->TaskId = CFE_ES_TASKID_UNDEFINED;
+    CFE_ES_TaskRecordNameHashRemove(TaskRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -560,12 +647,39 @@ static inline CFE_ES_CounterId_t CFE_ES_CounterRecordGetID(const CFE_ES_GenCount
     return CounterRecPtr->CounterId;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a counter table entry to the name index
+ *
+ * The name must be stored in the entry before it is added, and the entry
+ * is added again whenever it is marked as used.
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   CounterRecPtr   pointer to counter table entry
+ */
+void CFE_ES_CounterRecordNameHashAdd(const CFE_ES_GenCounterRecord_t *CounterRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a counter table entry from the name index
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   CounterRecPtr   pointer to counter table entry
+ */
+void CFE_ES_CounterRecordNameHashRemove(const CFE_ES_GenCounterRecord_t *CounterRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Marks a Counter table entry as used (not free)
  *
  * This sets the internal field(s) within this entry, and marks
  * it as being associated with the given Counter ID.
+ * The name of the entry must already be stored, as this also
+ * adds the entry to the name index.
  *
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
@@ -579,6 +693,7 @@ static inline CFE_ES_CounterId_t CFE_ES_CounterRecordGetID(const CFE_ES_GenCount
 static inline void CFE_ES_CounterRecordSetUsed(CFE_ES_GenCounterRecord_t *CounterRecPtr, CFE_ResourceId_t PendingId)
 {
     CounterRecPtr->CounterId = CFE_ES_COUNTERID_C(PendingId);
+    CFE_ES_CounterRecordNameHashAdd(CounterRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -599,6 +714,7 @@ static inline void CFE_ES_CounterRecordSetUsed(CFE_ES_GenCounterRecord_t *Counte
 static inline void CFE_ES_CounterRecordSetFree(CFE_ES_GenCounterRecord_t *CounterRecPtr)
 {
     CounterRecPtr->CounterId = CFE_ES_COUNTERID_UNDEFINED;
+    CFE_ES_CounterRecordNameHashRemove(CounterRecPtr);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -769,6 +885,17 @@ CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name);
  */
 CFE_ES_TaskRecord_t *CFE_ES_LocateTaskRecordByName(const char *Name);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds a task table record matching the given name
+ *
+ * Helper function, aids in finding a task record from a name string.
+ * Must be called while locked.
+ *
+ * @returns pointer to table entry matching name, or NULL if not found
+ */
+CFE_ES_TaskRecord_t *CFE_ES_LocateTaskRecordByName(const char *Name);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Finds a counter table record matching the given name
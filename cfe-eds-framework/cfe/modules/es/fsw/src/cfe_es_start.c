@@ -75,7 +75,11 @@ CFE_ES_Global_t CFE_ES_Global;
  *-----------------------------------------------------------------*/
 void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const char *StartFilePath)
 {
-    int32 OsStatus;
+    int32     OsStatus;
+    OS_time_t CoreStartupTime;
+    OS_time_t CoreReadyTime;
+    OS_time_t AppsInitTime;
+    OS_time_t OperationalTime;
 
     /*
      * Clear the entire global data structure.
@@ -181,6 +185,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     /*
     ** Indicate that the CFE core is now starting up / going multi-threaded
     */
+    OS_GetLocalTime(&CoreStartupTime);
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_STARTUP state\n", __func__);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
 
@@ -192,6 +197,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     /*
     ** Indicate that the CFE core is ready
     */
+    OS_GetLocalTime(&CoreReadyTime);
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_READY state\n", __func__);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
 
@@ -214,6 +220,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         CFE_ES_WriteToSysLog("%s: Startup Sync failed - Applications may not have all initialized\n", __func__);
     }
 
+    OS_GetLocalTime(&AppsInitTime);
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering APPS_INIT state\n", __func__);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
 
@@ -232,8 +239,18 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     /*
     ** Startup is fully complete
     */
+    OS_GetLocalTime(&OperationalTime);
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering OPERATIONAL state\n", __func__);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+
+    /*
+    ** Report how long each startup phase took
+    */
+    CFE_ES_WriteToSysLog("%s: Startup phases: core %lu ms, apps to LATE_INIT %lu ms, apps to RUNNING %lu ms\n",
+                         __func__,
+                         (unsigned long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CoreReadyTime, CoreStartupTime)),
+                         (unsigned long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(AppsInitTime, CoreReadyTime)),
+                         (unsigned long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(OperationalTime, AppsInitTime)));
 }
 
 /*----------------------------------------------------------------
@@ -251,6 +251,18 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data);
  */
 int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Command handler to start streaming performance data
+ */
+int32 CFE_ES_StartPerfStreamCmd(const CFE_ES_StartPerfStreamCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Command handler to stop streaming performance data
+ */
+int32 CFE_ES_StopPerfStreamCmd(const CFE_ES_StopPerfStreamCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Command handler to set perf ID filter mask
@@ -142,6 +142,24 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Per-task performance data ring size
+*/
+#if CFE_PLATFORM_ES_PERF_TASK_RING_SIZE < 64
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE cannot be less than 64 entries!
+#elif CFE_PLATFORM_ES_PERF_TASK_RING_SIZE > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE cannot be greater than CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE!
+#elif (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)) != 0
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE must be a power of two!
+#endif
+
+/*
+** Performance log stream rate
+*/
+#if CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE cannot be less than 1!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -165,6 +183,13 @@
 #error CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN must be a power of 2!
 #endif
 
+/*
+**  Number of memory pool block sizes, the size class map of a pool holds 8 bit bucket indexes
+*/
+#if CFE_PLATFORM_ES_POOL_MAX_BUCKETS > 255
+#error CFE_PLATFORM_ES_POOL_MAX_BUCKETS cannot be greater than 255!
+#endif
+
 /*
 **  Intermediate ES Memory Pool Block Sizes
 */
@@ -180,6 +205,16 @@
 #error CFE_PLATFORM_ES_MAX_BLOCK_SIZE must be equal to or larger than CFE_PLATFORM_TBL_MAX_DBL_TABLE_SIZE!
 #endif
 
+#if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS < 0
+#error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS must be 0 or greater
+#elif CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS >= OS_MAX_TASKS
+#error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS must be less than OS_MAX_TASKS
+#endif
+
+#if CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH < 0
+#error CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH must be 0 or greater
+#endif
+
 #if CFE_PLATFORM_ES_MEM_BLOCK_SIZE_01 > CFE_PLATFORM_ES_MEM_BLOCK_SIZE_02
 #error CFE_PLATFORM_ES_MEM_BLOCK_SIZE_01 must be less than CFE_PLATFORM_ES_MEM_BLOCK_SIZE_02
 #endif
@@ -0,0 +1,217 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * ES CRC throughput benchmark
+ *
+ * Reports the throughput of the CRC engine used by CFE_ES_CalculateCRC for
+ * each algorithm, with the CPU instructions (where supported) and with the
+ * slice-by-8 tables.  For comparison it also times the byte-at-a-time table
+ * and bit-at-a-time loops that were previously used for CRC-16 and CRC-32C,
+ * and checks that every implementation produces the same result.
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "uttest.h"
+#include "edslib_crc.h"
+
+#include <time.h>
+
+/*
+ * Defines
+ */
+
+/* Size of the buffer that is checked, large enough to not fit in L1 cache */
+#define ES_BENCH_CRC_BUFFER_SIZE 0x100000
+
+/* Number of passes over the buffer for each case */
+#define ES_BENCH_CRC_PASSES      64
+
+/* The bit-at-a-time loop is much slower, so fewer passes are done */
+#define ES_BENCH_CRC_SLOW_PASSES 4
+
+typedef uint32 (*Bench_ES_CrcFunc_t)(uint32 Crc, const uint8 *Buf, size_t Len);
+
+static uint8 Bench_ES_CrcBuffer[ES_BENCH_CRC_BUFFER_SIZE];
+
+static uint16 Bench_ES_Crc16Table[256];
+static uint32 Bench_ES_Crc32Table[256];
+
+/******************************************************************************
+ * Reference implementations
+ */
+uint32 Bench_ES_Crc16ByteTable(uint32 Crc, const uint8 *Buf, size_t Len)
+{
+    while (Len-- > 0)
+    {
+        Crc = (Crc >> 8) ^ Bench_ES_Crc16Table[(Crc ^ *Buf++) & 0xFF];
+    }
+    return Crc;
+}
+
+uint32 Bench_ES_Crc32ByteTable(uint32 Crc, const uint8 *Buf, size_t Len)
+{
+    Crc = ~Crc;
+    while (Len-- > 0)
+    {
+        Crc = (Crc >> 8) ^ Bench_ES_Crc32Table[(Crc ^ *Buf++) & 0xFF];
+    }
+    return ~Crc;
+}
+
+uint32 Bench_ES_Crc32cBitwise(uint32 Crc, const uint8 *Buf, size_t Len)
+{
+    int k;
+
+    Crc = ~Crc;
+    while (Len-- > 0)
+    {
+        Crc ^= *Buf++;
+        for (k = 0; k < 8; k++)
+        {
+            Crc = (Crc & 1) ? (Crc >> 1) ^ 0x82F63B78 : Crc >> 1;
+        }
+    }
+    return ~Crc;
+}
+
+/******************************************************************************
+ * Engine wrappers
+ */
+uint32 Bench_ES_Crc16Engine(uint32 Crc, const uint8 *Buf, size_t Len)
+{
+    return EdsLib_CRC16_ARC_Update(Crc, Buf, Len);
+}
+
+uint32 Bench_ES_Crc32Engine(uint32 Crc, const uint8 *Buf, size_t Len)
+{
+    return EdsLib_CRC32_Update(Crc, Buf, Len);
+}
+
+uint32 Bench_ES_Crc32cEngine(uint32 Crc, const uint8 *Buf, size_t Len)
+{
+    return EdsLib_CRC32C_Update(Crc, Buf, Len);
+}
+
+/******************************************************************************
+ * Local helper to time a CRC over the buffer, returns MB per second
+ */
+double Bench_ES_TimeCrc(Bench_ES_CrcFunc_t Func, uint32 Passes, uint32 *CrcPtr)
+{
+    clock_t Start;
+    clock_t Elapsed;
+    uint32  i;
+    uint32  Crc = 0;
+
+    Start = clock();
+    for (i = 0; i < Passes; i++)
+    {
+        Crc = Func(0, Bench_ES_CrcBuffer, sizeof(Bench_ES_CrcBuffer));
+    }
+    Elapsed = clock() - Start;
+    if (Elapsed == 0)
+    {
+        Elapsed = 1;
+    }
+
+    *CrcPtr = Crc;
+
+    return ((double)Passes * sizeof(Bench_ES_CrcBuffer) * CLOCKS_PER_SEC) / ((double)Elapsed * 1e6);
+}
+
+/******************************************************************************
+ * Local helper to time and check one algorithm with and without CPU instructions
+ */
+void Bench_ES_CrcAlgorithm(const char *Name, Bench_ES_CrcFunc_t Engine, uint32 AccelFlag, Bench_ES_CrcFunc_t RefFunc,
+                           const char *RefName, uint32 RefPasses)
+{
+    uint32 RefCrc;
+    uint32 Crc;
+    double MBps;
+
+    MBps = Bench_ES_TimeCrc(RefFunc, RefPasses, &RefCrc);
+    UtPrintf("%-10s %-18s %9.1f MB/s", Name, RefName, MBps);
+
+    EdsLib_CRC_SetAcceleration(0);
+    MBps = Bench_ES_TimeCrc(Engine, ES_BENCH_CRC_PASSES, &Crc);
+    UtPrintf("%-10s %-18s %9.1f MB/s", Name, "slice-by-8", MBps);
+    UtAssert_UINT32_EQ(Crc, RefCrc);
+
+    /* Algorithms without a CPU implementation pass 0 here */
+    EdsLib_CRC_SetAcceleration(AccelFlag);
+    if (EdsLib_CRC_GetAcceleration() != 0)
+    {
+        MBps = Bench_ES_TimeCrc(Engine, ES_BENCH_CRC_PASSES, &Crc);
+        UtPrintf("%-10s %-18s %9.1f MB/s", Name, "CPU instructions", MBps);
+        UtAssert_UINT32_EQ(Crc, RefCrc);
+    }
+    else if (AccelFlag != 0)
+    {
+        UtPrintf("%-10s %-18s not supported on this CPU", Name, "CPU instructions");
+    }
+
+    EdsLib_CRC_SetAcceleration(~0U);
+}
+
+void Bench_ES_Crc(void)
+{
+    uint32 Seed = 1;
+    uint32 i;
+    uint32 k;
+    uint32 Crc16;
+    uint32 Crc32;
+
+    for (i = 0; i < sizeof(Bench_ES_CrcBuffer); i++)
+    {
+        Seed                  = (Seed * 1103515245) + 12345;
+        Bench_ES_CrcBuffer[i] = (uint8)(Seed >> 16);
+    }
+
+    for (i = 0; i < 256; i++)
+    {
+        Crc16 = i;
+        Crc32 = i;
+        for (k = 0; k < 8; k++)
+        {
+            Crc16 = (Crc16 & 1) ? (Crc16 >> 1) ^ 0xA001 : Crc16 >> 1;
+            Crc32 = (Crc32 & 1) ? (Crc32 >> 1) ^ 0xEDB88320 : Crc32 >> 1;
+        }
+        Bench_ES_Crc16Table[i] = (uint16)Crc16;
+        Bench_ES_Crc32Table[i] = Crc32;
+    }
+
+    Bench_ES_CrcAlgorithm("CRC-16/ARC", Bench_ES_Crc16Engine, 0, Bench_ES_Crc16ByteTable, "byte table",
+                          ES_BENCH_CRC_PASSES);
+    Bench_ES_CrcAlgorithm("CRC-32", Bench_ES_Crc32Engine, EDSLIB_CRC_ACCEL_CRC32, Bench_ES_Crc32ByteTable,
+                          "byte table", ES_BENCH_CRC_PASSES);
+    Bench_ES_CrcAlgorithm("CRC-32C", Bench_ES_Crc32cEngine, EDSLIB_CRC_ACCEL_CRC32C, Bench_ES_Crc32cBitwise,
+                          "bit loop", ES_BENCH_CRC_SLOW_PASSES);
+}
+
+/* Main benchmark routine */
+void UtTest_Setup(void)
+{
+    UtPrintf("ES CRC throughput benchmark");
+
+    UtTest_Add(Bench_ES_Crc, NULL, NULL, "Bench_ES_Crc");
+}
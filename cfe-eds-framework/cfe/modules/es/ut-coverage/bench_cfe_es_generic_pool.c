@@ -0,0 +1,158 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * ES generic memory pool benchmark
+ *
+ * Reports the average time of a get and put of a block of random size, for
+ * pools with an increasing number of block sizes.  Each pool is timed with its
+ * size class map, then with the map cleared, which makes every bucket search
+ * start from the smallest bucket like a plain scan of the bucket list.
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "uttest.h"
+#include "cfe_es_module_all.h"
+
+#include <time.h>
+
+/*
+ * Defines
+ */
+
+/* Number of get and put pairs timed for each case */
+#define ES_BENCH_POOL_CYCLES 0x400000
+
+/* Largest block size of the pools, requests are spread up to this size */
+#define ES_BENCH_POOL_MAX_BLOCK 4096
+
+/* Number of request sizes, a power of 2 */
+#define ES_BENCH_POOL_NUM_REQS 0x1000
+
+/* Pool memory, large enough for one block of each size */
+static union
+{
+    CFE_ES_GenPoolBD_t BD;
+    uint8              Data[CFE_PLATFORM_ES_POOL_MAX_BUCKETS * (ES_BENCH_POOL_MAX_BLOCK + 64)];
+} Bench_ES_PoolBuffer;
+
+int32 Bench_ES_PoolRetrieve(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset, CFE_ES_GenPoolBD_t **BdPtr)
+{
+    *BdPtr = (CFE_ES_GenPoolBD_t *)((void *)&Bench_ES_PoolBuffer.Data[Offset]);
+    return CFE_SUCCESS;
+}
+
+int32 Bench_ES_PoolCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset, const CFE_ES_GenPoolBD_t *BdPtr)
+{
+    return CFE_SUCCESS;
+}
+
+/******************************************************************************
+ * Local helper to time gets and puts of the request sizes, returns ns per pair
+ */
+double Bench_ES_TimeGetPut(CFE_ES_GenPoolRecord_t *PoolRecPtr, const size_t *ReqSizes, uint32 *FailPtr)
+{
+    clock_t Start;
+    uint32  i;
+    uint32  Fail = 0;
+    size_t  Offset;
+    size_t  BlockSize;
+
+    Start = clock();
+    for (i = 0; i < ES_BENCH_POOL_CYCLES; i++)
+    {
+        if (CFE_ES_GenPoolGetBlock(PoolRecPtr, &Offset, ReqSizes[i & (ES_BENCH_POOL_NUM_REQS - 1)]) != CFE_SUCCESS ||
+            CFE_ES_GenPoolPutBlock(PoolRecPtr, &BlockSize, Offset) != CFE_SUCCESS)
+        {
+            Fail++;
+        }
+    }
+
+    *FailPtr = Fail;
+
+    return ((double)(clock() - Start) * 1e9) / ((double)CLOCKS_PER_SEC * ES_BENCH_POOL_CYCLES);
+}
+
+void Bench_ES_GenericPool(void)
+{
+    static size_t          ReqSizes[ES_BENCH_POOL_NUM_REQS];
+    size_t                 BlockSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    CFE_ES_GenPoolRecord_t Pool;
+    uint32                 Seed = 1;
+    uint32                 Fail;
+    uint16                 NumSizes;
+    uint16                 i;
+    double                 MapNs;
+    double                 ScanNs;
+
+    /* Random request sizes, the same for every pool */
+    for (i = 0; i < ES_BENCH_POOL_NUM_REQS; i++)
+    {
+        Seed        = (Seed * 1103515245) + 12345;
+        ReqSizes[i] = 1 + ((Seed >> 8) % ES_BENCH_POOL_MAX_BLOCK);
+    }
+
+    NumSizes = 1;
+    while (NumSizes <= CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        /* Block sizes evenly spread up to the largest, so every bucket gets used */
+        for (i = 0; i < NumSizes; i++)
+        {
+            BlockSizes[i] = (((ES_BENCH_POOL_MAX_BLOCK * (i + 1)) / NumSizes) + 7) & ~7;
+        }
+
+        UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool, 0, sizeof(Bench_ES_PoolBuffer.Data), sizeof(uint64),
+                                                   NumSizes, BlockSizes, Bench_ES_PoolRetrieve, Bench_ES_PoolCommit),
+                          CFE_SUCCESS);
+
+        MapNs = Bench_ES_TimeGetPut(&Pool, ReqSizes, &Fail);
+        UtAssert_ZERO(Fail);
+
+        memset(Pool.SizeClassMap, 0, sizeof(Pool.SizeClassMap));
+
+        ScanNs = Bench_ES_TimeGetPut(&Pool, ReqSizes, &Fail);
+        UtAssert_ZERO(Fail);
+
+        UtPrintf("%2u block sizes: get and put %.2f ns with size class map, %.2f ns with bucket scan",
+                 (unsigned int)NumSizes, MapNs, ScanNs);
+
+        if (NumSizes == CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+        {
+            break;
+        }
+
+        NumSizes *= 2;
+        if (NumSizes > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+        {
+            NumSizes = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+        }
+    }
+}
+
+/* Main benchmark routine */
+void UtTest_Setup(void)
+{
+    UtPrintf("ES generic memory pool get and put benchmark");
+
+    UtTest_Add(Bench_ES_GenericPool, NULL, NULL, "Bench_ES_GenericPool");
+}
@@ -155,6 +155,12 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC = {
     .DispatchOffset =
         offsetof(CFE_ES_Application_Component_Telecommand_DispatchTable_t, CMD.DumpCDSRegistryCmd_indication)};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_START_PERF_STREAM_CC = {
+    .DispatchOffset =
+        offsetof(CFE_ES_Application_Component_Telecommand_DispatchTable_t, CMD.StartPerfStreamCmd_indication)};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_STOP_PERF_STREAM_CC = {
+    .DispatchOffset =
+        offsetof(CFE_ES_Application_Component_Telecommand_DispatchTable_t, CMD.StopPerfStreamCmd_indication)};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_CC     = {.DispatchOffset = -1,
                                                                       .DispatchError  = CFE_STATUS_BAD_COMMAND_CODE};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_LENGTH = {.DispatchOffset = -1,
@@ -298,13 +304,6 @@ void ES_UT_SetupSingleAppId(CFE_ES_AppType_Enum_t AppType, CFE_ES_AppState_Enum_
 
     LocalTaskPtr = CFE_ES_LocateTaskRecordByID(CFE_ES_TASKID_C(UtTaskId));
     LocalAppPtr  = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(UtAppId));
-    CFE_ES_TaskRecordSetUsed(LocalTaskPtr, UtTaskId);
-    CFE_ES_AppRecordSetUsed(LocalAppPtr, UtAppId);
-    LocalTaskPtr->AppId     = CFE_ES_AppRecordGetID(LocalAppPtr);
-    LocalAppPtr->MainTaskId = CFE_ES_TaskRecordGetID(LocalTaskPtr);
-    LocalAppPtr->AppState   = AppState;
-    LocalAppPtr->Type       = AppType;
-
     if (AppName)
     {
         strncpy(LocalAppPtr->AppName, AppName, sizeof(LocalAppPtr->AppName) - 1);
@@ -313,6 +312,13 @@ void ES_UT_SetupSingleAppId(CFE_ES_AppType_Enum_t AppType, CFE_ES_AppState_Enum_
         LocalTaskPtr->TaskName[sizeof(LocalTaskPtr->TaskName) - 1] = 0;
     }
 
+    CFE_ES_TaskRecordSetUsed(LocalTaskPtr, UtTaskId);
+    CFE_ES_AppRecordSetUsed(LocalAppPtr, UtAppId);
+    LocalTaskPtr->AppId     = CFE_ES_AppRecordGetID(LocalAppPtr);
+    LocalAppPtr->MainTaskId = CFE_ES_TaskRecordGetID(LocalTaskPtr);
+    LocalAppPtr->AppState   = AppState;
+    LocalAppPtr->Type       = AppType;
+
     if (OutAppRec)
     {
         *OutAppRec = LocalAppPtr;
@@ -354,15 +360,15 @@ void ES_UT_SetupChildTaskId(const CFE_ES_AppRecord_t *ParentApp, const char *Tas
     UtTaskId = CFE_ES_TaskId_FromOSAL(UtOsalId);
 
     LocalTaskPtr = CFE_ES_LocateTaskRecordByID(UtTaskId);
-    CFE_ES_TaskRecordSetUsed(LocalTaskPtr, CFE_RESOURCEID_UNWRAP(UtTaskId));
-    LocalTaskPtr->AppId = UtAppId;
-
     if (TaskName)
     {
         strncpy(LocalTaskPtr->TaskName, TaskName, sizeof(LocalTaskPtr->TaskName) - 1);
         LocalTaskPtr->TaskName[sizeof(LocalTaskPtr->TaskName) - 1] = 0;
     }
 
+    CFE_ES_TaskRecordSetUsed(LocalTaskPtr, CFE_RESOURCEID_UNWRAP(UtTaskId));
+    LocalTaskPtr->AppId = UtAppId;
+
     if (OutTaskRec)
     {
         *OutTaskRec = LocalTaskPtr;
@@ -384,14 +390,14 @@ void ES_UT_SetupSingleLibId(const char *LibName, CFE_ES_LibRecord_t **OutLibRec)
     CFE_ES_Global.LastLibId = CFE_ResourceId_FromInteger(CFE_ResourceId_ToInteger(UtLibId) + 1);
 
     LocalLibPtr = CFE_ES_LocateLibRecordByID(CFE_ES_LIBID_C(UtLibId));
-    CFE_ES_LibRecordSetUsed(LocalLibPtr, UtLibId);
-
     if (LibName)
     {
         strncpy(LocalLibPtr->LibName, LibName, sizeof(LocalLibPtr->LibName) - 1);
         LocalLibPtr->LibName[sizeof(LocalLibPtr->LibName) - 1] = 0;
     }
 
+    CFE_ES_LibRecordSetUsed(LocalLibPtr, UtLibId);
+
     if (OutLibRec)
     {
         *OutLibRec = LocalLibPtr;
@@ -636,6 +642,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestInit);
     UT_ADD_TEST(TestStartupErrorPaths);
     UT_ADD_TEST(TestResourceID);
+    UT_ADD_TEST(TestNameHash);
     UT_ADD_TEST(TestApps);
     UT_ADD_TEST(TestLibs);
     UT_ADD_TEST(TestERLog);
@@ -647,6 +654,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestGenericPool);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
+    UT_ADD_TEST(TestESMempoolTaskCache);
     UT_ADD_TEST(TestSysLog);
     UT_ADD_TEST(TestBackground);
 }
@@ -1229,6 +1237,72 @@ void TestApps(void)
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]);
 
+    /* Test that the apps of the script are loaded by the workers and started in order */
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumWorkers, CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumJobs, 3);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_Global.StartupLoad.JobSem));
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.StartupLoad.Jobs[0].AppRecPtr->AppName, OS_MAX_API_NAME, "CI_APP",
+                          OS_MAX_API_NAME);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.StartupLoad.Jobs[2].AppRecPtr->AppName, OS_MAX_API_NAME, "TO_APP",
+                          OS_MAX_API_NAME);
+
+    /* Test starting the applications one at a time if the load semaphores cannot be created */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumJobs, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 0);
+
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
+    CFE_ES_StartupLoadBegin();
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_Global.StartupLoad.JobSem));
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+
+    /* Test loading all modules in the startup task if the workers cannot be created */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumWorkers, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumJobs, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+
+    /* Test a worker loading the queued modules and exiting once there are none left */
+    ES_ResetUnitTest();
+    CFE_ES_StartupLoadBegin();
+    ES_UT_SetupAppStartParams(&StartParams, "ut/filename.x", "EntryPoint", 170, 8192, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupLoadQueueApp("UT_APP1", &StartParams));
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupLoadQueueApp("UT_APP2", &StartParams));
+    UtAssert_INT32_EQ(CFE_ES_StartupLoadQueueApp("UT_APP1", &StartParams), CFE_ES_ERR_DUPLICATE_NAME);
+    UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 2, -1);
+    CFE_ES_StartupLoadWorker();
+    CFE_UtAssert_SUCCESS(CFE_ES_Global.StartupLoad.Jobs[0].LoadStatus);
+    UtAssert_INT32_EQ(CFE_ES_Global.StartupLoad.Jobs[1].LoadStatus, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 3);
+    UtAssert_UINT32_EQ(CFE_ES_StartupLoadFinish(), 1);
+    UtAssert_NOT_NULL(CFE_ES_LocateAppRecordByName("UT_APP1"));
+    UtAssert_NULL(CFE_ES_LocateAppRecordByName("UT_APP2"));
+
+    /* Test a worker exiting if the job semaphore fails */
+    ES_ResetUnitTest();
+    CFE_ES_StartupLoadBegin();
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupLoadQueueApp("UT_APP1", &StartParams));
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 1, OS_ERROR);
+    CFE_ES_StartupLoadWorker();
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NextJob, 0);
+    UtAssert_UINT32_EQ(CFE_ES_StartupLoadFinish(), 1);
+
+    /* Test queuing more apps than there are jobs */
+    ES_ResetUnitTest();
+    CFE_ES_StartupLoadBegin();
+    CFE_ES_Global.StartupLoad.NumJobs = CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupLoadQueueApp("UT_APP1", &StartParams));
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 1);
+
     /* Test parsing the startup script with an unknown entry type */
     ES_ResetUnitTest();
     {
@@ -1946,6 +2020,120 @@ void TestResourceID(void)
     CFE_UtAssert_RESOURCEID_EQ(cfe_id1, cfe_id2);
 }
 
+/*
+ * Helper function to find a name in a name hash index.  Returns the
+ * first entry with a matching hash, or UINT32_MAX if there is none.
+ */
+uint32 ES_UT_NameHashFind(const CFE_ES_NameHash_t *Index, const char *Name)
+{
+    CFE_ES_NameHashIter_t Iter;
+    uint32                EntryIdx;
+
+    CFE_ES_NameHashIterInit(Index, &Iter, Name);
+    if (!CFE_ES_NameHashIterNext(Index, &Iter, &EntryIdx))
+    {
+        EntryIdx = UINT32_MAX;
+    }
+
+    return EntryIdx;
+}
+
+void TestNameHash(void)
+{
+    CFE_ES_NAMEHASH_STORAGE(4) Storage;
+    const CFE_ES_NameHash_t Index = CFE_ES_NAMEHASH_INIT(Storage, 4);
+    CFE_ES_NameHashIter_t   Iter;
+    uint32                  EntryIdx;
+
+    UtPrintf("Begin Test Name Hash");
+
+    memset(&Storage, 0, sizeof(Storage));
+
+    /* The hash is never 0, which marks entries not in the index */
+    UtAssert_NONZERO(CFE_ES_NameHashCompute(""));
+    UtAssert_UINT32_EQ(CFE_ES_NameHashCompute("UT1"), CFE_ES_NameHashCompute("UT1"));
+
+    /*
+     * The names are chosen so that in 8 slots, UT1, UT9 and UT12 share
+     * the last slot and UT4 has the first, so the probe run wraps around
+     */
+    UtAssert_UINT32_EQ(CFE_ES_NameHashCompute("UT1") % 8, 7);
+    UtAssert_UINT32_EQ(CFE_ES_NameHashCompute("UT9") % 8, 7);
+    UtAssert_UINT32_EQ(CFE_ES_NameHashCompute("UT12") % 8, 7);
+    UtAssert_UINT32_EQ(CFE_ES_NameHashCompute("UT4") % 8, 0);
+    CFE_ES_NameHashAdd(&Index, 0, "UT1");
+    CFE_ES_NameHashAdd(&Index, 1, "UT9");
+    CFE_ES_NameHashAdd(&Index, 2, "UT4");
+    CFE_ES_NameHashAdd(&Index, 3, "UT12");
+    UtAssert_UINT32_EQ(Storage.Slots[7], 1);
+    UtAssert_UINT32_EQ(Storage.Slots[0], 2);
+    UtAssert_UINT32_EQ(Storage.Slots[1], 3);
+    UtAssert_UINT32_EQ(Storage.Slots[2], 4);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT1"), 0);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT9"), 1);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT4"), 2);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT12"), 3);
+
+    /* A name with the same home slot that is not in the index */
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT17"), UINT32_MAX);
+
+    /* Removing the head of the run moves the rest back, unless before their home slot */
+    CFE_ES_NameHashRemove(&Index, 0);
+    UtAssert_ZERO(Storage.EntryHash[0]);
+    UtAssert_UINT32_EQ(Storage.Slots[7], 2);
+    UtAssert_UINT32_EQ(Storage.Slots[0], 3);
+    UtAssert_UINT32_EQ(Storage.Slots[1], 4);
+    UtAssert_ZERO(Storage.Slots[2]);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT1"), UINT32_MAX);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT9"), 1);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT4"), 2);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT12"), 3);
+
+    /* Removing an entry that is not in the index does nothing */
+    CFE_ES_NameHashRemove(&Index, 0);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT9"), 1);
+
+    /* Removing UT4 leaves UT12 after it, which is already past its home slot */
+    CFE_ES_NameHashRemove(&Index, 2);
+    UtAssert_UINT32_EQ(Storage.Slots[0], 4);
+    UtAssert_ZERO(Storage.Slots[1]);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT12"), 3);
+
+    /* Adding an entry again replaces its old name */
+    CFE_ES_NameHashAdd(&Index, 1, "UT2");
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT9"), UINT32_MAX);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT2"), 1);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT12"), 3);
+
+    /* The same name may be in the index more than once */
+    CFE_ES_NameHashAdd(&Index, 0, "UT2");
+    CFE_ES_NameHashIterInit(&Index, &Iter, "UT2");
+    UtAssert_BOOL_TRUE(CFE_ES_NameHashIterNext(&Index, &Iter, &EntryIdx));
+    UtAssert_BOOL_TRUE(CFE_ES_NameHashIterNext(&Index, &Iter, &EntryIdx));
+    UtAssert_BOOL_FALSE(CFE_ES_NameHashIterNext(&Index, &Iter, &EntryIdx));
+
+    /* A full run of slots ends the search */
+    memset(Storage.Slots, 0, sizeof(Storage.Slots));
+    memset(Storage.EntryHash, 0, sizeof(Storage.EntryHash));
+    Storage.EntryHash[0] = CFE_ES_NameHashCompute("UT1");
+    for (EntryIdx = 0; EntryIdx < 8; ++EntryIdx)
+    {
+        Storage.Slots[EntryIdx] = 1;
+    }
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT9"), UINT32_MAX);
+
+    CFE_ES_NameHashClear(&Index);
+    UtAssert_ZERO(Storage.EntryHash[0]);
+    UtAssert_UINT32_EQ(ES_UT_NameHashFind(&Index, "UT1"), UINT32_MAX);
+
+    /* The table lookups only return used entries with the same name */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleLibId("UT4", NULL);
+    UtAssert_NOT_NULL(CFE_ES_LocateLibRecordByName("UT4"));
+    UtAssert_NULL(CFE_ES_LocateLibRecordByName("UT1"));
+    UtAssert_NULL(CFE_ES_LocateCounterRecordByName("UT4"));
+}
+
 void TestLibs(void)
 {
     CFE_ES_LibRecord_t *      UtLibRecPtr;
@@ -2177,6 +2365,9 @@ void TestGenericPool(void)
          */
         16, 56, 60, 40, 44, 48, 64, 128, 20, 24, 28, 12, 52, 32, 4, 8, 36};
     uint16              i;
+    uint16              SizeClass;
+    size_t              ClassSize;
+    uint32              Mismatches;
     uint32              ExpectedCount;
     CFE_ES_GenPoolBD_t *BdPtr;
 
@@ -2196,6 +2387,25 @@ void TestGenericPool(void)
                                                   UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve,
                                                   ES_UT_PoolDirectCommit));
 
+    /* Check the size classes, and that each maps to the first bucket that can fit its smallest size */
+    UtAssert_UINT32_LT(CFE_ES_GenPoolSizeClass(SIZE_MAX), CFE_ES_GENERIC_POOL_NUM_CLASSES);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolClassMinSize(CFE_ES_GenPoolSizeClass(SIZE_MAX)),
+                       SIZE_MAX & ~(SIZE_MAX >> (CFE_ES_GENERIC_POOL_CLASS_BITS + 1)));
+    Mismatches = 0;
+    for (BlockSize = 0; BlockSize <= 1024; ++BlockSize)
+    {
+        SizeClass = CFE_ES_GenPoolSizeClass(BlockSize);
+        ClassSize = CFE_ES_GenPoolClassMinSize(SizeClass);
+        i         = Pool1.SizeClassMap[SizeClass];
+        if (ClassSize > BlockSize || CFE_ES_GenPoolClassMinSize(SizeClass + 1) <= BlockSize ||
+            (i > 0 && Pool1.Buckets[i - 1].BlockSize >= ClassSize) ||
+            (i < Pool1.NumBuckets && Pool1.Buckets[i].BlockSize < ClassSize))
+        {
+            ++Mismatches;
+        }
+    }
+    UtAssert_ZERO(Mismatches);
+
     /* Allocate buffers until no space left */
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 44));
     UtAssert_NONZERO(Offset1);
@@ -3535,12 +3745,18 @@ void TestPerf(void)
         CFE_ES_StopPerfDataCmd_t       PerfStopCmd;
         CFE_ES_SetPerfFilterMaskCmd_t  PerfSetFilterMaskCmd;
         CFE_ES_SetPerfTriggerMaskCmd_t PerfSetTrigMaskCmd;
+        CFE_ES_StartPerfStreamCmd_t    PerfStartStreamCmd;
+        CFE_ES_StopPerfStreamCmd_t     PerfStopStreamCmd;
     } CmdBuf;
 
     UtPrintf("Begin Test Performance Log");
 
-    CFE_ES_PerfData_t *Perf;
-    void *             TempBuff;
+    CFE_ES_PerfData_t *        Perf;
+    CFE_ES_PerfTaskRing_t *    Ring;
+    CFE_ES_PerfStreamGlobal_t *Stream;
+    void *                 TempBuff;
+    osal_index_t           TaskIndex;
+    uint32                 i;
 
     /*
     ** Set the pointer to the data area
@@ -3754,11 +3970,22 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PERF_TRIGGER_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
-    /* Test addition where state goes to idle after first check */
+    /* Test addition where state goes to idle after first check, from outside of a task */
     ES_ResetUnitTest();
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERROR);
     UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[CFE_ES_PERF_SHARED_RING_IDX].WriteCount, 0);
+
+    /* Test addition from outside of a task goes to the shared ring under the lock */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERROR);
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[CFE_ES_PERF_SHARED_RING_IDX].WriteCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3775,19 +4002,35 @@ void TestPerf(void)
     ES_ResetUnitTest();
     Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.FilterMask[0] = 0x0;
-    Perf->MetaData.DataEnd       = 0;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDataCount(), 0);
 
     /* Test addition of a new entry to the performance log with the data count
      * below the maximum allowed
      */
     ES_ResetUnitTest();
     Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.DataCount     = 0;
     Perf->MetaData.FilterMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDataCount(), 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[CFE_ES_GetPerfTaskRingIndex()].WriteCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[CFE_ES_GetPerfTaskRingIndex()].Entry[0].Data, 0x1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test the ring index of a task outside of the task table */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_LT(CFE_ES_GetPerfTaskRingIndex(), OS_MAX_TASKS);
+    TaskIndex = OS_MAX_TASKS;
+    UT_SetDataBuffer(UT_KEY(OS_ObjectIdToArrayIndex), &TaskIndex, sizeof(TaskIndex), false);
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfTaskRingIndex(), CFE_ES_PERF_SHARED_RING_IDX);
+
+    /* Test the data count is limited to the size of the log */
+    ES_ResetUnitTest();
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        CFE_ES_Global.PerfTaskRing[i].WriteCount = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1;
+    }
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDataCount(), CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
 
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
@@ -3809,6 +4052,49 @@ void TestPerf(void)
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
 
+    /* Test that in START mode a busy task's ring stops before it wraps over
+     * the entries after the trigger, so the merge keeps the trigger window
+     */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_TRIGGER_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd), UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x2;
+    Ring                          = &CFE_ES_Global.PerfTaskRing[CFE_ES_GetPerfTaskRingIndex()];
+    CFE_ES_PerfLogAdd(0x0, 0);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 10; ++i)
+    {
+        CFE_ES_PerfLogAdd(0x2, 0);
+    }
+    UtAssert_UINT32_EQ(Ring->WriteCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 11);
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE; ++i)
+    {
+        Ring->Entry[i].TimerLower32 = 100 + i;
+    }
+    Ring                        = &CFE_ES_Global.PerfTaskRing[CFE_ES_PERF_SHARED_RING_IDX];
+    Ring->Entry[0].TimerLower32 = 50;
+    Ring->Entry[1].TimerLower32 = 102;
+    Ring->WriteCount            = 2;
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogMergeInit(&CFE_ES_Global.BackgroundPerfDumpState),
+                       CFE_PLATFORM_ES_PERF_TASK_RING_SIZE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[CFE_ES_GetPerfTaskRingIndex()], 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[CFE_ES_PERF_SHARED_RING_IDX], 1);
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].Data, 0x1);
+
+    /* Test that the ring takes entries again once collection is restarted */
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd), UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Ring                 = &CFE_ES_Global.PerfTaskRing[CFE_ES_GetPerfTaskRingIndex()];
+    CFE_ES_PerfLogAdd(0x2, 0);
+    UtAssert_UINT32_EQ(Ring->WriteCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1);
+    UtAssert_UINT32_EQ(Ring->TriggerBase, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE);
+
     /* Test addition of a new entry to the performance log with a center
      * trigger mode and the trigger count is less than half the buffer size
      */
@@ -3853,6 +4139,7 @@ void TestPerf(void)
     /* Nominal call 1 - should go through up to the DELAY state */
     ES_ResetUnitTest();
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    Perf->MetaData.DataCount = 0;
     CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_DELAY);
@@ -3931,6 +4218,199 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
+    /* before the merge, it should report the entries in the task rings */
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_LOCK_DATA;
+    CFE_ES_Global.PerfTaskRing[0].WriteCount           = 3;
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 3);
+
+    /* Test that starting collection leaves out the entries already in the task rings */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfTaskRing[1].WriteCount = 7;
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_TRIGGER_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd), UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[1].ReadBase, 7);
+    UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDataCount(), 0);
+
+    /* Test that the merge orders the entries of all task rings by time */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    Perf->MetaData.DataCount    = 5;
+    Ring                        = &CFE_ES_Global.PerfTaskRing[0];
+    Ring->Entry[0].Data         = 1;
+    Ring->Entry[0].TimerLower32 = 10;
+    Ring->Entry[1].Data         = 3;
+    Ring->Entry[1].TimerLower32 = 30;
+    Ring->Entry[2].Data         = 4;
+    Ring->Entry[2].TimerLower32 = 50;
+    Ring->WriteCount            = 3;
+    Ring                        = &CFE_ES_Global.PerfTaskRing[CFE_ES_PERF_SHARED_RING_IDX];
+    Ring->Entry[0].Data         = 2;
+    Ring->Entry[0].TimerLower32 = 20;
+    Ring->Entry[1].Data         = 5;
+    Ring->Entry[1].TimerUpper32 = 1;
+    Ring->WriteCount            = 2;
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogMergeInit(&CFE_ES_Global.BackgroundPerfDumpState), 5);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+    for (i = 0; i < 6; ++i)
+    {
+        CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    }
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 5);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 5);
+    for (i = 0; i < 5; ++i)
+    {
+        UtAssert_UINT32_EQ(Perf->DataBuffer[i].Data, i + 1);
+    }
+
+    /* Test that empty task rings leave the perf log as it was, e.g. after a processor reset */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogMergeInit(&CFE_ES_Global.BackgroundPerfDumpState), 0);
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 5);
+
+    /* Test that a wrapped ring excludes the older entries of the other rings */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    Ring = &CFE_ES_Global.PerfTaskRing[0];
+    for (i = 10; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 10; ++i)
+    {
+        Ring->Entry[i & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)].TimerLower32 = 1000 + i;
+    }
+    Ring->WriteCount            = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 10;
+    Ring                        = &CFE_ES_Global.PerfTaskRing[1];
+    Ring->Entry[0].TimerLower32 = 5;
+    Ring->Entry[1].TimerLower32 = 2000;
+    Ring->WriteCount            = 2;
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogMergeInit(&CFE_ES_Global.BackgroundPerfDumpState),
+                       CFE_PLATFORM_ES_PERF_TASK_RING_SIZE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[0], 11);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[1], 1);
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].TimerLower32, 1011);
+
+    /* Test that only the newest entries are kept if there are more than fit */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    for (i = 0; i < CFE_ES_PERF_TASK_RING_COUNT; ++i)
+    {
+        CFE_ES_Global.PerfTaskRing[i].WriteCount = CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1;
+    }
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter =
+        CFE_ES_PerfLogMergeInit(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_True(CFE_ES_Global.BackgroundPerfDumpState.StateCounter > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE,
+                  "More entries than fit in the log");
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergeSkip,
+                       CFE_ES_Global.BackgroundPerfDumpState.StateCounter - CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+    CFE_ES_Global.BackgroundPerfDumpState.MergeSkip = 0;
+    Perf->MetaData.DataCount                        = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+
+    /* Test that an entry overwritten by a late writer is dropped */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    CFE_ES_Global.PerfTaskRing[0].WriteCount = 2;
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogMergeInit(&CFE_ES_Global.BackgroundPerfDumpState), 2);
+    CFE_ES_Global.PerfTaskRing[0].WriteCount = 2 + CFE_PLATFORM_ES_PERF_TASK_RING_SIZE;
+    CFE_ES_PerfLogMergeNext(&CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[0], 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+
+    /* Test a complete perf log dump of the task rings */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    CFE_ES_Global.PerfTaskRing[0].WriteCount           = 2;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 2);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_DATAWRITTEN_EID);
+
+    /* Test starting the perf stream, which begins with the entries added after the start */
+    ES_ResetUnitTest();
+    Stream                                   = &CFE_ES_Global.BackgroundPerfStreamState;
+    CFE_ES_Global.PerfTaskRing[0].WriteCount = 3;
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(0, Stream));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartStreamCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_STREAM_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_START_EID);
+    UtAssert_BOOL_TRUE(Stream->RequestedEnable);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, Stream));
+    UtAssert_BOOL_TRUE(Stream->Enabled);
+    UtAssert_UINT32_EQ(Stream->StreamPos[0], 3);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    /* Test that the stream merges the task rings by time and holds a partly filled packet */
+    Ring                        = &CFE_ES_Global.PerfTaskRing[0];
+    Ring->Entry[3].Data         = 1;
+    Ring->Entry[3].TimerLower32 = 10;
+    Ring->Entry[4].Data         = 3;
+    Ring->Entry[4].TimerLower32 = 30;
+    Ring->WriteCount            = 5;
+    Ring                        = &CFE_ES_Global.PerfTaskRing[CFE_ES_PERF_SHARED_RING_IDX];
+    Ring->Entry[0].Data         = 2;
+    Ring->Entry[0].TimerLower32 = 20;
+    Ring->WriteCount            = 1;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(10, Stream));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.EntryCount, 3);
+    for (i = 0; i < 3; ++i)
+    {
+        UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.Entries[i].Data, i + 1);
+    }
+
+    /* Test that a partly filled packet is sent after the flush delay */
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(CFE_PLATFORM_ES_PERF_STREAM_FLUSH_DELAY, Stream));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.PacketCount, 1);
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.EntryCount, 0);
+
+    /* Test that full packets are sent right away, up to the limit for one run */
+    Ring->WriteCount = 1 + (CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE + 1) * CFE_MISSION_ES_PERF_STREAM_MAX_ENTRIES;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, Stream));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1 + CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE);
+    UtAssert_UINT32_EQ(Stream->StreamPos[CFE_ES_PERF_SHARED_RING_IDX],
+                       1 + CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE * CFE_MISSION_ES_PERF_STREAM_MAX_ENTRIES);
+
+    /* Test that a failed send is counted */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitMsg), 1, -1);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, Stream));
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.SendErrorCount, 1);
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.EntryCount, 0);
+
+    /* Test that entries overwritten before they are streamed are counted as lost */
+    Ring             = &CFE_ES_Global.PerfTaskRing[0];
+    Ring->WriteCount = 5 + CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 9;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, Stream));
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.LostEntryCount, 10);
+    Stream->StreamEnd[0]              = Stream->StreamPos[0] + 1;
+    Stream->TlmPkt.Payload.EntryCount = 0;
+    Ring->WriteCount += CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1;
+    CFE_ES_PerfLogStreamFill(Stream);
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.LostEntryCount, 11);
+    UtAssert_UINT32_EQ(Stream->TlmPkt.Payload.EntryCount, 0);
+
+    /* Test that stopping the stream sends the partly filled packet */
+    UT_InitData();
+    Stream->TlmPkt.Payload.EntryCount = 1;
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopStreamCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_STREAM_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_STOP_EID);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(0, Stream));
+    UtAssert_BOOL_FALSE(Stream->Enabled);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(0, Stream));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 }
 
 void TestAPI(void)
@@ -4398,11 +4878,22 @@ void TestAPI(void)
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_16), 2688);
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test CRC type 16 with a result that has the high bit set, which is returned sign extended */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32), 1314624383);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data[6], 6, CFE_ES_CalculateCRC(&Data, 6, 345353, CFE_MISSION_ES_CRC_32),
+                                           CFE_MISSION_ES_CRC_32),
+                       1314624383);
+
+    /* Test calculating a CRC on a range of memory using CRC type 32C */
     ES_ResetUnitTest();
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32), 0);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32C), 942868152);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -4509,7 +5000,7 @@ void TestAPI(void)
 
     /*
      * Test public Name+ID query/lookup API for tasks
-     * This just uses OSAL routines to implement, but need to cover error paths.
+     * Tasks not registered with ES are looked up through OSAL.
      */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &UtAppRecPtr, &UtTaskRecPtr);
@@ -4526,6 +5017,11 @@ void TestAPI(void)
     UtAssert_INT32_EQ(CFE_ES_GetTaskIDByName(&TaskId, NULL), CFE_ES_BAD_ARGUMENT);
     UtAssert_INT32_EQ(CFE_ES_GetTaskIDByName(NULL, "NotNULL"), CFE_ES_BAD_ARGUMENT);
     CFE_UtAssert_SUCCESS(CFE_ES_GetTaskIDByName(&TaskId, AppName));
+    CFE_UtAssert_RESOURCEID_EQ(TaskId, CFE_ES_TaskRecordGetID(UtTaskRecPtr));
+    CFE_UtAssert_SUCCESS(CFE_ES_GetTaskIDByName(&TaskId, "NotRegistered"));
+    CFE_ES_TaskRecordSetUsed(UtTaskRecPtr, CFE_RESOURCEID_RESERVED);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetIdByName), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskIDByName(&TaskId, AppName), CFE_ES_ERR_NAME_NOT_FOUND);
     UT_SetDeferredRetcode(UT_KEY(OS_TaskGetIdByName), 1, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_GetTaskIDByName(&TaskId, "Nonexistent"), CFE_ES_ERR_NAME_NOT_FOUND);
 
@@ -5510,6 +6006,123 @@ void TestESMempool(void)
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, NULL), CFE_ES_BAD_ARGUMENT);
 }
 
+/* Tests of the per-task caches of mutex-protected memory pools */
+void TestESMempoolTaskCache(void)
+{
+    CFE_ES_MemHandle_t      PoolID1; /* Poo1 1 handle, with mutex */
+    CFE_ES_MemHandle_t      PoolID2; /* Poo1 2 handle, no mutex */
+    uint8                   Buffer1[2048];
+    uint8                   Buffer2[1024];
+    CFE_ES_MemPoolBuf_t     addressp[CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH + 1];
+    CFE_ES_MemPoolBuf_t     addressp2 = CFE_ES_MEMPOOLBUF_C(0);
+    CFE_ES_MemPoolStats_t   Stats;
+    CFE_ES_PoolTaskCache_t *CachePtr;
+    CFE_ES_TaskId_t         TaskId;
+    uint32                  Idx;
+    uint32                  i;
+
+    UtPrintf("Begin Test ES memory pool task caches");
+
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreate(&PoolID1, Buffer1, sizeof(Buffer1)));
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateNoSem(&PoolID2, Buffer2, sizeof(Buffer2)));
+
+    TaskId = CFE_ES_TaskId_FromOSAL(OS_TaskGetId());
+    CFE_UtAssert_SUCCESS(CFE_ES_TaskID_ToIndex(TaskId, &Idx));
+    CachePtr = &CFE_ES_Global.PoolTaskCache[Idx];
+
+    /* Test that a returned block is kept by the task and handed out again */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[0], PoolID1, 100), 100);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), 100);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.NumCachedBlocks, 1);
+    UtAssert_UINT32_EQ(Stats.CacheHitCount, 0);
+
+    /* Test that a cached block can not be returned or queried again */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp[0]), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* Test that a request of a different bucket does not use the cached block */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[1], PoolID1, 500), 500);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 1);
+
+    /* Test that a request of the same bucket uses the cached block */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 120), 120);
+    UtAssert_ADDRESS_EQ(addressp2, addressp[0]);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp2), 120);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.NumCachedBlocks, 0);
+    UtAssert_UINT32_EQ(Stats.CacheHitCount, 1);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), 120);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[1]), 500);
+
+    /* Test that blocks of pools without a mutex are not cached */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID2, 100), 100);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID2, addressp2), 100);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 2);
+
+    /* Test that the oldest block goes back to the pool when the cache is full */
+    CFE_ES_FlushPoolTaskCache(TaskId);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[i], PoolID1, 16), 16);
+    }
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[i]), 16);
+    }
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.NumCachedBlocks, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH);
+    UtAssert_ADDRESS_EQ(CFE_ES_MEMPOOLBUF_C(Buffer1 + CachePtr->Entry[0].DataOffset), addressp[1]);
+
+    /* Test that the cache of a deleted task is returned to the pool */
+    CFE_ES_FlushPoolTaskCache(TaskId);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+    UtAssert_UINT32_EQ(CachePtr->OwnerTask, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.NumCachedBlocks, 0);
+
+    /* Test that a flush of an invalid task or a cache owned by another task does nothing */
+    CFE_ES_FlushPoolTaskCache(CFE_ES_TASKID_UNDEFINED);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[0], PoolID1, 16), 16);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), 16);
+    CachePtr->OwnerTask = 0x12345;
+    CFE_ES_FlushPoolTaskCache(TaskId);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 1);
+
+    /* Test that the blocks left by a previous task are returned when the cache is claimed */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[0], PoolID1, 16), 16);
+    UtAssert_UINT32_EQ(CachePtr->OwnerTask, OS_ObjectIdToInteger(OS_TaskGetId()));
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.NumCachedBlocks, 0);
+    UtAssert_UINT32_EQ(Stats.CacheHitCount, 1);
+
+    /* Test that a cache being flushed is bypassed */
+    CachePtr->OwnerTask = CFE_ES_POOL_TASK_CACHE_BUSY;
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), 16);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+    CachePtr->OwnerTask = 0;
+
+    /* Test that callers which are not tasks bypass the cache */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[0], PoolID1, 16), 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), 16);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+
+    /* Test that blocks of a deleted pool are dropped from the cache */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp[0], PoolID1, 16), 16);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp[0]), 16);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID1));
+    CFE_ES_FlushPoolTaskCache(TaskId);
+    UtAssert_UINT32_EQ(CachePtr->NumEntries, 0);
+}
+
 /* Tests to fill gaps in coverage in SysLog */
 void TestSysLog(void)
 {
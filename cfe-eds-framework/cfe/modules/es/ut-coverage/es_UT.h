@@ -245,8 +245,11 @@ void TestCDSMempool(void);
 ******************************************************************************/
 void TestESMempool(void);
 
+void TestESMempoolTaskCache(void);
+
 void TestSysLog(void);
 void TestResourceID(void);
+void TestNameHash(void);
 void TestGenericCounterAPI(void);
 void TestGenericPool(void);
 void TestLibs(void);
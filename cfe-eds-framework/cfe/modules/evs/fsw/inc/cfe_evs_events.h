@@ -468,6 +468,28 @@
  *  Invalid length for the command code in message ID #CFE_EVS_CMD_MID received on the EVS message pipe.
  */
 #define CFE_EVS_LEN_ERR_EID 43
+
+/**
+ * \brief EVS Set Event Rate Limit Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_EVS_SET_EVENT_RATE_CC EVS Set Event Rate Limit Command \endlink success.
+ */
+#define CFE_EVS_SETEVTRATE_EID 44
+
+/**
+ * \brief EVS Set Application Event Rate Limit Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_EVS_SET_APP_EVENT_RATE_CC EVS Set Application Event Rate Limit Command \endlink success.
+ */
+#define CFE_EVS_SETAPPEVTRATE_EID 45
 /**\}*/
 
 #endif /* CFE_EVS_EVENTS_H */
@@ -45,12 +45,13 @@
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 FilterScheme)
 {
-    uint16               FilterLimit;
-    uint16               i;
-    int32                Status;
-    CFE_ES_AppId_t       AppID;
-    CFE_EVS_BinFilter_t *AppFilters;
-    EVS_AppData_t *      AppDataPtr;
+    uint16                         FilterLimit;
+    uint16                         i;
+    int32                          Status;
+    CFE_ES_AppId_t                 AppID;
+    const CFE_EVS_BinFilter_t *    AppFilters;
+    const CFE_EVS_BinRateFilter_t *AppRateFilters;
+    EVS_AppData_t *                AppDataPtr;
 
     /* Query and verify the caller's AppID */
     Status = EVS_GetCurrentContext(&AppDataPtr, &AppID);
@@ -60,7 +61,7 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
         memset(AppDataPtr, 0, sizeof(EVS_AppData_t));
 
         /* Verify filter arguments */
-        if (FilterScheme != CFE_EVS_EventFilter_BINARY)
+        if (FilterScheme != CFE_EVS_EventFilter_BINARY && FilterScheme != CFE_EVS_EventFilter_BINARY_RATE)
         {
             Status = CFE_EVS_UNKNOWN_FILTER;
         }
@@ -85,9 +86,26 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
                 CFE_ES_WriteToSysLog("%s: Filter limit truncated to %d\n", __func__, (int)FilterLimit);
             }
 
-            if (Filters != NULL)
+            /* Initialize the limit of all the application's events */
+            EVS_SetRateLimit(&AppDataPtr->AppRate, CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE,
+                             CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST);
+
+            if (Filters != NULL && FilterScheme == CFE_EVS_EventFilter_BINARY_RATE)
+            {
+                AppRateFilters = Filters;
+
+                /* Copy provided filters and their rate limits */
+                for (i = 0; i < FilterLimit; i++)
+                {
+                    AppDataPtr->BinFilters[i].EventID = AppRateFilters[i].EventID;
+                    AppDataPtr->BinFilters[i].Mask    = AppRateFilters[i].Mask;
+                    AppDataPtr->BinFilters[i].Count   = 0;
+                    EVS_SetRateLimit(&AppDataPtr->FilterRates[i], AppRateFilters[i].Rate, AppRateFilters[i].Burst);
+                }
+            }
+            else if (Filters != NULL)
             {
-                AppFilters = (CFE_EVS_BinFilter_t *)Filters;
+                AppFilters = Filters;
 
                 /* Copy provided filters */
                 for (i = 0; i < FilterLimit; i++)
@@ -106,6 +124,8 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
                 AppDataPtr->BinFilters[i].Count   = 0;
             }
 
+            EVS_IndexFilters(AppDataPtr);
+
             EVS_AppDataSetUsed(AppDataPtr, AppID);
         }
     }
@@ -243,6 +263,60 @@ CFE_Status_t CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uin
     return (Status);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_EVS_SendDeferredEvent
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_EVS_SendDeferredEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    int32              Status;
+    CFE_ES_AppId_t     AppID;
+    CFE_TIME_SysTime_t Time;
+    va_list            Ptr;
+    EVS_AppData_t *    AppDataPtr;
+    bool               IsDeferred;
+
+    if (Spec == NULL)
+    {
+        return CFE_EVS_INVALID_PARAMETER;
+    }
+
+    /* Query and verify the caller's AppID */
+    Status = EVS_GetCurrentContext(&AppDataPtr, &AppID);
+    if (Status == CFE_SUCCESS)
+    {
+        if (!EVS_AppDataIsMatch(AppDataPtr, AppID))
+        {
+            /* Handler for events from apps not registered with EVS */
+            Status = EVS_NotRegistered(AppDataPtr, AppID);
+        }
+        else if (EVS_IsFiltered(AppDataPtr, EventID, EventType) == false)
+        {
+            /* Get current spacecraft time */
+            Time = CFE_TIME_GetTime();
+
+            /* Queue the event for the EVS task */
+            va_start(Ptr, Spec);
+            IsDeferred = EVS_DeferEvent(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            va_end(Ptr);
+
+            if (!IsDeferred)
+            {
+                /* Send the event packets now */
+                va_start(Ptr, Spec);
+                EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                va_end(Ptr);
+            }
+        }
+    }
+
+    return (Status);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_EVS_ResetFilter
@@ -268,7 +342,7 @@ int32 CFE_EVS_ResetFilter(uint16 EventID)
         }
         else
         {
-            FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+            FilterPtr = EVS_FindEventID(AppDataPtr, EventID);
 
             if (FilterPtr != NULL)
             {
@@ -0,0 +1,670 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File: cfe_evs_deferred.c
+**
+**  Title: Event Services Deferred Events
+**
+**  Purpose: This module defines the functions that capture events sent with
+**           CFE_EVS_SendDeferredEvent() and format them in the EVS task
+**
+**  Notes:
+**    Each application has a bounded multi-producer, single consumer ring.
+**    Every slot has a sequence number: a sender claims position P by
+**    advancing PutPos with a compare and swap when the slot's sequence is P,
+**    fills the slot and then sets the sequence to P+1.  The EVS task formats
+**    the slot when its sequence is P+1 and sets it to P+RING_SIZE to give it
+**    back to the senders.
+**
+*/
+
+/* Include Files */
+#include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+#include "cfe_evs_deferred.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Mask to convert a ring position to a slot index */
+#define EVS_DEFERRED_RING_MASK (CFE_PLATFORM_EVS_DEFERRED_RING_SIZE - 1)
+
+/* Local Function Prototypes */
+bool EVS_DeferredRingPut(EVS_DeferredRing_t *Ring, const EVS_DeferredEvent_t *Event);
+int  EVS_DeferredFormatArg(char *Buffer, size_t BufferSize, const char *ConvSpec, const EVS_DeferredConversion_t *Conv,
+                           const EVS_DeferredEvent_t *Event, const EVS_DeferredArg_t *Arg);
+void EVS_GenerateDeferredEventTelemetry(EVS_AppData_t *AppDataPtr, const EVS_DeferredEvent_t *Event);
+
+/* Function Definitions */
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_DeferredInit(void)
+{
+    uint32 AppIndex;
+    uint32 i;
+
+    for (AppIndex = 0; AppIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS; AppIndex++)
+    {
+        CFE_EVS_Global.DeferredRing[AppIndex].PutPos = 0;
+        CFE_EVS_Global.DeferredRing[AppIndex].GetPos = 0;
+
+        /* Every slot starts out free for the first pass of positions */
+        for (i = 0; i < CFE_PLATFORM_EVS_DEFERRED_RING_SIZE; i++)
+        {
+            CFE_EVS_Global.DeferredRing[AppIndex].Slots[i].Sequence = i;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_DeferEvent(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType, const CFE_TIME_SysTime_t *TimeStamp,
+                    const char *Spec, va_list ArgPtr)
+{
+    EVS_DeferredEvent_t Event;
+    bool                IsDeferred;
+
+    IsDeferred = EVS_DeferredCaptureArgs(&Event, Spec, ArgPtr);
+
+    if (IsDeferred)
+    {
+        Event.AppID     = EVS_AppDataGetID(AppDataPtr);
+        Event.EventID   = EventID;
+        Event.EventType = EventType;
+        Event.Time      = *TimeStamp;
+
+        /* The ring has the same index as the app data */
+        IsDeferred =
+            EVS_DeferredRingPut(&CFE_EVS_Global.DeferredRing[AppDataPtr - CFE_EVS_Global.AppData], &Event);
+    }
+
+    return IsDeferred;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredRingPut
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Claims the next slot in the ring and copies the event to it.
+ * Returns false if the ring is full.
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_DeferredRingPut(EVS_DeferredRing_t *Ring, const EVS_DeferredEvent_t *Event)
+{
+    EVS_DeferredSlot_t *Slot;
+    uint32              Pos;
+    int32               Lag;
+
+    Pos = CFE_ATOMIC_LOAD_RELAXED(&Ring->PutPos);
+    while (true)
+    {
+        Slot = &Ring->Slots[Pos & EVS_DEFERRED_RING_MASK];
+        Lag  = (int32)(CFE_ATOMIC_LOAD(&Slot->Sequence) - Pos);
+
+        if (Lag == 0)
+        {
+            /* Slot is free for this position, claim it unless another sender did first */
+            if (CFE_ATOMIC_CAS(&Ring->PutPos, &Pos, Pos + 1))
+            {
+                break;
+            }
+        }
+        else if (Lag < 0)
+        {
+            /* Slot still holds the event from the previous pass, the ring is full */
+            return false;
+        }
+        else
+        {
+            /* Another sender claimed this position */
+            Pos = CFE_ATOMIC_LOAD_RELAXED(&Ring->PutPos);
+        }
+    }
+
+    Slot->Event = *Event;
+
+    /* Publish the event to the EVS task */
+    CFE_ATOMIC_STORE(&Slot->Sequence, Pos + 1);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_ProcessDeferredEvents
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_ProcessDeferredEvents(void)
+{
+    EVS_DeferredRing_t *Ring;
+    EVS_DeferredSlot_t *Slot;
+    EVS_AppData_t *     AppDataPtr;
+    uint32              AppIndex;
+
+    for (AppIndex = 0; AppIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS; AppIndex++)
+    {
+        Ring       = &CFE_EVS_Global.DeferredRing[AppIndex];
+        AppDataPtr = &CFE_EVS_Global.AppData[AppIndex];
+        Slot       = &Ring->Slots[Ring->GetPos & EVS_DEFERRED_RING_MASK];
+
+        while (CFE_ATOMIC_LOAD(&Slot->Sequence) == Ring->GetPos + 1)
+        {
+            /* The app data of a deleted app may be in use by another app by now */
+            if (EVS_AppDataIsMatch(AppDataPtr, Slot->Event.AppID))
+            {
+                EVS_GenerateDeferredEventTelemetry(AppDataPtr, &Slot->Event);
+            }
+
+            /* Give the slot back to the senders for the next pass */
+            CFE_ATOMIC_STORE(&Slot->Sequence, Ring->GetPos + CFE_PLATFORM_EVS_DEFERRED_RING_SIZE);
+
+            ++Ring->GetPos;
+            Slot = &Ring->Slots[Ring->GetPos & EVS_DEFERRED_RING_MASK];
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_GenerateDeferredEventTelemetry
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Formats a deferred event and sends all configured telemetry for it
+ *
+ *-----------------------------------------------------------------*/
+void EVS_GenerateDeferredEventTelemetry(EVS_AppData_t *AppDataPtr, const EVS_DeferredEvent_t *Event)
+{
+    CFE_EVS_LongEventTlm_t LongEventTlm;
+    int                    ExpandedLength;
+
+    CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                 sizeof(LongEventTlm));
+    LongEventTlm.Payload.PacketID.EventID   = Event->EventID;
+    LongEventTlm.Payload.PacketID.EventType = Event->EventType;
+
+    ExpandedLength =
+        EVS_DeferredExpand((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), Event);
+
+    EVS_SendEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, &Event->Time);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredParseConversion
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_DeferredParseConversion(const char *Fmt, EVS_DeferredConversion_t *ConvOut)
+{
+    const char *          Ptr = Fmt + 1;
+    uint32                LongCount;
+    char                  Modifier = 0;
+    bool                  HasPrecision;
+    EVS_DeferredArgType_t IntType;
+
+    ConvOut->ArgType  = EVS_DeferredArgType_INVALID;
+    ConvOut->IsSigned = false;
+
+    /* Flags, field width and precision, a '*' ends the scan and is rejected as a conversion */
+    Ptr += strspn(Ptr, "-+ #0");
+    Ptr += strspn(Ptr, "0123456789");
+    HasPrecision = (*Ptr == '.');
+    if (HasPrecision)
+    {
+        ++Ptr;
+        Ptr += strspn(Ptr, "0123456789");
+    }
+
+    /* Length modifier */
+    LongCount = strspn(Ptr, "l");
+    Ptr += LongCount;
+    if (LongCount == 0 && *Ptr != 0 && strchr("hjztL", *Ptr) != NULL)
+    {
+        Modifier = *Ptr;
+        ++Ptr;
+        if (Modifier == 'h' && *Ptr == 'h')
+        {
+            ++Ptr;
+        }
+    }
+
+    switch (Modifier)
+    {
+        case 'j':
+            IntType = EVS_DeferredArgType_INTMAX;
+            break;
+        case 'z':
+            IntType = EVS_DeferredArgType_SIZE;
+            break;
+        case 't':
+            IntType = EVS_DeferredArgType_PTRDIFF;
+            break;
+        case 'L':
+            IntType = EVS_DeferredArgType_INVALID;
+            break;
+        default:
+            if (LongCount == 0)
+            {
+                IntType = EVS_DeferredArgType_INT;
+            }
+            else if (LongCount == 1)
+            {
+                IntType = EVS_DeferredArgType_LONG;
+            }
+            else if (LongCount == 2)
+            {
+                IntType = EVS_DeferredArgType_LONGLONG;
+            }
+            else
+            {
+                IntType = EVS_DeferredArgType_INVALID;
+            }
+            break;
+    }
+
+    switch (*Ptr)
+    {
+        case '%':
+            if (Ptr == Fmt + 1)
+            {
+                ConvOut->ArgType = EVS_DeferredArgType_NONE;
+            }
+            break;
+        case 'd':
+        case 'i':
+            ConvOut->IsSigned = true;
+            ConvOut->ArgType  = IntType;
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            ConvOut->ArgType = IntType;
+            break;
+        case 'c':
+            if (LongCount == 0 && Modifier == 0)
+            {
+                ConvOut->ArgType = EVS_DeferredArgType_INT;
+            }
+            break;
+        case 'a':
+        case 'A':
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+            /* An 'l' has no effect on floating point conversions */
+            if (LongCount <= 1 && Modifier == 0)
+            {
+                ConvOut->ArgType = EVS_DeferredArgType_DOUBLE;
+            }
+            break;
+        case 'p':
+            if (LongCount == 0 && Modifier == 0)
+            {
+                ConvOut->ArgType = EVS_DeferredArgType_POINTER;
+            }
+            break;
+        case 's':
+            /* With a precision the argument need not be terminated, so it can't be copied */
+            if (LongCount == 0 && Modifier == 0 && !HasPrecision)
+            {
+                ConvOut->ArgType = EVS_DeferredArgType_STRING;
+            }
+            break;
+        default:
+            /* Includes "%n", '*' and the end of the string */
+            break;
+    }
+
+    if (*Ptr != 0)
+    {
+        ++Ptr;
+    }
+
+    ConvOut->Length = Ptr - Fmt;
+    if (ConvOut->Length >= EVS_DEFERRED_MAX_CONVERSION_LENGTH)
+    {
+        ConvOut->ArgType = EVS_DeferredArgType_INVALID;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredCaptureArgs
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_DeferredCaptureArgs(EVS_DeferredEvent_t *Event, const char *Spec, va_list ArgPtr)
+{
+    EVS_DeferredConversion_t Conv;
+    EVS_DeferredArg_t *      Arg;
+    const char *             Fmt;
+    const char *             Str;
+    size_t                   StrSize;
+    size_t                   StringsUsed = 0;
+    uint32                   ArgCount    = 0;
+    bool                     IsCaptured  = true;
+
+    /*
+     * The format string is copied as well, the app may be deleted and its
+     * image unloaded before the EVS task formats the event
+     */
+    StrSize = strlen(Spec) + 1;
+    if (StrSize > sizeof(Event->Spec))
+    {
+        IsCaptured = false;
+    }
+    else
+    {
+        memcpy(Event->Spec, Spec, StrSize);
+    }
+
+    Fmt = strchr(Spec, '%');
+    while (IsCaptured && Fmt != NULL)
+    {
+        EVS_DeferredParseConversion(Fmt, &Conv);
+
+        if (Conv.ArgType == EVS_DeferredArgType_INVALID ||
+            (Conv.ArgType != EVS_DeferredArgType_NONE && ArgCount >= CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS))
+        {
+            /* Format immediately, no argument is read */
+            Conv.ArgType = EVS_DeferredArgType_INVALID;
+            IsCaptured   = false;
+        }
+
+        /* At most one past the end of the array, only used for an argument that is read */
+        Arg = &Event->Args[ArgCount];
+
+        /* Read each argument as the type printf would read it */
+        switch (Conv.ArgType)
+        {
+            case EVS_DeferredArgType_INT:
+                if (Conv.IsSigned)
+                {
+                    Arg->SignedInt = va_arg(ArgPtr, int);
+                }
+                else
+                {
+                    Arg->UnsignedInt = va_arg(ArgPtr, unsigned int);
+                }
+                break;
+            case EVS_DeferredArgType_LONG:
+                if (Conv.IsSigned)
+                {
+                    Arg->SignedInt = va_arg(ArgPtr, long);
+                }
+                else
+                {
+                    Arg->UnsignedInt = va_arg(ArgPtr, unsigned long);
+                }
+                break;
+            case EVS_DeferredArgType_LONGLONG:
+                if (Conv.IsSigned)
+                {
+                    Arg->SignedInt = va_arg(ArgPtr, long long);
+                }
+                else
+                {
+                    Arg->UnsignedInt = va_arg(ArgPtr, unsigned long long);
+                }
+                break;
+            case EVS_DeferredArgType_INTMAX:
+                if (Conv.IsSigned)
+                {
+                    Arg->SignedInt = va_arg(ArgPtr, intmax_t);
+                }
+                else
+                {
+                    Arg->UnsignedInt = va_arg(ArgPtr, uintmax_t);
+                }
+                break;
+            case EVS_DeferredArgType_SIZE:
+                Arg->UnsignedInt = va_arg(ArgPtr, size_t);
+                break;
+            case EVS_DeferredArgType_PTRDIFF:
+                Arg->SignedInt = va_arg(ArgPtr, ptrdiff_t);
+                break;
+            case EVS_DeferredArgType_DOUBLE:
+                Arg->Float = va_arg(ArgPtr, double);
+                break;
+            case EVS_DeferredArgType_POINTER:
+                Arg->Pointer = va_arg(ArgPtr, void *);
+                break;
+            case EVS_DeferredArgType_STRING:
+                Str = va_arg(ArgPtr, const char *);
+                if (Str == NULL)
+                {
+                    IsCaptured = false;
+                }
+                else
+                {
+                    StrSize = strlen(Str) + 1;
+                    if (StrSize > sizeof(Event->Strings) - StringsUsed)
+                    {
+                        IsCaptured = false;
+                    }
+                    else
+                    {
+                        memcpy(&Event->Strings[StringsUsed], Str, StrSize);
+                        Arg->StringOffset = StringsUsed;
+                        StringsUsed += StrSize;
+                    }
+                }
+                break;
+            default:
+                /* "%%" */
+                break;
+        }
+
+        if (Conv.ArgType != EVS_DeferredArgType_NONE)
+        {
+            ++ArgCount;
+        }
+
+        Fmt = strchr(Fmt + Conv.Length, '%');
+    }
+
+    return IsCaptured;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredFormatArg
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Formats one argument with its conversion specification, passing
+ * the argument as the same type the sender passed it.  Returns the
+ * result of snprintf().
+ *
+ *-----------------------------------------------------------------*/
+int EVS_DeferredFormatArg(char *Buffer, size_t BufferSize, const char *ConvSpec, const EVS_DeferredConversion_t *Conv,
+                          const EVS_DeferredEvent_t *Event, const EVS_DeferredArg_t *Arg)
+{
+    int Length;
+
+    switch (Conv->ArgType)
+    {
+        case EVS_DeferredArgType_INT:
+            if (Conv->IsSigned)
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, (int)Arg->SignedInt);
+            }
+            else
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, (unsigned int)Arg->UnsignedInt);
+            }
+            break;
+        case EVS_DeferredArgType_LONG:
+            if (Conv->IsSigned)
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, (long)Arg->SignedInt);
+            }
+            else
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, (unsigned long)Arg->UnsignedInt);
+            }
+            break;
+        case EVS_DeferredArgType_LONGLONG:
+            if (Conv->IsSigned)
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, Arg->SignedInt);
+            }
+            else
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, Arg->UnsignedInt);
+            }
+            break;
+        case EVS_DeferredArgType_INTMAX:
+            if (Conv->IsSigned)
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, (intmax_t)Arg->SignedInt);
+            }
+            else
+            {
+                Length = snprintf(Buffer, BufferSize, ConvSpec, (uintmax_t)Arg->UnsignedInt);
+            }
+            break;
+        case EVS_DeferredArgType_SIZE:
+            Length = snprintf(Buffer, BufferSize, ConvSpec, (size_t)Arg->UnsignedInt);
+            break;
+        case EVS_DeferredArgType_PTRDIFF:
+            Length = snprintf(Buffer, BufferSize, ConvSpec, (ptrdiff_t)Arg->SignedInt);
+            break;
+        case EVS_DeferredArgType_DOUBLE:
+            Length = snprintf(Buffer, BufferSize, ConvSpec, Arg->Float);
+            break;
+        case EVS_DeferredArgType_POINTER:
+            Length = snprintf(Buffer, BufferSize, ConvSpec, Arg->Pointer);
+            break;
+        case EVS_DeferredArgType_STRING:
+            Length = snprintf(Buffer, BufferSize, ConvSpec, &Event->Strings[Arg->StringOffset]);
+            break;
+        default:
+            /* Not reached, the sender only defers events with supported conversions */
+            Length = 0;
+            break;
+    }
+
+    return Length;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredExpand
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int EVS_DeferredExpand(char *Buffer, size_t BufferSize, const EVS_DeferredEvent_t *Event)
+{
+    EVS_DeferredConversion_t Conv;
+    char                     ConvSpec[EVS_DEFERRED_MAX_CONVERSION_LENGTH];
+    const char *             Fmt      = Event->Spec;
+    size_t                   Pos      = 0;
+    uint32                   ArgCount = 0;
+    int                      Length;
+
+    while (*Fmt != 0)
+    {
+        if (*Fmt != '%')
+        {
+            if (Pos + 1 < BufferSize)
+            {
+                Buffer[Pos] = *Fmt;
+            }
+            ++Pos;
+            ++Fmt;
+        }
+        else
+        {
+            EVS_DeferredParseConversion(Fmt, &Conv);
+
+            if (Conv.ArgType == EVS_DeferredArgType_NONE)
+            {
+                if (Pos + 1 < BufferSize)
+                {
+                    Buffer[Pos] = '%';
+                }
+                ++Pos;
+            }
+            else
+            {
+                memcpy(ConvSpec, Fmt, Conv.Length);
+                ConvSpec[Conv.Length] = 0;
+
+                /* Once the buffer is full only the length is computed */
+                if (Pos < BufferSize)
+                {
+                    Length = EVS_DeferredFormatArg(&Buffer[Pos], BufferSize - Pos, ConvSpec, &Conv, Event,
+                                                   &Event->Args[ArgCount]);
+                }
+                else
+                {
+                    Length = EVS_DeferredFormatArg(NULL, 0, ConvSpec, &Conv, Event, &Event->Args[ArgCount]);
+                }
+
+                if (Length > 0)
+                {
+                    Pos += Length;
+                }
+                ++ArgCount;
+            }
+
+            Fmt += Conv.Length;
+        }
+    }
+
+    if (BufferSize > 0)
+    {
+        Buffer[(Pos < BufferSize) ? Pos : (BufferSize - 1)] = 0;
+    }
+
+    return (int)Pos;
+}
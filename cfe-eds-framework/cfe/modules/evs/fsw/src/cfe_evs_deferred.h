@@ -0,0 +1,177 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ *  Title:    Event Services Deferred Event Interfaces.
+ *
+ *  Purpose:
+ *            Unit specification for events that are formatted by the EVS task
+ *            instead of the sending task.
+ *
+ *  Contents:
+ *       I.  macro and constant type definitions
+ *      II.  EVS deferred event internal structures
+ *     III.  function prototypes
+ *
+ *  Design Notes:
+ *     The sender stores a copy of the format string and the argument values
+ *     in its application's ring, EVS_DeferredRing_t.  The format string is parsed
+ *     on both sides to know the type of each argument.  Only the conversions
+ *     that can be reproduced without the caller's data are deferred, see
+ *     EVS_DeferredParseConversion().
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *
+ */
+
+#ifndef CFE_EVS_DEFERRED_H
+#define CFE_EVS_DEFERRED_H
+
+/********************* Include Files  ************************/
+
+#include "cfe_evs_task.h" /* EVS internal definitions */
+#include "cfe_evs_msg.h"  /* EVS public definitions */
+
+#include <stdarg.h>
+
+/* ==============   Section I: Macro and Constant Type Definitions   =========== */
+
+/**
+ * Longest conversion specification that can be deferred, including the '%'
+ * and the terminator of the copy made when formatting
+ */
+#define EVS_DEFERRED_MAX_CONVERSION_LENGTH 16
+
+/* ==============   Section II: Internal Structures ============ */
+
+/**
+ * Type of argument consumed by a conversion specification
+ */
+typedef enum
+{
+    EVS_DeferredArgType_NONE,     /**< "%%", no argument */
+    EVS_DeferredArgType_INT,      /**< int or unsigned int, also char and short which are promoted */
+    EVS_DeferredArgType_LONG,     /**< long or unsigned long */
+    EVS_DeferredArgType_LONGLONG, /**< long long or unsigned long long */
+    EVS_DeferredArgType_INTMAX,   /**< intmax_t or uintmax_t */
+    EVS_DeferredArgType_SIZE,     /**< size_t */
+    EVS_DeferredArgType_PTRDIFF,  /**< ptrdiff_t */
+    EVS_DeferredArgType_DOUBLE,   /**< double, float is promoted */
+    EVS_DeferredArgType_POINTER,  /**< void pointer for "%p" */
+    EVS_DeferredArgType_STRING,   /**< string for "%s", copied by the sender */
+    EVS_DeferredArgType_INVALID   /**< Not supported, the event must be formatted immediately */
+} EVS_DeferredArgType_t;
+
+/**
+ * A conversion specification in a format string
+ */
+typedef struct
+{
+    EVS_DeferredArgType_t ArgType;  /**< Type of argument consumed */
+    bool                  IsSigned; /**< True for the signed integer conversions "d" and "i" */
+    size_t                Length;   /**< Number of characters from the '%' through the conversion character */
+} EVS_DeferredConversion_t;
+
+/* ==============   Section III: Function Prototypes =========== */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initialize the deferred event rings
+ *
+ * Must be called after the EVS global data is cleared and before any event is deferred.
+ */
+void EVS_DeferredInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Place an event in the sending application's deferred event ring
+ *
+ * The caller has already checked the event against the application's filters.
+ * The ring is not locked, so this may be called from any task of the application.
+ *
+ * @param[in]   AppDataPtr  Application that sent the event
+ * @param[in]   EventID     Numerical event identifier
+ * @param[in]   EventType   Event type
+ * @param[in]   TimeStamp   Time of the event
+ * @param[in]   Spec        Format string, must remain valid until the event is formatted
+ * @param[in]   ArgPtr      Arguments for the format string
+ *
+ * @returns true if the event was deferred, false if it must be formatted immediately
+ *          because the format is not supported or the ring is full.
+ */
+bool EVS_DeferEvent(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType, const CFE_TIME_SysTime_t *TimeStamp,
+                    const char *Spec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Format and send all deferred events
+ *
+ * Only called by the EVS task.  Events from an application that was deleted after
+ * sending them are discarded, as its app data may already belong to another app.
+ */
+void EVS_ProcessDeferredEvents(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Parse a conversion specification
+ *
+ * Flags, field width, precision and length modifiers are accepted along with the
+ * conversion characters of the C standard, except that a '*' width or precision,
+ * "%n", "%ls", "%lc", long double and a precision on "%s" are not supported because
+ * the argument could not be captured or reproduced.
+ *
+ * @param[in]   Fmt     Format string at the '%' that starts the specification
+ * @param[out]  ConvOut Result of the parse
+ */
+void EVS_DeferredParseConversion(const char *Fmt, EVS_DeferredConversion_t *ConvOut);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Capture a format string and its arguments
+ *
+ * @param[out]  Event   Event to store the format string and arguments in
+ * @param[in]   Spec    Format string
+ * @param[in]   ArgPtr  Arguments for the format string
+ *
+ * @returns true if the format string and arguments were captured, false if the format
+ *          is not supported, has too many conversions, or it or the string arguments do
+ *          not fit.
+ */
+bool EVS_DeferredCaptureArgs(EVS_DeferredEvent_t *Event, const char *Spec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Expand the message text of a deferred event
+ *
+ * Produces the same text as snprintf() with the original arguments.
+ *
+ * @param[out]  Buffer      Buffer for the text, always terminated
+ * @param[in]   BufferSize  Size of the buffer
+ * @param[in]   Event       Event to expand
+ *
+ * @returns Length of the expanded text, which is greater than or equal to
+ *          BufferSize if the text was truncated
+ */
+int EVS_DeferredExpand(char *Buffer, size_t BufferSize, const EVS_DeferredEvent_t *Event);
+
+#endif /* CFE_EVS_DEFERRED_H */
@@ -58,7 +58,9 @@ static const CFE_EVS_Application_Component_Telecommand_DispatchTable_t CFE_EVS_T
             .ResetAppCounterCmd_indication     = CFE_EVS_ResetAppCounterCmd,
             .ResetCountersCmd_indication       = CFE_EVS_ResetCountersCmd,
             .ResetFilterCmd_indication         = CFE_EVS_ResetFilterCmd,
+            .SetAppEventRateCmd_indication     = CFE_EVS_SetAppEventRateCmd,
             .SetEventFormatModeCmd_indication  = CFE_EVS_SetEventFormatModeCmd,
+            .SetEventRateCmd_indication        = CFE_EVS_SetEventRateCmd,
             .SetFilterCmd_indication           = CFE_EVS_SetFilterCmd,
             .SetLogModeCmd_indication          = CFE_EVS_SetLogModeCmd},
     .SEND_HK = {.indication = CFE_EVS_ReportHousekeepingCmd}};
@@ -0,0 +1,169 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File: cfe_evs_port.c
+**
+**  Title: Event Services Output Port Queue
+**
+**  Purpose: This module defines the functions that pass events from the
+**           sending task to the EVS port task, which writes them to the local
+**           event log and the enabled output ports
+**
+**  Notes:
+**    The port task is created at a lower priority than the applications so
+**    that console or serial output only uses otherwise idle time.  If the
+**    queue fills up, events are discarded rather than making the sender wait.
+**
+*/
+
+/* Include Files */
+#include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+#include "cfe_evs_port.h"
+
+/* Function Definitions */
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_PortQueueInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_PortQueueInit(void)
+{
+    int32     OsStatus;
+    int32     Status;
+    osal_id_t QueueID;
+
+    if (CFE_PLATFORM_EVS_PORT_QUEUE_DEPTH == 0)
+    {
+        return;
+    }
+
+    /*
+     * The queue never leaves the process, and a local queue is not subject to
+     * the kernel message queue depth limit (msg_max is only 10 by default on Linux)
+     */
+    OsStatus = OS_QueueCreate(&QueueID, CFE_EVS_PORT_QUEUE_NAME, CFE_PLATFORM_EVS_PORT_QUEUE_DEPTH,
+                              sizeof(CFE_EVS_LongEventTlm_t), OS_QUEUE_FLAG_LOCAL);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Failed to create port queue, RC=%ld, writing events from the sender\n", __func__,
+                             (long)OsStatus);
+        return;
+    }
+
+    /* The port task reads the queue ID from the global data */
+    CFE_EVS_Global.PortQueueID = QueueID;
+
+    Status = CFE_ES_CreateChildTask(&CFE_EVS_Global.PortTaskID, CFE_EVS_PORT_TASK_NAME, EVS_PortTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE, CFE_PLATFORM_EVS_PORT_TASK_STACK_SIZE,
+                                    CFE_PLATFORM_EVS_PORT_TASK_PRIORITY, 0);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Failed to create port task, RC=0x%08X, writing events from the sender\n", __func__,
+                             (unsigned int)Status);
+
+        /* Go back to writing the log and ports from the sending task */
+        CFE_EVS_Global.PortQueueID = OS_OBJECT_ID_UNDEFINED;
+        OS_QueueDelete(QueueID);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SendToLogAndPorts
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SendToLogAndPorts(CFE_EVS_LongEventTlm_t *EVS_PktPtr)
+{
+    int32                  OsStatus;
+    osal_id_t              QueueID;
+    size_t                 DiscardSize;
+    CFE_EVS_LongEventTlm_t DiscardTlm;
+
+    QueueID = CFE_EVS_Global.PortQueueID;
+
+    if (!OS_ObjectIdDefined(QueueID))
+    {
+        /* Write event to the event log */
+        EVS_AddLog(EVS_PktPtr);
+
+        /* Send event via selected ports */
+        EVS_SendViaPorts(EVS_PktPtr);
+        return;
+    }
+
+    OsStatus = OS_QueuePut(QueueID, EVS_PktPtr, sizeof(*EVS_PktPtr), 0);
+
+    if (OsStatus == OS_QUEUE_FULL && CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY == CFE_EVS_PORT_QUEUE_DISCARD_OLDEST)
+    {
+        /* Make room by discarding the oldest event, another sender may still fill it first */
+        if (OS_QueueGet(QueueID, &DiscardTlm, sizeof(DiscardTlm), &DiscardSize, OS_CHECK) == OS_SUCCESS)
+        {
+            CFE_ATOMIC_INCR(&CFE_EVS_Global.PortDropCounter);
+        }
+
+        OsStatus = OS_QueuePut(QueueID, EVS_PktPtr, sizeof(*EVS_PktPtr), 0);
+    }
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ATOMIC_INCR(&CFE_EVS_Global.PortDropCounter);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_PortTask
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_PortTask(void)
+{
+    int32                  OsStatus;
+    size_t                 Size;
+    CFE_EVS_LongEventTlm_t EventTlm;
+
+    while (true)
+    {
+        OsStatus = OS_QueueGet(CFE_EVS_Global.PortQueueID, &EventTlm, sizeof(EventTlm), &Size, OS_PEND);
+
+        if (OsStatus != OS_SUCCESS)
+        {
+            /* should never occur */
+            CFE_ES_WriteToSysLog("%s: Failed to read port queue, RC=%ld\n", __func__, (long)OsStatus);
+            break;
+        }
+
+        if (Size == sizeof(EventTlm))
+        {
+            EVS_AddLog(&EventTlm);
+            EVS_SendViaPorts(&EventTlm);
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ *  Title:    Event Services Output Port Queue Interfaces.
+ *
+ *  Purpose:
+ *            Unit specification for the queue between event generation and the
+ *            local event log and output ports.
+ *
+ *  Contents:
+ *       I.  macro and constant type definitions
+ *      II.  EVS internal structures
+ *     III.  function prototypes
+ *
+ *  Design Notes:
+ *     The queue is an OSAL queue of complete long format event packets.  It is
+ *     emptied by the EVS port task, a low priority child task of EVS, so that
+ *     the task sending an event does not wait on the event log mutex or on
+ *     console and serial output.  Until the queue exists, and when it is
+ *     disabled, the log and ports are written by the sending task.
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *
+ */
+
+#ifndef CFE_EVS_PORT_H
+#define CFE_EVS_PORT_H
+
+/********************* Include Files  ************************/
+
+#include "cfe_evs_msg.h" /* EVS public definitions */
+
+/* ==============   Section I: Macro and Constant Type Definitions   =========== */
+
+#define CFE_EVS_PORT_QUEUE_NAME "EVS_PORT_QUEUE"
+#define CFE_EVS_PORT_TASK_NAME  "EVS_PORT_TASK"
+
+/* Values of CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY */
+#define CFE_EVS_PORT_QUEUE_DISCARD_NEW    0
+#define CFE_EVS_PORT_QUEUE_DISCARD_OLDEST 1
+
+/* ==============   Section II: Internal Structures ============ */
+
+/* ==============   Section III: Function Prototypes =========== */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Create the output port queue and the port task
+ *
+ * Called by the EVS task during its initialization.  A failure is reported in
+ * the system log and leaves the sending tasks writing the log and ports.
+ */
+void EVS_PortQueueInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Write an event to the local event log and the enabled output ports
+ *
+ * The event is queued for the port task when the queue exists, otherwise it is
+ * written immediately.  When the queue is full an event is discarded according
+ * to CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY and the drop counter incremented.
+ *
+ * @param[in]   EVS_PktPtr  Event to write, copied before returning
+ */
+void EVS_SendToLogAndPorts(CFE_EVS_LongEventTlm_t *EVS_PktPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Main function of the EVS port task
+ *
+ * Writes the queued events to the local event log and the enabled output ports.
+ */
+void EVS_PortTask(void);
+
+#endif /* CFE_EVS_PORT_H */
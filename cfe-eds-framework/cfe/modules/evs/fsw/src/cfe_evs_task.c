@@ -64,6 +64,7 @@ int32 CFE_EVS_EarlyInit(void)
     CFE_ES_ResetData_t *CFE_EVS_ResetDataPtr = (CFE_ES_ResetData_t *)NULL;
 
     memset(&CFE_EVS_Global, 0, sizeof(CFE_EVS_Global));
+    EVS_DeferredInit();
 
     /* Initialize housekeeping packet */
     CFE_MSG_Init(CFE_MSG_PTR(CFE_EVS_Global.EVS_TlmPkt.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID),
@@ -229,8 +230,9 @@ void CFE_EVS_TaskMain(void)
 
         CFE_ES_PerfLogExit(CFE_MISSION_EVS_MAIN_PERF_ID);
 
-        /* Pend on receipt of packet */
-        Status = CFE_SB_ReceiveBuffer(&SBBufPtr, CFE_EVS_Global.EVS_CommandPipe, CFE_SB_PEND_FOREVER);
+        /* Pend on receipt of packet, waking up to send deferred events */
+        Status = CFE_SB_ReceiveBuffer(&SBBufPtr, CFE_EVS_Global.EVS_CommandPipe,
+                                      CFE_PLATFORM_EVS_DEFERRED_DRAIN_PERIOD);
 
         CFE_ES_PerfLogEntry(CFE_MISSION_EVS_MAIN_PERF_ID);
 
@@ -239,11 +241,18 @@ void CFE_EVS_TaskMain(void)
             /* Process cmd pipe msg */
             CFE_EVS_ProcessCommandPacket(SBBufPtr);
         }
+        else if (Status == CFE_SB_TIME_OUT)
+        {
+            Status = CFE_SUCCESS;
+        }
         else
         {
             CFE_ES_WriteToSysLog("%s: Error reading cmd pipe,RC=0x%08X\n", __func__, (unsigned int)Status);
         } /* end if */
 
+        /* Format and send events deferred by apps */
+        EVS_ProcessDeferredEvents();
+
     } /* end while */
 
     /* while loop exits only if CFE_SB_ReceiveBuffer returns error */
@@ -302,6 +311,9 @@ int32 CFE_EVS_TaskInit(void)
         return Status;
     }
 
+    /* Move writing the event log and output ports off the sending tasks */
+    EVS_PortQueueInit();
+
     /* Write the AppID to the global location, now that the rest of initialization is done */
     CFE_EVS_Global.EVS_AppID = AppID;
     EVS_SendEvent(CFE_EVS_STARTUP_EID, CFE_EVS_EventType_INFORMATION, "cFE EVS Initialized: %s", CFE_VERSION_STRING);
@@ -348,6 +360,8 @@ int32 CFE_EVS_ClearLogCmd(const CFE_EVS_ClearLogCmd_t *data)
 int32 CFE_EVS_ReportHousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
 {
     uint32                i, j;
+    uint32                PortDropCounter;
+    uint32                RateLimitedCounter;
     EVS_AppData_t *       AppDataPtr;
     CFE_EVS_AppTlmData_t *AppTlmDataPtr;
 
@@ -356,6 +370,28 @@ int32 CFE_EVS_ReportHousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
     CFE_EVS_Global.EVS_TlmPkt.Payload.LogMode            = CFE_EVS_Global.EVS_LogPtr->LogMode;
     CFE_EVS_Global.EVS_TlmPkt.Payload.LogOverflowCounter = CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter;
 
+    /* Copy the port queue drop counter, which is incremented by the sending tasks */
+    PortDropCounter = CFE_ATOMIC_LOAD_RELAXED(&CFE_EVS_Global.PortDropCounter);
+    if (PortDropCounter < CFE_EVS_MAX_EVENT_SEND_COUNT)
+    {
+        CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPortDropCounter = PortDropCounter;
+    }
+    else
+    {
+        CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPortDropCounter = CFE_EVS_MAX_EVENT_SEND_COUNT;
+    }
+
+    /* Same for the counter of events over their rate limit */
+    RateLimitedCounter = CFE_ATOMIC_LOAD_RELAXED(&CFE_EVS_Global.RateLimitedCounter);
+    if (RateLimitedCounter < CFE_EVS_MAX_EVENT_SEND_COUNT)
+    {
+        CFE_EVS_Global.EVS_TlmPkt.Payload.RateLimitedCounter = RateLimitedCounter;
+    }
+    else
+    {
+        CFE_EVS_Global.EVS_TlmPkt.Payload.RateLimitedCounter = CFE_EVS_MAX_EVENT_SEND_COUNT;
+    }
+
     /* Write event state data for registered apps to telemetry packet */
     AppDataPtr    = CFE_EVS_Global.AppData;
     AppTlmDataPtr = CFE_EVS_Global.EVS_TlmPkt.Payload.AppData;
@@ -405,6 +441,8 @@ int32 CFE_EVS_ResetCountersCmd(const CFE_EVS_ResetCountersCmd_t *data)
     CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter     = 0;
     CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter    = 0;
     CFE_EVS_Global.EVS_TlmPkt.Payload.UnregisteredAppCounter = 0;
+    CFE_ATOMIC_STORE_RELAXED(&CFE_EVS_Global.PortDropCounter, 0);
+    CFE_ATOMIC_STORE_RELAXED(&CFE_EVS_Global.RateLimitedCounter, 0);
 
     EVS_SendEvent(CFE_EVS_RSTCNT_EID, CFE_EVS_EventType_DEBUG, "Reset Counters Command Received");
 
@@ -437,7 +475,7 @@ int32 CFE_EVS_SetFilterCmd(const CFE_EVS_SetFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(AppDataPtr, CmdPtr->EventID);
 
         if (FilterPtr != NULL)
         {
@@ -478,6 +516,123 @@ int32 CFE_EVS_SetFilterCmd(const CFE_EVS_SetFilterCmd_t *data)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_EVS_SetEventRateCmd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_EVS_SetEventRateCmd(const CFE_EVS_SetEventRateCmd_t *data)
+{
+    const CFE_EVS_AppNameEventIDRateCmd_Payload_t *CmdPtr = &data->Payload;
+    EVS_BinFilter_t *                              FilterPtr;
+    int32                                          Status;
+    EVS_AppData_t *                                AppDataPtr;
+    char                                           LocalName[OS_MAX_API_NAME];
+
+    /* Copy appname from command, ensures NULL termination */
+    CFE_SB_MessageStringGet(LocalName, (char *)CmdPtr->AppName, NULL, sizeof(LocalName), sizeof(CmdPtr->AppName));
+
+    /* Retrieve application data */
+    Status = EVS_GetApplicationInfo(&AppDataPtr, LocalName);
+
+    if (Status == CFE_SUCCESS)
+    {
+        FilterPtr = EVS_FindEventID(AppDataPtr, CmdPtr->EventID);
+
+        if (FilterPtr != NULL)
+        {
+            /* Set the rate limit kept with the filter */
+            EVS_SetRateLimit(&AppDataPtr->FilterRates[FilterPtr - AppDataPtr->BinFilters], CmdPtr->Rate,
+                             CmdPtr->Burst);
+
+            EVS_SendEvent(CFE_EVS_SETEVTRATE_EID, CFE_EVS_EventType_DEBUG,
+                          "Set Event Rate Command Received with AppName=%s, EventID=0x%08x, Rate=%u, Burst=%u",
+                          LocalName, (unsigned int)CmdPtr->EventID, (unsigned int)CmdPtr->Rate,
+                          (unsigned int)CmdPtr->Burst);
+        }
+        else
+        {
+            EVS_SendEvent(CFE_EVS_ERR_EVTIDNOREGS_EID, CFE_EVS_EventType_ERROR,
+                          "%s Event ID %d not registered for filtering: CC = %lu ", LocalName, (int)CmdPtr->EventID,
+                          (long unsigned int)CFE_EVS_SET_EVENT_RATE_CC);
+
+            Status = CFE_EVS_EVT_NOT_REGISTERED;
+        }
+    }
+    else if (Status == CFE_EVS_APP_NOT_REGISTERED)
+    {
+        EVS_SendEvent(CFE_EVS_ERR_APPNOREGS_EID, CFE_EVS_EventType_ERROR, "%s not registered with EVS: CC = %lu",
+                      LocalName, (long unsigned int)CFE_EVS_SET_EVENT_RATE_CC);
+    }
+    else if (Status == CFE_EVS_APP_ILLEGAL_APP_ID)
+    {
+        EVS_SendEvent(CFE_EVS_ERR_ILLAPPIDRANGE_EID, CFE_EVS_EventType_ERROR,
+                      "Illegal application ID retrieved for %s: CC = %lu", LocalName,
+                      (long unsigned int)CFE_EVS_SET_EVENT_RATE_CC);
+    }
+    else
+    {
+        EVS_SendEvent(CFE_EVS_ERR_NOAPPIDFOUND_EID, CFE_EVS_EventType_ERROR,
+                      "Unable to retrieve application ID for %s: CC = %lu", LocalName,
+                      (long unsigned int)CFE_EVS_SET_EVENT_RATE_CC);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_EVS_SetAppEventRateCmd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_EVS_SetAppEventRateCmd(const CFE_EVS_SetAppEventRateCmd_t *data)
+{
+    const CFE_EVS_AppNameRateCmd_Payload_t *CmdPtr = &data->Payload;
+    int32                                   Status;
+    EVS_AppData_t *                         AppDataPtr;
+    char                                    LocalName[OS_MAX_API_NAME];
+
+    /* Copy appname from command, ensures NULL termination */
+    CFE_SB_MessageStringGet(LocalName, (char *)CmdPtr->AppName, NULL, sizeof(LocalName), sizeof(CmdPtr->AppName));
+
+    /* Retrieve application data */
+    Status = EVS_GetApplicationInfo(&AppDataPtr, LocalName);
+
+    if (Status == CFE_SUCCESS)
+    {
+        EVS_SetRateLimit(&AppDataPtr->AppRate, CmdPtr->Rate, CmdPtr->Burst);
+
+        EVS_SendEvent(CFE_EVS_SETAPPEVTRATE_EID, CFE_EVS_EventType_DEBUG,
+                      "Set App Event Rate Command Received with AppName=%s, Rate=%u, Burst=%u", LocalName,
+                      (unsigned int)CmdPtr->Rate, (unsigned int)CmdPtr->Burst);
+    }
+    else if (Status == CFE_EVS_APP_NOT_REGISTERED)
+    {
+        EVS_SendEvent(CFE_EVS_ERR_APPNOREGS_EID, CFE_EVS_EventType_ERROR, "%s not registered with EVS: CC = %lu",
+                      LocalName, (long unsigned int)CFE_EVS_SET_APP_EVENT_RATE_CC);
+    }
+    else if (Status == CFE_EVS_APP_ILLEGAL_APP_ID)
+    {
+        EVS_SendEvent(CFE_EVS_ERR_ILLAPPIDRANGE_EID, CFE_EVS_EventType_ERROR,
+                      "Illegal application ID retrieved for %s: CC = %lu", LocalName,
+                      (long unsigned int)CFE_EVS_SET_APP_EVENT_RATE_CC);
+    }
+    else
+    {
+        EVS_SendEvent(CFE_EVS_ERR_NOAPPIDFOUND_EID, CFE_EVS_EventType_ERROR,
+                      "Unable to retrieve application ID for %s: CC = %lu", LocalName,
+                      (long unsigned int)CFE_EVS_SET_APP_EVENT_RATE_CC);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_EVS_EnablePortsCmd
@@ -1005,7 +1160,7 @@ int32 CFE_EVS_ResetFilterCmd(const CFE_EVS_ResetFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(AppDataPtr, CmdPtr->EventID);
 
         if (FilterPtr != NULL)
         {
@@ -1123,7 +1278,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
     if (Status == CFE_SUCCESS)
     {
         /* Check to see if this event is already registered for filtering */
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(AppDataPtr, CmdPtr->EventID);
 
         /* FilterPtr != NULL means that this Event ID was found as already being registered */
         if (FilterPtr != NULL)
@@ -1137,7 +1292,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
         else
         {
             /* now check to see if there is a free slot */
-            FilterPtr = EVS_FindEventID(CFE_EVS_FREE_SLOT, AppDataPtr->BinFilters);
+            FilterPtr = EVS_FindFreeFilter(AppDataPtr);
 
             if (FilterPtr != NULL)
             {
@@ -1145,6 +1300,9 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
                 FilterPtr->EventID = CmdPtr->EventID;
                 FilterPtr->Mask    = CmdPtr->Mask;
                 FilterPtr->Count   = 0;
+                EVS_SetRateLimit(&AppDataPtr->FilterRates[FilterPtr - AppDataPtr->BinFilters], 0, 0);
+
+                EVS_IndexFilters(AppDataPtr);
 
                 EVS_SendEvent(CFE_EVS_ADDFILTER_EID, CFE_EVS_EventType_DEBUG,
                               "Add Filter Command Received with AppName = %s, EventID = 0x%08x, Mask = 0x%04x",
@@ -1206,7 +1364,7 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(AppDataPtr, CmdPtr->EventID);
 
         if (FilterPtr != NULL)
         {
@@ -1214,6 +1372,9 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
             FilterPtr->EventID = CFE_EVS_FREE_SLOT;
             FilterPtr->Mask    = CFE_EVS_NO_MASK;
             FilterPtr->Count   = 0;
+            EVS_SetRateLimit(&AppDataPtr->FilterRates[FilterPtr - AppDataPtr->BinFilters], 0, 0);
+
+            EVS_IndexFilters(AppDataPtr);
 
             EVS_SendEvent(CFE_EVS_DELFILTER_EID, CFE_EVS_EventType_DEBUG,
                           "Delete Filter Command Received with AppName = %s, EventID = 0x%08x", LocalName,
@@ -49,7 +49,9 @@
 #include "cfe_evs_api_typedefs.h"
 #include "cfe_evs_log_typedef.h"
 #include "cfe_sb_api_typedefs.h"
+#include "cfe_time_api_typedefs.h"
 #include "cfe_evs_events.h"
+#include "cfe_core_atomic.h"
 
 /*********************  Macro and Constant Type Definitions   ***************************/
 
@@ -62,6 +64,16 @@
 #define CFE_EVS_PIPE_NAME            "EVS_CMD_PIPE"
 #define CFE_EVS_MAX_PORT_MSG_LENGTH  (CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + OS_MAX_API_NAME + 30)
 
+/* The filter index of each application has twice as many entries as there are
+ * filters, so it is never more than half full and looking up an event ID that
+ * has no filter usually stops at the first entry probed */
+#define EVS_FILTER_INDEX_SIZE  (2 * CFE_PLATFORM_EVS_MAX_EVENT_FILTERS)
+#define EVS_FILTER_INDEX_EMPTY 0
+
+/* Tokens of an event rate limit are counted in thousandths of an event, so
+ * that a rate in events per second adds Rate tokens every millisecond */
+#define EVS_RATE_TOKENS_PER_EVENT 1000
+
 /* Since CFE_EVS_MAX_PORT_MSG_LENGTH is the size of the buffer that is sent to
  * print out (using OS_printf), we need to check to make sure that the buffer
  * size the OS uses is big enough. This check has to be made here because it is
@@ -81,12 +93,25 @@ typedef struct
 
 } EVS_BinFilter_t;
 
+/* Token bucket limiting the rate of events */
+typedef struct
+{
+    uint16    Rate;     /* Events per second, 0 for no limit */
+    uint16    Burst;    /* Size of the bucket in events */
+    uint32    Tokens;   /* Tokens in the bucket, EVS_RATE_TOKENS_PER_EVENT per event */
+    OS_time_t LastTime; /* Time up to which tokens were added */
+
+} EVS_RateLimit_t;
+
 typedef struct
 {
     CFE_ES_AppId_t AppID;
     CFE_ES_AppId_t UnregAppID;
 
     EVS_BinFilter_t BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Array of binary filters */
+    uint8           FilterIndex[EVS_FILTER_INDEX_SIZE]; /* Hash of filter event IDs, holds BinFilters index + 1 or empty */
+    EVS_RateLimit_t FilterRates[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Rate limits, same index as BinFilters */
+    EVS_RateLimit_t AppRate;                                         /* Rate limit of all events of the app */
 
     uint8  ActiveFlag;           /* Application event service active flag */
     uint8  EventTypesActiveFlag; /* Application event types active flag */
@@ -104,11 +129,56 @@ typedef struct
 
 } CFE_EVS_AppDataFile_t;
 
+/* Argument of a deferred event, the member used depends on the conversion in the format string */
+typedef union
+{
+    long long          SignedInt;
+    unsigned long long UnsignedInt;
+    double             Float;
+    const void *       Pointer;
+    uint32             StringOffset; /* Offset of a copied "%s" argument in the event Strings */
+} EVS_DeferredArg_t;
+
+typedef struct
+{
+    CFE_ES_AppId_t     AppID;     /* Application that sent the event */
+    uint16             EventID;   /* Numerical event identifier */
+    uint16             EventType; /* Event type */
+    CFE_TIME_SysTime_t Time;      /* Time of the send call */
+
+    char              Spec[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];       /* Copy of the format string */
+    EVS_DeferredArg_t Args[CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS];  /* Arguments in format string order */
+    char              Strings[CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE]; /* Copies of "%s" arguments */
+
+} EVS_DeferredEvent_t;
+
+typedef struct
+{
+    uint32              Sequence; /* Ring position whose event this slot holds or can accept */
+    EVS_DeferredEvent_t Event;
+
+} EVS_DeferredSlot_t;
+
+/*
+ * Events sent with CFE_EVS_SendDeferredEvent() by one application.  Any task of
+ * the application can add events without a lock, only the EVS task removes them.
+ */
+typedef struct
+{
+    uint32 PutPos CFE_CACHE_ALIGNED; /* Next position claimed by a sender */
+    uint32 GetPos CFE_CACHE_ALIGNED; /* Next position formatted by the EVS task */
+
+    EVS_DeferredSlot_t Slots[CFE_PLATFORM_EVS_DEFERRED_RING_SIZE];
+
+} EVS_DeferredRing_t;
+
 /* Global data structure */
 typedef struct
 {
     EVS_AppData_t AppData[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /* Application state data and event filters */
 
+    EVS_DeferredRing_t DeferredRing[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /* Deferred events, same index as AppData */
+
     CFE_EVS_Log_t *EVS_LogPtr; /* Pointer to the EVS log in the ES Reset area*/
                                /* see cfe_es_global.h */
 
@@ -120,6 +190,15 @@ typedef struct
     osal_id_t                 EVS_SharedDataMutexID;
     CFE_ES_AppId_t            EVS_AppID;
 
+    /*
+    ** EVS port task data
+    */
+    osal_id_t       PortQueueID;     /* Events for the port task, undefined when the queue is not used */
+    CFE_ES_TaskId_t PortTaskID;      /* EVS port task */
+    uint32          PortDropCounter; /* Events discarded because the port queue was full */
+
+    uint32 RateLimitedCounter; /* Events discarded by rate limits, incremented by the sending tasks */
+
 } CFE_EVS_Global_t;
 
 /*
@@ -194,6 +273,23 @@ int32 CFE_EVS_ResetCountersCmd(const CFE_EVS_ResetCountersCmd_t *data);
  */
 int32 CFE_EVS_SetFilterCmd(const CFE_EVS_SetFilterCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Message Handler Function
+ *
+ * This routine sets the rate limit of the filter for the given event_id
+ * of the given application
+ */
+int32 CFE_EVS_SetEventRateCmd(const CFE_EVS_SetEventRateCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Message Handler Function
+ *
+ * This routine sets the rate limit of all events of the given application
+ */
+int32 CFE_EVS_SetAppEventRateCmd(const CFE_EVS_SetAppEventRateCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Message Handler Function
@@ -35,7 +35,6 @@
 #include <string.h>
 
 /* Local Function Prototypes */
-void EVS_SendViaPorts(CFE_EVS_LongEventTlm_t *EVS_PktPtr);
 void EVS_OutputPort1(char *Message);
 void EVS_OutputPort2(char *Message);
 void EVS_OutputPort3(char *Message);
@@ -200,8 +199,8 @@ int32 EVS_NotRegistered(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t CallerID)
  *-----------------------------------------------------------------*/
 bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 {
-    EVS_BinFilter_t *FilterPtr;
-    bool             Filtered = false;
+    EVS_BinFilter_t *FilterPtr = NULL;
+    bool             Filtered  = false;
     char             AppName[OS_MAX_API_NAME];
 
     if (AppDataPtr->ActiveFlag == false)
@@ -258,7 +257,7 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
     /* Is this type of event enabled for this application? */
     if (Filtered == false)
     {
-        FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(AppDataPtr, EventID);
 
         /* Does this event ID have an event filter table entry? */
         if (FilterPtr != NULL)
@@ -287,6 +286,17 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
         }
     }
 
+    /* Rate limits are checked last so that events filtered otherwise do not use tokens */
+    if (Filtered == false)
+    {
+        if (!EVS_TakeRateTokens(FilterPtr != NULL ? &AppDataPtr->FilterRates[FilterPtr - AppDataPtr->BinFilters] : NULL,
+                                &AppDataPtr->AppRate))
+        {
+            Filtered = true;
+            CFE_ATOMIC_INCR(&CFE_EVS_Global.RateLimitedCounter);
+        }
+    }
+
     return (Filtered);
 }
 
@@ -298,21 +308,232 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray)
+EVS_BinFilter_t *EVS_FindEventID(EVS_AppData_t *AppDataPtr, uint16 EventID)
+{
+    uint32 Pos;
+    uint32 i;
+    uint8  Entry;
+
+    /* Unused filters are not indexed, they match the free slot marker as before */
+    if (EventID == (uint16)CFE_EVS_FREE_SLOT)
+    {
+        return EVS_FindFreeFilter(AppDataPtr);
+    }
+
+    Pos = EventID % EVS_FILTER_INDEX_SIZE;
+
+    for (i = 0; i < EVS_FILTER_INDEX_SIZE; i++)
+    {
+        Entry = AppDataPtr->FilterIndex[Pos];
+
+        if (Entry == EVS_FILTER_INDEX_EMPTY)
+        {
+            break;
+        }
+
+        if (AppDataPtr->BinFilters[Entry - 1].EventID == EventID)
+        {
+            return (&AppDataPtr->BinFilters[Entry - 1]);
+        }
+
+        Pos = (Pos + 1) % EVS_FILTER_INDEX_SIZE;
+    }
+
+    return ((EVS_BinFilter_t *)NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_FindFreeFilter
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr)
 {
     uint32 i;
 
     for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
     {
-        if (FilterArray[i].EventID == EventID)
+        if (AppDataPtr->BinFilters[i].EventID == (uint16)CFE_EVS_FREE_SLOT)
         {
-            return (&FilterArray[i]);
+            return (&AppDataPtr->BinFilters[i]);
         }
     }
 
     return ((EVS_BinFilter_t *)NULL);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_IndexFilters
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_IndexFilters(EVS_AppData_t *AppDataPtr)
+{
+    uint8  NewIndex[EVS_FILTER_INDEX_SIZE];
+    uint32 Pos;
+    uint32 i;
+    uint16 EventID;
+
+    memset(NewIndex, EVS_FILTER_INDEX_EMPTY, sizeof(NewIndex));
+
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        EventID = AppDataPtr->BinFilters[i].EventID;
+
+        if (EventID == (uint16)CFE_EVS_FREE_SLOT)
+        {
+            continue;
+        }
+
+        /* The index is at most half full so an empty entry is always found */
+        Pos = EventID % EVS_FILTER_INDEX_SIZE;
+        while (NewIndex[Pos] != EVS_FILTER_INDEX_EMPTY && AppDataPtr->BinFilters[NewIndex[Pos] - 1].EventID != EventID)
+        {
+            Pos = (Pos + 1) % EVS_FILTER_INDEX_SIZE;
+        }
+
+        /* Keep the first filter of a duplicated event ID */
+        if (NewIndex[Pos] == EVS_FILTER_INDEX_EMPTY)
+        {
+            NewIndex[Pos] = (uint8)(i + 1);
+        }
+    }
+
+    /* Build aside and copy so that tasks sending events see the old or the new entry */
+    memcpy(AppDataPtr->FilterIndex, NewIndex, sizeof(AppDataPtr->FilterIndex));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SetRateLimit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SetRateLimit(EVS_RateLimit_t *Limit, uint16 Rate, uint16 Burst)
+{
+    if (Burst == 0)
+    {
+        Burst = 1;
+    }
+
+    OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+    Limit->Rate   = Rate;
+    Limit->Burst  = Burst;
+    Limit->Tokens = (uint32)Burst * EVS_RATE_TOKENS_PER_EVENT;
+    CFE_PSP_GetTime(&Limit->LastTime);
+    OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_RefillRateTokens
+ *
+ * Internal helper routine only, not part of API.
+ * Adds the tokens earned since the last refill, caller holds the EVS lock
+ *
+ *-----------------------------------------------------------------*/
+static void EVS_RefillRateTokens(EVS_RateLimit_t *Limit, OS_time_t Now)
+{
+    int64  ElapsedMsec;
+    uint64 Earned;
+    uint32 Capacity;
+
+    ElapsedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, Limit->LastTime));
+    Capacity    = (uint32)Limit->Burst * EVS_RATE_TOKENS_PER_EVENT;
+
+    if (ElapsedMsec < 0)
+    {
+        /* The clock was set back */
+        Limit->Tokens   = Capacity;
+        Limit->LastTime = Now;
+    }
+    else if (ElapsedMsec > 0)
+    {
+        /* Products are 64 bits wide, a long idle time times a high rate does not fit 32 */
+        Earned = (uint64)ElapsedMsec * Limit->Rate;
+
+        if (Earned >= Capacity - Limit->Tokens)
+        {
+            Limit->Tokens   = Capacity;
+            Limit->LastTime = Now;
+        }
+        else
+        {
+            /* Only whole milliseconds are used, the remainder counts toward the next call */
+            Limit->Tokens += (uint32)Earned;
+            Limit->LastTime =
+                OS_TimeAdd(Limit->LastTime, OS_TimeAssembleFromMilliseconds(ElapsedMsec / 1000, ElapsedMsec % 1000));
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_TakeRateTokens
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_TakeRateTokens(EVS_RateLimit_t *FilterLimit, EVS_RateLimit_t *AppLimit)
+{
+    OS_time_t Now;
+    bool      Allowed = true;
+
+    if (FilterLimit != NULL && FilterLimit->Rate == 0)
+    {
+        FilterLimit = NULL;
+    }
+    if (AppLimit->Rate == 0)
+    {
+        AppLimit = NULL;
+    }
+
+    if (FilterLimit != NULL || AppLimit != NULL)
+    {
+        CFE_PSP_GetTime(&Now);
+
+        /* Any task may send events, the buckets are only changed while holding the lock */
+        OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+
+        if (FilterLimit != NULL)
+        {
+            EVS_RefillRateTokens(FilterLimit, Now);
+            Allowed = (FilterLimit->Tokens >= EVS_RATE_TOKENS_PER_EVENT);
+        }
+        if (AppLimit != NULL)
+        {
+            EVS_RefillRateTokens(AppLimit, Now);
+            Allowed = Allowed && (AppLimit->Tokens >= EVS_RATE_TOKENS_PER_EVENT);
+        }
+
+        /* Tokens are only taken when both limits allow the event */
+        if (Allowed)
+        {
+            if (FilterLimit != NULL)
+            {
+                FilterLimit->Tokens -= EVS_RATE_TOKENS_PER_EVENT;
+            }
+            if (AppLimit != NULL)
+            {
+                AppLimit->Tokens -= EVS_RATE_TOKENS_PER_EVENT;
+            }
+        }
+
+        OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+    }
+
+    return Allowed;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: EVS_EnableTypes
@@ -356,9 +577,8 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask)
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
 {
-    CFE_EVS_LongEventTlm_t  LongEventTlm;  /* The "long" flavor is always generated, as this is what is logged */
-    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
-    int                     ExpandedLength;
+    CFE_EVS_LongEventTlm_t LongEventTlm; /* The "long" flavor is always generated, as this is what is logged */
+    int                    ExpandedLength;
 
     /* Initialize EVS event packets */
     CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
@@ -371,36 +591,49 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
     ExpandedLength =
         vsnprintf((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec, ArgPtr);
 
+    EVS_SendEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, TimeStamp);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SendEventTelemetry
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SendEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlm, int ExpandedLength,
+                            const CFE_TIME_SysTime_t *TimeStamp)
+{
+    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
+
     /*
-     * If vsnprintf is bigger than message size, mark with truncation character
-     * Note negative returns (error from vsnprintf) will just leave the message as-is
+     * If the expanded message is bigger than message size, mark with truncation character
+     * Note negative lengths (error from vsnprintf) will just leave the message as-is
      */
-    if (ExpandedLength >= (int)sizeof(LongEventTlm.Payload.Message))
+    if (ExpandedLength >= (int)sizeof(LongEventTlm->Payload.Message))
     {
         /* Mark character before zero terminator to indicate truncation */
-        LongEventTlm.Payload.Message[sizeof(LongEventTlm.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
+        LongEventTlm->Payload.Message[sizeof(LongEventTlm->Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter++;
     }
 
     /* Obtain task and system information */
-    CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
-                      sizeof(LongEventTlm.Payload.PacketID.AppName));
-    LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
-    LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
+    CFE_ES_GetAppName((char *)LongEventTlm->Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
+                      sizeof(LongEventTlm->Payload.PacketID.AppName));
+    LongEventTlm->Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
+    LongEventTlm->Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
 
     /* Set the packet timestamp */
-    CFE_MSG_SetMsgTime(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), *TimeStamp);
-
-    /* Write event to the event log */
-    EVS_AddLog(&LongEventTlm);
+    CFE_MSG_SetMsgTime(CFE_MSG_PTR(LongEventTlm->TelemetryHeader), *TimeStamp);
 
-    /* Send event via selected ports */
-    EVS_SendViaPorts(&LongEventTlm);
+    /* Write event to the event log and send it via selected ports, usually from the port task */
+    EVS_SendToLogAndPorts(LongEventTlm);
 
     if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_LONG)
     {
         /* Send long event via SoftwareBus */
-        CFE_SB_TransmitMsg(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), true);
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(LongEventTlm->TelemetryHeader), true);
     }
     else if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_SHORT)
     {
@@ -413,7 +646,7 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         CFE_MSG_Init(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
                      sizeof(ShortEventTlm));
         CFE_MSG_SetMsgTime(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), *TimeStamp);
-        ShortEventTlm.Payload.PacketID = LongEventTlm.Payload.PacketID;
+        ShortEventTlm.Payload.PacketID = LongEventTlm->Payload.PacketID;
         CFE_SB_TransmitMsg(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), true);
     }
 
@@ -433,10 +666,8 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
  *
  * Function: EVS_SendViaPorts
  *
- * Internal helper routine only, not part of API.
- *
- * This routine sends a string event message out all enabled
- * output ports
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
 void EVS_SendViaPorts(CFE_EVS_LongEventTlm_t *EVS_PktPtr)
@@ -196,10 +196,54 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 /**
  * @brief Find the filter record corresponding to the given event ID
  *
- * This routine searches and returns an index to the given Event ID with the
- * given application filter array.
+ * This routine looks up the given Event ID in the filter index of the given
+ * application and returns a pointer to its filter, or NULL if the event ID
+ * has no filter.
  */
-EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray);
+EVS_BinFilter_t *EVS_FindEventID(EVS_AppData_t *AppDataPtr, uint16 EventID);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an unused filter record
+ *
+ * This routine returns a pointer to the first unused filter of the given
+ * application, or NULL if all filters are in use.
+ */
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Rebuild the filter index of an application
+ *
+ * Must be called after an event ID is added to or removed from the filters
+ * of the given application.  When several filters have the same event ID the
+ * first one is indexed, which is the one a search of the filters would find.
+ */
+void EVS_IndexFilters(EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Set an event rate limit
+ *
+ * The bucket starts full.  A Rate of 0 removes the limit and a Burst of 0 is
+ * the same as 1.
+ */
+void EVS_SetRateLimit(EVS_RateLimit_t *Limit, uint16 Rate, uint16 Burst);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Take the tokens for one event from its filter and application rate limits
+ *
+ * Adds the tokens earned since the last call to both limits, then removes one
+ * event's worth from each only if both have it, so that an event rejected by
+ * one limit does not use up the other.  Serialized by the EVS shared data mutex.
+ *
+ * @param FilterLimit  Rate limit of the event ID, NULL if the event has no filter
+ * @param AppLimit     Rate limit of all the application's events
+ *
+ * @returns true if the event can be sent, false if it is over a limit
+ */
+bool EVS_TakeRateTokens(EVS_RateLimit_t *FilterLimit, EVS_RateLimit_t *AppLimit);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -231,6 +275,30 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask);
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *Time, const char *MsgSpec, va_list ArgPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send all configured telemetry for an event that is already formatted
+ *
+ * Completes the long event message, whose header, event ID, event type and message text
+ * are already set by the caller, then logs and sends it like EVS_GenerateEventTelemetry().
+ *
+ * @param[in]   AppDataPtr      Application that sent the event
+ * @param[in]   LongEventTlm    Event message to complete and send
+ * @param[in]   ExpandedLength  Length of the message text before truncation, as returned by snprintf
+ * @param[in]   TimeStamp       Time of the event
+ */
+void EVS_SendEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlm, int ExpandedLength,
+                            const CFE_TIME_SysTime_t *TimeStamp);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send an event message out all enabled output ports
+ *
+ * Called by the EVS port task, or by the sending task when the output port
+ * queue is disabled.
+ */
+void EVS_SendViaPorts(CFE_EVS_LongEventTlm_t *EVS_PktPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Internal function to send an event
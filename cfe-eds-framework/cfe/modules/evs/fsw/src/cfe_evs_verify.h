@@ -56,6 +56,48 @@
 #error CFE_PLATFORM_EVS_PORT_DEFAULT cannot be greater than 0x0F!
 #endif
 
+/* The per-application filter index stores a filter number + 1 in a uint8 */
+#if CFE_PLATFORM_EVS_MAX_EVENT_FILTERS > 254
+#error CFE_PLATFORM_EVS_MAX_EVENT_FILTERS cannot be more than 254!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_RING_SIZE < 2 || \
+    (CFE_PLATFORM_EVS_DEFERRED_RING_SIZE & (CFE_PLATFORM_EVS_DEFERRED_RING_SIZE - 1)) != 0
+#error CFE_PLATFORM_EVS_DEFERRED_RING_SIZE must be a power of two and at least 2!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS < 1 || CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS > 255
+#error CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS must be between 1 and 255!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE < 1
+#error CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE must be at least 1!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_DRAIN_PERIOD < 1
+#error CFE_PLATFORM_EVS_DEFERRED_DRAIN_PERIOD must be greater than zero!
+#endif
+
+#if CFE_PLATFORM_EVS_PORT_QUEUE_DEPTH < 0
+#error CFE_PLATFORM_EVS_PORT_QUEUE_DEPTH cannot be negative!
+#endif
+
+#if (CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY != 0) && (CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY != 1)
+#error CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY can only be 0 (Discard New) or 1 (Discard Oldest)!
+#endif
+
+#if CFE_PLATFORM_EVS_PORT_TASK_PRIORITY < 1 || CFE_PLATFORM_EVS_PORT_TASK_PRIORITY > 255
+#error CFE_PLATFORM_EVS_PORT_TASK_PRIORITY must be between 1 and 255!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE < 0 || CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE > 65535
+#error CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE must be between 0 and 65535!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST < 1 || CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST > 65535
+#error CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST must be between 1 and 65535!
+#endif
+
 /*
 ** Validate task stack size...
 */
@@ -63,4 +105,8 @@
 #error CFE_PLATFORM_EVS_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_EVS_PORT_TASK_STACK_SIZE < 2048
+#error CFE_PLATFORM_EVS_PORT_TASK_STACK_SIZE must be greater than or equal to 2048
+#endif
+
 #endif /* CFE_EVS_VERIFY_H */
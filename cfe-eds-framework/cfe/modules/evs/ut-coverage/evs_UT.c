@@ -57,7 +57,10 @@ static const char *EVS_SYSLOG_MSGS[] = {
     "%s: Call to CFE_EVS_Register Failed:RC=0x%08X\n",
     "%s: Call to CFE_SB_CreatePipe Failed:RC=0x%08X\n",
     "%s: Subscribing to Cmds Failed:RC=0x%08X\n",
-    "%s: Subscribing to HK Request Failed:RC=0x%08X\n"};
+    "%s: Subscribing to HK Request Failed:RC=0x%08X\n",
+    "%s: Failed to create port queue, RC=%ld, writing events from the sender\n",
+    "%s: Failed to create port task, RC=0x%08X, writing events from the sender\n",
+    "%s: Failed to read port queue, RC=%ld\n"};
 
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_NOOP_CC = {
     .DispatchOffset = offsetof(CFE_EVS_Application_Component_Telecommand_DispatchTable_t, CMD.NoopCmd_indication)};
@@ -108,6 +111,12 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_ADD_EVENT_FILTER_CC = {
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_DELETE_EVENT_FILTER_CC = {
     .DispatchOffset =
         offsetof(CFE_EVS_Application_Component_Telecommand_DispatchTable_t, CMD.DeleteEventFilterCmd_indication)};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_SET_EVENT_RATE_CC = {
+    .DispatchOffset =
+        offsetof(CFE_EVS_Application_Component_Telecommand_DispatchTable_t, CMD.SetEventRateCmd_indication)};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_SET_APP_EVENT_RATE_CC = {
+    .DispatchOffset =
+        offsetof(CFE_EVS_Application_Component_Telecommand_DispatchTable_t, CMD.SetAppEventRateCmd_indication)};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_WRITE_APP_DATA_FILE_CC = {
     .DispatchOffset =
         offsetof(CFE_EVS_Application_Component_Telecommand_DispatchTable_t, CMD.WriteAppDataFileCmd_indication)};
@@ -214,6 +223,45 @@ static void UT_EVS_DoGenericCheckEvents(void (*Func)(void), UT_EVS_EventCapture_
     UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), NULL, NULL);
 }
 
+/* Capture the arguments of a deferred event, the format may be one that is not supported */
+static bool UT_EVS_CaptureDeferredArgs(EVS_DeferredEvent_t *Event, const char *Spec, ...)
+{
+    va_list ArgPtr;
+    bool    Result;
+
+    memset(Event, 0, sizeof(*Event));
+
+    va_start(ArgPtr, Spec);
+    Result = EVS_DeferredCaptureArgs(Event, Spec, ArgPtr);
+    va_end(ArgPtr);
+
+    return Result;
+}
+
+/* Check a deferred event expands to the same text as vsnprintf() */
+static void UT_EVS_CheckDeferredFormat(const char *Spec, ...) OS_PRINTF(1, 2);
+static void UT_EVS_CheckDeferredFormat(const char *Spec, ...)
+{
+    EVS_DeferredEvent_t Event;
+    char                Expected[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    char                Actual[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    int                 ExpectedLength;
+    va_list             ArgPtr;
+
+    va_start(ArgPtr, Spec);
+    ExpectedLength = vsnprintf(Expected, sizeof(Expected), Spec, ArgPtr);
+    va_end(ArgPtr);
+
+    memset(&Event, 0, sizeof(Event));
+
+    va_start(ArgPtr, Spec);
+    UtAssert_BOOL_TRUE(EVS_DeferredCaptureArgs(&Event, Spec, ArgPtr));
+    va_end(ArgPtr);
+
+    UtAssert_INT32_EQ(EVS_DeferredExpand(Actual, sizeof(Actual), &Event), ExpectedLength);
+    UtAssert_STRINGBUF_EQ(Actual, sizeof(Actual), Expected, sizeof(Expected));
+}
+
 /*
 ** Functions
 */
@@ -230,12 +278,15 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_FilterRegistration);
     UT_ADD_TEST(Test_FilterReset);
     UT_ADD_TEST(Test_Format);
+    UT_ADD_TEST(Test_Deferred);
     UT_ADD_TEST(Test_Ports);
+    UT_ADD_TEST(Test_PortQueue);
     UT_ADD_TEST(Test_Logging);
     UT_ADD_TEST(Test_WriteApp);
     UT_ADD_TEST(Test_BadAppCmd);
     UT_ADD_TEST(Test_EventCmd);
     UT_ADD_TEST(Test_FilterCmd);
+    UT_ADD_TEST(Test_RateLimit);
     UT_ADD_TEST(Test_InvalidCmd);
     UT_ADD_TEST(Test_Misc);
 }
@@ -272,6 +323,9 @@ void Test_Init(void)
     UtPrintf("CFE_EVS_TaskMain - Test error reading command pipe, unrecognized msgid");
     UT_InitData();
 
+    /* The default timeout on the second read only sends deferred events, end the loop on the third */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_PIPE_RD_ERR);
+
     /* Set unexpected message ID */
     UT_SetupBasicMsgDispatch(&UT_TPID_CFE_EVS_INVALID_MID, 0, true);
 
@@ -375,6 +429,11 @@ void Test_Init(void)
     UT_InitData();
     CFE_EVS_TaskInit();
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CFE_EVS_Global.PortQueueID));
+
+    /* The other tests expect events to be logged by the sender, see Test_PortQueue */
+    CFE_EVS_Global.PortQueueID = OS_OBJECT_ID_UNDEFINED;
 
     /* Enable DEBUG message output */
     UT_InitData();
@@ -412,6 +471,7 @@ void Test_IllegalAppID(void)
     UtAssert_INT32_EQ(CFE_EVS_SendEvent(0, 0, NULL), CFE_EVS_INVALID_PARAMETER);
     UtAssert_INT32_EQ(CFE_EVS_SendEventWithAppID(0, 0, CFE_ES_APPID_UNDEFINED, NULL), CFE_EVS_INVALID_PARAMETER);
     UtAssert_INT32_EQ(CFE_EVS_SendTimedEvent(time, 0, 0, NULL), CFE_EVS_INVALID_PARAMETER);
+    UtAssert_INT32_EQ(CFE_EVS_SendDeferredEvent(0, 0, NULL), CFE_EVS_INVALID_PARAMETER);
 
     /* Test sending an event using an illegal application ID */
     UT_InitData();
@@ -428,6 +488,11 @@ void Test_IllegalAppID(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_ES_AppID_ToIndex), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_EVS_SendTimedEvent(time, 0, 0, "NULL"), CFE_EVS_APP_ILLEGAL_APP_ID);
 
+    /* Test sending a deferred event using an illegal application ID */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_AppID_ToIndex), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_EVS_SendDeferredEvent(0, 0, "NULL"), CFE_EVS_APP_ILLEGAL_APP_ID);
+
     /* Test sending an event with app ID using an illegal application ID */
     UT_InitData();
     UT_SetDefaultReturnValue(UT_KEY(CFE_ES_AppID_ToIndex), CFE_ES_ERR_RESOURCEID_NOT_VALID);
@@ -495,6 +560,10 @@ void Test_UnregisteredApp(void)
     UtAssert_INT32_EQ(CFE_EVS_SendTimedEvent(time, CFE_EVS_EventType_INFORMATION, 0, "NULL"),
                       CFE_EVS_APP_NOT_REGISTERED);
 
+    /* Test sending a deferred event to an unregistered application */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "NULL"), CFE_EVS_APP_NOT_REGISTERED);
+
     /* Test application cleanup using an unregistered application */
     UT_InitData();
     CFE_UtAssert_SUCCESS(CFE_EVS_CleanUpApp(AppID));
@@ -527,7 +596,7 @@ void Test_FilterRegistration(void)
 
     /* Test filter registration using an invalid filter option */
     UT_InitData();
-    UtAssert_INT32_EQ(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY + 1), CFE_EVS_UNKNOWN_FILTER);
+    UtAssert_INT32_EQ(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY_RATE + 1), CFE_EVS_UNKNOWN_FILTER);
 
     /* Test successful filter registration with no filters */
     UT_InitData();
@@ -574,7 +643,7 @@ void Test_FilterRegistration(void)
 
     /* Send last information message, which should cause filtering to lock */
     UT_InitData();
-    FilterPtr        = EVS_FindEventID(0, (EVS_BinFilter_t *)AppDataPtr->BinFilters);
+    FilterPtr        = EVS_FindEventID(AppDataPtr, 0);
     FilterPtr->Count = CFE_EVS_MAX_FILTER_COUNT - 1;
     CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
     UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter, 3);
@@ -595,6 +664,47 @@ void Test_FilterRegistration(void)
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 0);
     UtAssert_UINT32_EQ(FilterPtr->Count, CFE_EVS_MAX_FILTER_COUNT);
 
+    /* Test the filter index with event IDs that hash to the same entry,
+     * a duplicated event ID, and a delete in the middle of a probe sequence
+     */
+    UT_InitData();
+    filter[0].EventID = 1;
+    filter[0].Mask    = 0x0001;
+    filter[1].EventID = 1 + EVS_FILTER_INDEX_SIZE;
+    filter[1].Mask    = 0x0003;
+    filter[2].EventID = 1 + (2 * EVS_FILTER_INDEX_SIZE);
+    filter[2].Mask    = 0x0007;
+    filter[3].EventID = 1 + EVS_FILTER_INDEX_SIZE;
+    filter[3].Mask    = 0x000F;
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(filter, 4, CFE_EVS_EventFilter_BINARY));
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, 1), &AppDataPtr->BinFilters[0]);
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, 1 + EVS_FILTER_INDEX_SIZE), &AppDataPtr->BinFilters[1]);
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, 1 + (2 * EVS_FILTER_INDEX_SIZE)), &AppDataPtr->BinFilters[2]);
+    UtAssert_NULL(EVS_FindEventID(AppDataPtr, 1 + (3 * EVS_FILTER_INDEX_SIZE)));
+    UtAssert_NULL(EVS_FindEventID(AppDataPtr, 2));
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, (uint16)CFE_EVS_FREE_SLOT), &AppDataPtr->BinFilters[4]);
+    UtAssert_ADDRESS_EQ(EVS_FindFreeFilter(AppDataPtr), &AppDataPtr->BinFilters[4]);
+
+    AppDataPtr->BinFilters[1].EventID = CFE_EVS_FREE_SLOT;
+    EVS_IndexFilters(AppDataPtr);
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, 1 + EVS_FILTER_INDEX_SIZE), &AppDataPtr->BinFilters[3]);
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, 1 + (2 * EVS_FILTER_INDEX_SIZE)), &AppDataPtr->BinFilters[2]);
+    UtAssert_ADDRESS_EQ(EVS_FindFreeFilter(AppDataPtr), &AppDataPtr->BinFilters[1]);
+
+    /* Test finding a free filter when all are in use */
+    UT_InitData();
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        filter[i].EventID = i * EVS_FILTER_INDEX_SIZE;
+        filter[i].Mask    = 1;
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(filter, CFE_PLATFORM_EVS_MAX_EVENT_FILTERS, CFE_EVS_EventFilter_BINARY));
+    UtAssert_NULL(EVS_FindFreeFilter(AppDataPtr));
+    UtAssert_ADDRESS_EQ(EVS_FindEventID(AppDataPtr, (CFE_PLATFORM_EVS_MAX_EVENT_FILTERS - 1) * EVS_FILTER_INDEX_SIZE),
+                        &AppDataPtr->BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS - 1]);
+    UtAssert_NULL(EVS_FindEventID(AppDataPtr, CFE_PLATFORM_EVS_MAX_EVENT_FILTERS * EVS_FILTER_INDEX_SIZE));
+
     /* Return application to original state: re-register application */
     UT_InitData();
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
@@ -781,6 +891,166 @@ void Test_Format(void)
     CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "%s", long_msg));
 }
 
+/*
+** Test events formatted later by the EVS task
+*/
+void Test_Deferred(void)
+{
+    EVS_DeferredEvent_t Event;
+    EVS_AppData_t *     AppDataPtr;
+    EVS_AppData_t       AppDataSave;
+    CFE_ES_AppId_t      AppID;
+    char                ShortBuffer[8];
+    char                LongString[CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE + 1];
+    char                LongSpec[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + 1];
+    char                Spec[16];
+    char                Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    uint32              i;
+
+    UT_SoftwareBusSnapshot_Entry_t MessageSnapshotData = {
+        .MsgId          = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_LONG_EVENT_MSG_MID),
+        .SnapshotBuffer = Message,
+        .SnapshotOffset = offsetof(CFE_EVS_LongEventTlm_t, Payload.Message),
+        .SnapshotSize   = sizeof(Message)};
+
+#if CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS < 16
+    char ManyArgs[4 * (CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS + 1)];
+#endif
+
+    /* Get a local ref to the "current" AppData table entry */
+    EVS_GetCurrentContext(&AppDataPtr, &AppID);
+
+    UtPrintf("Begin Test Deferred");
+
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+
+    /* Test expanding each supported argument type gives the same text as printf */
+    UT_InitData();
+    UT_EVS_CheckDeferredFormat("No arguments");
+    UT_EVS_CheckDeferredFormat("%d %i %u %x %X %o %c", -12, 34, 56u, 0xabu, 0xCDu, 8u, 'c');
+    UT_EVS_CheckDeferredFormat("%ld %lu %lld %llu %hd %hhu", -1L, 2UL, -3LL, 4ULL, (short)-5, (unsigned char)6);
+    UT_EVS_CheckDeferredFormat("%jd %ju %zu %td", (intmax_t)-7, (uintmax_t)8, (size_t)9, (ptrdiff_t)-10);
+    UT_EVS_CheckDeferredFormat("%-6d|%06.2f|%+e|%lg|%%|%#x|%5s|%-5s|", 1, 3.14159, 2.5, 0.125, 255u, "ab", "cd");
+    UT_EVS_CheckDeferredFormat("%p %s%s", (void *)&Event, "first", "second");
+
+    /* Test expanding into a buffer that is too small, the full length is returned */
+    UT_InitData();
+    UtAssert_BOOL_TRUE(UT_EVS_CaptureDeferredArgs(&Event, "%s and %d more", "text", 10));
+    UtAssert_INT32_EQ(EVS_DeferredExpand(ShortBuffer, sizeof(ShortBuffer), &Event), 16);
+    UtAssert_STRINGBUF_EQ(ShortBuffer, sizeof(ShortBuffer), "text an", SIZE_MAX);
+    UtAssert_INT32_EQ(EVS_DeferredExpand(ShortBuffer, 1, &Event), 16);
+    UtAssert_STRINGBUF_EQ(ShortBuffer, sizeof(ShortBuffer), "", SIZE_MAX);
+
+    /* Test formats whose arguments can't be captured */
+    UT_InitData();
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%*d", 2, 3));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%.*s", 2, "ab"));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%.2s", "abc"));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%n", &i));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%Lf", (long double)1));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%Ld", 1LL));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%lllu", 1ULL));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%lc", 'a'));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%hp", &i));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%hf", 1.0));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%k", 1));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%0000000000000000d", 1));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "trailing %"));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%s", (char *)NULL));
+
+    /* Test string arguments that don't fit */
+    memset(LongString, 'x', sizeof(LongString) - 1);
+    LongString[sizeof(LongString) - 1] = 0;
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%s", LongString));
+    UtAssert_BOOL_TRUE(UT_EVS_CaptureDeferredArgs(&Event, "%s", &LongString[1]));
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, "%s%s", &LongString[1], ""));
+
+    /* Test a format string that doesn't fit */
+    memset(LongSpec, 'x', sizeof(LongSpec) - 1);
+    LongSpec[sizeof(LongSpec) - 1] = 0;
+    UtAssert_BOOL_FALSE(UT_EVS_CaptureDeferredArgs(&Event, LongSpec));
+    UtAssert_BOOL_TRUE(UT_EVS_CaptureDeferredArgs(&Event, &LongSpec[1]));
+
+#if CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS < 16
+    /* Test too many arguments, "%%" does not count as one */
+    ManyArgs[0] = 0;
+    for (i = 0; i < CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS; i++)
+    {
+        strcat(ManyArgs, "%d");
+    }
+    strcat(ManyArgs, "%%");
+    UtAssert_BOOL_TRUE(UT_EVS_CaptureDeferredArgs(&Event, ManyArgs, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    strcat(ManyArgs, "%d");
+    UtAssert_BOOL_FALSE(
+        UT_EVS_CaptureDeferredArgs(&Event, ManyArgs, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+#endif
+
+    /* Test a deferred event is only sent when the EVS task processes it */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "Deferred %s %u", "event", 1u));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    memset(Message, 0, sizeof(Message));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &MessageSnapshotData);
+    UtAssert_VOIDCALL(EVS_ProcessDeferredEvents());
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), NULL, NULL);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STRINGBUF_EQ(Message, sizeof(Message), "Deferred event 1", SIZE_MAX);
+
+    /* Test a deferred event does not use the sender's format string after it is sent,
+     * as it may be unloaded with the app before the event is processed
+     */
+    UT_InitData();
+    strcpy(Spec, "Copied %u");
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, Spec, 2u));
+    memset(Spec, 0, sizeof(Spec));
+    memset(Message, 0, sizeof(Message));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &MessageSnapshotData);
+    UtAssert_VOIDCALL(EVS_ProcessDeferredEvents());
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), NULL, NULL);
+    UtAssert_STRINGBUF_EQ(Message, sizeof(Message), "Copied 2", SIZE_MAX);
+
+    /* Test an event with an unsupported format is sent immediately */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "Immediate %*d", 2, 1));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Test events are sent immediately when the app's ring is full */
+    UT_InitData();
+    for (i = 0; i < CFE_PLATFORM_EVS_DEFERRED_RING_SIZE; i++)
+    {
+        CFE_UtAssert_SUCCESS(
+            CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "Deferred %u", (unsigned int)i));
+    }
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "Ring full"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_VOIDCALL(EVS_ProcessDeferredEvents());
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1 + CFE_PLATFORM_EVS_DEFERRED_RING_SIZE);
+
+    /* Test the ring is usable again after wrapping */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "After wrap"));
+    UtAssert_VOIDCALL(EVS_ProcessDeferredEvents());
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Test events from an app deleted before they are processed are discarded */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_INFORMATION, "Discarded"));
+    AppDataSave = *AppDataPtr;
+    EVS_AppDataSetFree(AppDataPtr);
+    UtAssert_VOIDCALL(EVS_ProcessDeferredEvents());
+    *AppDataPtr = AppDataSave;
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    /* Test a filtered event is not deferred */
+    UT_InitData();
+    EVS_DisableTypes(AppDataPtr, CFE_EVS_DEBUG_BIT);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendDeferredEvent(0, CFE_EVS_EventType_DEBUG, "Filtered"));
+    EVS_EnableTypes(AppDataPtr, CFE_EVS_DEBUG_BIT);
+    UtAssert_VOIDCALL(EVS_ProcessDeferredEvents());
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
 /*
 ** Test enable/disable of port outputs
 */
@@ -869,6 +1139,97 @@ void Test_Ports(void)
     UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_DISPORT_EID);
 }
 
+/*
+** Test the output port queue and the port task
+*/
+void Test_PortQueue(void)
+{
+    CFE_EVS_LongEventTlm_t EventTlm;
+
+    UtPrintf("Begin Test Port Queue");
+
+    memset(&EventTlm, 0, sizeof(EventTlm));
+    EventTlm.Payload.PacketID.EventID = 1;
+
+    /* Test port queue creation failure */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 1, OS_ERROR);
+    EVS_PortQueueInit();
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[15]);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_EVS_Global.PortQueueID));
+
+    /* Test port task creation failure, which deletes the queue */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    EVS_PortQueueInit();
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[16]);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_EVS_Global.PortQueueID));
+
+    /* Test that the sender writes the log when there is no queue */
+    UT_InitData();
+    EVS_SendToLogAndPorts(&EventTlm);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+    /* Test successful port queue and task creation */
+    UT_InitData();
+    EVS_PortQueueInit();
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CFE_EVS_Global.PortQueueID));
+
+    /* Test that the port task writes a queued event, then stops when the queue cannot be read */
+    UT_InitData();
+    EVS_SendToLogAndPorts(&EventTlm);
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_VOIDCALL(EVS_PortTask());
+    UtAssert_STUB_COUNT(OS_QueueGet, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[17]);
+
+    /* Test that a queued event with the wrong size is ignored */
+    UT_InitData();
+    UT_SetDataBuffer((UT_EntryKey_t)OS_ObjectIdToInteger(CFE_EVS_Global.PortQueueID), &EventTlm, 1, false);
+    UtAssert_VOIDCALL(EVS_PortTask());
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test a full queue, whichever the drop policy only one event is lost */
+    UT_InitData();
+    CFE_EVS_Global.PortDropCounter = 0;
+    EVS_SendToLogAndPorts(&EventTlm);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    EVS_SendToLogAndPorts(&EventTlm);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.PortDropCounter, 1);
+
+    /* Test a queue that stays full */
+    UT_InitData();
+    CFE_EVS_Global.PortDropCounter = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+    EVS_SendToLogAndPorts(&EventTlm);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.PortDropCounter, 1);
+
+    /* Test reporting the drop counter in housekeeping telemetry */
+    UT_InitData();
+    CFE_EVS_Global.PortDropCounter = 5;
+    UtAssert_INT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPortDropCounter, 5);
+
+    UT_InitData();
+    CFE_EVS_Global.PortDropCounter = CFE_EVS_MAX_EVENT_SEND_COUNT + 1;
+    UtAssert_INT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPortDropCounter, CFE_EVS_MAX_EVENT_SEND_COUNT);
+
+    /* Test that the reset counters command clears the drop counter */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_EVS_ResetCountersCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_ZERO(CFE_EVS_Global.PortDropCounter);
+
+    /* Return to writing the log from the sender for the other tests */
+    CFE_EVS_Global.PortQueueID = OS_OBJECT_ID_UNDEFINED;
+}
+
 /*
 ** Test event logging
 */
@@ -1705,6 +2066,200 @@ void Test_FilterCmd(void)
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
 }
 
+/*
+** Test event rate limiting
+*/
+void Test_RateLimit(void)
+{
+    CFE_EVS_BinRateFilter_t         filter;
+    CFE_EVS_SetEventRateCmd_t       appratecmd;
+    CFE_EVS_SetAppEventRateCmd_t    appnameratecmd;
+    CFE_EVS_AppNameEventIDMaskCmd_t appmaskcmd;
+    CFE_EVS_AppNameEventIDCmd_t     appcmdcmd;
+    EVS_AppData_t *                 AppDataPtr;
+    CFE_ES_AppId_t                  AppID;
+    OS_time_t                       OneSecond = OS_TimeAssembleFromMilliseconds(1, 0);
+
+    /* Get a local ref to the "current" AppData table entry */
+    EVS_GetCurrentContext(&AppDataPtr, &AppID);
+
+    UtPrintf("Begin Test Rate Limit");
+
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+
+    memset(&appratecmd, 0, sizeof(appratecmd));
+    memset(&appnameratecmd, 0, sizeof(appnameratecmd));
+    memset(&appmaskcmd, 0, sizeof(appmaskcmd));
+    memset(&appcmdcmd, 0, sizeof(appcmdcmd));
+    strncpy(appratecmd.Payload.AppName, "ut_cfe_evs", sizeof(appratecmd.Payload.AppName) - 1);
+    strncpy(appnameratecmd.Payload.AppName, "ut_cfe_evs", sizeof(appnameratecmd.Payload.AppName) - 1);
+    strncpy(appmaskcmd.Payload.AppName, "ut_cfe_evs", sizeof(appmaskcmd.Payload.AppName) - 1);
+    strncpy(appcmdcmd.Payload.AppName, "ut_cfe_evs", sizeof(appcmdcmd.Payload.AppName) - 1);
+
+    /* Test registration with an event limited to 1 per second in bursts of 2 */
+    UT_InitData();
+    filter.EventID = 0;
+    filter.Mask    = CFE_EVS_NO_FILTER;
+    filter.Rate    = 1;
+    filter.Burst   = 2;
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(&filter, 1, CFE_EVS_EventFilter_BINARY_RATE));
+    UtAssert_UINT32_EQ(AppDataPtr->FilterRates[0].Tokens, 2 * EVS_RATE_TOKENS_PER_EVENT);
+    UtAssert_UINT32_EQ(AppDataPtr->AppRate.Rate, CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE);
+
+    /* Enable all application event message output */
+    EVS_EnableTypes(AppDataPtr, CFE_EVS_DEBUG_BIT | CFE_EVS_INFORMATION_BIT | CFE_EVS_ERROR_BIT | CFE_EVS_CRITICAL_BIT);
+
+    /* Test that the burst gets through and the next event is limited */
+    UT_InitData();
+    CFE_EVS_Global.RateLimitedCounter = 0;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "FAILED"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.RateLimitedCounter, 1);
+
+    /* Test that an event without a rate is not limited */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "OK"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Test that one token is back after one second */
+    UT_InitData();
+    AppDataPtr->FilterRates[0].LastTime = OS_TimeSubtract(AppDataPtr->FilterRates[0].LastTime, OneSecond);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "FAILED"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.RateLimitedCounter, 2);
+
+    /* Test that the bucket refills up to the burst after a long time */
+    UT_InitData();
+    AppDataPtr->FilterRates[0].LastTime =
+        OS_TimeSubtract(AppDataPtr->FilterRates[0].LastTime, OS_TimeAssembleFromMilliseconds(100, 0));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
+    UtAssert_UINT32_EQ(AppDataPtr->FilterRates[0].Tokens, EVS_RATE_TOKENS_PER_EVENT);
+
+    /* Test that a clock set back refills the bucket */
+    UT_InitData();
+    AppDataPtr->FilterRates[0].LastTime = OS_TimeAdd(AppDataPtr->FilterRates[0].LastTime, OneSecond);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
+    UtAssert_UINT32_EQ(AppDataPtr->FilterRates[0].Tokens, EVS_RATE_TOKENS_PER_EVENT);
+
+    /* Test that an event over the application limit does not use the filter token */
+    UT_InitData();
+    CFE_EVS_Global.RateLimitedCounter = 0;
+    EVS_SetRateLimit(&AppDataPtr->AppRate, 1, 1);
+    AppDataPtr->AppRate.Tokens = 0;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "FAILED"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.RateLimitedCounter, 1);
+    UtAssert_UINT32_EQ(AppDataPtr->FilterRates[0].Tokens, EVS_RATE_TOKENS_PER_EVENT);
+    UtAssert_ZERO(AppDataPtr->AppRate.Tokens);
+
+    /* Test that a high rate after a long time fills the bucket without overflowing */
+    UT_InitData();
+    EVS_SetRateLimit(&AppDataPtr->AppRate, 0xFFFF, 0xFFFF);
+    AppDataPtr->AppRate.Tokens = 0;
+    AppDataPtr->AppRate.LastTime =
+        OS_TimeSubtract(AppDataPtr->AppRate.LastTime, OS_TimeAssembleFromMilliseconds(1000, 0));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "OK"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(AppDataPtr->AppRate.Tokens, (0xFFFF - 1) * EVS_RATE_TOKENS_PER_EVENT);
+    EVS_SetRateLimit(&AppDataPtr->AppRate, CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE,
+                     CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST);
+
+    /* Test reporting the rate limited counter in housekeeping telemetry */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.RateLimitedCounter, 2);
+
+    UT_InitData();
+    CFE_EVS_Global.RateLimitedCounter = CFE_EVS_MAX_EVENT_SEND_COUNT + 1;
+    UtAssert_INT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.RateLimitedCounter, CFE_EVS_MAX_EVENT_SEND_COUNT);
+
+    /* Test that the reset counters command clears the rate limited counter */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_EVS_ResetCountersCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_ZERO(CFE_EVS_Global.RateLimitedCounter);
+
+    /* Test setting the rate of an event by command, a burst of 0 allows 1 event */
+    UT_InitData();
+    appratecmd.Payload.EventID = 0;
+    appratecmd.Payload.Rate    = 5;
+    appratecmd.Payload.Burst   = 0;
+    UT_EVS_DoDispatchCheckEvents(&appratecmd, sizeof(appratecmd), UT_TPID_CFE_EVS_CMD_SET_EVENT_RATE_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_SETEVTRATE_EID);
+    UtAssert_UINT32_EQ(AppDataPtr->FilterRates[0].Rate, 5);
+    UtAssert_UINT32_EQ(AppDataPtr->FilterRates[0].Burst, 1);
+
+    /* Test setting the rate of an event that is not registered for filtering */
+    UT_InitData();
+    appratecmd.Payload.EventID = 1;
+    UT_EVS_DoDispatchCheckEvents(&appratecmd, sizeof(appratecmd), UT_TPID_CFE_EVS_CMD_SET_EVENT_RATE_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_ERR_EVTIDNOREGS_EID);
+
+    /* Test that deleting and adding back a filter clears its rate */
+    UT_InitData();
+    appcmdcmd.Payload.EventID = 0;
+    UT_EVS_DoDispatchCheckEvents(&appcmdcmd, sizeof(appcmdcmd), UT_TPID_CFE_EVS_CMD_DELETE_EVENT_FILTER_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_DELFILTER_EID);
+
+    UT_InitData();
+    appmaskcmd.Payload.EventID = 0;
+    appmaskcmd.Payload.Mask    = CFE_EVS_NO_FILTER;
+    UT_EVS_DoDispatchCheckEvents(&appmaskcmd, sizeof(appmaskcmd), UT_TPID_CFE_EVS_CMD_ADD_EVENT_FILTER_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_ADDFILTER_EID);
+    UtAssert_ZERO(AppDataPtr->FilterRates[0].Rate);
+
+    /* Test limiting all the events of the application */
+    UT_InitData();
+    appnameratecmd.Payload.Rate  = 1;
+    appnameratecmd.Payload.Burst = 1;
+    UT_EVS_DoDispatchCheckEvents(&appnameratecmd, sizeof(appnameratecmd), UT_TPID_CFE_EVS_CMD_SET_APP_EVENT_RATE_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_SETAPPEVTRATE_EID);
+
+    /* The command event took the only token */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "FAILED"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.RateLimitedCounter, 1);
+
+    /* Test removing the application limit */
+    UT_InitData();
+    appnameratecmd.Payload.Rate = 0;
+    UT_EVS_DoDispatchCheckEvents(&appnameratecmd, sizeof(appnameratecmd), UT_TPID_CFE_EVS_CMD_SET_APP_EVENT_RATE_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_SETAPPEVTRATE_EID);
+
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "OK"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Test the rate commands with an application that is not registered */
+    UT_InitData();
+    strncpy(appratecmd.Payload.AppName, "unknown_name", sizeof(appratecmd.Payload.AppName) - 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetAppIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_EVS_DoDispatchCheckEvents(&appratecmd, sizeof(appratecmd), UT_TPID_CFE_EVS_CMD_SET_EVENT_RATE_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_ERR_NOAPPIDFOUND_EID);
+
+    UT_InitData();
+    strncpy(appnameratecmd.Payload.AppName, "unknown_name", sizeof(appnameratecmd.Payload.AppName) - 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetAppIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_EVS_DoDispatchCheckEvents(&appnameratecmd, sizeof(appnameratecmd), UT_TPID_CFE_EVS_CMD_SET_APP_EVENT_RATE_CC,
+                                 &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_ERR_NOAPPIDFOUND_EID);
+
+    /* Return application to original state, re-register application */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+}
+
 /*
 ** Test commands with invalid command, command packet, and command length
 */
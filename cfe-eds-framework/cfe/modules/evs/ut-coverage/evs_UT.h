@@ -41,6 +41,8 @@
 ** Includes
 */
 #include <string.h>
+#include <stdio.h>
+#include <stdint.h>
 #include "cfe_evs_module_all.h"
 #include "ut_support.h"
 
@@ -141,6 +143,22 @@ void Test_FilterReset(void);
 ******************************************************************************/
 void Test_Format(void);
 
+/*****************************************************************************/
+/**
+** \brief Test events formatted later by the EVS task
+**
+** \par Description
+**        This function tests capturing and expanding deferred events, the
+**        deferred event rings, and falling back to immediate formatting.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Deferred(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test enable/disable of port outputs
@@ -156,6 +174,22 @@ void Test_Format(void);
 ******************************************************************************/
 void Test_Ports(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the output port queue and the port task
+**
+** \par Description
+**        This function tests creating the output port queue and the port
+**        task, queueing events, the port task, and counting dropped events.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_PortQueue(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test event logging
@@ -233,6 +267,22 @@ void Test_EventCmd(void);
 ******************************************************************************/
 void Test_FilterCmd(void);
 
+/*****************************************************************************/
+/**
+** \brief Test event rate limiting
+**
+** \par Description
+**        This function tests the token bucket rate limits of events and
+**        applications, and the commands that set them.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_RateLimit(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test commands with invalid command, command packet, and
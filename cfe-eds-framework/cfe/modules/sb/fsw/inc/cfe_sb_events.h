@@ -761,6 +761,19 @@
  *  #CFE_SB_CreatePipe API failure due to no free queues.
  */
 #define CFE_SB_CR_PIPE_NO_FREE_EID 70
+
+/**
+ * \brief SB Transmit API Large Message Copied Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_TransmitMsg copied a message of at least #CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD
+ *  bytes into an SB buffer.  Only sent for the first such message from each application
+ *  since the counters were last reset.
+ */
+#define CFE_SB_LARGE_MSG_COPY_EID 71
 /**\}*/
 
 #endif /* CFE_SB_EVENTS_H */
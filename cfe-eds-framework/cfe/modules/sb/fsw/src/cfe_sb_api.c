@@ -164,8 +164,11 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
 
     if (Status == CFE_SUCCESS)
     {
-        /* create the queue */
-        OsStatus = OS_QueueCreate(&SysQueueId, PipeName, Depth, sizeof(CFE_SB_BufferD_t *), 0);
+        /*
+         * create the queue - pipes only ever carry buffer descriptor pointers between
+         * tasks in this process, so request the in-process queue implementation
+         */
+        OsStatus = OS_QueueCreate(&SysQueueId, PipeName, Depth, sizeof(CFE_SB_BufferD_t *), OS_QUEUE_FLAG_LOCAL);
         if (OsStatus == OS_SUCCESS)
         {
             /* just translate the RC to CFE */
@@ -382,22 +385,19 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     }
     else
     {
-        /* Remove the pipe from all routes */
-        Args.PipeId   = PipeId;
-        Args.FullName = FullName;
-        CFE_SBR_ForEachRouteId(CFE_SB_RemovePipeFromRoute, &Args, NULL);
-
         /*
-         * With the route removed there should be no new messages written to this pipe,
-         *
-         * but the pipe ID itself also needs to be invalidated now (before releasing lock) to make
-         * sure that no no subscriptions/routes can be added either.
+         * The pipe ID needs to be invalidated before removing it from the routes,
+         * since the lock is released while waiting for publishers below, to make
+         * sure that no subscriptions/routes can be added meanwhile.
          *
          * However we must first save certain state data for later deletion.
          */
         SysQueueId = PipeDscPtr->SysQueueId;
         BufDscPtr  = PipeDscPtr->LastBuffer;
 
+        /* The owner will not release the buffers it still holds from batch receives anymore */
+        CFE_SB_ReleasePipeBatchBuffers(PipeDscPtr);
+
         /*
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
@@ -405,6 +405,11 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          * any task from re-subscribing to this pipe.
          */
         CFE_SB_PipeDescSetUsed(PipeDscPtr, CFE_RESOURCEID_RESERVED);
+
+        /* Remove the pipe from all routes, publishers may still write to it until they are waited on below */
+        Args.PipeId   = PipeId;
+        Args.FullName = FullName;
+        CFE_SBR_ForEachRouteId(CFE_SB_RemovePipeFromRoute, &Args, NULL);
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -412,6 +417,14 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     /* remove any messages that might be on the pipe */
     if (Status == CFE_SUCCESS)
     {
+        /*
+         * Publishers that looked up a route before the pipe was removed may still
+         * put to the queue.  Once the routes are published without the pipe and
+         * those publishers are done, no new messages are written to it.
+         */
+        CFE_SB_PublishDestArrays();
+        CFE_SB_WaitForRouteReaders();
+
         while (true)
         {
             /* decrement refcount of any previous buffer */
@@ -855,6 +868,45 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_GetPipeSelectId
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_GetPipeSelectId(CFE_SB_PipeId_t PipeId, osal_id_t *SelectIdPtr)
+{
+    int32           Status;
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    if (SelectIdPtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status = CFE_SUCCESS;
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check input parameter */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        *SelectIdPtr = PipeDscPtr->SysQueueId;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_SubscribeEx
@@ -1026,6 +1078,7 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
 
                 /* add destination node */
                 CFE_SB_AddDestNode(RouteId, DestPtr);
+                CFE_SB_UpdateDestArray(RouteId, NULL);
 
                 CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse++;
                 if (CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse >
@@ -1056,6 +1109,12 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
+    /* The new destination must be visible to publishers before returning */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_SB_PublishDestArrays();
+    }
+
     /* Send events now */
     if (PendingEventID != 0)
     {
@@ -1273,6 +1332,12 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
+    /* Publishers must stop delivering to the removed destination before returning */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_SB_PublishDestArrays();
+    }
+
     if (PendingEventID != 0)
     {
         switch (PendingEventID)
@@ -1332,26 +1397,35 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
     int32             Status;
     CFE_MSG_Size_t    Size  = 0;
     CFE_SB_MsgId_t    MsgId = CFE_SB_INVALID_MSG_ID;
+    CFE_ES_AppId_t    AppId;
     CFE_ES_TaskId_t   TskId;
-    char              FullName[(OS_MAX_API_NAME * 2)];
     CFE_SB_BufferD_t *BufDscPtr;
     CFE_SBR_RouteId_t RouteId;
+    CFE_SB_EventBuf_t SBSndErr;
     uint16            PendingEventID;
+    bool              LargeCopy;
 
-    PendingEventID = 0;
-    BufDscPtr      = NULL;
-    RouteId        = CFE_SBR_INVALID_ROUTE_ID;
+    PendingEventID     = 0;
+    BufDscPtr          = NULL;
+    RouteId            = CFE_SBR_INVALID_ROUTE_ID;
+    SBSndErr.EvtsToSnd = 0;
+    LargeCopy          = false;
 
     Status = CFE_SB_TransmitMsgValidate(MsgPtr, &MsgId, &Size, &RouteId);
 
-    CFE_SB_LockSharedData(__func__, __LINE__);
-
     if (Status == CFE_SUCCESS && CFE_SBR_IsValidRouteId(RouteId))
     {
         /* Get buffer - note this pre-initializes the returned buffer with
          * a use count of 1, which refers to this task as it fills the buffer. */
         BufDscPtr = CFE_SB_GetBufferFromPool(Size);
-        if (BufDscPtr == NULL)
+        if (BufDscPtr != NULL)
+        {
+            /* The lock is only needed for the buffer tracking lists */
+            CFE_SB_LockSharedData(__func__, __LINE__);
+            CFE_SB_SetBufferInTransit_Unsync(BufDscPtr);
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+        }
+        else
         {
             PendingEventID = CFE_SB_GET_BUF_ERR_EID;
             Status         = CFE_SB_BUF_ALOC_ERR;
@@ -1366,14 +1440,12 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
      */
     if (Status != CFE_SUCCESS)
     {
-        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
     }
 
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
-
     /*
      * If a buffer was obtained above, then copy the content into it
-     * and broadcast it to all subscribers in the route.
+     * and deliver it to all subscribers in the route.
      *
      * Note - if there is no route / no subscribers, the "Status" will
      * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
@@ -1392,37 +1464,215 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
         BufDscPtr->AutoSequence = IncrementSequenceCount;
         CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
 
+        /* get app id for loopback testing */
+        CFE_ES_GetAppID(&AppId);
+
+        /* Account for the copy, large messages should use the zero copy API */
+        LargeCopy = CFE_SB_RecordMsgCopy(AppId, Size);
+
         /*
          * This routine will use best-effort to send to all subscribers,
          * increment the buffer use count for every successful delivery,
-         * and send an event/increment counter for any unsuccessful delivery.
+         * and record an event/increment counter for any unsuccessful delivery.
          */
-        CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
+        CFE_SB_DeliverBufferToRoute(BufDscPtr, RouteId, AppId, &SBSndErr);
 
         /*
-         * The broadcast function consumes the buffer, so it should not be
+         * Drop the reference held while filling the buffer, it should not be
          * accessed in this function anymore
          */
+        CFE_SB_ReleaseBufferRef(BufDscPtr);
         BufDscPtr = NULL;
     }
 
-    if (PendingEventID == CFE_SB_GET_BUF_ERR_EID)
+    if (PendingEventID != 0 || SBSndErr.EvtsToSnd > 0 || LargeCopy)
     {
         /* Get task id for events and Sender Info*/
         CFE_ES_GetTaskID(&TskId);
 
-        if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
+        if (PendingEventID != 0)
+        {
+            CFE_SB_SendTransmitEvent(TskId, PendingEventID, MsgPtr, MsgId, Size);
+        }
+
+        if (LargeCopy)
+        {
+            CFE_SB_SendLargeCopyEvent(TskId, MsgId, Size);
+        }
+
+        /* send an event for each pipe write error that may have occurred */
+        CFE_SB_SendBroadcastEvents(TskId, &SBSndErr);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgBatch
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitMsgBatch(const CFE_MSG_Message_t *const *MsgPtrArray, size_t Count,
+                                     bool IncrementSequenceCount, CFE_Status_t *StatusArray)
+{
+    CFE_Status_t             Status;
+    int32                    MsgStatus;
+    CFE_ES_AppId_t           AppId;
+    CFE_ES_TaskId_t          TskId;
+    const CFE_MSG_Message_t *MsgPtr;
+    CFE_MSG_Size_t           Size;
+    CFE_SB_MsgId_t           MsgId;
+    CFE_SB_BufferD_t *       BufDscPtr;
+    CFE_SBR_RouteId_t        RouteId;
+    CFE_SB_EventBuf_t        SBSndErr;
+    uint16                   MsgEventID;
+    uint16                   PendingEventID;
+    const CFE_MSG_Message_t *PendingMsgPtr;
+    CFE_SB_MsgId_t           PendingMsgId;
+    CFE_MSG_Size_t           PendingSize;
+    bool                     LargeCopy;
+    CFE_SB_MsgId_t           LargeCopyMsgId;
+    CFE_MSG_Size_t           LargeCopySize;
+    CFE_SB_BufferD_t *       FilledBufs[CFE_SB_TRANSMIT_BATCH_CHUNK];
+    CFE_SBR_RouteId_t        FilledRoutes[CFE_SB_TRANSMIT_BATCH_CHUNK];
+    uint32                   NumFilled;
+    uint32                   j;
+    size_t                   i;
+
+    Status             = CFE_SUCCESS;
+    PendingEventID     = 0;
+    PendingMsgPtr      = NULL;
+    PendingMsgId       = CFE_SB_INVALID_MSG_ID;
+    PendingSize        = 0;
+    SBSndErr.EvtsToSnd = 0;
+    LargeCopy          = false;
+    LargeCopyMsgId     = CFE_SB_INVALID_MSG_ID;
+    LargeCopySize      = 0;
+
+    /* The caller identity is the same for every message, so only resolve it once */
+    CFE_ES_GetAppID(&AppId);
+    CFE_ES_GetTaskID(&TskId);
+
+    if (MsgPtrArray == NULL)
+    {
+        PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+        CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
+    }
+    else
+    {
+        i = 0;
+        while (i < Count)
         {
-            CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                       "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
-                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_SB_GetAppTskName(TskId, FullName),
-                                       (int)Size);
+            NumFilled = 0;
+
+            /* Validate and fill the buffers of a chunk, this is private to this task so needs no lock */
+            for (; i < Count && NumFilled < CFE_SB_TRANSMIT_BATCH_CHUNK; ++i)
+            {
+                MsgPtr     = MsgPtrArray[i];
+                MsgId      = CFE_SB_INVALID_MSG_ID;
+                Size       = 0;
+                RouteId    = CFE_SBR_INVALID_ROUTE_ID;
+                BufDscPtr  = NULL;
+                MsgEventID = 0;
+
+                MsgStatus = CFE_SB_TransmitMsgValidateNoEvent(MsgPtr, &MsgId, &Size, &RouteId, &MsgEventID);
+
+                if (MsgStatus == CFE_SUCCESS && CFE_SBR_IsValidRouteId(RouteId))
+                {
+                    /* Same as CFE_SB_TransmitMsg(), the use count of 1 refers to this task as it fills the buffer */
+                    BufDscPtr = CFE_SB_GetBufferFromPool(Size);
+                    if (BufDscPtr == NULL)
+                    {
+                        MsgEventID = CFE_SB_GET_BUF_ERR_EID;
+                        MsgStatus  = CFE_SB_BUF_ALOC_ERR;
+                    }
+                }
+
+                /* Same as CFE_SB_TransmitMsg(), no route is not counted as an error */
+                if (MsgStatus != CFE_SUCCESS)
+                {
+                    CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
+
+                    if (Status == CFE_SUCCESS)
+                    {
+                        Status = MsgStatus;
+                    }
+                }
+
+                /* Only the first condition in a batch is reported by event, the counters cover the rest */
+                if (MsgEventID != 0 && PendingEventID == 0)
+                {
+                    PendingEventID = MsgEventID;
+                    PendingMsgPtr  = MsgPtr;
+                    PendingMsgId   = MsgId;
+                    PendingSize    = Size;
+                }
 
-            /* clear the bit so the task may send this event again */
-            CFE_SB_FinishSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT);
+                if (BufDscPtr != NULL)
+                {
+                    memcpy(&BufDscPtr->Content, MsgPtr, Size);
+                    BufDscPtr->MsgId        = MsgId;
+                    BufDscPtr->ContentSize  = Size;
+                    BufDscPtr->AutoSequence = IncrementSequenceCount;
+                    CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
+
+                    /* At most one large copy event can be pending, as it is only sent once per app */
+                    if (CFE_SB_RecordMsgCopy(AppId, Size))
+                    {
+                        LargeCopy      = true;
+                        LargeCopyMsgId = MsgId;
+                        LargeCopySize  = Size;
+                    }
+
+                    FilledBufs[NumFilled]   = BufDscPtr;
+                    FilledRoutes[NumFilled] = RouteId;
+                    ++NumFilled;
+                }
+
+                if (StatusArray != NULL)
+                {
+                    StatusArray[i] = MsgStatus;
+                }
+            }
+
+            if (NumFilled > 0)
+            {
+                /* The lock is only needed for the buffer tracking lists, take it once for the whole chunk */
+                CFE_SB_LockSharedData(__func__, __LINE__);
+                for (j = 0; j < NumFilled; ++j)
+                {
+                    CFE_SB_SetBufferInTransit_Unsync(FilledBufs[j]);
+                }
+                CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+                for (j = 0; j < NumFilled; ++j)
+                {
+                    CFE_SB_DeliverBufferToRoute(FilledBufs[j], FilledRoutes[j], AppId, &SBSndErr);
+
+                    /* Drop the reference held while filling the buffer, it should not be accessed after this */
+                    CFE_SB_ReleaseBufferRef(FilledBufs[j]);
+                }
+            }
         }
     }
 
+    if (PendingEventID != 0)
+    {
+        CFE_SB_SendTransmitEvent(TskId, PendingEventID, PendingMsgPtr, PendingMsgId, PendingSize);
+    }
+
+    if (LargeCopy)
+    {
+        CFE_SB_SendLargeCopyEvent(TskId, LargeCopyMsgId, LargeCopySize);
+    }
+
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_SendBroadcastEvents(TskId, &SBSndErr);
+
     return Status;
 }
 
@@ -1438,18 +1688,47 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
                                  CFE_SBR_RouteId_t *RouteIdPtr)
 {
     CFE_ES_TaskId_t TskId;
-    char            FullName[(OS_MAX_API_NAME * 2)];
     uint16          PendingEventID;
     int32           Status;
 
     PendingEventID = 0;
-    Status         = CFE_SUCCESS;
+
+    /* The route lookup is safe against concurrent subscription changes without the lock */
+    Status = CFE_SB_TransmitMsgValidateNoEvent(MsgPtr, MsgIdPtr, SizePtr, RouteIdPtr, &PendingEventID);
+
+    if (PendingEventID != 0)
+    {
+        /* get task id for events */
+        CFE_ES_GetTaskID(&TskId);
+
+        CFE_SB_SendTransmitEvent(TskId, PendingEventID, MsgPtr, *MsgIdPtr, *SizePtr);
+    } /* end if */
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgValidateNoEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_TransmitMsgValidateNoEvent(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr,
+                                        CFE_MSG_Size_t *SizePtr, CFE_SBR_RouteId_t *RouteIdPtr,
+                                        uint16 *PendingEventIdPtr)
+{
+    int32 Status;
+
+    *PendingEventIdPtr = 0;
+    Status             = CFE_SUCCESS;
 
     /* check input parameter */
     if (MsgPtr == NULL)
     {
-        PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
-        Status         = CFE_SB_BAD_ARGUMENT;
+        *PendingEventIdPtr = CFE_SB_SEND_BAD_ARG_EID;
+        Status             = CFE_SB_BAD_ARGUMENT;
     }
 
     if (Status == CFE_SUCCESS)
@@ -1459,8 +1738,8 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
         /* validate the msgid in the message */
         if (!CFE_SB_IsValidMsgId(*MsgIdPtr))
         {
-            PendingEventID = CFE_SB_SEND_INV_MSGID_EID;
-            Status         = CFE_SB_BAD_ARGUMENT;
+            *PendingEventIdPtr = CFE_SB_SEND_INV_MSGID_EID;
+            Status             = CFE_SB_BAD_ARGUMENT;
         }
     }
 
@@ -1471,16 +1750,13 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
         /* Verify the size of the pkt is < or = the mission defined max */
         if (*SizePtr > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
         {
-            PendingEventID = CFE_SB_MSG_TOO_BIG_EID;
-            Status         = CFE_SB_MSG_TOO_BIG;
+            *PendingEventIdPtr = CFE_SB_MSG_TOO_BIG_EID;
+            Status             = CFE_SB_MSG_TOO_BIG;
         } /* end if */
     }
 
     if (Status == CFE_SUCCESS)
     {
-        /* check the route, which should be done while locked */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         /* Get the routing id */
         *RouteIdPtr = CFE_SBR_GetRouteId(*MsgIdPtr);
 
@@ -1488,77 +1764,95 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
         /* increment the dropped pkt cnt, send event and return success */
         if (!CFE_SBR_IsValidRouteId(*RouteIdPtr))
         {
-            CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
-            PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
+            CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter);
+            *PendingEventIdPtr = CFE_SB_SEND_NO_SUBS_EID;
         }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
-    if (PendingEventID != 0)
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_SendTransmitEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_SendTransmitEvent(CFE_ES_TaskId_t TskId, uint16 EventId, const CFE_MSG_Message_t *MsgPtr,
+                              CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    char FullName[(OS_MAX_API_NAME * 2)];
+
+    switch (EventId)
     {
-        /* get task id for events */
-        CFE_ES_GetTaskID(&TskId);
+        case CFE_SB_SEND_BAD_ARG_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Bad input argument,Arg 0x%lx,App %s", (unsigned long)MsgPtr,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
 
-        switch (PendingEventID)
-        {
-            case CFE_SB_SEND_BAD_ARG_EID:
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                               "Send Err:Bad input argument,Arg 0x%lx,App %s", (unsigned long)MsgPtr,
-                                               CFE_SB_GetAppTskName(TskId, FullName));
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT);
+            }
+            break;
 
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT);
-                }
-                break;
+        case CFE_SB_SEND_INV_MSGID_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_INV_MSGID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Invalid MsgId(0x%x)in msg,App %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
 
-            case CFE_SB_SEND_INV_MSGID_EID:
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_INV_MSGID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                               "Send Err:Invalid MsgId(0x%x)in msg,App %s",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName));
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT);
+            }
+            break;
 
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT);
-                }
-                break;
+        case CFE_SB_MSG_TOO_BIG_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (int)Size,
+                                           CFE_MISSION_SB_MAX_SB_MSG_SIZE);
 
-            case CFE_SB_MSG_TOO_BIG_EID:
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                               "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName), (int)*SizePtr,
-                                               CFE_MISSION_SB_MAX_SB_MSG_SIZE);
-
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT);
-                }
-                break;
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT);
+            }
+            break;
 
-            case CFE_SB_SEND_NO_SUBS_EID:
-                /* Determine if event can be sent without causing recursive event problem */
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION,
-                                               CFE_SB_Global.AppId, "No subscribers for MsgId 0x%x,sender %s",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName));
+        case CFE_SB_SEND_NO_SUBS_EID:
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION,
+                                           CFE_SB_Global.AppId, "No subscribers for MsgId 0x%x,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
 
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT);
-                } /* end if */
-                break;
-        }
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT);
+            } /* end if */
+            break;
 
-    } /* end if */
+        case CFE_SB_GET_BUF_ERR_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (int)Size);
 
-    return Status;
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT);
+            }
+            break;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -1571,15 +1865,9 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
  *-----------------------------------------------------------------*/
 void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId)
 {
-    CFE_ES_AppId_t         AppId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_EventBuf_t      SBSndErr;
-    int32                  OsStatus;
-    uint32                 i;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
+    CFE_ES_AppId_t    AppId;
+    CFE_ES_TaskId_t   TskId;
+    CFE_SB_EventBuf_t SBSndErr;
 
     SBSndErr.EvtsToSnd = 0;
 
@@ -1589,38 +1877,96 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     /* get task id for events and Sender Info*/
     CFE_ES_GetTaskID(&TskId);
 
-    /* take semaphore to prevent a task switch during processing */
+    /* the tracking lists are only modified while locked */
     CFE_SB_LockSharedData(__func__, __LINE__);
+    CFE_SB_SetBufferInTransit_Unsync(BufDscPtr);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-    /* For an invalid route / no subscribers this whole logic can be skipped */
-    if (CFE_SBR_IsValidRouteId(RouteId))
-    {
-        /* Set the seq count if requested (while locked) before actually sending */
-        /* For some reason this is only done for TLM types (historical, TBD) */
-        if (BufDscPtr->AutoSequence && BufDscPtr->ContentType == CFE_MSG_Type_Tlm)
-        {
-            CFE_SBR_IncrementSequenceCounter(RouteId);
+    CFE_SB_DeliverBufferToRoute(BufDscPtr, RouteId, AppId, &SBSndErr);
 
-            /* Write the sequence into the message header itself (overwrites whatever was there) */
-            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(RouteId));
-        }
+    /*
+    ** Decrement the buffer UseCount and free buffer if cnt=0. This decrement is done
+    ** because the use cnt is initialized to 1 in CFE_SB_GetBufferFromPool.
+    ** Initializing the count to 1 (as opposed to zero) and decrementing it here are
+    ** done to ensure the buffer gets released when there are destinations that have
+    ** been disabled via ground command.
+    */
+    CFE_SB_ReleaseBufferRef(BufDscPtr);
 
-        /* Send the packet to all destinations  */
-        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
-        {
-            if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
-            {
-                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
-            }
-            else
-            {
-                PipeDscPtr = NULL;
-            }
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_SendBroadcastEvents(TskId, &SBSndErr);
+}
 
-            if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
-            {
-                continue;
-            }
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_SetBufferInTransit_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_SetBufferInTransit_Unsync(CFE_SB_BufferD_t *BufDscPtr)
+{
+    /*
+     * Remove this from whatever list it was in
+     *
+     * If it was a singleton/new buffer this has no effect.
+     * If it was a zero-copy buffer this removes it from the ZeroCopyList.
+     */
+    CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+
+    /* clear the AppID field in case it was a zero copy buffer,
+     * as it is no longer owned by that app after broadcasting */
+    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+
+    /* track the buffer as an in-transit message */
+    CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_DeliverBufferToRoute
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DeliverBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId, CFE_ES_AppId_t AppId,
+                                 CFE_SB_EventBuf_t *SBSndErr)
+{
+    const CFE_SBR_DestArray_t *      DestArrayPtr;
+    const CFE_SB_DestinationEntry_t *EntryPtr;
+    CFE_SB_DestinationD_t *          DestPtr;
+    CFE_SB_PipeD_t *                 PipeDscPtr;
+    int32                            OsStatus;
+    uint32                           DeliveryErrors;
+    uint32                           ReadToken;
+    uint32                           i;
+    uint16                           QueueDepth;
+
+    DeliveryErrors = 0;
+
+    /* For an invalid route / no subscribers this whole logic can be skipped */
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        /* Set the seq count if requested before actually sending */
+        /* For some reason this is only done for TLM types (historical, TBD) */
+        if (BufDscPtr->AutoSequence && BufDscPtr->ContentType == CFE_MSG_Type_Tlm)
+        {
+            /* Write the sequence into the message header itself (overwrites whatever was there) */
+            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_IncrementSequenceCounter(RouteId));
+        }
+
+        /* Destinations removed by a concurrent unsubscribe stay valid until this ends */
+        ReadToken    = CFE_SBR_ReadLock();
+        DestArrayPtr = CFE_SBR_GetDestArray(RouteId);
+
+        /* Send the packet to all destinations, the array only holds active ones with a valid pipe */
+        for (i = 0; i < DestArrayPtr->NumDests; ++i)
+        {
+            EntryPtr   = &DestArrayPtr->Dests[i];
+            DestPtr    = EntryPtr->DestPtr;
+            PipeDscPtr = EntryPtr->PipeDscPtr;
 
             if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) != 0 &&
                 CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
@@ -1630,17 +1976,24 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
 
             /* if Msg limit exceeded, log event, increment counter */
             /* and go to next destination */
-            if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+            if (!CFE_SB_CounterIncrementBelow(&DestPtr->BuffCount, DestPtr->MsgId2PipeLim))
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter++;
-                PipeDscPtr->SendErrors++;
+                CFE_SB_AddSendErrEvent(SBSndErr, CFE_SB_MSGID_LIM_ERR_EID, BufDscPtr->MsgId, EntryPtr->PipeId,
+                                       OS_SUCCESS);
+                ++DeliveryErrors;
+                CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter);
+                CFE_ATOMIC_INCR(&PipeDscPtr->SendErrors);
 
                 continue;
             } /* end if */
 
+            /*
+            ** The receiver may dequeue the buffer before OS_QueuePut() even returns,
+            ** so the reference and the queue depth it gives back are taken up front.
+            */
+            CFE_SB_IncrBufUseCnt(BufDscPtr);
+            QueueDepth = CFE_ATOMIC_ADD(&PipeDscPtr->CurrentQueueDepth, 1);
+
             /*
             ** Write the buffer descriptor to the queue of the pipe.  If the write
             ** failed, log info and increment the pipe's error counter.
@@ -1649,114 +2002,99 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
 
             if (OsStatus == OS_SUCCESS)
             {
-                /* The queue now holds a ref to the buffer, so increment its ref count. */
-                CFE_SB_IncrBufUseCnt(BufDscPtr);
-
-                DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
-                DestPtr->DestCnt++;   /* used for statistics */
-                ++PipeDscPtr->CurrentQueueDepth;
-                if (PipeDscPtr->CurrentQueueDepth >= PipeDscPtr->PeakQueueDepth)
-                {
-                    PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
-                }
+                CFE_ATOMIC_INCR(&DestPtr->DestCnt); /* used for statistics */
+                CFE_SB_CounterRaisePeak(&PipeDscPtr->PeakQueueDepth, QueueDepth);
+                continue;
             }
-            else if (OsStatus == OS_QUEUE_FULL)
+
+            /* Not queued, so back out the accounting.  The caller still holds a reference. */
+            CFE_SB_CounterDecrement(&DestPtr->BuffCount);
+            CFE_SB_CounterDecrement(&PipeDscPtr->CurrentQueueDepth);
+            CFE_SB_DropBufUseCnt(BufDscPtr);
+
+            if (OsStatus == OS_QUEUE_FULL)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
-                PipeDscPtr->SendErrors++;
+                CFE_SB_AddSendErrEvent(SBSndErr, CFE_SB_Q_FULL_ERR_EID, BufDscPtr->MsgId, EntryPtr->PipeId, OsStatus);
+                ++DeliveryErrors;
+                CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter);
+                CFE_ATOMIC_INCR(&PipeDscPtr->SendErrors);
             }
             else
             {
                 /* Unexpected error while writing to queue. */
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId   = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId  = CFE_SB_Q_WR_ERR_EID;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].OsStatus = OsStatus;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
-                PipeDscPtr->SendErrors++;
+                CFE_SB_AddSendErrEvent(SBSndErr, CFE_SB_Q_WR_ERR_EID, BufDscPtr->MsgId, EntryPtr->PipeId, OsStatus);
+                ++DeliveryErrors;
+                CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter);
+                CFE_ATOMIC_INCR(&PipeDscPtr->SendErrors);
             } /*end if */
 
         } /* end loop over destinations */
+
+        CFE_SBR_ReadUnlock(ReadToken);
     }
 
     /*
      * If any specific delivery issues occurred, also increment the
-     * general error count before releasing the lock.
+     * general error count.
      */
-    if (SBSndErr.EvtsToSnd > 0)
+    if (DeliveryErrors > 0)
     {
-        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
     }
+}
 
-    /*
-     * Remove this from whatever list it was in
-     *
-     * If it was a singleton/new buffer this has no effect.
-     * If it was a zero-copy buffer this removes it from the ZeroCopyList.
-     */
-    CFE_SB_TrackingListRemove(&BufDscPtr->Link);
-
-    /* clear the AppID field in case it was a zero copy buffer,
-     * as it is no longer owned by that app after broadcasting */
-    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
-
-    /* track the buffer as an in-transit message */
-    CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
-
-    /*
-    ** Decrement the buffer UseCount and free buffer if cnt=0. This decrement is done
-    ** because the use cnt is initialized to 1 in CFE_SB_GetBufferFromPool.
-    ** Initializing the count to 1 (as opposed to zero) and decrementing it here are
-    ** done to ensure the buffer gets released when there are destinations that have
-    ** been disabled via ground command.
-    */
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
-
-    /* release the semaphore */
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_SendBroadcastEvents
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_SendBroadcastEvents(CFE_ES_TaskId_t TskId, const CFE_SB_EventBuf_t *SBSndErr)
+{
+    uint32 i;
+    char   FullName[(OS_MAX_API_NAME * 2)];
+    char   PipeName[OS_MAX_API_NAME];
 
-    /* send an event for each pipe write error that may have occurred */
-    for (i = 0; i < SBSndErr.EvtsToSnd; i++)
+    for (i = 0; i < SBSndErr->EvtsToSnd; i++)
     {
-        if (SBSndErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
+        if (SBSndErr->EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
         {
 
             /* Determine if event can be sent without causing recursive event problem */
             if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
             {
 
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
 
                 CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
                 CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(SBSndErr->EvtBuf[i].MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
 
                 /* clear the bit so the task may send this event again */
                 CFE_SB_FinishSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT);
             } /* end if */
         }
-        else if (SBSndErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
+        else if (SBSndErr->EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
         {
 
             /* Determine if event can be sent without causing recursive event problem */
             if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED)
             {
 
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
 
                 CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
                 CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(SBSndErr->EvtBuf[i].MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
 
                 /* clear the bit so the task may send this event again */
@@ -1770,12 +2108,12 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED)
             {
 
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName), (long)(SBSndErr.EvtBuf[i].OsStatus));
+                                           (unsigned int)CFE_SB_MsgIdToValue(SBSndErr->EvtBuf[i].MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName), (long)(SBSndErr->EvtBuf[i].OsStatus));
 
                 /* clear the bit so the task may send this event again */
                 CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT);
@@ -1795,18 +2133,16 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
 {
-    int32                  Status;
-    int32                  OsStatus;
-    CFE_SB_BufferD_t *     BufDscPtr;
-    size_t                 BufDscSize;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SBR_RouteId_t      RouteId;
-    CFE_ES_TaskId_t        TskId;
-    uint16                 PendingEventID;
-    osal_id_t              SysQueueId;
-    int32                  SysTimeout;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
+    int32             Status;
+    int32             OsStatus;
+    CFE_SB_BufferD_t *BufDscPtr;
+    size_t            BufDscSize;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_ES_TaskId_t   TskId;
+    uint16            PendingEventID;
+    osal_id_t         SysQueueId;
+    int32             SysTimeout;
+    char              FullName[(OS_MAX_API_NAME * 2)];
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
@@ -1814,7 +2150,6 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
     PipeDscPtr     = NULL;
     BufDscPtr      = NULL;
-    DestPtr        = NULL;
     BufDscSize     = 0;
     OsStatus       = OS_SUCCESS;
 
@@ -1883,12 +2218,7 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
              * in a future version of CFE to decouple these actions, to allow for
              * multiple workers to service the same pipe.
              */
-            if (PipeDscPtr->LastBuffer != NULL)
-            {
-                /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-                CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-                PipeDscPtr->LastBuffer = NULL;
-            }
+            CFE_SB_ReleasePipeBuffers(PipeDscPtr);
         }
 
         CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1959,25 +2289,8 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
              */
             *BufPtr = &BufDscPtr->Content;
 
-            /* get pointer to destination to be used in decrementing msg limit cnt*/
-            RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
-            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
-
-            /*
-            ** DestPtr would be NULL if the msg is unsubscribed to while it is on
-            ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
-            ** then resubscribed to while it is on the pipe. Both of these cases are
-            ** considered nominal and are handled by the code below.
-            */
-            if (DestPtr != NULL && DestPtr->BuffCount > 0)
-            {
-                DestPtr->BuffCount--;
-            }
-
-            if (PipeDscPtr->CurrentQueueDepth > 0)
-            {
-                --PipeDscPtr->CurrentQueueDepth;
-            }
+            /* decrement the msg limit count and pipe depth */
+            CFE_SB_UpdatePipeOnReceive(PipeDscPtr, BufDscPtr);
         }
         else
         {
@@ -2000,7 +2313,7 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
         else
         {
             /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
-            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+            CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter);
         }
     }
 
@@ -2042,6 +2355,331 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReceiveBufferBatch
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, size_t MaxCount, size_t *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    int32             Status;
+    int32             OsStatus;
+    CFE_SB_BufferD_t *BufDscArray[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+    uint32            Count;
+    uint32            Valid;
+    uint32            Room;
+    uint32            i;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_ES_TaskId_t   TskId;
+    uint16            PendingEventID;
+    osal_id_t         SysQueueId;
+    int32             SysTimeout;
+    char              FullName[(OS_MAX_API_NAME * 2)];
+
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+    SysTimeout     = OS_PEND;
+    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    PipeDscPtr     = NULL;
+    Count          = 0;
+    OsStatus       = OS_SUCCESS;
+
+    /* Check input args and translate the timeout, same as CFE_SB_ReceiveBuffer() */
+    if (BufPtrArray == NULL || CountPtr == NULL || MaxCount == 0)
+    {
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (TimeOut > 0)
+    {
+        SysTimeout = TimeOut;
+    }
+    else if (TimeOut == CFE_SB_POLL)
+    {
+        SysTimeout = OS_CHECK;
+    }
+    else if (TimeOut != CFE_SB_PEND_FOREVER)
+    {
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+
+    /* The descriptors are read into a local array, so the batch size is bounded */
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+    {
+        MaxCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    }
+
+    /* If OK, then lock and pull relevant info from Pipe Descriptor */
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+        /* If the pipe does not exist or PipeId is out of range... */
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
+        }
+        else
+        {
+            SysQueueId = PipeDscPtr->SysQueueId;
+
+            /*
+             * Un-reference the buffer from the last CFE_SB_ReceiveBuffer() call, as that
+             * call would do.  Batch buffers are released by the caller instead.
+             */
+            CFE_SB_ReleasePipeBuffers(PipeDscPtr);
+
+            /* Batch buffers are tracked on the pipe until released, which bounds how many may be held */
+            Room = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH - PipeDscPtr->BatchCount;
+            if (Room == 0)
+            {
+                PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+                Status         = CFE_SB_BAD_ARGUMENT;
+            }
+            else if (MaxCount > Room)
+            {
+                MaxCount = Room;
+            }
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /*
+     * Wait for the first buffer descriptor per the caller's timeout, and take
+     * whatever else is already queued in the same call.  As with the single
+     * receive this must be done OUTSIDE the SB lock.
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        OsStatus = OS_QueueGetMulti(SysQueueId, BufDscArray, sizeof(BufDscArray[0]), (uint32)MaxCount, &Count,
+                                    SysTimeout);
+
+        if (OsStatus == OS_SUCCESS)
+        {
+            /* A NULL descriptor is not expected, but skip it rather than lose the rest */
+            Valid = 0;
+            for (i = 0; i < Count; ++i)
+            {
+                if (BufDscArray[i] != NULL)
+                {
+                    BufDscArray[Valid] = BufDscArray[i];
+                    ++Valid;
+                }
+            }
+            Count = Valid;
+
+            if (Count == 0)
+            {
+                PendingEventID = CFE_SB_Q_RD_ERR_EID;
+                Status         = CFE_SB_PIPE_RD_ERR;
+            }
+        }
+        else if (OsStatus == OS_QUEUE_EMPTY)
+        {
+            Status = CFE_SB_NO_MESSAGE;
+        }
+        else if (OsStatus == OS_QUEUE_TIMEOUT)
+        {
+            Status = CFE_SB_TIME_OUT;
+        }
+        else
+        {
+            PendingEventID = CFE_SB_Q_RD_ERR_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+    }
+
+    /* Now re-lock once to account for the whole batch */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            /*
+             * The reference each buffer held while in the queue is transferred to the
+             * caller, to be dropped by CFE_SB_ReleaseBufferBatch() or when the pipe
+             * is deleted.  Another task reading the same pipe could have used up the
+             * room meanwhile, any buffer that cannot be tracked is dropped.
+             */
+            Valid = 0;
+            for (i = 0; i < Count; ++i)
+            {
+                CFE_SB_UpdatePipeOnReceive(PipeDscPtr, BufDscArray[i]);
+
+                if (PipeDscPtr->BatchCount < CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+                {
+                    PipeDscPtr->BatchBuffers[PipeDscPtr->BatchCount] = BufDscArray[i];
+                    ++PipeDscPtr->BatchCount;
+
+                    BufPtrArray[Valid] = &BufDscArray[i]->Content;
+                    ++Valid;
+                }
+                else
+                {
+                    CFE_SB_DecrBufUseCnt(BufDscArray[i]);
+                }
+            }
+            Count = Valid;
+
+            if (Count == 0)
+            {
+                PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+                Status         = CFE_SB_BAD_ARGUMENT;
+            }
+        }
+        else
+        {
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+
+            /* Drop the refs that were in the queue */
+            for (i = 0; i < Count; ++i)
+            {
+                CFE_SB_DecrBufUseCnt(BufDscArray[i]);
+            }
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (PendingEventID == CFE_SB_RCV_BAD_ARG_EID || PendingEventID == CFE_SB_BAD_PIPEID_EID)
+        {
+            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+        }
+        else if (PendingEventID != 0)
+        {
+            /* An empty pipe is the normal end of a batch drain, so only count real errors */
+            CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter);
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Now actually send the event, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_ES_GetTaskID(&TskId);
+
+        switch (PendingEventID)
+        {
+            case CFE_SB_Q_RD_ERR_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_RD_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Read Err,pipe %lu,app %s,stat %ld", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (long)OsStatus);
+                break;
+            case CFE_SB_RCV_BAD_ARG_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Rcv Err:Bad Input Arg:BufPtr 0x%lx,Count 0x%lx,pipe %lu,t/o %d,app %s",
+                                           (unsigned long)BufPtrArray, (unsigned long)CountPtr,
+                                           CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+            case CFE_SB_BAD_PIPEID_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Rcv Err:PipeId %lu does not exist,app %s", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+        }
+    }
+
+    if (CountPtr != NULL)
+    {
+        if (Status != CFE_SUCCESS)
+        {
+            Count = 0;
+        }
+        *CountPtr = Count;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReleaseBufferBatch
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReleaseBufferBatch(CFE_SB_Buffer_t *const *BufPtrArray, size_t Count, CFE_SB_PipeId_t PipeId)
+{
+    CFE_Status_t      Status;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+    cpuaddr           BufDscAddr;
+    size_t            i;
+    uint16            j;
+
+    if (BufPtrArray == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    for (i = 0; i < Count; ++i)
+    {
+        if (BufPtrArray[i] == NULL)
+        {
+            return CFE_SB_BAD_ARGUMENT;
+        }
+    }
+
+    Status = CFE_SUCCESS;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        for (i = 0; i < Count; ++i)
+        {
+            /* The buffer is just a member (offset) in the descriptor */
+            BufDscAddr = (cpuaddr)BufPtrArray[i] - offsetof(CFE_SB_BufferD_t, Content);
+            BufDscPtr  = (CFE_SB_BufferD_t *)BufDscAddr;
+
+            /* Only buffers the pipe still holds for the caller may be released */
+            for (j = 0; j < PipeDscPtr->BatchCount; ++j)
+            {
+                if (PipeDscPtr->BatchBuffers[j] == BufDscPtr)
+                {
+                    break;
+                }
+            }
+
+            if (j == PipeDscPtr->BatchCount)
+            {
+                Status = CFE_SB_BUFFER_INVALID;
+                continue;
+            }
+
+            --PipeDscPtr->BatchCount;
+            PipeDscPtr->BatchBuffers[j]                      = PipeDscPtr->BatchBuffers[PipeDscPtr->BatchCount];
+            PipeDscPtr->BatchBuffers[PipeDscPtr->BatchCount] = NULL;
+
+            /* Drop the reference that was transferred from the pipe queue */
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_AllocateMessageBuffer
@@ -2069,8 +2707,6 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
     /* get callers AppId */
     if (CFE_ES_GetAppID(&AppId) == CFE_SUCCESS)
     {
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         /*
          * All this needs to do is get a descriptor from the pool,
          * and associate that descriptor with this app ID, so it
@@ -2083,10 +2719,11 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
             /* Track the buffer as a zero-copy assigned to this app ID */
             BufDscPtr->AppId = AppId;
             BufPtr           = &BufDscPtr->Content;
+
+            CFE_SB_LockSharedData(__func__, __LINE__);
             CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
         }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
     if (BufPtr != NULL)
@@ -2220,9 +2857,7 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequen
     if (Status != CFE_SUCCESS)
     {
         /* Increment send error counter for validation failure */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
+        CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
     }
 
     return Status;
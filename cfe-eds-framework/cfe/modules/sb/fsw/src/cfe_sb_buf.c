@@ -96,46 +96,68 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SB_GetBufferFromPool
+ * Function: CFE_SB_RaisePeak
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Internal helper routine only, not part of API.
+ * Buffers are allocated and freed without the SB lock, so the statistics are atomic
  *
  *-----------------------------------------------------------------*/
-CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
+static void CFE_SB_RaisePeak(uint32 *PeakPtr, uint32 InUse)
 {
-    int32               stat1;
-    size_t              AllocSize;
-    CFE_ES_MemPoolBuf_t addr = NULL;
-    CFE_SB_BufferD_t *  bd;
+    uint32 Peak;
 
-    /* The allocation needs to include enough space for the descriptor object */
-    AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
-
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    Peak = CFE_ATOMIC_LOAD_RELAXED(PeakPtr);
+    while (InUse > Peak && !CFE_ATOMIC_CAS(PeakPtr, &Peak, InUse))
     {
-        return NULL;
+        /* Peak was reloaded, try again */
     }
+}
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_CountBufferAllocated
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_CountBufferAllocated(size_t AllocSize)
+{
     /* increment the number of buffers in use and adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse++;
-    if (CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse)
-    {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
-    } /* end if */
+    CFE_SB_RaisePeak(&CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse,
+                     CFE_ATOMIC_ADD(&CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1));
 
     /* Add the size of the actual buffer to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += AllocSize;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
-    {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
-    } /* end if */
+    CFE_SB_RaisePeak(&CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse,
+                     CFE_ATOMIC_ADD(&CFE_SB_Global.StatTlmMsg.Payload.MemInUse, (uint32)AllocSize));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_CountBufferFreed
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_CountBufferFreed(size_t AllocSize)
+{
+    CFE_ATOMIC_SUB(&CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    CFE_ATOMIC_SUB(&CFE_SB_Global.StatTlmMsg.Payload.MemInUse, (uint32)AllocSize);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_InitBufferD
+ *
+ * Internal helper routine only, not part of API.
+ * Initializes a buffer descriptor that was just allocated
+ *
+ *-----------------------------------------------------------------*/
+static CFE_SB_BufferD_t *CFE_SB_InitBufferD(CFE_SB_BufferD_t *bd, size_t AllocSize)
+{
+    CFE_SB_CountBufferAllocated(AllocSize);
 
     /* Initialize the buffer descriptor structure. */
-    bd = (CFE_SB_BufferD_t *)addr;
     memset(bd, 0, CFE_SB_BUFFERD_CONTENT_OFFSET);
 
     bd->MsgId         = CFE_SB_INVALID_MSG_ID;
@@ -147,6 +169,118 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
     return bd;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_AllocBuffer_Unsync
+ *
+ * Internal helper routine only, not part of API.
+ * Gets a buffer from the free lists or the pool when the task cache has none
+ *
+ *-----------------------------------------------------------------*/
+static CFE_SB_BufferD_t *CFE_SB_AllocBuffer_Unsync(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass, size_t AllocSize)
+{
+    int32               stat1;
+    CFE_ES_MemPoolBuf_t addr = NULL;
+    CFE_SB_BufferD_t *  bd   = NULL;
+
+    if (SizeClass < CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        bd = CFE_SB_BufCacheRefill_Unsync(CachePtr, SizeClass);
+    }
+
+    if (bd == NULL)
+    {
+        /* Allocate a new buffer descriptor from the SB memory pool.*/
+        stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        if (stat1 < 0)
+        {
+            /* The pool may be short of blocks that are sitting in the caches */
+            CFE_SB_BufCacheFlush_Unsync();
+            stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        }
+        if (stat1 < 0)
+        {
+            return NULL;
+        }
+
+        bd = (CFE_SB_BufferD_t *)addr;
+    }
+
+    return CFE_SB_InitBufferD(bd, AllocSize);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_GetBufferFromPool
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
+{
+    size_t             AllocSize;
+    uint32             SizeClass;
+    CFE_SB_BufCache_t *CachePtr;
+    CFE_SB_BufferD_t * bd = NULL;
+
+    /* The allocation needs to include enough space for the descriptor object */
+    AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
+
+    /* Reuse a buffer of the same block size freed earlier by this task, without the lock */
+    SizeClass = CFE_SB_GetBufferSizeClass(AllocSize);
+    CachePtr  = CFE_SB_GetTaskBufCache();
+    if (CachePtr != NULL && SizeClass < CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        bd = CFE_SB_BufCacheGet(CachePtr, SizeClass);
+    }
+
+    if (bd != NULL)
+    {
+        return CFE_SB_InitBufferD(bd, AllocSize);
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    bd = CFE_SB_AllocBuffer_Unsync(CachePtr, SizeClass, AllocSize);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return bd;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReturnBufferToCache
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_ReturnBufferToCache(CFE_SB_BufferD_t *bd)
+{
+    size_t             AllocSize;
+    uint32             SizeClass;
+    CFE_SB_BufCache_t *CachePtr;
+
+    /* Removing the buffer from a tracking list needs the lock */
+    if (bd->Link.Next != &bd->Link)
+    {
+        return false;
+    }
+
+    /* Once in the cache, the buffer may be flushed by another task */
+    AllocSize = bd->AllocatedSize;
+    SizeClass = CFE_SB_GetBufferSizeClass(AllocSize);
+    CachePtr  = CFE_SB_GetTaskBufCache();
+    if (CachePtr == NULL || SizeClass >= CFE_PLATFORM_ES_POOL_MAX_BUCKETS ||
+        !CFE_SB_BufCachePut(CachePtr, SizeClass, bd))
+    {
+        return false;
+    }
+
+    CFE_SB_CountBufferFreed(AllocSize);
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_ReturnBufferToPool
@@ -157,14 +291,333 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
  *-----------------------------------------------------------------*/
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 {
+    size_t             AllocSize;
+    uint32             SizeClass;
+    CFE_SB_BufCache_t *CachePtr;
+
     /* Remove from any tracking list (no effect if not in a list) */
     CFE_SB_TrackingListRemove(&bd->Link);
 
-    --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
+    AllocSize = bd->AllocatedSize;
+    SizeClass = CFE_SB_GetBufferSizeClass(AllocSize);
+    CachePtr  = CFE_SB_GetTaskBufCache();
+    if (CachePtr != NULL && SizeClass < CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        /* Keep the buffer for reuse by this task, making room in a full cache */
+        if (!CFE_SB_BufCachePut(CachePtr, SizeClass, bd))
+        {
+            CFE_SB_BufCacheDrain_Unsync(CachePtr);
+            CFE_SB_BufCachePut(CachePtr, SizeClass, bd);
+        }
+    }
+    else
+    {
+        /* finally give the buf descriptor back to the buf descriptor pool */
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    }
+
+    CFE_SB_CountBufferFreed(AllocSize);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_InitBufferSizeClasses
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_InitBufferSizeClasses(void)
+{
+    uint32 Log2;
+    uint32 SizeClass;
+    size_t Lower;
+
+    /* Sizes with a ceiling base 2 logarithm of Log2 are above 2^(Log2 - 1) */
+    for (Log2 = 0; Log2 <= CFE_SB_BUF_SIZE_MAX_LOG2; ++Log2)
+    {
+        Lower = (Log2 > 0) ? ((size_t)1 << (Log2 - 1)) : 0;
+
+        /* The block sizes are in descending order, so search from the smallest */
+        SizeClass = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+        while (SizeClass > 0)
+        {
+            --SizeClass;
+            if (CFE_SB_MemPoolDefSize[SizeClass] > Lower)
+            {
+                break;
+            }
+        }
 
-    /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+        CFE_SB_Global.BufSizeClassByLog2[Log2] = SizeClass;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_GetBufferSizeClass
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_GetBufferSizeClass(size_t AllocSize)
+{
+    uint32 Log2;
+    uint32 SizeClass;
+
+    /* The first block size is the largest */
+    if (AllocSize > CFE_SB_MemPoolDefSize[0])
+    {
+        return CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    }
+
+    /* Ceiling of the base 2 logarithm, from the leading zeros of AllocSize - 1 */
+    Log2 = 0;
+    if (AllocSize > 1)
+    {
+        Log2 = 32 - __builtin_clz((uint32)(AllocSize - 1));
+    }
+
+    /* Every block size of a larger index is below AllocSize, step up through the rest */
+    SizeClass = CFE_SB_Global.BufSizeClassByLog2[Log2];
+    while (CFE_SB_MemPoolDefSize[SizeClass] < AllocSize)
+    {
+        --SizeClass;
+    }
+
+    return SizeClass;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_GetTaskBufCache
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufCache_t *CFE_SB_GetTaskBufCache(void)
+{
+    CFE_ES_TaskId_t TskId;
+    uint32          TskIdx;
+
+    if (CFE_ES_GetTaskID(&TskId) != CFE_SUCCESS || CFE_ES_TaskID_ToIndex(TskId, &TskIdx) != CFE_SUCCESS ||
+        TskIdx >= OS_MAX_TASKS)
+    {
+        return NULL;
+    }
+
+    return &CFE_SB_Global.BufCache[TskIdx];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufCacheGet
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_BufCacheGet(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass)
+{
+    CFE_SB_BufferD_t *bd;
+    uint32            i;
+
+    /* Slots are filled from the start, so the last ones hold the most recently freed buffers */
+    i = CFE_PLATFORM_SB_BUF_CACHE_DEPTH;
+    while (i > 0)
+    {
+        --i;
+        bd = CFE_ATOMIC_LOAD(&CachePtr->Buf[i]);
+
+        /* A flush may empty the slot at any time, the buffer is only ours if the swap succeeds */
+        if (bd != NULL && CachePtr->SizeClass[i] == SizeClass && CFE_ATOMIC_CAS(&CachePtr->Buf[i], &bd, NULL))
+        {
+            CFE_ATOMIC_INCR(&CFE_SB_Global.StatTlmMsg.Payload.BufCacheHitCounter);
+            return bd;
+        }
+    }
+
+    CFE_ATOMIC_INCR(&CFE_SB_Global.StatTlmMsg.Payload.BufCacheMissCounter);
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufCachePut
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_BufCachePut(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass, CFE_SB_BufferD_t *bd)
+{
+    uint32 i;
+
+    /* Only the owner fills slots, so an empty slot stays empty until it is stored below */
+    for (i = 0; i < CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+    {
+        if (CFE_ATOMIC_LOAD(&CachePtr->Buf[i]) == NULL)
+        {
+            CachePtr->SizeClass[i] = SizeClass;
+            CFE_ATOMIC_STORE(&CachePtr->Buf[i], bd);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufFreeListPut_Unsync
+ *
+ * Internal helper routine only, not part of API.
+ * Keeps a free buffer on the shared free list of its size, or returns it to the pool
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_BufFreeListPut_Unsync(uint32 SizeClass, CFE_SB_BufferD_t *bd)
+{
+    if (CFE_SB_Global.BufFreeCount[SizeClass] >= CFE_SB_BUF_FREE_LIST_DEPTH)
+    {
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+        return;
+    }
+
+    bd->Link.Next                        = CFE_SB_Global.BufFreeList[SizeClass];
+    CFE_SB_Global.BufFreeList[SizeClass] = &bd->Link;
+    ++CFE_SB_Global.BufFreeCount[SizeClass];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufFreeListGet_Unsync
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_SB_BufferD_t *CFE_SB_BufFreeListGet_Unsync(uint32 SizeClass)
+{
+    CFE_SB_BufferLink_t *Link;
+
+    Link = CFE_SB_Global.BufFreeList[SizeClass];
+    if (Link == NULL)
+    {
+        return NULL;
+    }
+
+    CFE_SB_Global.BufFreeList[SizeClass] = Link->Next;
+    --CFE_SB_Global.BufFreeCount[SizeClass];
+
+    /* NOTE: casting via void* here rather than CFE_SB_BufferD_t* avoids a false
+     * alignment warning on platforms with strict alignment requirements */
+    return (void *)Link;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufCacheRefill_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_BufCacheRefill_Unsync(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass)
+{
+    CFE_SB_BufferD_t *bd;
+    CFE_SB_BufferD_t *Extra;
+    uint32            Moved;
+
+    bd = CFE_SB_BufFreeListGet_Unsync(SizeClass);
+    if (bd == NULL || CachePtr == NULL)
+    {
+        return bd;
+    }
+
+    /* Take one buffer for this request and a batch more for the next ones */
+    ++CFE_SB_Global.StatTlmMsg.Payload.BufCacheRefillCounter;
+    for (Moved = 1; Moved < CFE_SB_BUF_CACHE_BATCH; ++Moved)
+    {
+        Extra = CFE_SB_BufFreeListGet_Unsync(SizeClass);
+        if (Extra == NULL)
+        {
+            break;
+        }
+        if (!CFE_SB_BufCachePut(CachePtr, SizeClass, Extra))
+        {
+            CFE_SB_BufFreeListPut_Unsync(SizeClass, Extra);
+            break;
+        }
+    }
+
+    return bd;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufCacheDrain_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BufCacheDrain_Unsync(CFE_SB_BufCache_t *CachePtr)
+{
+    CFE_SB_BufferD_t *bd;
+    uint32            i;
+
+    /* Move the oldest buffers to the free lists, where any task can pick them up */
+    ++CFE_SB_Global.StatTlmMsg.Payload.BufCacheDrainCounter;
+    for (i = 0; i < CFE_SB_BUF_CACHE_BATCH; ++i)
+    {
+        bd = CFE_ATOMIC_LOAD(&CachePtr->Buf[i]);
+        if (bd != NULL && CFE_ATOMIC_CAS(&CachePtr->Buf[i], &bd, NULL))
+        {
+            CFE_SB_BufFreeListPut_Unsync(CachePtr->SizeClass[i], bd);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BufCacheFlush_Unsync
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BufCacheFlush_Unsync(void)
+{
+    CFE_SB_BufferD_t *bd;
+    uint32            SizeClass;
+    uint32            TskIdx;
+    uint32            i;
+
+    for (SizeClass = 0; SizeClass < CFE_PLATFORM_ES_POOL_MAX_BUCKETS; ++SizeClass)
+    {
+        while ((bd = CFE_SB_BufFreeListGet_Unsync(SizeClass)) != NULL)
+        {
+            CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+        }
+    }
+
+    /* The owners may be using their caches, so each buffer is taken with a swap */
+    for (TskIdx = 0; TskIdx < OS_MAX_TASKS; ++TskIdx)
+    {
+        for (i = 0; i < CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+        {
+            bd = CFE_ATOMIC_LOAD(&CFE_SB_Global.BufCache[TskIdx].Buf[i]);
+            while (bd != NULL && !CFE_ATOMIC_CAS(&CFE_SB_Global.BufCache[TskIdx].Buf[i], &bd, NULL))
+            {
+                /* bd was reloaded, try again */
+            }
+            if (bd != NULL)
+            {
+                CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+            }
+        }
+    }
 }
 
 /*----------------------------------------------------------------
@@ -177,11 +630,42 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
  *-----------------------------------------------------------------*/
 void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd)
 {
+    uint16 count;
+
+    /* References are added by publishers without the SB lock, so this is atomic */
+    count = CFE_ATOMIC_LOAD(&bd->UseCount);
+
     /* range check the UseCount variable */
-    if (bd->UseCount < 0x7FFF)
+    while (count < 0x7FFF && !CFE_ATOMIC_CAS(&bd->UseCount, &count, count + 1))
     {
-        ++bd->UseCount;
+        /* count was reloaded, try again */
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_DropBufUseCnt
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_DropBufUseCnt(CFE_SB_BufferD_t *bd)
+{
+    uint16 count;
+
+    count = CFE_ATOMIC_LOAD(&bd->UseCount);
+
+    /* range check the UseCount variable */
+    while (count > 0)
+    {
+        if (CFE_ATOMIC_CAS(&bd->UseCount, &count, count - 1))
+        {
+            return (count == 1);
+        }
     }
+
+    return false;
 }
 
 /*----------------------------------------------------------------
@@ -194,14 +678,37 @@ void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd)
  *-----------------------------------------------------------------*/
 void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
 {
-    /* range check the UseCount variable */
-    if (bd->UseCount > 0)
+    if (CFE_SB_DropBufUseCnt(bd))
     {
-        --bd->UseCount;
+        CFE_SB_ReturnBufferToPool(bd);
+    }
+}
 
-        if (bd->UseCount == 0)
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReleaseBufferRef
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleaseBufferRef(CFE_SB_BufferD_t *bd)
+{
+    if (CFE_SB_DropBufUseCnt(bd))
+    {
+        /* Only the tracking lists and a full cache need the lock */
+        if (bd->Link.Next != &bd->Link)
         {
+            CFE_SB_LockSharedData(__func__, __LINE__);
+            CFE_SB_TrackingListRemove(&bd->Link);
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+        }
+
+        if (!CFE_SB_ReturnBufferToCache(bd))
+        {
+            CFE_SB_LockSharedData(__func__, __LINE__);
             CFE_SB_ReturnBufferToPool(bd);
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
         }
     }
 }
@@ -228,11 +735,8 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 
     /* Add the size of a destination descriptor to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
-    {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
-    } /* end if */
+    CFE_SB_RaisePeak(&CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse,
+                     CFE_ATOMIC_ADD(&CFE_SB_Global.StatTlmMsg.Payload.MemInUse, (uint32)Stat));
 
     return (CFE_SB_DestinationD_t *)addr;
 }
@@ -259,7 +763,7 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
     if (Stat > 0)
     {
         /* Subtract the size of the destination block from the Memory in use ctr */
-        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
+        CFE_ATOMIC_SUB(&CFE_SB_Global.StatTlmMsg.Payload.MemInUse, (uint32)Stat);
     } /* end if */
 
     return CFE_SUCCESS;
@@ -108,6 +108,8 @@ int32 CFE_SB_InitBuffers(void)
 
     int32 Stat = 0;
 
+    CFE_SB_InitBufferSizeClasses();
+
     Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
                                CFE_PLATFORM_SB_BUF_MEMORY_BYTES, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
                                &CFE_SB_MemPoolDefSize[0], CFE_ES_NO_MUTEX);
@@ -126,6 +128,11 @@ int32 CFE_SB_InitBuffers(void)
     CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
 
+    /* Any cached buffers belonged to the previous pool */
+    memset(CFE_SB_Global.BufCache, 0, sizeof(CFE_SB_Global.BufCache));
+    memset(CFE_SB_Global.BufFreeList, 0, sizeof(CFE_SB_Global.BufFreeList));
+    memset(CFE_SB_Global.BufFreeCount, 0, sizeof(CFE_SB_Global.BufFreeCount));
+
     return CFE_SUCCESS;
 }
 
@@ -46,6 +46,7 @@
 #include "cfe_sb_destination_typedef.h"
 #include "cfe_sb_msg.h"
 #include "cfe_sbr.h"
+#include "cfe_core_atomic.h"
 #include "cfe_core_resourceid_basevalues.h"
 
 #endif /* CFE_SB_MODULE_ALL_H */
@@ -121,6 +121,12 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
     /* Release any zero copy buffers */
     CFE_SB_ZeroCopyReleaseAppId(AppId);
 
+    /* Forget the copy statistics so a new app in this slot starts clean */
+    if (CFE_ES_AppID_ToIndex(AppId, &i) == CFE_SUCCESS && i < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        memset(&CFE_SB_Global.AppCopyStats[i], 0, sizeof(CFE_SB_AppCopyStats_t));
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -249,6 +255,214 @@ CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId)
     return PipeDscPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReleasePipeBuffers
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleasePipeBuffers(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    if (PipeDscPtr->LastBuffer != NULL)
+    {
+        /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+        PipeDscPtr->LastBuffer = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReleasePipeBatchBuffers
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleasePipeBatchBuffers(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    while (PipeDscPtr->BatchCount > 0)
+    {
+        --PipeDscPtr->BatchCount;
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->BatchBuffers[PipeDscPtr->BatchCount]);
+        PipeDscPtr->BatchBuffers[PipeDscPtr->BatchCount] = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_AddSendErrEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_AddSendErrEvent(CFE_SB_EventBuf_t *SBSndErr, uint32 EventId, CFE_SB_MsgId_t MsgId,
+                            CFE_SB_PipeId_t PipeId, int32 OsStatus)
+{
+    /*
+     * A single message can not exceed this, but a batch can.  The related
+     * counters are still incremented by the caller when the entry is dropped.
+     */
+    if (SBSndErr->EvtsToSnd < CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+    {
+        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId  = EventId;
+        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].OsStatus = OsStatus;
+        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].PipeId   = PipeId;
+        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].MsgId    = MsgId;
+        SBSndErr->EvtsToSnd++;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_RecordMsgCopy
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_RecordMsgCopy(CFE_ES_AppId_t AppId, CFE_MSG_Size_t Size)
+{
+    CFE_SB_AppCopyStats_t *StatsPtr;
+    uint32                 AppIdx;
+    bool                   Expected;
+
+    if (CFE_ES_AppID_ToIndex(AppId, &AppIdx) != CFE_SUCCESS || AppIdx >= CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        return false;
+    }
+
+    StatsPtr = &CFE_SB_Global.AppCopyStats[AppIdx];
+
+    /* An app ID maps to a single slot, so a concurrent store writes the same value */
+    StatsPtr->AppId = AppId;
+    CFE_ATOMIC_ADD(&StatsPtr->BytesCopied, (uint32)Size);
+
+    if (CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD == 0 || Size < CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD)
+    {
+        return false;
+    }
+
+    CFE_ATOMIC_INCR(&CFE_SB_Global.HKTlmMsg.Payload.LargeMsgCopyCounter);
+
+    Expected = false;
+    return CFE_ATOMIC_CAS(&StatsPtr->LargeCopyReported, &Expected, true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_SendLargeCopyEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_SendLargeCopyEvent(CFE_ES_TaskId_t TskId, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    char FullName[(OS_MAX_API_NAME * 2)];
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_LARGE_MSG_COPY_EID, CFE_EVS_EventType_INFORMATION, CFE_SB_Global.AppId,
+                               "Large msg copied, use zero copy,MsgId 0x%x,size %lu,sender %s",
+                               (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned long)Size,
+                               CFE_SB_GetAppTskName(TskId, FullName));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_UpdatePipeOnReceive
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_UpdatePipeOnReceive(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SBR_RouteId_t      RouteId;
+
+    /* get pointer to destination to be used in decrementing msg limit cnt*/
+    RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
+    DestPtr = CFE_SB_GetDestPtr(RouteId, PipeDscPtr->PipeId);
+
+    /*
+    ** DestPtr would be NULL if the msg is unsubscribed to while it is on
+    ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
+    ** then resubscribed to while it is on the pipe. Both of these cases are
+    ** considered nominal and are handled by the code below.
+    */
+    if (DestPtr != NULL)
+    {
+        CFE_SB_CounterDecrement(&DestPtr->BuffCount);
+    }
+
+    CFE_SB_CounterDecrement(&PipeDscPtr->CurrentQueueDepth);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_CounterIncrementBelow
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_CounterIncrementBelow(uint16 *CounterPtr, uint16 Limit)
+{
+    uint16 Count;
+
+    Count = CFE_ATOMIC_LOAD(CounterPtr);
+    while (Count < Limit)
+    {
+        if (CFE_ATOMIC_CAS(CounterPtr, &Count, Count + 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_CounterDecrement
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CounterDecrement(uint16 *CounterPtr)
+{
+    uint16 Count;
+
+    Count = CFE_ATOMIC_LOAD(CounterPtr);
+    while (Count > 0 && !CFE_ATOMIC_CAS(CounterPtr, &Count, Count - 1))
+    {
+        /* Count was reloaded, try again */
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_CounterRaisePeak
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CounterRaisePeak(uint16 *PeakPtr, uint16 Value)
+{
+    uint16 Peak;
+
+    Peak = CFE_ATOMIC_LOAD(PeakPtr);
+    while (Value > Peak && !CFE_ATOMIC_CAS(PeakPtr, &Peak, Value))
+    {
+        /* Peak was reloaded, try again */
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_CheckPipeDescSlotUsed
@@ -422,8 +636,10 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
-    CFE_SB_PutDestinationBlk(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
+
+    /* Publishers may still reference the node, it is returned when the old array is reclaimed */
+    CFE_SB_UpdateDestArray(RouteId, DestPtr);
 }
 
 /*----------------------------------------------------------------
@@ -472,6 +688,145 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
     NodeToRemove->Prev = NULL;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReleaseRemovedDest
+ *
+ * Internal helper routine only, not part of API.
+ * Returns a destination block once no publisher can still reference it.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_ReleaseRemovedDest(CFE_SB_DestinationD_t *DestPtr)
+{
+    CFE_SB_PutDestinationBlk(DestPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_UpdateDestArray
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_UpdateDestArray(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *RemovedDestPtr)
+{
+    CFE_SB_DestinationEntry_t Dests[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+    CFE_SB_DestinationD_t *   DestPtr;
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    uint32                    NumDests;
+
+    NumDests = 0;
+
+    for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId);
+         DestPtr != NULL && NumDests < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; DestPtr = DestPtr->Next)
+    {
+        /* Disabled routes and stale pipes are left out, so delivery needs no checks for them */
+        if (DestPtr->Active != CFE_SB_ACTIVE)
+        {
+            continue;
+        }
+
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+        {
+            continue;
+        }
+
+        Dests[NumDests].PipeDscPtr = PipeDscPtr;
+        Dests[NumDests].DestPtr    = DestPtr;
+        Dests[NumDests].PipeId     = DestPtr->PipeId;
+        ++NumDests;
+    }
+
+    /* If publishers still use the array retired last time, the route is left stale for later */
+    CFE_SBR_SetDestArray(RouteId, Dests, NumDests, RemovedDestPtr, CFE_SB_ReleaseRemovedDest);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_UpdateStaleDestArray
+ *
+ * Internal helper routine only, not part of API.
+ * Route callback that publishes the destination array of a stale
+ * route and counts the routes that are still stale.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_UpdateStaleDestArray(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    uint32 *StaleCountPtr = ArgPtr;
+
+    if (CFE_SBR_IsDestArrayStale(RouteId))
+    {
+        CFE_SB_UpdateDestArray(RouteId, NULL);
+
+        if (CFE_SBR_IsDestArrayStale(RouteId))
+        {
+            ++(*StaleCountPtr);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_PublishDestArrays
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PublishDestArrays(void)
+{
+    uint32 StaleCount;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* Each pass also returns the destinations retired by the previous one, if publishers are done */
+    while (CFE_SBR_ReclaimDestArrays(CFE_SB_ReleaseRemovedDest) > 0)
+    {
+        StaleCount = 0;
+        CFE_SBR_ForEachRouteId(CFE_SB_UpdateStaleDestArray, &StaleCount, NULL);
+
+        if (StaleCount > 0)
+        {
+            /* The caller's changes are complete, so other tasks may use the lock while publishers finish */
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+            OS_TaskDelay(CFE_SB_DEST_ARRAY_POLL_MSEC);
+            CFE_SB_LockSharedData(__func__, __LINE__);
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_WaitForRouteReaders
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_WaitForRouteReaders(void)
+{
+    uint32 Epoch;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    Epoch = CFE_SBR_GetReadEpoch();
+    while (!CFE_SBR_EpochElapsed(Epoch))
+    {
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+        OS_TaskDelay(CFE_SB_DEST_ARRAY_POLL_MSEC);
+        CFE_SB_LockSharedData(__func__, __LINE__);
+    }
+
+    /* Destinations retired before the call can not be referenced anymore either */
+    CFE_SBR_ReclaimDestArrays(CFE_SB_ReleaseRemovedDest);
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SB_ZeroCopyReleaseAppId
@@ -84,6 +84,21 @@
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
 
+/* Number of buffers moved between a task cache and the free lists at once */
+#define CFE_SB_BUF_CACHE_BATCH (CFE_PLATFORM_SB_BUF_CACHE_DEPTH / 2)
+
+/* Buffers kept on each shared free list, enough for a few cache refills, any more go back to the pool */
+#define CFE_SB_BUF_FREE_LIST_DEPTH (2 * CFE_PLATFORM_SB_BUF_CACHE_DEPTH)
+
+/* Largest base 2 logarithm of a buffer size class lookup, sizes above this never fit a pool block */
+#define CFE_SB_BUF_SIZE_MAX_LOG2 32
+
+/* Messages of a transmit batch that are filled before being put in transit under one lock hold */
+#define CFE_SB_TRANSMIT_BATCH_CHUNK 32
+
+/* Delay between checks, with the SB lock released, for publishers to leave a retired destination array */
+#define CFE_SB_DEST_ARRAY_POLL_MSEC 1
+
 #define CFE_SB_PIPE_OVERFLOW (-1)
 #define CFE_SB_PIPE_WR_ERR   (-2)
 #define CFE_SB_USECNT_ERR    (-3)
@@ -169,7 +184,7 @@ typedef struct CFE_SB_BufferD
 **     characteristics and status of a pipe.
 */
 
-typedef struct
+typedef struct CFE_SB_PipeD
 {
     CFE_SB_PipeId_t   PipeId;
     uint8             Opts;
@@ -181,6 +196,8 @@ typedef struct
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
     CFE_SB_BufferD_t *LastBuffer;
+    uint16            BatchCount;                                         /**< Number of entries in BatchBuffers */
+    CFE_SB_BufferD_t *BatchBuffers[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH]; /**< Batch buffers held by the owner */
 } CFE_SB_PipeD_t;
 
 /******************************************************************************
@@ -233,6 +250,36 @@ typedef struct
     CFE_SB_BackgroundFileBuffer_t Buffer;    /**< Temporary holding area for file record */
 } CFE_SB_BackgroundFileStateInfo_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_AppCopyStats_t
+**
+**  Purpose:
+**     This structure tracks how much message data an application has sent
+**     through the copying transmit path, indexed by application.
+*/
+typedef struct
+{
+    CFE_ES_AppId_t AppId;             /**< App using this entry, undefined if unused */
+    uint32         BytesCopied;       /**< Bytes copied into SB buffers by CFE_SB_TransmitMsg */
+    bool           LargeCopyReported; /**< Large copy event already sent for this app */
+} CFE_SB_AppCopyStats_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BufCache_t
+**
+**  Purpose:
+**     This structure holds the buffers freed by one task, so they can be
+**     reused without going through the SB memory pool.  Only the owning task
+**     puts buffers in its slots, without the SB lock.  A slot is emptied with
+**     an atomic compare and swap, either by the owner taking the buffer or by
+**     a flush of all the caches while holding the SB lock.
+*/
+typedef struct
+{
+    uint8             SizeClass[CFE_PLATFORM_SB_BUF_CACHE_DEPTH]; /**< Pool block size index of each slot */
+    CFE_SB_BufferD_t *Buf[CFE_PLATFORM_SB_BUF_CACHE_DEPTH];       /**< Buffer in each slot, NULL if empty */
+} CFE_CACHE_ALIGNED CFE_SB_BufCache_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_Global_t
 **
@@ -254,9 +301,20 @@ typedef struct
     CFE_EVS_BinFilter_t          EventFilters[CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER];
     CFE_SB_Qos_t                 Default_Qos;
     CFE_ResourceId_t             LastPipeId;
+    CFE_SB_AppCopyStats_t        AppCopyStats[CFE_PLATFORM_ES_MAX_APPLICATIONS];
 
     CFE_SB_BackgroundFileStateInfo_t BackgroundFile;
 
+    /* Freed buffers kept by each task, indexed by task */
+    CFE_SB_BufCache_t BufCache[OS_MAX_TASKS];
+
+    /* Buffers moved out of the task caches, one list per pool block size */
+    CFE_SB_BufferLink_t *BufFreeList[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    uint32               BufFreeCount[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
+    /* Smallest pool block size index that may fit a size, by the base 2 logarithm of the size */
+    uint8 BufSizeClassByLog2[CFE_SB_BUF_SIZE_MAX_LOG2 + 1];
+
     /* A list of buffers currently in-transit, owned by SB */
     CFE_SB_BufferLink_t InTransitList;
 
@@ -276,6 +334,7 @@ typedef struct
     uint32          EventId;
     int32           OsStatus;
     CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId;
 } CFE_SB_SendErrEventBuf_t;
 
 /******************************************************************************
@@ -312,6 +371,12 @@ int32 CFE_SB_AppInit(void);
  */
 int32 CFE_SB_InitBuffers(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Initialize the lookup used by CFE_SB_GetBufferSizeClass() from the pool block sizes.
+ */
+void CFE_SB_InitBufferSizeClasses(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Initialize the Software Bus Pipe Table.
@@ -338,6 +403,121 @@ void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber);
  */
 void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Releases the buffer held by a pipe descriptor from the previous receive call
+ *
+ * Apps indicate they are done with the buffer returned by CFE_SB_ReceiveBuffer()
+ * by calling it again on the same pipe.  This drops the reference that was held
+ * on behalf of the app since then.
+ *
+ * @note This must be called while the SB global data is locked
+ *
+ * @param PipeDscPtr  The pipe descriptor to release buffers from
+ */
+void CFE_SB_ReleasePipeBuffers(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Releases all the buffers still held from CFE_SB_ReceiveBufferBatch() calls on a pipe
+ *
+ * Used when the pipe is deleted, as the app will not release them anymore.
+ *
+ * @note This must be called while the SB global data is locked
+ *
+ * @param PipeDscPtr  The pipe descriptor to release buffers from
+ */
+void CFE_SB_ReleasePipeBatchBuffers(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Updates the pipe and destination accounting for a buffer just read from a pipe queue
+ *
+ * Decrements the message limit count of the destination that queued the buffer and
+ * the current depth of the pipe.  Does not change the use count of the buffer.
+ *
+ * @note This must be called while the SB global data is locked
+ *
+ * @param PipeDscPtr  The pipe descriptor the buffer was read from
+ * @param BufDscPtr   The buffer descriptor that was read from the queue
+ */
+void CFE_SB_UpdatePipeOnReceive(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Atomically increments a count unless it has already reached a limit
+ *
+ * Used for counts that are updated by publishers without the SB global lock.
+ *
+ * @param CounterPtr  The count to increment
+ * @param Limit       The count is not incremented if it is at or above this value
+ *
+ * @returns true if the count was incremented
+ */
+bool CFE_SB_CounterIncrementBelow(uint16 *CounterPtr, uint16 Limit);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Atomically decrements a count, stopping at zero
+ *
+ * @param CounterPtr  The count to decrement
+ */
+void CFE_SB_CounterDecrement(uint16 *CounterPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Atomically raises a high water mark to the given value if it is higher
+ *
+ * @param PeakPtr  The high water mark to update
+ * @param Value    The current value
+ */
+void CFE_SB_CounterRaisePeak(uint16 *PeakPtr, uint16 Value);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Accounts for a message copied into an SB buffer on behalf of an application
+ *
+ * Adds the size to the per-application byte count and, for messages of at
+ * least #CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD bytes, increments the
+ * large copy counter.  Counters are updated atomically, so this may be
+ * called with or without the SB lock.
+ *
+ * @param AppId  The application that sent the message
+ * @param Size   The size of the message
+ *
+ * @returns true if this is the first large copy for the application and
+ *          CFE_SB_SendLargeCopyEvent() should be called
+ */
+bool CFE_SB_RecordMsgCopy(CFE_ES_AppId_t AppId, CFE_MSG_Size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Sends the event reporting a large message sent by copying
+ *
+ * \note This must be called while the SB global data is NOT locked
+ *
+ * @param TskId  Task ID of the sender
+ * @param MsgId  The message ID of the copied message
+ * @param Size   The size of the copied message
+ */
+void CFE_SB_SendLargeCopyEvent(CFE_ES_TaskId_t TskId, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds a delivery error to the set of events to be sent after a broadcast
+ *
+ * If the event buffer is already full the entry is dropped; this can only
+ * happen when one event buffer is shared across a batch of messages.
+ *
+ * @param SBSndErr  The event buffer to add to
+ * @param EventId   The event ID to send
+ * @param MsgId     The message ID that failed to be delivered
+ * @param PipeId    The pipe that the message failed to be delivered to
+ * @param OsStatus  The OSAL status of the failed queue write, if applicable
+ */
+void CFE_SB_AddSendErrEvent(CFE_SB_EventBuf_t *SBSndErr, uint32 EventId, CFE_SB_MsgId_t MsgId,
+                            CFE_SB_PipeId_t PipeId, int32 OsStatus);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Processes a single message buffer that has been received from the command pipe
@@ -439,6 +619,43 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
 int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr,
                                  CFE_SBR_RouteId_t *RouteIdPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to validate a transmit message, without events
+ *
+ * This is the same as CFE_SB_TransmitMsgValidate() but the caller is responsible
+ * for sending the returned event (if any) using CFE_SB_SendTransmitEvent() while
+ * not holding the SB global lock.  The route lookup does not need the lock, so
+ * this may be called with or without it held.
+ *
+ * \param[in]  MsgPtr            Pointer to the message to validate
+ * \param[out] MsgIdPtr          Message Id of message
+ * \param[out] SizePtr           Size of message
+ * \param[out] RouteIdPtr        Route ID of the message (invalid if none)
+ * \param[out] PendingEventIdPtr Event ID to be sent by the caller, or 0 if none
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_TransmitMsgValidateNoEvent(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr,
+                                        CFE_MSG_Size_t *SizePtr, CFE_SBR_RouteId_t *RouteIdPtr,
+                                        uint16 *PendingEventIdPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Sends the event for a transmit validation or buffer allocation failure
+ *
+ * \note This must be called while the SB global data is NOT locked
+ *
+ * \param[in] TskId   Task ID of the sender
+ * \param[in] EventId Event ID as returned by CFE_SB_TransmitMsgValidateNoEvent(),
+ *                    or #CFE_SB_GET_BUF_ERR_EID
+ * \param[in] MsgPtr  Pointer to the message that was being sent
+ * \param[in] MsgId   Message Id of message
+ * \param[in] Size    Size of message
+ */
+void CFE_SB_SendTransmitEvent(CFE_ES_TaskId_t TskId, uint16 EventId, const CFE_MSG_Message_t *MsgPtr,
+                              CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Release all zero-copy buffers associated with the given app ID.
@@ -460,7 +677,8 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
  * UseCount is a variable in the CFE_SB_BufferD_t and is used to
  * determine when a buffer may be returned to the memory pool.
  *
- * @note This must only be invoked while holding the SB global lock
+ * @note The update is atomic, so this may be invoked without the SB global
+ * lock as long as the caller already holds a reference to the buffer.
  *
  * @param bd  Pointer to the buffer descriptor.
  *
@@ -468,6 +686,33 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
  */
 void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Decrement the UseCount of a buffer without returning it to the pool
+ *
+ * Atomic decrement for callers that do not hold the SB global lock.  If this
+ * returns true, the caller dropped the last reference and must return the
+ * buffer via CFE_SB_ReturnBufferToCache() or CFE_SB_ReturnBufferToPool().
+ *
+ * @param bd  Pointer to the buffer descriptor.
+ *
+ * @returns true if the UseCount was decremented to zero
+ */
+bool CFE_SB_DropBufUseCnt(CFE_SB_BufferD_t *bd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Drop a reference to a buffer while not holding the SB global lock
+ *
+ * Same as CFE_SB_DecrBufUseCnt() but the SB global lock is only taken if the
+ * buffer needs to be removed from a tracking list or the task cache is full.
+ *
+ * @note This must only be invoked while NOT holding the SB global lock
+ *
+ * @param bd  Pointer to the buffer descriptor.
+ */
+void CFE_SB_ReleaseBufferRef(CFE_SB_BufferD_t *bd);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Decrement the UseCount of a buffer
@@ -619,7 +864,13 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  * by the SB to dynamically allocate memory to hold the message and a buffer
  * descriptor associated with the message during the sending of a message.
  *
- * @note This must only be invoked while holding the SB global lock
+ * A buffer of the same pool block size is reused from the calling task's
+ * buffer cache, or from the shared free lists, before the pool is used.  If
+ * the pool has no block left, all the cached buffers are returned to it and
+ * the allocation is tried again.
+ *
+ * @note This must only be invoked while NOT holding the SB global lock, which
+ * is only taken if the calling task's cache has no buffer of the right size.
  *
  * \param[in] MaxMsgSize Maximum message content size that the buffer must be capable of holding
  * \returns Pointer to buffer descriptor, or NULL on failure.
@@ -633,11 +884,116 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
  * This function will return a block of memory back to the SB memory pool,
  * so it can be re-used for a future message
  *
+ * The buffer is kept in the calling task's buffer cache.  When the cache is
+ * full, half of it is first moved to the shared free lists.  Buffers go back
+ * to the pool itself if the calling task has no cache or a free list is full.
+ *
  * @note This must only be invoked while holding the SB global lock
  * \param[in] bd Pointer to descriptor to return
  */
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Returns a buffer to the calling task's buffer cache
+ *
+ * Only succeeds if the buffer is not in a tracking list and the calling task
+ * has a cache with a free slot.  Otherwise CFE_SB_ReturnBufferToPool() must
+ * be used.
+ *
+ * @note This may be invoked with or without the SB global lock
+ *
+ * \param[in] bd Pointer to descriptor to return
+ * \returns true if the buffer was returned, false if it was not
+ */
+bool CFE_SB_ReturnBufferToCache(CFE_SB_BufferD_t *bd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the index of the pool block size used for a buffer allocation
+ *
+ * The base 2 logarithm of the size selects the first candidate, which leaves
+ * at most the few block sizes within the same power of two to compare.
+ *
+ * \param[in] AllocSize Total size of the buffer, including the descriptor
+ * \returns Index into #CFE_SB_MemPoolDefSize of the smallest block that fits,
+ *          or #CFE_PLATFORM_ES_POOL_MAX_BUCKETS if no block is large enough
+ */
+uint32 CFE_SB_GetBufferSizeClass(size_t AllocSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the buffer cache of the calling task
+ *
+ * \returns Pointer to the cache, or NULL if the task ID could not be resolved
+ */
+CFE_SB_BufCache_t *CFE_SB_GetTaskBufCache(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Takes a buffer of the given block size from a task cache
+ *
+ * @note This must only be invoked by the task owning the cache, with or
+ * without the SB global lock
+ *
+ * \param[in] CachePtr  The task buffer cache
+ * \param[in] SizeClass Index of the pool block size
+ * \returns Pointer to buffer descriptor, or NULL if the cache has none of this size
+ */
+CFE_SB_BufferD_t *CFE_SB_BufCacheGet(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Puts a free buffer in a free slot of a task cache
+ *
+ * @note This must only be invoked by the task owning the cache, with or
+ * without the SB global lock
+ *
+ * \param[in] CachePtr  The task buffer cache
+ * \param[in] SizeClass Index of the pool block size of the buffer
+ * \param[in] bd        The free buffer
+ * \returns true if the buffer was put in the cache, false if the cache is full
+ */
+bool CFE_SB_BufCachePut(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass, CFE_SB_BufferD_t *bd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets a buffer of the given block size from the shared free lists
+ *
+ * Up to #CFE_SB_BUF_CACHE_BATCH - 1 more buffers of the same size are moved
+ * to the task cache for its next allocations.
+ *
+ * @note This must only be invoked while holding the SB global lock, by the
+ * task owning the cache
+ *
+ * \param[in] CachePtr  The task buffer cache, or NULL if the task has none
+ * \param[in] SizeClass Index of the pool block size
+ * \returns Pointer to buffer descriptor, or NULL if the free list is empty
+ */
+CFE_SB_BufferD_t *CFE_SB_BufCacheRefill_Unsync(CFE_SB_BufCache_t *CachePtr, uint32 SizeClass);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Moves half of a full task cache to the shared free lists
+ *
+ * Buffers that do not fit in a free list of #CFE_SB_BUF_FREE_LIST_DEPTH go
+ * back to the pool.
+ *
+ * @note This must only be invoked while holding the SB global lock, by the
+ * task owning the cache
+ *
+ * \param[in] CachePtr  The task buffer cache
+ */
+void CFE_SB_BufCacheDrain_Unsync(CFE_SB_BufCache_t *CachePtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Returns all the buffers of the task caches and the free lists to the pool
+ *
+ * @note This must only be invoked while holding the SB global lock
+ */
+void CFE_SB_BufCacheFlush_Unsync(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Broadcast a SB buffer descriptor to all destinations in route
@@ -673,6 +1029,53 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  */
 void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Moves a buffer onto the in-transit tracking list before it is delivered
+ *
+ * Removes the buffer from the zero copy list if it was there and clears its owner.
+ *
+ * \note This must be called while the SB global data is locked
+ *
+ * \param[in] BufDscPtr Pointer to the buffer descriptor about to be delivered
+ */
+void CFE_SB_SetBufferInTransit_Unsync(CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Deliver a SB buffer descriptor to all destinations in route
+ *
+ * Puts the buffer on the queue of every active destination pipe, incrementing
+ * the buffer use count for every successful delivery.  The destination array of
+ * the route (see CFE_SB_UpdateDestArray()) is scanned within a routing table
+ * read section (see CFE_SBR_ReadLock()) and all counters
+ * are updated atomically, so this does not need the SB global lock and never
+ * takes it.  It may also be called while holding the lock.
+ *
+ * Unlike CFE_SB_BroadcastBufferToRoute() this does not consume the caller's
+ * reference to the buffer.  Delivery errors are added to SBSndErr rather than
+ * sent directly; the caller should pass it to CFE_SB_SendBroadcastEvents()
+ * while not holding the lock.
+ *
+ * \param[in]    BufDscPtr Pointer to the buffer descriptor to deliver
+ * \param[in]    RouteId   Route to send to
+ * \param[in]    AppId     App ID of the sender, for the #CFE_SB_PIPEOPTS_IGNOREMINE check
+ * \param[inout] SBSndErr  Event buffer that delivery errors are added to
+ */
+void CFE_SB_DeliverBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId, CFE_ES_AppId_t AppId,
+                                 CFE_SB_EventBuf_t *SBSndErr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Sends the events for the delivery errors recorded during a broadcast
+ *
+ * \note This must be called while the SB global data is NOT locked
+ *
+ * \param[in] TskId    Task ID of the sender
+ * \param[in] SBSndErr Event buffer filled by CFE_SB_DeliverBufferToRoute()
+ */
+void CFE_SB_SendBroadcastEvents(CFE_ES_TaskId_t TskId, const CFE_SB_EventBuf_t *SBSndErr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Perform basic sanity check on the Zero Copy handle
@@ -714,8 +1117,12 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
 /**
  * \brief Remove a destination
  *
- * Private function that will remove a destination by removing the node,
- * returning the block, and decrementing counters
+ * Private function that will remove a destination by removing the node
+ * and decrementing counters.  The block is returned once no publisher can
+ * still be referencing it through the previous destination array.
+ *
+ * The caller must call CFE_SB_PublishDestArrays() after releasing the
+ * lock, see CFE_SB_UpdateDestArray().
  *
  * \note Assumes destination pointer is valid and in route
  *
@@ -724,6 +1131,57 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
  */
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Rebuild the destination array of a route from its destination list
+ *
+ * Private function that publishes the active destinations of the route, with
+ * their pipe descriptors resolved, as the flat array used by
+ * CFE_SB_DeliverBufferToRoute().  Must be called after any change to the
+ * destination list or to the Active state of a destination.
+ *
+ * The previous array is retired and reclaimed once publishers still using
+ * it are done, along with RemovedDestPtr if given.  This never waits or
+ * releases the lock: if publishers still use the array retired by the
+ * previous update of the route, the route is left stale and is published
+ * by CFE_SB_PublishDestArrays(), which the caller must call once it has
+ * released the lock.
+ *
+ * \note This must be called while the SB global data is locked
+ *
+ * \param[in] RouteId The route ID to rebuild
+ * \param[in] RemovedDestPtr Destination removed from the list to return once unused, or NULL
+ */
+void CFE_SB_UpdateDestArray(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *RemovedDestPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Publish the destination arrays of all stale routes
+ *
+ * Completes the CFE_SB_UpdateDestArray() calls that left a route stale,
+ * waiting for publishers still using a retired array with the SB global
+ * lock released.  Returns once no route is stale, so publishers see every
+ * change made before the call.  Also returns removed destinations that
+ * no publisher can still reference.
+ *
+ * \note This must be called while the SB global data is NOT locked, and
+ *       not from a routing table read section
+ */
+void CFE_SB_PublishDestArrays(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Wait for publishers that may still use a retired destination array
+ *
+ * Returns once every publisher that could have seen a destination array
+ * replaced before the call has finished delivering, e.g. so the queue of
+ * a pipe removed from all routes receives no more messages.
+ *
+ * \note This must be called while the SB global data is NOT locked, and
+ *       not from a routing table read section
+ */
+void CFE_SB_WaitForRouteReaders(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Get destination pointer for PipeId from RouteId
@@ -1072,4 +1530,6 @@ void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event
 
 extern CFE_SB_Global_t CFE_SB_Global;
 
+extern const size_t CFE_SB_MemPoolDefSize[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
 #endif /* CFE_SB_PRIV_H */
@@ -355,12 +355,39 @@ int32 CFE_SB_DisableSubReportingCmd(const CFE_SB_DisableSubReportingCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_SendHKTlmCmd(const CFE_MSG_CommandHeader_t *data)
 {
+    uint32                   i, j;
+    CFE_SB_AppCopyStats_t *  StatsPtr;
+    CFE_SB_AppCopyTlmData_t *AppTlmDataPtr;
+
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
     CFE_SB_Global.HKTlmMsg.Payload.MemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
     CFE_SB_Global.HKTlmMsg.Payload.UnmarkedMem =
         CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse;
 
+    /* Write copy statistics for apps that have sent messages to telemetry packet */
+    StatsPtr      = CFE_SB_Global.AppCopyStats;
+    AppTlmDataPtr = CFE_SB_Global.HKTlmMsg.Payload.AppCopyData;
+    for (i = 0, j = 0; j < CFE_MISSION_ES_MAX_APPLICATIONS && i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++)
+    {
+        if (CFE_RESOURCEID_TEST_DEFINED(StatsPtr->AppId))
+        {
+            AppTlmDataPtr->AppID       = StatsPtr->AppId;
+            AppTlmDataPtr->BytesCopied = CFE_ATOMIC_LOAD(&StatsPtr->BytesCopied);
+            ++j;
+            ++AppTlmDataPtr;
+        }
+        ++StatsPtr;
+    }
+
+    /* Clear unused portion of copy statistics in telemetry packet */
+    for (i = j; i < CFE_MISSION_ES_MAX_APPLICATIONS; i++)
+    {
+        AppTlmDataPtr->AppID       = CFE_ES_APPID_UNDEFINED;
+        AppTlmDataPtr->BytesCopied = 0;
+        ++AppTlmDataPtr;
+    }
+
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
 
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.HKTlmMsg.TelemetryHeader));
@@ -379,6 +406,7 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_MSG_CommandHeader_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_ResetCounters(void)
 {
+    uint32 i;
 
     CFE_SB_Global.HKTlmMsg.Payload.CommandCounter                = 0;
     CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter           = 0;
@@ -391,6 +419,14 @@ void CFE_SB_ResetCounters(void)
     CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter         = 0;
     CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter      = 0;
     CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter          = 0;
+    CFE_SB_Global.HKTlmMsg.Payload.LargeMsgCopyCounter           = 0;
+
+    /* Keep the app IDs so the slots still report, but restart the counts and events */
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++)
+    {
+        CFE_SB_Global.AppCopyStats[i].BytesCopied       = 0;
+        CFE_SB_Global.AppCopyStats[i].LargeCopyReported = false;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -406,6 +442,7 @@ int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRouteCmd_t *data)
     CFE_SB_MsgId_t                   MsgId;
     CFE_SB_PipeD_t *                 PipeDscPtr;
     CFE_SB_DestinationD_t *          DestPtr;
+    CFE_SBR_RouteId_t                RouteId;
     const CFE_SB_RouteCmd_Payload_t *CmdPtr;
     uint16                           PendingEventID;
 
@@ -425,7 +462,8 @@ int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRouteCmd_t *data)
     }
     else
     {
-        DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), CmdPtr->Pipe);
+        RouteId = CFE_SBR_GetRouteId(MsgId);
+        DestPtr = CFE_SB_GetDestPtr(RouteId, CmdPtr->Pipe);
         if (DestPtr == NULL)
         {
             PendingEventID = CFE_SB_ENBL_RTE1_EID;
@@ -434,6 +472,7 @@ int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRouteCmd_t *data)
         else
         {
             DestPtr->Active = CFE_SB_ACTIVE;
+            CFE_SB_UpdateDestArray(RouteId, NULL);
             PendingEventID  = CFE_SB_ENBL_RTE2_EID;
             CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
         }
@@ -442,6 +481,12 @@ int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRouteCmd_t *data)
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
+    /* The route change must be visible to publishers before reporting it */
+    if (PendingEventID == CFE_SB_ENBL_RTE2_EID)
+    {
+        CFE_SB_PublishDestArrays();
+    }
+
     switch (PendingEventID)
     {
         case CFE_SB_ENBL_RTE1_EID:
@@ -476,6 +521,7 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
     CFE_SB_MsgId_t                   MsgId;
     CFE_SB_PipeD_t *                 PipeDscPtr;
     CFE_SB_DestinationD_t *          DestPtr;
+    CFE_SBR_RouteId_t                RouteId;
     const CFE_SB_RouteCmd_Payload_t *CmdPtr;
     uint16                           PendingEventID;
 
@@ -495,7 +541,8 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
     }
     else
     {
-        DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), CmdPtr->Pipe);
+        RouteId = CFE_SBR_GetRouteId(MsgId);
+        DestPtr = CFE_SB_GetDestPtr(RouteId, CmdPtr->Pipe);
         if (DestPtr == NULL)
         {
             PendingEventID = CFE_SB_DSBL_RTE1_EID;
@@ -504,6 +551,7 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
         else
         {
             DestPtr->Active = CFE_SB_INACTIVE;
+            CFE_SB_UpdateDestArray(RouteId, NULL);
             PendingEventID  = CFE_SB_DSBL_RTE2_EID;
             CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
         }
@@ -512,6 +560,12 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
+    /* The route change must be visible to publishers before reporting it */
+    if (PendingEventID == CFE_SB_DSBL_RTE2_EID)
+    {
+        CFE_SB_PublishDestArrays();
+    }
+
     switch (PendingEventID)
     {
         case CFE_SB_DSBL_RTE1_EID:
@@ -50,6 +50,24 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH < 1
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH > 65535
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD < 0
+#error CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD cannot be less than 0!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH < 2
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be less than 2!
+#elif CFE_PLATFORM_SB_BUF_CACHE_DEPTH > 255
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be greater than 255!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
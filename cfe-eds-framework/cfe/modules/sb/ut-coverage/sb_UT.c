@@ -211,10 +211,13 @@ void UtTest_Setup(void)
     Test_PipeOpts_API();
     Test_GetPipeName_API();
     Test_GetPipeIdByName_API();
+    Test_GetPipeSelectId_API();
     Test_Subscribe_API();
     Test_Unsubscribe_API();
     Test_TransmitMsg_API();
+    Test_TransmitMsgBatch_API();
     Test_ReceiveBuffer_API();
+    Test_ReceiveBufferBatch_API();
     SB_UT_ADD_SUBTEST(Test_CleanupApp_API);
     Test_SB_Utils();
 
@@ -554,6 +557,11 @@ void Test_SB_Cmds_RstCtrs(void)
         CFE_SB_ResetCountersCmd_t Cmd;
     } ResetCounters;
 
+    CFE_SB_Global.HKTlmMsg.Payload.LargeMsgCopyCounter = 3;
+    CFE_SB_Global.AppCopyStats[1].AppId                = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(1));
+    CFE_SB_Global.AppCopyStats[1].BytesCopied          = 100;
+    CFE_SB_Global.AppCopyStats[1].LargeCopyReported    = true;
+
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, &ResetCounters.SBBuf.Msg, sizeof(ResetCounters.Cmd),
                     UT_TPID_CFE_SB_CMD_RESET_COUNTERS_CC);
 
@@ -561,6 +569,12 @@ void Test_SB_Cmds_RstCtrs(void)
 
     CFE_UtAssert_EVENTSENT(CFE_SB_CMD1_RCVD_EID);
 
+    /* The app keeps its slot, only the statistics are reset */
+    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.LargeMsgCopyCounter);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.AppCopyStats[1].AppId, CFE_ES_APPID_C(CFE_ResourceId_FromInteger(1)));
+    UtAssert_ZERO(CFE_SB_Global.AppCopyStats[1].BytesCopied);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.AppCopyStats[1].LargeCopyReported);
+
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, &ResetCounters.SBBuf.Msg, 0, UT_TPID_CFE_SB_CMD_RESET_COUNTERS_CC);
     CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
 
@@ -1050,6 +1064,8 @@ void Test_SB_Cmds_EnRouteValParam(void)
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, &EnableRoute.SBBuf.Msg, sizeof(EnableRoute.Cmd),
                     UT_TPID_CFE_SB_CMD_ENABLE_ROUTE_CC);
 
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(CFE_SBR_GetRouteId(MsgId))->NumDests, 1);
+
     CFE_UtAssert_EVENTCOUNT(3);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_PIPE_ADDED_EID);
@@ -1190,6 +1206,8 @@ void Test_SB_Cmds_DisRouteValParam(void)
     DisableRoute.Cmd.Payload.MsgId = MsgId;
     DisableRoute.Cmd.Payload.Pipe  = PipeId;
 
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(CFE_SBR_GetRouteId(MsgId))->NumDests, 1);
+
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, &DisableRoute.SBBuf.Msg, sizeof(DisableRoute.Cmd),
                     UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC);
 
@@ -1201,6 +1219,9 @@ void Test_SB_Cmds_DisRouteValParam(void)
 
     CFE_UtAssert_EVENTSENT(CFE_SB_DSBL_RTE2_EID);
 
+    /* Disabled destination is no longer delivered to */
+    UtAssert_ZERO(CFE_SBR_GetDestArray(CFE_SBR_GetRouteId(MsgId))->NumDests);
+
     /* Bad Size */
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, &DisableRoute.SBBuf.Msg, 0, UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC);
     CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
@@ -1335,12 +1356,24 @@ void Test_SB_Cmds_SendHK(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgIdCmd, sizeof(MsgIdCmd), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
+    /* Only apps that have sent messages are reported, packed at the start of the array */
+    CFE_SB_Global.AppCopyStats[2].AppId       = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2));
+    CFE_SB_Global.AppCopyStats[2].BytesCopied = 100;
+    CFE_SB_Global.HKTlmMsg.Payload.AppCopyData[1].AppID       = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(5));
+    CFE_SB_Global.HKTlmMsg.Payload.AppCopyData[1].BytesCopied = 5;
+
     CFE_SB_ProcessCmdPipePkt(&Housekeeping.SBBuf);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
 
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.HKTlmMsg.Payload.AppCopyData[0].AppID,
+                               CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.AppCopyData[0].BytesCopied, 100);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.HKTlmMsg.Payload.AppCopyData[1].AppID, CFE_ES_APPID_UNDEFINED);
+    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.AppCopyData[1].BytesCopied);
+
 } /* end Test_SB_Cmds_SendHK */
 
 /*
@@ -1629,6 +1662,7 @@ void Test_SB_EarlyInit_NoErrors(void)
     UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.GetPipeIdByNameErrorCounter);
     UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter);
     UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.LargeMsgCopyCounter);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PipesInUse);
@@ -1819,6 +1853,7 @@ void Test_DeletePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_DeletePipe_InvalidPipeId);
     SB_UT_ADD_SUBTEST(Test_DeletePipe_InvalidPipeOwner);
     SB_UT_ADD_SUBTEST(Test_DeletePipe_WithAppid);
+    SB_UT_ADD_SUBTEST(Test_DeletePipe_WaitForReaders);
 } /* end Test_DeletePipe_API */
 
 /*
@@ -1932,6 +1967,30 @@ void Test_DeletePipe_WithAppid(void)
 
 } /* end Test_DeletePipe_WithAppid */
 
+/*
+** Test that a pipe queue is only deleted once publishers that may still see the pipe are done
+*/
+void Test_DeletePipe_WaitForReaders(void)
+{
+    CFE_SB_PipeId_t         PipeId;
+    uint16                  PipeDepth = 10;
+    SB_UT_ReaderHookState_t State;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID, PipeId));
+
+    State.Token            = CFE_SBR_ReadLock();
+    State.QueueDeleteCount = 0xFFFFFFFF;
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_ReadUnlockHook, &State);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_DeletePipe(PipeId));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_ZERO(State.QueueDeleteCount);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 1);
+    UtAssert_ZERO(CFE_SBR_GetDestArray(CFE_SBR_GetRouteId(SB_UT_CMD_MID))->NumDests);
+
+} /* end Test_DeletePipe_WaitForReaders */
+
 /*
 ** Function for calling SB set pipe opts API test functions
 */
@@ -2088,6 +2147,51 @@ void Test_GetPipeIdByName(void)
 
 } /* end Test_GetPipeIdByName */
 
+/*
+** Function for calling SB get pipe select id API test functions
+*/
+void Test_GetPipeSelectId_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_GetPipeSelectId_BadArgs);
+    SB_UT_ADD_SUBTEST(Test_GetPipeSelectId);
+} /* end Test_GetPipeSelectId_API */
+
+/*
+** Call GetPipeSelectId with a null pointer or an invalid pipe id
+*/
+void Test_GetPipeSelectId_BadArgs(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    osal_id_t       SelectId;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
+
+    UtAssert_INT32_EQ(CFE_SB_GetPipeSelectId(PipeId, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetPipeSelectId(SB_UT_ALTERNATE_INVALID_PIPEID, &SelectId), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_GetPipeSelectId_BadArgs */
+
+/*
+** Successful call to GetPipeSelectId
+*/
+void Test_GetPipeSelectId(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    osal_id_t       SelectId = OS_OBJECT_ID_UNDEFINED;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
+
+    CFE_UtAssert_SUCCESS(CFE_SB_GetPipeSelectId(PipeId, &SelectId));
+    UtAssert_True(OS_ObjectIdEqual(SelectId, CFE_SB_Global.PipeTbl[0].SysQueueId),
+                  "SelectId (%lu) == SysQueueId (%lu)", OS_ObjectIdToInteger(SelectId),
+                  OS_ObjectIdToInteger(CFE_SB_Global.PipeTbl[0].SysQueueId));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_GetPipeSelectId */
+
 /*
 ** Try setting pipe options on an invalid pipe ID
 */
@@ -2590,6 +2694,7 @@ void Test_Unsubscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_FirstDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_MiddleDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_GetDestPtr);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_WaitForReaders);
 } /* end Test_Unsubscribe_API */
 
 /*
@@ -2846,7 +2951,9 @@ void Test_Unsubscribe_MiddleDestWithMany(void)
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, TestPipe3));
 
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(CFE_SBR_GetRouteId(MsgId))->NumDests, 3);
     CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(CFE_SBR_GetRouteId(MsgId))->NumDests, 2);
 
     CFE_UtAssert_EVENTCOUNT(7);
 
@@ -2891,6 +2998,78 @@ void Test_Unsubscribe_GetDestPtr(void)
 
 } /* end Test_Unsubscribe_GetDestPtr */
 
+/*
+** Routing read section held by the test, and the queue deletions done before SB waited on it
+*/
+typedef struct
+{
+    uint32 Token;
+    uint32 QueueDeleteCount;
+} SB_UT_ReaderHookState_t;
+
+/*
+** Hook to leave the routing read section held by the test while SB waits
+*/
+static int32 UT_ReadUnlockHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    SB_UT_ReaderHookState_t *StatePtr = UserObj;
+
+    StatePtr->QueueDeleteCount = UT_GetStubCount(UT_KEY(OS_QueueDelete));
+    CFE_SBR_ReadUnlock(StatePtr->Token);
+
+    return StubRetcode;
+}
+
+/*
+** Test that destinations removed while a publisher is routing are only
+** returned once it is done, and that a route still in use by a publisher
+** is published once it is done, with the SB lock released
+*/
+void Test_Unsubscribe_WaitForReaders(void)
+{
+    CFE_SB_MsgId_t          MsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t         TestPipe1;
+    CFE_SB_PipeId_t         TestPipe2;
+    CFE_SBR_RouteId_t       RouteId;
+    uint16                  PipeDepth = 50;
+    SB_UT_ReaderHookState_t State;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
+
+    State.Token = CFE_SBR_ReadLock();
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_ReadUnlockHook, &State);
+
+    /* A new route has a free second array, so it is published right away */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+
+    /* The array retired by the first update may still be in use, so this waits for the reader to leave */
+    CFE_UtAssert_SUCCESS(CFE_SB_Subscribe(MsgId, TestPipe2));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsDestArrayStale(RouteId));
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(RouteId)->NumDests, 2);
+
+    /* The removed destination is kept while a reader may still see it */
+    State.Token = CFE_SBR_ReadLock();
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, TestPipe1));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_NULL(CFE_SB_GetDestPtr(RouteId, TestPipe1));
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(RouteId)->NumDests, 1);
+
+    CFE_SBR_ReadUnlock(State.Token);
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_ZERO(CFE_SBR_GetDestArray(RouteId)->NumDests);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
+
+} /* end Test_Unsubscribe_WaitForReaders */
+
 /*
 ** Function for calling SB send message API test functions
 */
@@ -2900,6 +3079,7 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_NoSubscribers);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_MaxMsgSizePlusOne);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_BasicSend);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_LargeCopy);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_SequenceCount);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_QueuePutError);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_PipeFull);
@@ -2998,6 +3178,67 @@ void Test_TransmitMsg_BasicSend(void)
 
 } /* end Test_TransmitMsg_BasicSend */
 
+/*
+** Test accounting of copied bytes and the large copy event
+*/
+void Test_TransmitMsg_LargeCopy(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    CFE_ES_AppId_t  AppId;
+    uint32          AppIdx;
+    CFE_MSG_Size_t  Size = CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD;
+    CFE_MSG_Type_t  Type = CFE_MSG_Type_Tlm;
+    union
+    {
+        CFE_MSG_Message_t Msg;
+        uint8             Bytes[CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD];
+    } LargePkt;
+
+    memset(&LargePkt, 0, sizeof(LargePkt));
+    CFE_ES_GetAppID(&AppId);
+    CFE_ES_AppID_ToIndex(AppId, &AppIdx);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* The first large copy is counted and reported */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(&LargePkt.Msg, true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_LARGE_MSG_COPY_EID);
+    CFE_UtAssert_EVENTCOUNT(3);
+
+    /* Later ones from the same app are only counted */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(&LargePkt.Msg, true));
+    CFE_UtAssert_EVENTCOUNT(3);
+
+    /* Smaller messages are not counted as large copies */
+    Size = CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD - 1;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(&LargePkt.Msg, true));
+    CFE_UtAssert_EVENTCOUNT(3);
+
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.LargeMsgCopyCounter, 2);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.AppCopyStats[AppIdx].AppId, AppId);
+    UtAssert_UINT32_EQ(CFE_SB_Global.AppCopyStats[AppIdx].BytesCopied,
+                       (3 * CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD) - 1);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.AppCopyStats[AppIdx].LargeCopyReported);
+
+    /* Copies by an app without a valid index are not accounted */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_BOOL_FALSE(CFE_SB_RecordMsgCopy(AppId, Size));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsg_LargeCopy */
+
 /* Set sequence count hook */
 static int32 UT_CheckSetSequenceCount(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                       const UT_StubContext_t *Context)
@@ -3124,12 +3365,14 @@ void Test_TransmitMsg_QueuePutError(void)
 */
 void Test_TransmitMsg_PipeFull(void)
 {
-    CFE_SB_PipeId_t  PipeId;
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    int32            PipeDepth = 1;
-    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
-    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    int32                  PipeDepth = 1;
+    CFE_MSG_Size_t         Size      = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type      = CFE_MSG_Type_Tlm;
 
     CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PipeFullTestPipe"));
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
@@ -3150,6 +3393,13 @@ void Test_TransmitMsg_PipeFull(void)
     /* Pipe overflow causes TransmitMsg to return CFE_SUCCESS */
     CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
 
+    /* Counters reserved ahead of the failed put must be rolled back */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    DestPtr    = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
     CFE_UtAssert_EVENTCOUNT(4);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
@@ -3220,6 +3470,7 @@ void Test_TransmitMsg_GetPoolBufErr(void)
      * allocation failed)
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE); /* retry after the cache flush */
     UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true), CFE_SB_BUF_ALOC_ERR);
 
     CFE_UtAssert_EVENTCOUNT(3);
@@ -3229,7 +3480,8 @@ void Test_TransmitMsg_GetPoolBufErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_TaskID_ToIndex), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE); /* retry after the cache flush */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_TaskID_ToIndex), 2, -1); /* first call is the buffer cache lookup */
     UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true), CFE_SB_BUF_ALOC_ERR);
 
     /* Confirm no additional events sent */
@@ -3259,6 +3511,7 @@ void Test_AllocateMessageBuffer(void)
      * allocation failed)
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE); /* retry after the cache flush */
     UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
 
     CFE_UtAssert_EVENTCOUNT(0);
@@ -3487,12 +3740,14 @@ void Test_TransmitMsg_DisabledDestination(void)
     RouteId         = CFE_SBR_GetRouteId(MsgId);
     DestPtr         = CFE_SB_GetDestPtr(RouteId, PipeId);
     DestPtr->Active = CFE_SB_INACTIVE;
+    CFE_SB_UpdateDestArray(RouteId, NULL);
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
 
     CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
 
     CFE_UtAssert_EVENTCOUNT(2);
 
@@ -3606,6 +3861,206 @@ void Test_TransmitMsgValidate_InvalidMsgId(void)
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_INV_MSGID_EID);
 }
 
+/*
+** Function for calling SB batch transmit API test functions
+*/
+void Test_TransmitMsgBatch_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_Nominal);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_Chunks);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgBatch_Errors);
+} /* end Test_TransmitMsgBatch_API */
+
+/*
+** Test batch transmit with a null message array and an empty batch
+*/
+void Test_TransmitMsgBatch_InvalidArgs(void)
+{
+    SB_UT_Test_Tlm_t         TlmPkt;
+    const CFE_MSG_Message_t *MsgPtrs[1];
+
+    MsgPtrs[0] = CFE_MSG_PTR(TlmPkt.TelemetryHeader);
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(NULL, 1, true, NULL), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+
+    /* An empty batch is not an error */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgBatch(MsgPtrs, 0, true, NULL));
+    CFE_UtAssert_EVENTCOUNT(1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+
+} /* end Test_TransmitMsgBatch_InvalidArgs */
+
+/*
+** Test successfully sending a batch of messages
+*/
+void Test_TransmitMsgBatch_Nominal(void)
+{
+    static CFE_ES_PoolAlign_t PoolMem[3 * 64];
+    CFE_SB_PipeId_t           PipeId;
+    CFE_SB_MsgId_t            MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t          TlmPkt[3];
+    const CFE_MSG_Message_t * MsgPtrs[3];
+    CFE_Status_t              StatusArray[3];
+    CFE_MSG_Size_t            Size = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t            Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    uint32                    i;
+    uint32                    AppIdCalls;
+    uint32                    TaskIdCalls;
+
+    /* All buffers of the batch are held before being put in transit, so each needs its own memory */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), PoolMem, sizeof(PoolMem), false);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "BatchTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    for (i = 0; i < 3; ++i)
+    {
+        MsgPtrs[i] = CFE_MSG_PTR(TlmPkt[i].TelemetryHeader);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    }
+
+    AppIdCalls  = UT_GetStubCount(UT_KEY(CFE_ES_GetAppID));
+    TaskIdCalls = UT_GetStubCount(UT_KEY(CFE_ES_GetTaskID));
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgBatch(MsgPtrs, 3, true, StatusArray));
+    CFE_UtAssert_SUCCESS(StatusArray[0]);
+    CFE_UtAssert_SUCCESS(StatusArray[1]);
+    CFE_UtAssert_SUCCESS(StatusArray[2]);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 3);
+
+    /* Caller identity is only resolved once for the whole batch, the other task ID lookups find the buffer cache */
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppID)) - AppIdCalls, 1);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetTaskID)) - TaskIdCalls, 1 + 3);
+
+    /* Only the pipe creation and subscription events */
+    CFE_UtAssert_EVENTCOUNT(2);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgBatch_Nominal */
+
+/*
+** Test sending a batch larger than the group of messages put in transit at once
+*/
+void Test_TransmitMsgBatch_Chunks(void)
+{
+    static CFE_ES_PoolAlign_t PoolMem[(CFE_SB_TRANSMIT_BATCH_CHUNK + 2) * 64];
+    CFE_SB_PipeId_t           PipeId;
+    CFE_SB_MsgId_t            MsgId[CFE_SB_TRANSMIT_BATCH_CHUNK + 1];
+    SB_UT_Test_Tlm_t          TlmPkt;
+    const CFE_MSG_Message_t * MsgPtrs[CFE_SB_TRANSMIT_BATCH_CHUNK + 1];
+    CFE_Status_t              StatusArray[CFE_SB_TRANSMIT_BATCH_CHUNK + 1];
+    CFE_MSG_Size_t            Size[CFE_SB_TRANSMIT_BATCH_CHUNK + 1];
+    CFE_MSG_Type_t            Type[CFE_SB_TRANSMIT_BATCH_CHUNK + 1];
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    uint32                    i;
+
+    /* Every buffer of a group is held at the same time, so each needs its own memory */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), PoolMem, sizeof(PoolMem), false);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, CFE_SB_TRANSMIT_BATCH_CHUNK + 1, "BatchTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    for (i = 0; i < CFE_SB_TRANSMIT_BATCH_CHUNK + 1; ++i)
+    {
+        MsgPtrs[i] = CFE_MSG_PTR(TlmPkt.TelemetryHeader);
+        MsgId[i]   = SB_UT_TLM_MID;
+        Size[i]    = sizeof(TlmPkt);
+        Type[i]    = CFE_MSG_Type_Tlm;
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Type, sizeof(Type), false);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgBatch(MsgPtrs, CFE_SB_TRANSMIT_BATCH_CHUNK + 1, true, StatusArray));
+    for (i = 0; i < CFE_SB_TRANSMIT_BATCH_CHUNK + 1; ++i)
+    {
+        CFE_UtAssert_SUCCESS(StatusArray[i]);
+    }
+
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, CFE_SB_TRANSMIT_BATCH_CHUNK + 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, CFE_SB_TRANSMIT_BATCH_CHUNK + 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgBatch_Chunks */
+
+/*
+** Test that failures within a batch are reported per message
+*/
+void Test_TransmitMsgBatch_Errors(void)
+{
+    CFE_SB_PipeId_t          PipeId;
+    CFE_SB_MsgId_t           MsgId[2];
+    SB_UT_Test_Tlm_t         TlmPkt[2];
+    const CFE_MSG_Message_t *MsgPtrs[3];
+    CFE_Status_t             StatusArray[3];
+    CFE_MSG_Size_t           Size[2];
+    CFE_MSG_Type_t           Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeD_t *         PipeDscPtr;
+
+    MsgPtrs[0] = CFE_MSG_PTR(TlmPkt[0].TelemetryHeader);
+    MsgPtrs[1] = NULL;
+    MsgPtrs[2] = CFE_MSG_PTR(TlmPkt[1].TelemetryHeader);
+    MsgId[0]   = SB_UT_TLM_MID;
+    MsgId[1]   = SB_UT_TLM_MID;
+    Size[0]    = sizeof(SB_UT_Test_Tlm_t);
+    Size[1]    = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "BatchTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId[0], PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* The NULL entry does not read the header, so only two messages are read */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    /* The first failure is returned, but the rest of the batch is still sent */
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, 3, true, StatusArray), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(StatusArray[0]);
+    UtAssert_INT32_EQ(StatusArray[1], CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(StatusArray[2], CFE_SB_MSG_TOO_BIG);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 2);
+
+    /* Only the first failure in the batch is reported by event */
+    CFE_UtAssert_EVENTCOUNT(3);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* Buffer allocation failure */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId[0], sizeof(MsgId[0]), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size[0], sizeof(Size[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE); /* retry after the cache flush */
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgBatch(MsgPtrs, 1, true, NULL), CFE_SB_BUF_ALOC_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_GET_BUF_ERR_EID);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* Delivery errors are reported once the batch is done */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId[0], sizeof(MsgId[0]), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size[0], sizeof(Size[0]), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgBatch(MsgPtrs, 1, true, NULL));
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_WR_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgBatch_Errors */
+
 /*
 ** Function for calling SB receive message API test functions
 */
@@ -3639,6 +4094,46 @@ static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, cons
     PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
 }
 
+static void SB_UT_PipeIdModifyMultiHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *                  data         = UT_Hook_GetArgValueByName(Context, "data", void *);
+    uint32 *                count_copied = UT_Hook_GetArgValueByName(Context, "count_copied", uint32 *);
+    int32                   status;
+    static SB_UT_Test_Tlm_t FakeTlmPkt;
+    SB_UT_Test_Tlm_t **     OutData;
+    CFE_SB_PipeD_t *        PipeDscPtr = UserObj;
+
+    OutData       = data;
+    *OutData      = &FakeTlmPkt;
+    *count_copied = 1;
+    status        = OS_SUCCESS;
+    UT_Stub_SetReturnValue(FuncKey, status);
+
+    /* Modify the PipeID so it fails to match */
+    PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
+}
+
+/* Hook to take up all the batch buffer room of a pipe while pending on the queue */
+static int32 SB_UT_BatchFullMultiHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                      const UT_StubContext_t *Context)
+{
+    CFE_SB_PipeD_t *PipeDscPtr = UserObj;
+
+    PipeDscPtr->BatchCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+
+    return StubRetcode;
+}
+
+/* Hook to capture how many buffer descriptors were requested from the queue */
+static int32 SB_UT_MultiCountHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    uint32 *CountPtr = UserObj;
+
+    *CountPtr = UT_Hook_GetArgValueByName(Context, "count", uint32);
+
+    return StubRetcode;
+}
+
 /* Special handler to hit OS_QueueGet error casses */
 static void SB_UT_QueueGetHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
@@ -3833,6 +4328,216 @@ void Test_ReceiveBuffer_PendForever(void)
 
 } /* end Test_ReceiveBuffer_PendForever */
 
+/*
+** Function for calling SB batch receive API test functions
+*/
+void Test_ReceiveBufferBatch_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_Nominal);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_Errors);
+} /* end Test_ReceiveBufferBatch_API */
+
+/*
+** Test batch receive with invalid arguments and an invalid pipe ID
+*/
+void Test_ReceiveBufferBatch_InvalidArgs(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    size_t           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    UT_ClearEventHistory();
+
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(NULL, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_ZERO(Count);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 0, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, -5), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTCOUNT(4);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    UT_ClearEventHistory();
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_POLL),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UT_ClearEventHistory();
+
+    /* Pipe is changed while pending on the queue, see Test_ReceiveBuffer_InvalidPipeId */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetMulti), SB_UT_PipeIdModifyMultiHandler, PipeDscPtr);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 1, &Count, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetMulti), NULL, NULL);
+
+    /* restore the PipeID so it can be deleted */
+    PipeDscPtr->PipeId = PipeId;
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBufferBatch_InvalidArgs */
+
+/*
+** Test receiving multiple messages in one batch, and releasing them
+*/
+void Test_ReceiveBufferBatch_Nominal(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t * PipeDscPtr;
+    size_t           Count;
+    uint32           InUse;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+    InUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_NOT_NULL(SBBufPtrs[0]);
+    UtAssert_NOT_NULL(SBBufPtrs[1]);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_UINT32_EQ(PipeDscPtr->BatchCount, 2);
+
+    /* The buffers are held for the caller, not released by the next receive */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs + 2, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, InUse);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBufferBatch(SBBufPtrs, 2, PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, InUse - 2);
+    UtAssert_ZERO(PipeDscPtr->BatchCount);
+
+    /* Buffers can only be released once */
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBufferBatch(SBBufPtrs, 2, PipeId), CFE_SB_BUFFER_INVALID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, InUse - 2);
+
+    /* A batch receive still releases a single buffer from the last single receive */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_NOT_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+
+    /* Batch size is limited to the caller's MaxCount, remainder stays on the pipe */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    InUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 1, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* A buffer that cannot be tracked because the room was taken meanwhile is dropped */
+    UT_SetHookFunction(UT_KEY(OS_QueueGetMulti), SB_UT_BatchFullMultiHook, PipeDscPtr);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs + 1, 1, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, InUse - 1);
+    UT_SetHookFunction(UT_KEY(OS_QueueGetMulti), NULL, NULL);
+    PipeDscPtr->BatchCount = 1;
+
+    /* Buffers still held by the caller are released along with the pipe */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, InUse - 2);
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBufferBatch(SBBufPtrs, Count, PipeId), CFE_SB_BAD_ARGUMENT);
+
+} /* end Test_ReceiveBufferBatch_Nominal */
+
+/*
+** Test batch receive timeout and pipe read error responses
+*/
+void Test_ReceiveBufferBatch_Errors(void)
+{
+    CFE_SB_Buffer_t * SBBufPtrs[4];
+    CFE_SB_BufferD_t *NullBufDsc = NULL;
+    CFE_SB_PipeId_t   PipeId;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    size_t            Count;
+    uint32            MaxCount;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetMulti), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, 200), CFE_SB_TIME_OUT);
+    UtAssert_ZERO(Count);
+    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetMulti), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER),
+                      CFE_SB_PIPE_RD_ERR);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+
+    /* A batch of only NULL descriptors is a read error */
+    UT_ClearEventHistory();
+    OS_QueuePut(PipeDscPtr->SysQueueId, &NullBufDsc, sizeof(NullBufDsc), 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 2);
+
+    /* No more buffers can be received while the pipe's batch room is used up */
+    UT_ClearEventHistory();
+    PipeDscPtr->BatchCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    UtAssert_STUB_COUNT(OS_QueueGetMulti, 3);
+
+    /* Only as many as there is room for are requested */
+    PipeDscPtr->BatchCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH - 1;
+    UT_SetHookFunction(UT_KEY(OS_QueueGetMulti), SB_UT_MultiCountHook, &MaxCount);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(MaxCount, 1);
+    UT_SetHookFunction(UT_KEY(OS_QueueGetMulti), NULL, NULL);
+    PipeDscPtr->BatchCount = 0;
+
+    /* Release with bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBufferBatch(NULL, 1, PipeId), CFE_SB_BAD_ARGUMENT);
+    SBBufPtrs[0] = NULL;
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBufferBatch(SBBufPtrs, 1, PipeId), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBufferBatch(SBBufPtrs, 0, PipeId));
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBufferBatch(SBBufPtrs, 0, CFE_SB_INVALID_PIPE), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBufferBatch_Errors */
+
 /*
 ** Test releasing zero copy buffers for all pipes owned by a given app ID
 */
@@ -3872,20 +4577,25 @@ void Test_CleanupApp_API(void)
     CFE_SB_CleanUpApp(CFE_ES_APPID_UNDEFINED);
 
     /* This should have freed no buffers  */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
 
     /* Attempt again with a valid application ID */
     CFE_SB_CleanUpApp(AppID);
 
     /* This should have freed 2 out of the 3 buffers -
      * the ones which were gotten by this app. */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
 
-    /* Clean up the second App */
+    /* Clean up the second App, which also forgets its copy statistics */
+    CFE_SB_Global.AppCopyStats[2].AppId       = AppID2;
+    CFE_SB_Global.AppCopyStats[2].BytesCopied = 100;
     CFE_SB_CleanUpApp(AppID2);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.AppCopyStats[2].AppId, CFE_ES_APPID_UNDEFINED);
+    UtAssert_ZERO(CFE_SB_Global.AppCopyStats[2].BytesCopied);
 
-    /* This should have freed the last buffer */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    /* This should have freed the last buffer, all of them are kept in the buffer cache */
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
 
     CFE_UtAssert_EVENTCOUNT(2);
 
@@ -4154,6 +4864,7 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_ReqToSendEvent_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_PutDestBlk_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_BufCache);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_Nominal);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_LimitErr);
@@ -4267,6 +4978,7 @@ void Test_CFE_SB_Buffers(void)
      * so it shouldn't be tracked as "in use" - it is lost.
      */
     ExpRtn = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse - 1;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_TaskID_ToIndex), 1, -1);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_SB_ReturnBufferToPool(bd);
     UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, ExpRtn);
@@ -4301,6 +5013,146 @@ void Test_CFE_SB_Buffers(void)
 
 } /* end Test_CFE_SB_Buffers */
 
+/*
+** Test the per-task buffer cache and the shared free lists behind it
+*/
+void Test_CFE_SB_BufCache(void)
+{
+    CFE_SB_BufCache_t Cache;
+    CFE_SB_BufferD_t  Bufs[3 * CFE_PLATFORM_SB_BUF_CACHE_DEPTH];
+    CFE_SB_BufferD_t *bd;
+    uint32            SmallClass;
+    uint32            LargeClass;
+    uint32            Drained;
+    uint32            i;
+
+    memset(&Cache, 0, sizeof(Cache));
+    memset(Bufs, 0, sizeof(Bufs));
+
+    /* Size classes follow the pool block sizes */
+    SmallClass = CFE_SB_GetBufferSizeClass(1);
+    LargeClass = CFE_SB_GetBufferSizeClass(CFE_PLATFORM_SB_MAX_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(SmallClass, CFE_PLATFORM_ES_POOL_MAX_BUCKETS - 1);
+    UtAssert_ZERO(LargeClass);
+    UtAssert_UINT32_EQ(CFE_SB_GetBufferSizeClass(0), SmallClass);
+    UtAssert_UINT32_EQ(CFE_SB_GetBufferSizeClass(CFE_PLATFORM_SB_MAX_BLOCK_SIZE + 1),
+                       CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+
+    /* Each block size and the size just above it select the right class */
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        UtAssert_UINT32_EQ(CFE_SB_GetBufferSizeClass(CFE_SB_MemPoolDefSize[i]), i);
+        if (i > 0)
+        {
+            UtAssert_UINT32_EQ(CFE_SB_GetBufferSizeClass(CFE_SB_MemPoolDefSize[i] + 1), i - 1);
+        }
+    }
+
+    /* Empty cache is a miss */
+    UtAssert_NULL(CFE_SB_BufCacheGet(&Cache, SmallClass));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheMissCounter, 1);
+
+    /* The most recent buffer of the matching size class is reused */
+    UtAssert_BOOL_TRUE(CFE_SB_BufCachePut(&Cache, SmallClass, &Bufs[0]));
+    UtAssert_BOOL_TRUE(CFE_SB_BufCachePut(&Cache, LargeClass, &Bufs[1]));
+    UtAssert_BOOL_TRUE(CFE_SB_BufCachePut(&Cache, SmallClass, &Bufs[2]));
+    UtAssert_ADDRESS_EQ(CFE_SB_BufCacheGet(&Cache, SmallClass), &Bufs[2]);
+    UtAssert_ADDRESS_EQ(CFE_SB_BufCacheGet(&Cache, SmallClass), &Bufs[0]);
+    UtAssert_NULL(Cache.Buf[0]);
+    UtAssert_ADDRESS_EQ(Cache.Buf[1], &Bufs[1]);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheHitCounter, 2);
+    UtAssert_ADDRESS_EQ(CFE_SB_BufCacheGet(&Cache, LargeClass), &Bufs[1]);
+    UtAssert_NULL(Cache.Buf[1]);
+
+    /* A full cache refuses a buffer, then draining moves half of it to the free lists */
+    for (i = 0; i < CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+    {
+        UtAssert_BOOL_TRUE(CFE_SB_BufCachePut(&Cache, SmallClass, &Bufs[i]));
+    }
+    UtAssert_BOOL_FALSE(CFE_SB_BufCachePut(&Cache, SmallClass, &Bufs[i]));
+    CFE_SB_BufCacheDrain_Unsync(&Cache);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheDrainCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.BufFreeCount[SmallClass], CFE_SB_BUF_CACHE_BATCH);
+    UtAssert_NULL(Cache.Buf[0]);
+    UtAssert_ADDRESS_EQ(Cache.Buf[CFE_SB_BUF_CACHE_BATCH], &Bufs[CFE_SB_BUF_CACHE_BATCH]);
+    UtAssert_BOOL_TRUE(CFE_SB_BufCachePut(&Cache, SmallClass, &Bufs[i]));
+
+    /* Another task refills its cache from the free list in a batch */
+    memset(&Cache, 0, sizeof(Cache));
+    UtAssert_NOT_NULL(CFE_SB_BufCacheRefill_Unsync(&Cache, SmallClass));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheRefillCounter, 1);
+    for (i = 0; i < CFE_SB_BUF_CACHE_BATCH - 1; ++i)
+    {
+        UtAssert_NOT_NULL(CFE_SB_BufCacheGet(&Cache, SmallClass));
+    }
+    UtAssert_NULL(CFE_SB_BufCacheGet(&Cache, SmallClass));
+    UtAssert_NULL(CFE_SB_Global.BufFreeList[SmallClass]);
+    UtAssert_ZERO(CFE_SB_Global.BufFreeCount[SmallClass]);
+    UtAssert_NULL(CFE_SB_BufCacheRefill_Unsync(&Cache, SmallClass));
+
+    /* Buffers beyond the free list depth go back to the pool */
+    memset(&Cache, 0, sizeof(Cache));
+    Drained = 0;
+    while (Drained <= CFE_SB_BUF_FREE_LIST_DEPTH)
+    {
+        for (i = 0; i < CFE_SB_BUF_CACHE_BATCH; ++i)
+        {
+            Cache.SizeClass[i] = SmallClass;
+            Cache.Buf[i]       = &Bufs[Drained + i];
+        }
+        CFE_SB_BufCacheDrain_Unsync(&Cache);
+        Drained += CFE_SB_BUF_CACHE_BATCH;
+    }
+    UtAssert_UINT32_EQ(CFE_SB_Global.BufFreeCount[SmallClass], CFE_SB_BUF_FREE_LIST_DEPTH);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, Drained - CFE_SB_BUF_FREE_LIST_DEPTH);
+
+    /* A flush returns the free lists and every task cache to the pool */
+    UT_InitData();
+    CFE_SB_Global.BufCache[0].Buf[0] = &Bufs[0];
+    CFE_SB_BufCacheFlush_Unsync();
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, CFE_SB_BUF_FREE_LIST_DEPTH + 1);
+    UtAssert_NULL(CFE_SB_Global.BufFreeList[SmallClass]);
+    UtAssert_ZERO(CFE_SB_Global.BufFreeCount[SmallClass]);
+    UtAssert_NULL(CFE_SB_Global.BufCache[0].Buf[0]);
+
+    /* A task without a valid index has no cache */
+    UtAssert_NOT_NULL(CFE_SB_GetTaskBufCache());
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_TaskID_ToIndex), 1, -1);
+    UtAssert_NULL(CFE_SB_GetTaskBufCache());
+
+    /* Buffers freed by a task are handed back to it without the pool or the lock */
+    UT_InitData();
+    CFE_SB_InitBuffers();
+    memset(&CFE_SB_Global.StatTlmMsg.Payload, 0, sizeof(CFE_SB_Global.StatTlmMsg.Payload));
+    CFE_SB_ReturnBufferToPool(CFE_SB_GetBufferFromPool(10));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    bd = CFE_SB_GetBufferFromPool(10);
+    UtAssert_NOT_NULL(bd);
+    CFE_SB_ReleaseBufferRef(bd);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheHitCounter, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse, 1);
+
+    /* A pool failure flushes the cached buffers back to the pool and tries again */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NOT_NULL(CFE_SB_GetBufferFromPool(1000));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 3);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    /* Nothing left to flush, so the allocation fails if the retry does */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetBufferFromPool(1000));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+
+} /* end Test_CFE_SB_BufCache */
+
 /*
 ** Test internal function to get the pipe table index for the given pipe ID
 */
@@ -4384,6 +5236,7 @@ void Test_SB_TransmitMsgPaths_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE); /* retry after the cache flush */
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, &Housekeeping.SBBuf.Msg, sizeof(Housekeeping.Cmd),
                     UT_TPID_CFE_SB_SEND_HK);
     UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 0);
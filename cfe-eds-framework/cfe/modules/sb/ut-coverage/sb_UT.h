@@ -659,6 +659,52 @@ void Test_GetPipeIdByName_InvalidName(void);
 ******************************************************************************/
 void Test_GetPipeIdByName(void);
 
+/*****************************************************************************/
+/**
+** \brief Function for calling SB get pipe select id API test functions
+**
+** \par Description
+**        Function for calling SB get pipe select id API test functions.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetPipeSelectId_API(void);
+
+/*****************************************************************************/
+/**
+** \brief Test get pipe select id response to a null pointer or invalid pipe id
+**
+** \par Description
+**        This function tests getting the select id of a pipe with a null
+**        output pointer and with a pipe id that does not exist.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetPipeSelectId_BadArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting the select id of a valid pipe
+**
+** \par Description
+**        This function tests getting the select id of a valid pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetPipeSelectId(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send pipe information command default / nominal path
@@ -1339,6 +1385,22 @@ void Test_DeletePipe_InvalidPipeOwner(void);
 ******************************************************************************/
 void Test_DeletePipe_WithAppid(void);
 
+/*****************************************************************************/
+/**
+** \brief Test pipe delete while a publisher is routing
+**
+** \par Description
+**        This function tests that the queue of a deleted pipe is only
+**        deleted once publishers that may still see the pipe are done.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeletePipe_WaitForReaders(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB subscribe API test functions
@@ -1758,6 +1820,24 @@ void Test_Unsubscribe_MiddleDestWithMany(void);
 ******************************************************************************/
 void Test_Unsubscribe_GetDestPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test message unsubscription while a publisher is routing
+**
+** \par Description
+**        This function tests that a removed destination is only returned
+**        once the publisher is done, and that a route change that can not
+**        be published while the publisher is routing is published once it
+**        is done, with the SB lock released.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Unsubscribe_WaitForReaders(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB send message API test functions
@@ -1854,6 +1934,22 @@ void Test_TransmitMsg_MaxMsgSizePlusOne(void);
 ******************************************************************************/
 void Test_TransmitMsg_BasicSend(void);
 
+/*****************************************************************************/
+/**
+** \brief Test accounting of copied bytes and the large copy event
+**
+** \par Description
+**        This function tests that messages sent by copying are counted per
+**        application and that large copies are counted and reported once.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_LargeCopy(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test successful send/receive for packet sequence count
@@ -2096,6 +2192,85 @@ void Test_TransmitMsgValidate_InvalidMsgId(void);
 ******************************************************************************/
 void Test_TransmitMsgValidate_MaxMsgSizePlusOne(void);
 
+/*****************************************************************************/
+/**
+** \brief Function for calling SB batch transmit API test functions
+**
+** \par Description
+**        Function for calling SB batch transmit API test functions.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_API(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batch transmit with invalid arguments
+**
+** \par Description
+**        This function tests the batch transmit with a NULL message array
+**        and an empty batch.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a batch of messages
+**
+** \par Description
+**        This function tests sending several messages in one batch, and that
+**        the caller identity is only looked up once.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_Nominal(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a batch larger than one group of messages
+**
+** \par Description
+**        This function tests that a batch with more messages than are put
+**        in transit under one lock hold is delivered completely and in order.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_Chunks(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batch transmit error responses
+**
+** \par Description
+**        This function tests the per-message status of a batch containing
+**        invalid messages, and the buffer allocation and pipe write errors.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgBatch_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB receive message API test functions
@@ -2111,6 +2286,72 @@ void Test_TransmitMsgValidate_MaxMsgSizePlusOne(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_API(void);
 
+/*****************************************************************************/
+/**
+** \brief Function for calling SB batch receive API test functions
+**
+** \par Description
+**        Function for calling SB batch receive API test functions.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_API(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batch receive with invalid arguments
+**
+** \par Description
+**        This function tests the batch receive with NULL pointers, a zero
+**        count, an invalid timeout and an invalid or changed pipe ID.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages
+**
+** \par Description
+**        This function tests receiving several messages in one batch, and
+**        that the buffers are held until the caller releases them or the
+**        pipe is deleted.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_Nominal(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batch receive timeout and read error responses
+**
+** \par Description
+**        This function tests the batch receive response to a queue timeout,
+**        a queue read error, a NULL descriptor and a pipe already holding
+**        the most batch buffers, and the batch release response to invalid
+**        arguments.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message from the software bus with an invalid
@@ -2429,6 +2670,23 @@ void Test_PutDestBlk_ErrLogic(void);
 ******************************************************************************/
 void Test_CFE_SB_Buffers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the per-task SB buffer cache
+**
+** \par Description
+**        This function tests the size class lookup, cache hits and misses,
+**        and moving buffers between the task caches and the shared free
+**        lists.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_BufCache(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test functions that involve bad pipe information
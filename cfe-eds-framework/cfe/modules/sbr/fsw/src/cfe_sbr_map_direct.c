@@ -37,6 +37,7 @@
 #include <string.h>
 
 #include "cfe_sb.h"
+#include "cfe_core_atomic.h"
 
 /*
  * Macro Definitions
@@ -82,7 +83,7 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
 {
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)] = RouteId;
+        CFE_ATOMIC_STORE(&CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)].RouteId, RouteId.RouteId);
     }
 
     /* Direct lookup never collides, always return 0 */
@@ -102,7 +103,7 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        routeid = CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)];
+        routeid.RouteId = CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)].RouteId);
     }
 
     return routeid;
@@ -35,6 +35,7 @@
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
 #include "cfe_sb.h"
+#include "cfe_core_atomic.h"
 
 #include <string.h>
 #include <limits.h>
@@ -145,7 +146,8 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
             collisions++;
         }
 
-        CFE_SBR_MSGMAP[hash] = RouteId;
+        /* Publish to lock-free readers, the route entry is already complete */
+        CFE_ATOMIC_STORE(&CFE_SBR_MSGMAP[hash].RouteId, RouteId.RouteId);
     }
 
     return collisions;
@@ -165,8 +167,8 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        hash    = CFE_SBR_MsgIdHash(MsgId);
-        routeid = CFE_SBR_MSGMAP[hash];
+        hash            = CFE_SBR_MsgIdHash(MsgId);
+        routeid.RouteId = CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP[hash].RouteId);
 
         /*
          * Increment from original hash to find matching route.
@@ -176,8 +178,8 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
         while (CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
         {
             /* Increment or loop to start of array */
-            hash    = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
-            routeid = CFE_SBR_MSGMAP[hash];
+            hash            = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            routeid.RouteId = CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP[hash].RouteId);
         }
     }
 
@@ -0,0 +1,218 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/******************************************************************************
+ * Perfect hash routing map implementation
+ *
+ * Notes:
+ *   These functions manipulate/access global variables and need
+ *   to be protected by the SB Shared data lock.
+ *
+ *   The hash parameters are generated by the EDS toolchain from the set
+ *   of Message Ids in the mission database, so every mission Message Id
+ *   has its own slot and is found with a single probe.  Message Ids that
+ *   are not in the database (not expected on an EDS mission) are kept in
+ *   a small overflow list that is searched linearly.
+ *
+ */
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_sb.h"
+#include "cfe_core_atomic.h"
+#include "cfe_mission_eds_msgid_phash.h"
+
+#include <string.h>
+
+/*
+ * Macro Definitions
+ */
+
+/**
+ * \brief Message map size
+ *
+ * For perfect hash mapping, map size is the smallest power of 2 that
+ * holds every Message Id in the mission database
+ */
+#define CFE_SBR_MSG_MAP_SIZE (1U << CFE_MISSION_MSGID_PHASH_BITS)
+
+/** \brief Displacement table size */
+#define CFE_SBR_MSG_DISP_SIZE (1U << CFE_MISSION_MSGID_PHASH_DISP_BITS)
+
+/******************************************************************************
+ * Shared data
+ */
+
+/** \brief Message Id owning each map slot, generated */
+const CFE_SB_MsgIdValue_Atom_t CFE_SBR_MSGKEYS[CFE_SBR_MSG_MAP_SIZE] = CFE_MISSION_MSGID_PHASH_KEY_TABLE_INIT;
+
+/** \brief Slot displacement for each displacement index, generated */
+const uint16 CFE_SBR_MSGDISP[CFE_SBR_MSG_DISP_SIZE] = CFE_MISSION_MSGID_PHASH_DISP_TABLE_INIT;
+
+/** \brief Message map shared data */
+CFE_SBR_RouteId_t CFE_SBR_MSGMAP[CFE_SBR_MSG_MAP_SIZE];
+
+/** \brief Routes for Message Ids not in the mission database */
+CFE_SBR_RouteId_t CFE_SBR_MSGOVERFLOW[CFE_PLATFORM_SB_MAX_MSG_IDS];
+
+/** \brief Number of entries in use in the overflow list */
+uint32 CFE_SBR_MsgOverflowCount;
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_MsgIdPerfectHash
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Hashes the message id to its map slot
+ *
+ * Note: must match the hash computed by the EDS toolchain, see
+ * 77-cfe_sb_msgid_phash.lua
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_MsgIdPerfectHash(CFE_SB_MsgIdValue_Atom_t MsgIdValue)
+{
+    uint32 slot;
+    uint32 disp;
+
+    disp = (uint32)(MsgIdValue * CFE_MISSION_MSGID_PHASH_DISP_MULTIPLIER) >> (32 - CFE_MISSION_MSGID_PHASH_DISP_BITS);
+    slot = (uint32)(MsgIdValue * CFE_MISSION_MSGID_PHASH_MULTIPLIER) >> (32 - CFE_MISSION_MSGID_PHASH_BITS);
+
+    return slot ^ CFE_SBR_MSGDISP[disp];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_Init_Map
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Init_Map(void)
+{
+    /* Clear the shared data */
+    memset(&CFE_SBR_MSGMAP, 0, sizeof(CFE_SBR_MSGMAP));
+    memset(&CFE_SBR_MSGOVERFLOW, 0, sizeof(CFE_SBR_MSGOVERFLOW));
+    CFE_SBR_MsgOverflowCount = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_SetRouteId
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SB_MsgIdValue_Atom_t value;
+    uint32                   slot;
+    uint32                   collisions = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        value = CFE_SB_MsgIdToValue(MsgId);
+        slot  = CFE_SBR_MsgIdPerfectHash(value);
+
+        if (CFE_SBR_MSGKEYS[slot] == value)
+        {
+            /* Publish to lock-free readers, the route entry is already complete */
+            CFE_ATOMIC_STORE(&CFE_SBR_MSGMAP[slot].RouteId, RouteId.RouteId);
+        }
+        else
+        {
+            /*
+             * Not a mission Message Id, find it or the end of the overflow list.
+             * The list can't be longer than the number of routes.  Each entry
+             * searched before this one counts as a collision.
+             */
+            while (collisions < CFE_SBR_MsgOverflowCount &&
+                   !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(CFE_SBR_MSGOVERFLOW[collisions]), MsgId))
+            {
+                collisions++;
+            }
+
+            if (collisions < CFE_PLATFORM_SB_MAX_MSG_IDS)
+            {
+                CFE_ATOMIC_STORE(&CFE_SBR_MSGOVERFLOW[collisions].RouteId, RouteId.RouteId);
+                if (collisions == CFE_SBR_MsgOverflowCount)
+                {
+                    /* Entry must be visible before readers search it */
+                    CFE_ATOMIC_STORE(&CFE_SBR_MsgOverflowCount, collisions + 1);
+                }
+            }
+        }
+    }
+
+    return collisions;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetRouteId
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgIdValue_Atom_t value;
+    uint32                   slot;
+    uint32                   i;
+    uint32                   count;
+    CFE_SBR_RouteId_t        routeid = CFE_SBR_INVALID_ROUTE_ID;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        value = CFE_SB_MsgIdToValue(MsgId);
+        slot  = CFE_SBR_MsgIdPerfectHash(value);
+
+        if (CFE_SBR_MSGKEYS[slot] == value)
+        {
+            routeid.RouteId = CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP[slot].RouteId);
+        }
+        else
+        {
+            count = CFE_ATOMIC_LOAD(&CFE_SBR_MsgOverflowCount);
+            for (i = 0; i < count; i++)
+            {
+                routeid.RouteId = CFE_ATOMIC_LOAD(&CFE_SBR_MSGOVERFLOW[i].RouteId);
+                if (CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
+                {
+                    break;
+                }
+            }
+
+            if (i == count)
+            {
+                routeid = CFE_SBR_INVALID_ROUTE_ID;
+            }
+        }
+    }
+
+    return routeid;
+}
@@ -39,17 +39,31 @@
 
 #include "cfe_sb.h"
 #include "cfe_msg.h"
+#include "cfe_core_atomic.h"
 
 /******************************************************************************
  * Type Definitions
  */
 
+/** \brief Destination array storage, each one starts on its own cache line */
+typedef struct
+{
+    CFE_SBR_DestArray_t Array;
+} CFE_CACHE_ALIGNED CFE_SBR_DestArrayStore_t;
+
 /** \brief Routing table entry */
 typedef struct
 {
-    CFE_SB_DestinationD_t * ListHeadPtr; /**< \brief Destination list head */
-    CFE_SB_MsgId_t          MsgId;       /**< \brief Message ID associated with route */
-    CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
+    CFE_SB_DestinationD_t * ListHeadPtr;     /**< \brief Destination list head */
+    CFE_SBR_DestArray_t *   DestArrayPtr;    /**< \brief Published destination array */
+    CFE_SBR_DestArray_t *   RetiredArrayPtr; /**< \brief Previous array, reusable once readers of RetireEpoch left */
+    CFE_SB_DestinationD_t * RemovedDestPtr;  /**< \brief Removed destinations the published array may reference */
+    CFE_SB_DestinationD_t * RetiredDestPtr;  /**< \brief Removed destinations released with the retired array */
+    uint32                  RetireEpoch;     /**< \brief Read epoch in which the retired array was unpublished */
+    bool                    RetirePending;   /**< \brief Readers of RetireEpoch may not have left yet */
+    bool                    Stale;           /**< \brief Published array is behind the list, see SetDestArray */
+    CFE_SB_MsgId_t          MsgId;           /**< \brief Message ID associated with route */
+    CFE_MSG_SequenceCount_t SeqCnt;          /**< \brief Message sequence counter */
 } CFE_SBR_RouteEntry_t;
 
 /** \brief Module data */
@@ -57,6 +71,14 @@ typedef struct
 {
     CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS]; /**< \brief Routing table */
     CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First unused entry in RoutingTbl */
+    uint32                ReadEpoch;      /**< \brief Grace period counter, low bit selects the reader count */
+    uint32                DoneEpoch;      /**< \brief Latest epoch whose readers have all left */
+    uint32                ReaderCount[2]; /**< \brief Readers in progress per epoch parity */
+    uint32                NumPending;     /**< \brief Routes with a retired array not yet reclaimed */
+    uint32                NumStale;       /**< \brief Routes with a stale published array */
+
+    /** \brief Published and retired destination array of each route */
+    CFE_SBR_DestArrayStore_t DestArrayStore[2 * CFE_PLATFORM_SB_MAX_MSG_IDS];
 } cfe_sbr_route_data_t;
 
 /******************************************************************************
@@ -80,12 +102,18 @@ void CFE_SBR_Init(void)
     /* Clear the shared data */
     memset(&CFE_SBR_RDATA, 0, sizeof(CFE_SBR_RDATA));
 
-    /* Only non-zero value for shared data initialization is the invalid MsgId */
+    /* Non-zero values for shared data initialization are the invalid MsgId and the (empty) destination arrays */
     for (routeidx = 0; routeidx < CFE_PLATFORM_SB_MAX_MSG_IDS; routeidx++)
     {
-        CFE_SBR_RDATA.RoutingTbl[routeidx].MsgId = CFE_SB_INVALID_MSG_ID;
+        CFE_SBR_RDATA.RoutingTbl[routeidx].MsgId        = CFE_SB_INVALID_MSG_ID;
+        CFE_SBR_RDATA.RoutingTbl[routeidx].DestArrayPtr = &CFE_SBR_RDATA.DestArrayStore[2 * routeidx].Array;
+        CFE_SBR_RDATA.RoutingTbl[routeidx].RetiredArrayPtr =
+            &CFE_SBR_RDATA.DestArrayStore[(2 * routeidx) + 1].Array;
     }
 
+    /* No reader has seen the retired arrays, so they start out reusable */
+    CFE_SBR_RDATA.DoneEpoch = CFE_SBR_RDATA.ReadEpoch - 1;
+
     /* Initialize map */
     CFE_SBR_Init_Map();
 }
@@ -104,10 +132,12 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
 
     if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS))
     {
-        routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
-        collisions = CFE_SBR_SetRouteId(MsgId, routeid);
+        routeid = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
 
+        /* Entry must be complete before the map publishes it to lock-free readers */
         CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
+        collisions                                                = CFE_SBR_SetRouteId(MsgId, routeid);
+
         CFE_SBR_RDATA.RouteIdxTop++;
     }
 
@@ -174,6 +204,150 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetDestArray
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+const CFE_SBR_DestArray_t *CFE_SBR_GetDestArray(CFE_SBR_RouteId_t RouteId)
+{
+    const CFE_SBR_DestArray_t *arrayptr = NULL;
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        arrayptr = CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].DestArrayPtr);
+    }
+
+    return arrayptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_ReclaimRoute
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Reclaims the retired array of a route once its readers have left,
+ * returns true if it is free to be filled in.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_SBR_ReclaimRoute(CFE_SBR_RouteEntry_t *RoutePtr, CFE_SBR_ReleaseDestPtr_t ReleaseFunc)
+{
+    CFE_SB_DestinationD_t *destptr;
+
+    if (RoutePtr->RetirePending)
+    {
+        if (!CFE_SBR_EpochElapsed(RoutePtr->RetireEpoch))
+        {
+            return false;
+        }
+
+        RoutePtr->RetirePending = false;
+        --CFE_SBR_RDATA.NumPending;
+
+        while (RoutePtr->RetiredDestPtr != NULL)
+        {
+            destptr                  = RoutePtr->RetiredDestPtr;
+            RoutePtr->RetiredDestPtr = destptr->Next;
+            destptr->Next            = NULL;
+            (*ReleaseFunc)(destptr);
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_SetDestArray
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SBR_SetDestArray(CFE_SBR_RouteId_t RouteId, const CFE_SB_DestinationEntry_t *Dests, uint32 NumDests,
+                          CFE_SB_DestinationD_t *RemovedDestPtr, CFE_SBR_ReleaseDestPtr_t ReleaseFunc)
+{
+    CFE_SBR_RouteEntry_t *routeptr;
+    CFE_SBR_DestArray_t * newptr;
+
+    if (!CFE_SBR_IsValidRouteId(RouteId))
+    {
+        return false;
+    }
+
+    routeptr = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)];
+
+    /* The published array may still reference it, so it is kept until that array is reclaimed */
+    if (RemovedDestPtr != NULL)
+    {
+        RemovedDestPtr->Next     = routeptr->RemovedDestPtr;
+        routeptr->RemovedDestPtr = RemovedDestPtr;
+    }
+
+    /* Only the retired array of this route can be filled in, and only once no reader can still see it */
+    if (!CFE_SBR_ReclaimRoute(routeptr, ReleaseFunc))
+    {
+        if (!routeptr->Stale)
+        {
+            routeptr->Stale = true;
+            ++CFE_SBR_RDATA.NumStale;
+        }
+
+        return false;
+    }
+
+    if (NumDests > CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+    {
+        NumDests = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+    }
+
+    newptr           = routeptr->RetiredArrayPtr;
+    newptr->NumDests = NumDests;
+    if (NumDests > 0)
+    {
+        memcpy(newptr->Dests, Dests, NumDests * sizeof(newptr->Dests[0]));
+    }
+
+    /* Readers may still be scanning the old array, so it is only reused after their epoch ends */
+    routeptr->RetiredArrayPtr = routeptr->DestArrayPtr;
+    routeptr->RetiredDestPtr  = routeptr->RemovedDestPtr;
+    routeptr->RemovedDestPtr  = NULL;
+    routeptr->RetireEpoch     = CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.ReadEpoch);
+    routeptr->RetirePending   = true;
+    ++CFE_SBR_RDATA.NumPending;
+
+    if (routeptr->Stale)
+    {
+        routeptr->Stale = false;
+        --CFE_SBR_RDATA.NumStale;
+    }
+
+    CFE_ATOMIC_STORE(&routeptr->DestArrayPtr, newptr);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_IsDestArrayStale
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SBR_IsDestArrayStale(CFE_SBR_RouteId_t RouteId)
+{
+    bool stale = false;
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        stale = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].Stale;
+    }
+
+    return stale;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_SBR_IncrementSequenceCounter
@@ -181,15 +355,25 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
 {
     CFE_MSG_SequenceCount_t *cnt;
+    CFE_MSG_SequenceCount_t  oldcnt;
+    CFE_MSG_SequenceCount_t  newcnt = 0;
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        cnt  = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
-        *cnt = CFE_MSG_GetNextSequenceCount(*cnt);
+        cnt    = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        oldcnt = CFE_ATOMIC_LOAD(cnt);
+
+        /* Publishers are not serialized, retry if another one got in first */
+        do
+        {
+            newcnt = CFE_MSG_GetNextSequenceCount(oldcnt);
+        } while (!CFE_ATOMIC_CAS(cnt, &oldcnt, newcnt));
     }
+
+    return newcnt;
 }
 
 /*----------------------------------------------------------------
@@ -205,7 +389,7 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId)
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        seqcnt = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        seqcnt = CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt);
     }
 
     return seqcnt;
@@ -244,3 +428,117 @@ void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE
         (*CallbackPtr)(CFE_SBR_ValueToRouteId(routeidx), ArgPtr);
     }
 }
+
+/*----------------------------------------------------------------
+ * Function: CFE_SBR_ReadLock
+ * Internal helper routine only, not part of API.
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_ReadLock(void)
+{
+    uint32 token;
+
+    /*
+     * Register as a reader of the current epoch.  If a writer advanced the
+     * epoch in between it may already have checked this count, so back out
+     * and register again on the new epoch.
+     */
+    while (true)
+    {
+        token = CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.ReadEpoch) & 1;
+        CFE_ATOMIC_ADD(&CFE_SBR_RDATA.ReaderCount[token], 1);
+
+        /* Pairs with the fence in CFE_SBR_EpochElapsed(), one side always sees the other's store */
+        CFE_ATOMIC_FENCE();
+
+        if ((CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.ReadEpoch) & 1) == token)
+        {
+            break;
+        }
+
+        CFE_ATOMIC_SUB(&CFE_SBR_RDATA.ReaderCount[token], 1);
+    }
+
+    return token;
+}
+
+/*----------------------------------------------------------------
+ * Function: CFE_SBR_ReadUnlock
+ * Internal helper routine only, not part of API.
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ReadUnlock(uint32 Token)
+{
+    CFE_ATOMIC_SUB(&CFE_SBR_RDATA.ReaderCount[Token & 1], 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_GetReadEpoch
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_GetReadEpoch(void)
+{
+    return CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.ReadEpoch);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_EpochElapsed
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SBR_EpochElapsed(uint32 Epoch)
+{
+    uint32 current;
+
+    while ((int32)(Epoch - CFE_SBR_RDATA.DoneEpoch) > 0)
+    {
+        current = CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.ReadEpoch);
+
+        if (CFE_SBR_RDATA.DoneEpoch == current - 1)
+        {
+            /* New readers go to the other count, so only the ones already in need to leave */
+            CFE_ATOMIC_ADD(&CFE_SBR_RDATA.ReadEpoch, 1);
+            continue;
+        }
+
+        /*
+         * The epoch advance (and any array published before it) must be visible
+         * before the count is read, or a reader registering at the same time could
+         * be missed while it still sees the old epoch.  Pairs with CFE_SBR_ReadLock().
+         */
+        CFE_ATOMIC_FENCE();
+
+        if (CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.ReaderCount[(current - 1) & 1]) == 0)
+        {
+            CFE_SBR_RDATA.DoneEpoch = current - 1;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SBR_ReclaimDestArrays
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_ReclaimDestArrays(CFE_SBR_ReleaseDestPtr_t ReleaseFunc)
+{
+    CFE_SB_RouteId_Atom_t routeidx;
+
+    for (routeidx = 0; routeidx < CFE_SBR_RDATA.RouteIdxTop && CFE_SBR_RDATA.NumPending > 0; routeidx++)
+    {
+        CFE_SBR_ReclaimRoute(&CFE_SBR_RDATA.RoutingTbl[routeidx], ReleaseFunc);
+    }
+
+    return CFE_SBR_RDATA.NumStale;
+}
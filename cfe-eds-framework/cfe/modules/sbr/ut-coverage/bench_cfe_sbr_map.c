@@ -0,0 +1,170 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * SBR message map lookup benchmark
+ *
+ * Built once for each map implementation (see CMakeLists.txt).  Adds a route
+ * for each mission message id in the EDS database and reports the average
+ * time to look up a route that exists and one that does not, along with the
+ * memory used by the map.
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "uttest.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_mission_eds_msgid_phash.h"
+
+#include <time.h>
+
+/* The map implementation is part of this unit so its size is known */
+#include SBR_BENCH_MAP_SOURCE
+
+/*
+ * Defines
+ */
+
+/* Number of lookups timed for each case */
+#define SBR_BENCH_LOOKUPS 0x1000000
+
+/* Number of message ids in the lookup set, rounded up to a power of 2 */
+#define SBR_BENCH_SET_SIZE (1U << CFE_MISSION_MSGID_PHASH_BITS)
+
+/******************************************************************************
+ * Local helper to get the memory used by the map
+ */
+size_t Bench_SBR_MapFootprint(void)
+{
+    size_t Size = sizeof(CFE_SBR_MSGMAP);
+
+#ifdef CFE_SBR_MSG_DISP_SIZE
+    Size += sizeof(CFE_SBR_MSGKEYS) + sizeof(CFE_SBR_MSGDISP) + sizeof(CFE_SBR_MSGOVERFLOW);
+#endif
+
+    return Size;
+}
+
+/******************************************************************************
+ * Local helper to check if a key table entry is a mission message id
+ *
+ * Unused slots hold a value that does not hash to the slot.  This is the same
+ * hash as the perfect hash map, repeated here since not all maps include it.
+ */
+bool Bench_SBR_IsMissionSlot(CFE_SB_MsgIdValue_Atom_t Value, uint32 Slot)
+{
+    static const uint16 DispTable[1U << CFE_MISSION_MSGID_PHASH_DISP_BITS] = CFE_MISSION_MSGID_PHASH_DISP_TABLE_INIT;
+    uint32              Disp;
+
+    Disp = (uint32)(Value * CFE_MISSION_MSGID_PHASH_DISP_MULTIPLIER) >> (32 - CFE_MISSION_MSGID_PHASH_DISP_BITS);
+
+    return (((uint32)(Value * CFE_MISSION_MSGID_PHASH_MULTIPLIER) >> (32 - CFE_MISSION_MSGID_PHASH_BITS)) ^
+            DispTable[Disp]) == Slot;
+}
+
+/******************************************************************************
+ * Local helper to time lookups of a set of message ids, returns ns per lookup
+ */
+double Bench_SBR_TimeLookups(const CFE_SB_MsgId_t *MsgIdSet, uint32 SetCount, uint32 *FoundPtr)
+{
+    clock_t Start;
+    uint32  i;
+    uint32  Found = 0;
+
+    Start = clock();
+    for (i = 0; i < SBR_BENCH_LOOKUPS; i++)
+    {
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgIdSet[i & (SetCount - 1)])))
+        {
+            Found++;
+        }
+    }
+
+    *FoundPtr = Found;
+
+    return ((double)(clock() - Start) * 1e9) / ((double)CLOCKS_PER_SEC * SBR_BENCH_LOOKUPS);
+}
+
+void Bench_SBR_Map(void)
+{
+    static const CFE_SB_MsgIdValue_Atom_t KeyTable[SBR_BENCH_SET_SIZE] = CFE_MISSION_MSGID_PHASH_KEY_TABLE_INIT;
+    static CFE_SB_MsgId_t                 HitSet[SBR_BENCH_SET_SIZE];
+    static CFE_SB_MsgId_t                 MissSet[SBR_BENCH_SET_SIZE];
+    CFE_SB_MsgIdValue_Atom_t              Value;
+    uint32                                HitCount  = 0;
+    uint32                                MissCount = 0;
+    uint32                                Found;
+    uint32                                i;
+    double                                NsPerLookup;
+
+    CFE_SBR_Init();
+
+    /* Route every mission message id the map can hold */
+    for (i = 0; i < SBR_BENCH_SET_SIZE && HitCount < CFE_PLATFORM_SB_MAX_MSG_IDS; i++)
+    {
+        Value = KeyTable[i];
+        if (Value <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID && Bench_SBR_IsMissionSlot(Value, i))
+        {
+            HitSet[HitCount] = CFE_SB_ValueToMsgId(Value);
+            CFE_SBR_AddRoute(HitSet[HitCount], NULL);
+            HitCount++;
+        }
+    }
+
+    /* Message ids that have no route, taken from the ids just above the routed ones */
+    for (Value = 0; Value <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID && MissCount < SBR_BENCH_SET_SIZE; Value++)
+    {
+        if (!CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(Value))))
+        {
+            MissSet[MissCount] = CFE_SB_ValueToMsgId(Value);
+            MissCount++;
+        }
+    }
+
+    UtAssert_NONZERO(HitCount);
+    UtAssert_UINT32_EQ(MissCount, SBR_BENCH_SET_SIZE);
+
+    /* Repeat the set to fill the power of 2 that is indexed */
+    for (i = HitCount; i < SBR_BENCH_SET_SIZE; i++)
+    {
+        HitSet[i] = HitSet[i - HitCount];
+    }
+
+    UtPrintf("Map footprint: %lu bytes, %u routes", (unsigned long)Bench_SBR_MapFootprint(), (unsigned int)HitCount);
+
+    NsPerLookup = Bench_SBR_TimeLookups(HitSet, SBR_BENCH_SET_SIZE, &Found);
+    UtAssert_UINT32_EQ(Found, SBR_BENCH_LOOKUPS);
+    UtPrintf("Routed message id lookup: %.2f ns", NsPerLookup);
+
+    NsPerLookup = Bench_SBR_TimeLookups(MissSet, SBR_BENCH_SET_SIZE, &Found);
+    UtAssert_ZERO(Found);
+    UtPrintf("Unrouted message id lookup: %.2f ns", NsPerLookup);
+}
+
+/* Main benchmark routine */
+void UtTest_Setup(void)
+{
+    UtPrintf("Software Bus Routing map lookup benchmark: %s", SBR_BENCH_MAP_SOURCE);
+
+    UtTest_Add(Bench_SBR_Map, NULL, NULL, "Bench_SBR_Map");
+}
@@ -0,0 +1,123 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * Test SBR perfect hash message map implementation
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_mission_eds_msgid_phash.h"
+
+/*
+ * Defines
+ */
+#define CFE_SBR_MSG_MAP_SIZE (1U << CFE_MISSION_MSGID_PHASH_BITS)
+
+/*
+ * Map internals
+ */
+extern const CFE_SB_MsgIdValue_Atom_t CFE_SBR_MSGKEYS[CFE_SBR_MSG_MAP_SIZE];
+uint32                                CFE_SBR_MsgIdPerfectHash(CFE_SB_MsgIdValue_Atom_t MsgIdValue);
+
+/******************************************************************************
+ * Local helper to find a message id that is not in the mission database
+ */
+CFE_SB_MsgId_t Test_SBR_NonMissionMsgId(CFE_SB_MsgIdValue_Atom_t Start)
+{
+    while (CFE_SBR_MSGKEYS[CFE_SBR_MsgIdPerfectHash(Start)] == Start)
+    {
+        Start++;
+    }
+
+    return CFE_SB_ValueToMsgId(Start);
+}
+
+void Test_SBR_Map_PerfectHash(void)
+{
+    CFE_SB_MsgIdValue_Atom_t value;
+    CFE_SBR_RouteId_t        routeid[3];
+    CFE_SB_MsgId_t           msgid[3];
+    uint32                   slot;
+    uint32                   count;
+    uint32                   collisions;
+
+    UtPrintf("Invalid msg checks");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(CFE_SB_ValueToMsgId(0), CFE_SBR_ValueToRouteId(0)), 0);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(0))));
+
+    UtPrintf("Initialize routing and map");
+    CFE_SBR_Init();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Check the generated table holds every mission message id once, all without a route");
+    count    = 0;
+    msgid[0] = CFE_SB_INVALID_MSG_ID;
+    for (slot = 0; slot < CFE_SBR_MSG_MAP_SIZE; slot++)
+    {
+        value = CFE_SBR_MSGKEYS[slot];
+        if (CFE_SBR_MsgIdPerfectHash(value) == slot)
+        {
+            count++;
+            msgid[0] = CFE_SB_ValueToMsgId(value);
+            UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+        }
+    }
+    UtAssert_UINT32_EQ(count, CFE_MISSION_MSGID_PHASH_KEY_COUNT);
+
+    /* Note AddRoute required for hash logic to work since it depends on MsgId in routing table */
+    UtPrintf("Add a mission route and two that use the overflow list");
+    msgid[1]   = Test_SBR_NonMissionMsgId(0);
+    msgid[2]   = Test_SBR_NonMissionMsgId(CFE_SB_MsgIdToValue(msgid[1]) + 1);
+    routeid[0] = CFE_SBR_AddRoute(msgid[0], &collisions);
+    UtAssert_INT32_EQ(collisions, 0);
+    routeid[1] = CFE_SBR_AddRoute(msgid[1], &collisions);
+    UtAssert_INT32_EQ(collisions, 0);
+    routeid[2] = CFE_SBR_AddRoute(msgid[2], &collisions);
+    UtAssert_INT32_EQ(collisions, 1);
+
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[0])), CFE_SBR_RouteIdToValue(routeid[0]));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[1])), CFE_SBR_RouteIdToValue(routeid[1]));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[2])), CFE_SBR_RouteIdToValue(routeid[2]));
+
+    UtPrintf("Message id without a route is not found in the overflow list");
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(
+        CFE_SBR_GetRouteId(Test_SBR_NonMissionMsgId(CFE_SB_MsgIdToValue(msgid[2]) + 1))));
+
+    UtPrintf("Setting an overflow route again replaces it");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[2], routeid[2]), 1);
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[2])), CFE_SBR_RouteIdToValue(routeid[2]));
+}
+
+/* Main unit test routine */
+void UtTest_Setup(void)
+{
+    UT_Init("map_phash");
+    UtPrintf("Software Bus Routing perfect hash map coverage test...");
+
+    UT_ADD_TEST(Test_SBR_Map_PerfectHash);
+}
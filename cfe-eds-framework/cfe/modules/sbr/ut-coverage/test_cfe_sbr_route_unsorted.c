@@ -29,6 +29,8 @@
 #include "ut_support.h"
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
+#include "cfe_core_atomic.h"
+#include <string.h>
 
 /* Callback function for testing */
 void Test_SBR_Callback(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
@@ -132,7 +134,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
         UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[i]), NULL);
         UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[i]), 0);
         UtAssert_VOIDCALL(CFE_SBR_SetDestListHeadPtr(routeid[i], NULL));
-        UtAssert_VOIDCALL(CFE_SBR_IncrementSequenceCounter(routeid[i]));
+        UtAssert_INT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[i]), 0);
     }
 
     /*
@@ -174,7 +176,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
     for (i = 0; i < 3; i++)
     {
         UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(msgid[i], CFE_SBR_GetMsgId(routeid[i])));
-        CFE_SBR_IncrementSequenceCounter(routeid[0]);
+        UtAssert_UINT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[0]), seqcntexpected[0]);
     }
     UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 3);
 
@@ -194,6 +196,171 @@ void Test_SBR_Route_Unsort_GetSet(void)
     UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest[0]);
 }
 
+/* Destinations passed to the release callback */
+static CFE_SB_DestinationD_t *Test_SBR_ReleasedDest[3];
+static uint32                 Test_SBR_ReleaseCount;
+
+/* Release callback for testing */
+static void Test_SBR_ReleaseDest(CFE_SB_DestinationD_t *DestPtr)
+{
+    if (Test_SBR_ReleaseCount < 3)
+    {
+        Test_SBR_ReleasedDest[Test_SBR_ReleaseCount] = DestPtr;
+    }
+
+    Test_SBR_ReleaseCount++;
+}
+
+void Test_SBR_Route_Unsort_DestArray(void)
+{
+    CFE_SBR_RouteId_t          routeid[2];
+    CFE_SB_DestinationD_t      dest[2];
+    CFE_SB_DestinationEntry_t  entries[CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1];
+    const CFE_SBR_DestArray_t *arrayptr[2];
+    uint32                     token;
+    uint32                     i;
+
+    memset(entries, 0, sizeof(entries));
+    memset(dest, 0, sizeof(dest));
+    for (i = 0; i < 2; i++)
+    {
+        entries[i].DestPtr = &dest[i];
+    }
+
+    Test_SBR_ReleaseCount = 0;
+
+    UtPrintf("Invalid route ID checks");
+    UtAssert_NULL(CFE_SBR_GetDestArray(CFE_SBR_INVALID_ROUTE_ID));
+    UtAssert_BOOL_FALSE(CFE_SBR_SetDestArray(CFE_SBR_INVALID_ROUTE_ID, entries, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsDestArrayStale(CFE_SBR_INVALID_ROUTE_ID));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+    CFE_SBR_Init();
+
+    routeid[0] = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(0), NULL);
+    routeid[1] = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(1), NULL);
+
+    UtPrintf("Routes start with distinct empty arrays and none stale");
+    arrayptr[0] = CFE_SBR_GetDestArray(routeid[0]);
+    arrayptr[1] = CFE_SBR_GetDestArray(routeid[1]);
+    UtAssert_NOT_NULL(arrayptr[0]);
+    UtAssert_ZERO(arrayptr[0]->NumDests);
+    UtAssert_ZERO(arrayptr[1]->NumDests);
+    UtAssert_BOOL_TRUE(arrayptr[0] != arrayptr[1]);
+    UtAssert_ZERO((cpuaddr)arrayptr[0] % CFE_CACHE_LINE_SIZE);
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+
+    UtPrintf("Set publishes a new copy and leaves other routes alone");
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 2, NULL, Test_SBR_ReleaseDest));
+    UtAssert_BOOL_TRUE(CFE_SBR_GetDestArray(routeid[0]) != arrayptr[0]);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestArray(routeid[1]), arrayptr[1]);
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(routeid[0])->NumDests, 2);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestArray(routeid[0])->Dests[1].DestPtr, &dest[1]);
+
+    UtPrintf("Previous array of the route is reused once reclaimed");
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestArray(routeid[0]), arrayptr[0]);
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(routeid[0])->NumDests, 1);
+    UtAssert_ZERO(Test_SBR_ReleaseCount);
+
+    UtPrintf("Removed destination is released with the previous array");
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 1, &dest[0], Test_SBR_ReleaseDest));
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_UINT32_EQ(Test_SBR_ReleaseCount, 1);
+    UtAssert_ADDRESS_EQ(Test_SBR_ReleasedDest[0], &dest[0]);
+
+    UtPrintf("Route is left stale while a reader may use its retired array");
+    token = CFE_SBR_ReadLock();
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 0, &dest[1], Test_SBR_ReleaseDest));
+    UtAssert_BOOL_FALSE(CFE_SBR_SetDestArray(routeid[0], entries, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsDestArrayStale(routeid[0]));
+    UtAssert_ZERO(CFE_SBR_GetDestArray(routeid[0])->NumDests);
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[1], entries, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsDestArrayStale(routeid[1]));
+    UtAssert_UINT32_EQ(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest), 1);
+    UtAssert_UINT32_EQ(Test_SBR_ReleaseCount, 1);
+    CFE_SBR_ReadUnlock(token);
+    UtAssert_UINT32_EQ(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest), 1);
+    UtAssert_UINT32_EQ(Test_SBR_ReleaseCount, 2);
+    UtAssert_ADDRESS_EQ(Test_SBR_ReleasedDest[1], &dest[1]);
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsDestArrayStale(routeid[0]));
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(routeid[0])->NumDests, 1);
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+
+    UtPrintf("Destination removed while stale is kept until the array after it is reclaimed");
+    token = CFE_SBR_ReadLock();
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 2, NULL, Test_SBR_ReleaseDest));
+    UtAssert_BOOL_FALSE(CFE_SBR_SetDestArray(routeid[0], entries, 1, &dest[1], Test_SBR_ReleaseDest));
+    CFE_SBR_ReadUnlock(token);
+    UtAssert_UINT32_EQ(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest), 1);
+    UtAssert_UINT32_EQ(Test_SBR_ReleaseCount, 2);
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], entries, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_UINT32_EQ(Test_SBR_ReleaseCount, 3);
+    UtAssert_ADDRESS_EQ(Test_SBR_ReleasedDest[2], &dest[1]);
+
+    UtPrintf("Entry count is limited and may be cleared");
+    UtAssert_BOOL_TRUE(
+        CFE_SBR_SetDestArray(routeid[0], entries, CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_UINT32_EQ(CFE_SBR_GetDestArray(routeid[0])->NumDests, CFE_PLATFORM_SB_MAX_DEST_PER_PKT);
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid[0], NULL, 0, NULL, Test_SBR_ReleaseDest));
+    UtAssert_ZERO(CFE_SBR_GetDestArray(routeid[0])->NumDests);
+}
+
+void Test_SBR_Route_Unsort_ReadLock(void)
+{
+    CFE_SBR_RouteId_t         routeid;
+    CFE_SB_DestinationD_t     dest;
+    CFE_SB_DestinationEntry_t entry;
+    uint32                    token[2];
+    uint32                    epoch;
+
+    memset(&entry, 0, sizeof(entry));
+    memset(&dest, 0, sizeof(dest));
+    entry.DestPtr         = &dest;
+    Test_SBR_ReleaseCount = 0;
+
+    UtPrintf("Initialize map and route");
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+    CFE_SBR_Init();
+    routeid = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(0), NULL);
+
+    UtPrintf("Nested read sections");
+    token[0] = CFE_SBR_ReadLock();
+    token[1] = CFE_SBR_ReadLock();
+    UtAssert_UINT32_EQ(token[0], token[1]);
+    CFE_SBR_ReadUnlock(token[1]);
+    CFE_SBR_ReadUnlock(token[0]);
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid, &entry, 1, NULL, Test_SBR_ReleaseDest));
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_BOOL_TRUE(CFE_SBR_EpochElapsed(CFE_SBR_GetReadEpoch()));
+
+    UtPrintf("Reclaim waits for a reader of the retire epoch");
+    token[0] = CFE_SBR_ReadLock();
+    UtAssert_BOOL_TRUE(CFE_SBR_SetDestArray(routeid, &entry, 0, &dest, Test_SBR_ReleaseDest));
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_ZERO(Test_SBR_ReleaseCount);
+    epoch = CFE_SBR_GetReadEpoch();
+    UtAssert_BOOL_FALSE(CFE_SBR_EpochElapsed(epoch));
+
+    UtPrintf("Readers after the epoch change are not waited on");
+    token[1] = CFE_SBR_ReadLock();
+    UtAssert_UINT32_EQ(token[1], token[0] ^ 1);
+    CFE_SBR_ReadUnlock(token[0]);
+    UtAssert_ZERO(CFE_SBR_ReclaimDestArrays(Test_SBR_ReleaseDest));
+    UtAssert_UINT32_EQ(Test_SBR_ReleaseCount, 1);
+    UtAssert_ADDRESS_EQ(Test_SBR_ReleasedDest[0], &dest);
+
+    UtPrintf("Readers entered in the epoch read are waited on");
+    UtAssert_BOOL_FALSE(CFE_SBR_EpochElapsed(epoch));
+    CFE_SBR_ReadUnlock(token[1]);
+    UtAssert_BOOL_TRUE(CFE_SBR_EpochElapsed(epoch));
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -202,4 +369,6 @@ void UtTest_Setup(void)
 
     UT_ADD_TEST(Test_SBR_Route_Unsort_General);
     UT_ADD_TEST(Test_SBR_Route_Unsort_GetSet);
+    UT_ADD_TEST(Test_SBR_Route_Unsort_DestArray);
+    UT_ADD_TEST(Test_SBR_Route_Unsort_ReadLock);
 }
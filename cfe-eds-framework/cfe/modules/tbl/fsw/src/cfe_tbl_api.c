@@ -328,9 +328,11 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* Initialize the Table Access Descriptor */
                     AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
-                    AccessDescPtr->AppId    = ThisAppId;
-                    AccessDescPtr->LockFlag = false;
-                    AccessDescPtr->Updated  = false;
+                    AccessDescPtr->AppId         = ThisAppId;
+                    AccessDescPtr->LockFlag      = false;
+                    AccessDescPtr->Updated       = false;
+                    AccessDescPtr->PinFlag       = false;
+                    AccessDescPtr->PinGeneration = 0;
 
                     if ((RegRecPtr->DumpOnly) && (!RegRecPtr->UserDefAddr))
                     {
@@ -476,6 +478,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* By making it the last step, other APIs do not have to lock registry */
                     /* to share the table or get its address because registry entries that */
                     /* are unowned are not checked to see if they match names, etc.        */
+                    CFE_TBL_AddRegistryName(RegIndx);
                     RegRecPtr->OwnerAppId = ThisAppId;
                 }
             }
@@ -554,9 +557,11 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
                 /* Initialize the Table Access Descriptor */
                 AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
-                AccessDescPtr->AppId    = ThisAppId;
-                AccessDescPtr->LockFlag = false;
-                AccessDescPtr->Updated  = false;
+                AccessDescPtr->AppId         = ThisAppId;
+                AccessDescPtr->LockFlag      = false;
+                AccessDescPtr->Updated       = false;
+                AccessDescPtr->PinFlag       = false;
+                AccessDescPtr->PinGeneration = 0;
 
                 /* Check current state of table in order to set Notification flags properly */
                 if (RegRecPtr->TableLoadedOnce)
@@ -639,7 +644,10 @@ CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
             /* NOTE: Allocated memory is freed when all Access Links have been    */
             /*       removed.  This allows Applications to continue to use the    */
             /*       data until they acknowledge that the table has been removed. */
+            CFE_TBL_LockRegistry();
             RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+            CFE_TBL_RemoveRegistryName(AccessDescPtr->RegIndex);
+            CFE_TBL_UnlockRegistry();
 
             /* Remove Table Name */
             RegRecPtr->Name[0] = '\0';
@@ -1143,6 +1151,109 @@ CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t T
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_PinAddress
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_PinAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    int32                       Status;
+    uint32                      Generation;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+
+    if (TblPtr == NULL)
+    {
+        return CFE_TBL_BAD_ARGUMENT;
+    }
+
+    /* Assume failure at returning the table address */
+    *TblPtr = NULL;
+
+    /* Check table handle validity */
+    Status = CFE_TBL_ValidateHandle(TblHandle);
+
+    if (Status == CFE_SUCCESS)
+    {
+        AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
+        RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+        if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED))
+        {
+            Status = CFE_TBL_ERR_UNREGISTERED;
+
+            CFE_ES_WriteToSysLog("%s: Attempt to pin unowned Tbl Handle=%d\n", __func__, (int)TblHandle);
+        }
+        else if (!RegRecPtr->DoubleBuffered)
+        {
+            Status = CFE_TBL_ERR_NOT_DOUBLE_BUFFERED;
+
+            CFE_ES_WriteToSysLog("%s: Attempt to pin single buffered Tbl Handle=%d\n", __func__, (int)TblHandle);
+        }
+        else
+        {
+            /* A pin already held through this handle is replaced by the new one */
+            CFE_TBL_UnpinBuffer(AccessDescPtr);
+
+            AccessDescPtr->PinBufferIndex = CFE_TBL_PinActiveBuffer(RegRecPtr);
+            AccessDescPtr->PinFlag        = true;
+
+            *TblPtr = RegRecPtr->Buffers[AccessDescPtr->PinBufferIndex].BufferPtr;
+
+            /* Report an update once for each generation published since the last pin */
+            Generation = CFE_ATOMIC_LOAD(&RegRecPtr->Generation);
+
+            if (!RegRecPtr->TableLoadedOnce)
+            {
+                Status = CFE_TBL_ERR_NEVER_LOADED;
+            }
+            else if (Generation != AccessDescPtr->PinGeneration)
+            {
+                AccessDescPtr->PinGeneration = Generation;
+
+                Status = CFE_TBL_INFO_UPDATED;
+            }
+        }
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("%s: Invalid Tbl Handle=%d\n", __func__, (int)TblHandle);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_UnpinAddress
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_UnpinAddress(CFE_TBL_Handle_t TblHandle)
+{
+    int32 Status;
+
+    /* Check table handle validity */
+    Status = CFE_TBL_ValidateHandle(TblHandle);
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_TBL_UnpinBuffer(&CFE_TBL_Global.Handles[TblHandle]);
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("%s: Invalid Tbl Handle=%d\n", __func__, (int)TblHandle);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_Validate
@@ -344,6 +344,9 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
         }
     }
 
+    /* Release any buffer still pinned through the handle */
+    CFE_TBL_UnpinBuffer(AccessDescPtr);
+
     /* Return the Access Descriptor to the pool */
     AccessDescPtr->UsedFlag = false;
 
@@ -496,6 +499,62 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_PinActiveBuffer
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint8 CFE_TBL_PinActiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    uint8 BufferIndex;
+    uint8 ActiveIndex;
+
+    ActiveIndex = CFE_ATOMIC_LOAD(&RegRecPtr->ActiveBufferIndex);
+
+    /*
+     * Count this reader against the active buffer, then confirm the buffer was not
+     * swapped before the count was visible.  An update that swapped it afterwards
+     * sees the count when it next looks for an inactive buffer to load into.
+     */
+    do
+    {
+        BufferIndex = ActiveIndex;
+        CFE_ATOMIC_ADD(&RegRecPtr->PinCount[BufferIndex], 1);
+
+        ActiveIndex = CFE_ATOMIC_LOAD(&RegRecPtr->ActiveBufferIndex);
+        if (ActiveIndex != BufferIndex)
+        {
+            CFE_ATOMIC_SUB(&RegRecPtr->PinCount[BufferIndex], 1);
+        }
+    } while (ActiveIndex != BufferIndex);
+
+    return BufferIndex;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_UnpinBuffer
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_UnpinBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+
+    if (AccessDescPtr->PinFlag)
+    {
+        RegRecPtr = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+        AccessDescPtr->PinFlag = false;
+        CFE_ATOMIC_SUB(&RegRecPtr->PinCount[AccessDescPtr->PinBufferIndex], 1);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_FindTableInRegistry
@@ -506,29 +565,156 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
  *-----------------------------------------------------------------*/
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i       = -1;
+    int16  RegIndx = CFE_TBL_NOT_FOUND;
+    int16  i;
+    uint32 Hash;
+    uint32 SlotPos;
+    uint32 SlotCount;
+    uint16 SlotEntry;
 
-    do
+    /* Search the probe run of the name in the registry name index */
+    Hash      = CFE_TBL_ComputeNameHash(TblName);
+    SlotPos   = Hash % CFE_TBL_REG_NAME_SLOTS;
+    SlotCount = 0;
+
+    while ((RegIndx == CFE_TBL_NOT_FOUND) && (SlotCount < CFE_TBL_REG_NAME_SLOTS))
     {
-        /* Point to next record in the Table Registry */
-        i++;
+        SlotEntry = CFE_TBL_Global.RegNameSlots[SlotPos];
 
-        /* Check to see if the record is currently being used */
-        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
+        /* An empty slot ends the probe run */
+        if (SlotEntry == CFE_TBL_REG_NAME_SLOT_EMPTY)
         {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
+            break;
+        }
+
+        if (SlotEntry != CFE_TBL_REG_NAME_SLOT_REMOVED)
+        {
+            i = SlotEntry - 1;
+
+            /* Check to see if the record is currently being used */
+            if (CFE_TBL_Global.RegNameHash[i] == Hash &&
+                !CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
             {
-                /* If the names match, then return the index */
-                RegIndx = i;
+                /* Perform a case sensitive name comparison */
+                if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
+                {
+                    /* If the names match, then return the index */
+                    RegIndx = i;
+                }
             }
         }
-    } while ((RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1)));
+
+        SlotPos = (SlotPos + 1) % CFE_TBL_REG_NAME_SLOTS;
+        ++SlotCount;
+    }
 
     return RegIndx;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_ComputeNameHash
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_TBL_ComputeNameHash(const char *TblName)
+{
+    uint32 Hash = 2166136261U;
+
+    while (*TblName != '\0')
+    {
+        Hash ^= (uint8)*TblName;
+        Hash *= 16777619U;
+        ++TblName;
+    }
+
+    /* Zero marks registry entries that are not indexed */
+    if (Hash == 0)
+    {
+        Hash = 1;
+    }
+
+    return Hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_AddRegistryName
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_AddRegistryName(int16 RegIndx)
+{
+    uint32 Hash;
+    uint32 SlotPos;
+    uint16 SlotEntry;
+
+    CFE_TBL_RemoveRegistryName(RegIndx);
+
+    Hash    = CFE_TBL_ComputeNameHash(CFE_TBL_Global.Registry[RegIndx].Name);
+    SlotPos = Hash % CFE_TBL_REG_NAME_SLOTS;
+
+    /* There are more slots than registry entries, so there is always a free one */
+    SlotEntry = CFE_TBL_Global.RegNameSlots[SlotPos];
+    while ((SlotEntry != CFE_TBL_REG_NAME_SLOT_EMPTY) && (SlotEntry != CFE_TBL_REG_NAME_SLOT_REMOVED))
+    {
+        SlotPos   = (SlotPos + 1) % CFE_TBL_REG_NAME_SLOTS;
+        SlotEntry = CFE_TBL_Global.RegNameSlots[SlotPos];
+    }
+
+    /* Set the hash before the slot, so lookups never see the slot without it */
+    CFE_TBL_Global.RegNameHash[RegIndx]  = Hash;
+    CFE_TBL_Global.RegNameSlots[SlotPos] = RegIndx + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_RemoveRegistryName
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RemoveRegistryName(int16 RegIndx)
+{
+    uint32 SlotPos;
+
+    if (CFE_TBL_Global.RegNameHash[RegIndx] == 0)
+    {
+        return;
+    }
+
+    SlotPos = CFE_TBL_Global.RegNameHash[RegIndx] % CFE_TBL_REG_NAME_SLOTS;
+    while (CFE_TBL_Global.RegNameSlots[SlotPos] != (RegIndx + 1))
+    {
+        SlotPos = (SlotPos + 1) % CFE_TBL_REG_NAME_SLOTS;
+    }
+
+    CFE_TBL_Global.RegNameHash[RegIndx] = 0;
+
+    /*
+     * The slot is only emptied at the end of a probe run, together with the removed
+     * slots before it.  Elsewhere it is marked as removed, so that lookups running
+     * without the lock still reach the entries after it.
+     */
+    if (CFE_TBL_Global.RegNameSlots[(SlotPos + 1) % CFE_TBL_REG_NAME_SLOTS] == CFE_TBL_REG_NAME_SLOT_EMPTY)
+    {
+        do
+        {
+            CFE_TBL_Global.RegNameSlots[SlotPos] = CFE_TBL_REG_NAME_SLOT_EMPTY;
+            SlotPos                              = (SlotPos + CFE_TBL_REG_NAME_SLOTS - 1) % CFE_TBL_REG_NAME_SLOTS;
+        } while (CFE_TBL_Global.RegNameSlots[SlotPos] == CFE_TBL_REG_NAME_SLOT_REMOVED);
+    }
+    else
+    {
+        CFE_TBL_Global.RegNameSlots[SlotPos] = CFE_TBL_REG_NAME_SLOT_REMOVED;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_FindFreeRegistryEntry
@@ -723,6 +909,14 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                 /* Determine the index of the Inactive Buffer Pointer */
                 InactiveBufferIndex = 1 - RegRecPtr->ActiveBufferIndex;
 
+                /* Readers that pinned the buffer before it became inactive may still be using it */
+                if (CFE_ATOMIC_LOAD(&RegRecPtr->PinCount[InactiveBufferIndex]) != 0)
+                {
+                    Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+                    CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Pinned for '%s'\n", __func__, RegRecPtr->Name);
+                }
+
                 /* Scan the access descriptor table to determine if anyone is still using the inactive buffer */
                 AccessIterator = RegRecPtr->HeadOfAccessList;
                 while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
@@ -1151,7 +1345,8 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
         if (RegRecPtr->DoubleBuffered)
         {
             /* To update a double buffered table only requires a pointer swap */
-            RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+            /* The swap is published to readers that pin the active buffer without locking */
+            CFE_ATOMIC_STORE(&RegRecPtr->ActiveBufferIndex, (uint8)RegRecPtr->LoadInProgress);
 
             /* Source description in buffer should already have been updated by either */
             /* the LoadFromFile function or the Load function (when a memory load).    */
@@ -1248,7 +1443,12 @@ void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr)
     /* Clear notification of pending load (as well as NO LOAD) and notify everyone of update */
     RegRecPtr->LoadPending     = false;
     RegRecPtr->TableLoadedOnce = true;
-    AccessIterator             = RegRecPtr->HeadOfAccessList;
+
+    /* Start a new generation for readers that pin the table.  This also orders a */
+    /* buffer swap ahead of any later check of the pin counts on the old buffer.  */
+    CFE_ATOMIC_ADD(&RegRecPtr->Generation, 1);
+
+    AccessIterator = RegRecPtr->HeadOfAccessList;
     while (AccessIterator != CFE_TBL_END_OF_LIST)
     {
         CFE_TBL_Global.Handles[AccessIterator].Updated = true;
@@ -1465,7 +1665,10 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
                 /* NOTE: Allocated memory is freed when all Access Links have been    */
                 /*       removed.  This allows Applications to continue to use the    */
                 /*       data until they acknowledge that the table has been removed. */
+                CFE_TBL_LockRegistry();
                 RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+                CFE_TBL_RemoveRegistryName(AccessDescPtr->RegIndex);
+                CFE_TBL_UnlockRegistry();
 
                 /* Remove Table Name */
                 RegRecPtr->Name[0] = '\0';
@@ -192,6 +192,40 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
 */
 int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Pins the active buffer of a table
+**
+** \par Description
+**        Counts a reader against the active buffer of the table and returns the
+**        index of the buffer.  The count is taken without the registry lock and
+**        prevents the buffer from being reused as a working buffer while it is held.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: The pin must be released with #CFE_TBL_UnpinBuffer
+**
+** \param[in]  RegRecPtr Pointer to Registry Record of the table to pin.
+**
+** \return Index of the pinned buffer
+**
+*/
+uint8 CFE_TBL_PinActiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Releases the table buffer pinned through an access descriptor
+**
+** \par Description
+**        Releases the pin taken through the access descriptor, if any.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the access descriptor belongs to a valid handle.
+**
+** \param[in]  AccessDescPtr Pointer to the access descriptor holding the pin.
+**
+*/
+void CFE_TBL_UnpinBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Returns the Registry Index for the specified Table Name
@@ -225,6 +259,55 @@ int16 CFE_TBL_FindTableInRegistry(const char *TblName);
 */
 int16 CFE_TBL_FindFreeRegistryEntry(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Computes the hash of a Table Name for the Table Registry name index
+**
+** \par Description
+**        Computes the FNV-1a hash of the given Table Name.
+**
+** \par Assumptions, External Events, and Notes:
+**        The hash is never zero, which marks registry entries that are not indexed.
+**
+** \param[in]  TblName - Pointer to character string containing complete
+**                       Table Name (of the format "AppName.TblName").
+**
+** \returns Hash of the Table Name
+*/
+uint32 CFE_TBL_ComputeNameHash(const char *TblName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Adds a Table Registry entry to the registry name index
+**
+** \par Description
+**        Adds the name of the given Table Registry entry to the name index,
+**        so that #CFE_TBL_FindTableInRegistry can find it.  If the entry
+**        was already in the index, it is first removed.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**        The name must be stored in the entry before it is added.
+**
+** \param[in]  RegIndx - Index of the Table Registry entry
+*/
+void CFE_TBL_AddRegistryName(int16 RegIndx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Removes a Table Registry entry from the registry name index
+**
+** \par Description
+**        Removes the given Table Registry entry from the name index.
+**        Nothing is done if the entry is not in the index.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  RegIndx - Index of the Table Registry entry
+*/
+void CFE_TBL_RemoveRegistryName(int16 RegIndx);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Locates a free Access Descriptor in the Table Handles Array.
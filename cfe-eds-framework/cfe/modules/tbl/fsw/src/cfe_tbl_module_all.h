@@ -38,6 +38,7 @@
 #include "cfe_platform_cfg.h"
 #include "cfe_msgids.h"
 #include "cfe_perfids.h"
+#include "cfe_core_atomic.h"
 
 #include "cfe_tbl_core_internal.h"
 
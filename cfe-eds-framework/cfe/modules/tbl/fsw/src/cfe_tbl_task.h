@@ -78,6 +78,19 @@
 */
 #define CFE_TBL_NO_DUMP_PENDING (-1)
 
+/** \brief Number of slots in the Table Registry name index */
+/**
+**  The index has twice as many slots as there are registry entries, see
+**  #CFE_TBL_Global_t::RegNameSlots
+*/
+#define CFE_TBL_REG_NAME_SLOTS (2 * CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+
+/** \brief Value of a Table Registry name index slot that has never been used */
+#define CFE_TBL_REG_NAME_SLOT_EMPTY 0
+
+/** \brief Value of a Table Registry name index slot whose entry has been removed */
+#define CFE_TBL_REG_NAME_SLOT_REMOVED 0xFFFF
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -155,14 +168,17 @@ typedef struct
 */
 typedef struct
 {
-    CFE_ES_AppId_t   AppId;       /**< \brief Application ID to verify access */
-    int16            RegIndex;    /**< \brief Index into Table Registry (a.k.a. - Global Table #) */
-    CFE_TBL_Handle_t PrevLink;    /**< \brief Index of previous access descriptor in linked list */
-    CFE_TBL_Handle_t NextLink;    /**< \brief Index of next access descriptor in linked list */
-    bool             UsedFlag;    /**< \brief Indicates whether this descriptor is being used or not  */
-    bool             LockFlag;    /**< \brief Indicates whether thread is currently accessing table data */
-    bool             Updated;     /**< \brief Indicates table has been updated since last GetAddress call */
-    uint8            BufferIndex; /**< \brief Index of buffer currently being used */
+    CFE_ES_AppId_t   AppId;          /**< \brief Application ID to verify access */
+    int16            RegIndex;       /**< \brief Index into Table Registry (a.k.a. - Global Table #) */
+    CFE_TBL_Handle_t PrevLink;       /**< \brief Index of previous access descriptor in linked list */
+    CFE_TBL_Handle_t NextLink;       /**< \brief Index of next access descriptor in linked list */
+    bool             UsedFlag;       /**< \brief Indicates whether this descriptor is being used or not  */
+    bool             LockFlag;       /**< \brief Indicates whether thread is currently accessing table data */
+    bool             Updated;        /**< \brief Indicates table has been updated since last GetAddress call */
+    uint8            BufferIndex;    /**< \brief Index of buffer currently being used */
+    bool             PinFlag;        /**< \brief Indicates whether a table buffer is pinned through this handle */
+    uint8            PinBufferIndex; /**< \brief Index of buffer pinned through this handle */
+    uint32           PinGeneration;  /**< \brief Table generation seen by the last pin through this handle */
 } CFE_TBL_AccessDescriptor_t;
 
 /*******************************************************************************/
@@ -195,9 +211,11 @@ typedef struct
     bool               UserDefAddr;     /**< \brief Flag indicating Table address was defined by Owner Application */
     bool               NotifyByMsg;     /**< \brief Flag indicating Table Services should notify owning App via message
                                                     when table requires management */
-    uint8 ActiveBufferIndex;            /**< \brief Index identifying which buffer is the active buffer */
-    char  Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
-    char  LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
+    uint8  ActiveBufferIndex;               /**< \brief Index identifying which buffer is the active buffer */
+    uint32 Generation;                      /**< \brief Number of updates published to the table */
+    uint32 PinCount[2];                     /**< \brief Number of handles pinning each buffer */
+    char   Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
+    char   LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
 } CFE_TBL_RegistryRec_t;
 
 /*******************************************************************************/
@@ -331,6 +349,15 @@ typedef struct
     */
     CFE_TBL_AccessDescriptor_t Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Array of Access Descriptors */
     CFE_TBL_RegistryRec_t      Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Array of Table Registry Records */
+
+    /*
+    ** Registry name index, updated while the registry is locked.  Each slot holds
+    ** a registry index plus one, probed linearly from the name hash.  Removed entries
+    ** leave a marker in their slot, so lookups without the lock never lose an entry.
+    */
+    uint16 RegNameSlots[CFE_TBL_REG_NAME_SLOTS];         /**< \brief Registry name index slots */
+    uint32 RegNameHash[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Name hash of each indexed registry entry, 0 if
+                                                               not indexed */
     CFE_TBL_CritRegRec_t
         CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
     CFE_TBL_BufParams_t Buf; /**< \brief Parameters associated with Table Task's Memory Pool */
@@ -45,6 +45,10 @@
 #error CFE_PLATFORM_TBL_MAX_NUM_HANDLES cannot be set less than CFE_PLATFORM_TBL_MAX_NUM_TABLES!
 #endif
 
+#if CFE_PLATFORM_TBL_MAX_NUM_TABLES > 32767
+#error CFE_PLATFORM_TBL_MAX_NUM_TABLES cannot be greater than 32767!
+#endif
+
 #if CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES > CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES
 #error CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES cannot be greater than CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES!
 #endif
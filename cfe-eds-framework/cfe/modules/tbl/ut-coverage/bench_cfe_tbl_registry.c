@@ -0,0 +1,233 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * Table registry benchmark
+ *
+ * Registers tables until the registry is full, reporting the average time of
+ * a register, share and activate command as the registry fills up.  The registry
+ * lookup is also timed against a linear scan of the same registry.  The cFE
+ * services used by table services are stubs, so the times include stub calls.
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "uttest.h"
+#include "ut_support.h"
+#include "cfe_tbl_module_all.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/*
+ * Defines
+ */
+
+/* Size of the benchmark tables */
+#define TBL_BENCH_TABLE_SIZE 16
+
+/* Number of tables registered between reports */
+#define TBL_BENCH_STEP (CFE_PLATFORM_TBL_MAX_NUM_TABLES / 8)
+
+/* Number of activate commands timed at each step */
+#define TBL_BENCH_COMMANDS 0x4000
+
+/* Number of registry lookups timed with the full registry */
+#define TBL_BENCH_LOOKUPS 0x100000
+
+/* Memory for the table buffers, given to the pool stub */
+static union
+{
+    CFE_ES_PoolAlign_t Align;
+    uint8              Bytes[CFE_PLATFORM_TBL_MAX_NUM_TABLES * (TBL_BENCH_TABLE_SIZE + 64)];
+} Bench_TBL_PoolBuffer;
+
+static CFE_TBL_Handle_t Bench_TBL_Handles[CFE_PLATFORM_TBL_MAX_NUM_TABLES];
+
+/******************************************************************************
+ * Local helper returning the time since Start in ns, divided by Count
+ */
+double Bench_TBL_Elapsed(clock_t Start, uint32 Count)
+{
+    return ((double)(clock() - Start) * 1e9) / ((double)CLOCKS_PER_SEC * Count);
+}
+
+/******************************************************************************
+ * Linear scan of the registry, as done before the registry had a name index
+ */
+int16 Bench_TBL_LinearFind(const char *TblName)
+{
+    int16 RegIndx = CFE_TBL_NOT_FOUND;
+    int16 i       = -1;
+
+    do
+    {
+        i++;
+        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
+        {
+            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
+            {
+                RegIndx = i;
+            }
+        }
+    } while ((RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1)));
+
+    return RegIndx;
+}
+
+/******************************************************************************
+ * Local helper to get the full name of a registered table
+ */
+const char *Bench_TBL_FullName(uint32 TblIdx)
+{
+    return CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[Bench_TBL_Handles[TblIdx]].RegIndex].Name;
+}
+
+void Bench_TBL_Registry(void)
+{
+    CFE_TBL_ActivateCmd_t ActivateCmd;
+    CFE_TBL_Handle_t      ShareHandle;
+    char                  TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    clock_t               Start;
+    uint32                NumTables;
+    uint32                Fail;
+    uint32                Seed;
+    uint32                i;
+    int16                 Found;
+    double                RegisterNs;
+    double                ShareNs;
+    double                CommandNs;
+    double                IndexNs;
+    double                LinearNs;
+
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_EarlyInit(), CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &Bench_TBL_PoolBuffer, sizeof(Bench_TBL_PoolBuffer), false);
+
+    memset(&ActivateCmd, 0, sizeof(ActivateCmd));
+
+    Fail      = 0;
+    Seed      = 1;
+    NumTables = 0;
+    while (NumTables < CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+    {
+        /* Register the next step of tables, with a single buffer each */
+        Start = clock();
+        for (i = NumTables; i < (NumTables + TBL_BENCH_STEP); i++)
+        {
+            snprintf(TblName, sizeof(TblName), "Table%u", (unsigned int)i);
+            if (CFE_TBL_Register(&Bench_TBL_Handles[i], TblName, TBL_BENCH_TABLE_SIZE, CFE_TBL_OPT_DEFAULT, NULL) !=
+                CFE_SUCCESS)
+            {
+                Fail++;
+            }
+        }
+        RegisterNs = Bench_TBL_Elapsed(Start, TBL_BENCH_STEP);
+        NumTables += TBL_BENCH_STEP;
+
+        /* Share the tables just registered, so each table ends up with two handles */
+        Start = clock();
+        for (i = NumTables - TBL_BENCH_STEP; i < NumTables; i++)
+        {
+            if (CFE_TBL_Share(&ShareHandle, Bench_TBL_FullName(i)) != CFE_SUCCESS)
+            {
+                Fail++;
+            }
+        }
+        ShareNs = Bench_TBL_Elapsed(Start, TBL_BENCH_STEP);
+
+        /* Activate commands for random tables, which fail as no load is pending */
+        Start = clock();
+        for (i = 0; i < TBL_BENCH_COMMANDS; i++)
+        {
+            Seed = (Seed * 1103515245) + 12345;
+            strncpy(ActivateCmd.Payload.TableName, Bench_TBL_FullName((Seed >> 8) % NumTables),
+                    sizeof(ActivateCmd.Payload.TableName) - 1);
+            if (CFE_TBL_ActivateCmd(&ActivateCmd) != CFE_TBL_INC_ERR_CTR)
+            {
+                Fail++;
+            }
+        }
+        CommandNs = Bench_TBL_Elapsed(Start, TBL_BENCH_COMMANDS);
+
+        /* Keep the stub call history from growing */
+        UT_ResetState(UT_KEY(CFE_EVS_SendEvent));
+
+        UtPrintf("%4u tables: register %.0f ns, share %.0f ns, activate command %.0f ns", (unsigned int)NumTables,
+                 RegisterNs, ShareNs, CommandNs);
+    }
+
+    UtAssert_ZERO(Fail);
+
+    /* Registry lookups of random tables, through the name index and with a linear scan */
+    Seed  = 1;
+    Found = 0;
+    Start = clock();
+    for (i = 0; i < TBL_BENCH_LOOKUPS; i++)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        Found |= CFE_TBL_FindTableInRegistry(Bench_TBL_FullName((Seed >> 8) % NumTables));
+    }
+    IndexNs = Bench_TBL_Elapsed(Start, TBL_BENCH_LOOKUPS);
+    UtAssert_True(Found >= 0, "All tables found through the name index");
+
+    Seed  = 1;
+    Found = 0;
+    Start = clock();
+    for (i = 0; i < TBL_BENCH_LOOKUPS / 16; i++)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        Found |= Bench_TBL_LinearFind(Bench_TBL_FullName((Seed >> 8) % NumTables));
+    }
+    LinearNs = Bench_TBL_Elapsed(Start, TBL_BENCH_LOOKUPS / 16);
+    UtAssert_True(Found >= 0, "All tables found with a linear scan");
+
+    UtPrintf("%4u tables: lookup %.1f ns with name index, %.1f ns with linear scan", (unsigned int)NumTables, IndexNs,
+             LinearNs);
+
+    /* Lookups of a table that is not registered */
+    Start = clock();
+    for (i = 0; i < TBL_BENCH_LOOKUPS; i++)
+    {
+        Found |= CFE_TBL_FindTableInRegistry("BENCH.NotRegistered");
+    }
+    IndexNs = Bench_TBL_Elapsed(Start, TBL_BENCH_LOOKUPS);
+
+    Start = clock();
+    for (i = 0; i < TBL_BENCH_LOOKUPS / 16; i++)
+    {
+        Found |= Bench_TBL_LinearFind("BENCH.NotRegistered");
+    }
+    LinearNs = Bench_TBL_Elapsed(Start, TBL_BENCH_LOOKUPS / 16);
+    UtAssert_INT32_EQ(Found, CFE_TBL_NOT_FOUND);
+
+    UtPrintf("%4u tables: missing table lookup %.1f ns with name index, %.1f ns with linear scan",
+             (unsigned int)NumTables, IndexNs, LinearNs);
+}
+
+/* Main benchmark routine */
+void UtTest_Setup(void)
+{
+    UtPrintf("Table registry benchmark with %u tables", (unsigned int)CFE_PLATFORM_TBL_MAX_NUM_TABLES);
+
+    UtTest_Add(Bench_TBL_Registry, NULL, NULL, "Bench_TBL_Registry");
+}
@@ -0,0 +1,41 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * Platform configuration for the table registry benchmark
+ *
+ * Uses the platform configuration of the build, with room for the number
+ * of tables of a large deployment.  Only the benchmark is built with it.
+ */
+
+#ifndef TBL_BENCH_PLATFORM_CFG_H
+#define TBL_BENCH_PLATFORM_CFG_H
+
+/* Treated as a system header so the build's pedantic flags allow include_next */
+#pragma GCC system_header
+#include_next "cfe_platform_cfg.h"
+
+#undef CFE_PLATFORM_TBL_MAX_NUM_TABLES
+#define CFE_PLATFORM_TBL_MAX_NUM_TABLES 2048
+
+#undef CFE_PLATFORM_TBL_MAX_NUM_HANDLES
+#define CFE_PLATFORM_TBL_MAX_NUM_HANDLES 4096
+
+#endif /* TBL_BENCH_PLATFORM_CFG_H */
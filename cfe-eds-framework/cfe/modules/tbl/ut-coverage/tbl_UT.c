@@ -233,6 +233,10 @@ void UtTest_Setup(void)
 
     /* Miscellaneous cfe_tbl_internal.c tests */
     UT_ADD_TEST(Test_CFE_TBL_Internal);
+    UT_ADD_TEST(Test_CFE_TBL_RegistryNameIndex);
+
+    /* Lock-free table access tests */
+    UT_ADD_TEST(Test_CFE_TBL_PinAddress);
 }
 
 /*
@@ -246,6 +250,7 @@ void UT_InitializeTableRegistryNames()
     {
         snprintf(CFE_TBL_Global.Registry[i].Name, CFE_TBL_MAX_FULL_NAME_LEN, "%d", i);
         CFE_TBL_Global.Registry[i].OwnerAppId = UT_TBL_APPID_2;
+        CFE_TBL_AddRegistryName(i);
     }
 }
 
@@ -296,6 +301,10 @@ void UT_ResetTableRegistry(void)
         CFE_TBL_Global.LoadBuffs[i].Taken = false;
     }
 
+    /* Empty the registry name index */
+    memset(CFE_TBL_Global.RegNameSlots, 0, sizeof(CFE_TBL_Global.RegNameSlots));
+    memset(CFE_TBL_Global.RegNameHash, 0, sizeof(CFE_TBL_Global.RegNameHash));
+
     CFE_TBL_Global.ValidationCounter = 0;
     CFE_TBL_Global.HkTlmTblRegIndex  = CFE_TBL_NOT_FOUND;
     CFE_TBL_Global.LastTblUpdated    = CFE_TBL_NOT_FOUND;
@@ -1083,6 +1092,7 @@ void Test_CFE_TBL_DumpCmd(void)
     strncpy(CFE_TBL_Global.Registry[2].Name, "DumpCmdTest", sizeof(CFE_TBL_Global.Registry[2].Name) - 1);
     CFE_TBL_Global.Registry[2].Name[sizeof(CFE_TBL_Global.Registry[2].Name) - 1] = '\0';
     CFE_TBL_Global.Registry[2].OwnerAppId                                        = AppID;
+    CFE_TBL_AddRegistryName(2);
     strncpy(DumpCmd.Payload.TableName, CFE_TBL_Global.Registry[2].Name, sizeof(DumpCmd.Payload.TableName) - 1);
     DumpCmd.Payload.TableName[sizeof(DumpCmd.Payload.TableName) - 1] = '\0';
     DumpCmd.Payload.ActiveTableFlag                                  = CFE_TBL_BufferSelect_ACTIVE;
@@ -1237,6 +1247,7 @@ void Test_CFE_TBL_LoadCmd(void)
 
     /* The rest of the tests will use registry 0, note empty name matches */
     CFE_TBL_Global.Registry[0].OwnerAppId = AppID;
+    CFE_TBL_AddRegistryName(0);
 
     /* Test attempt to load a dump only table */
     UT_InitData();
@@ -2496,6 +2507,92 @@ void Test_CFE_TBL_ReleaseAddresses(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test function that pins the active buffer of a double buffered table
+*/
+void Test_CFE_TBL_PinAddress(void)
+{
+    CFE_TBL_Handle_t       DblHandle;
+    CFE_TBL_Handle_t       SnglHandle;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    UT_Table1_t            TestTable1;
+    UT_Table1_t *          PinPtr;
+    void *                 TblPtr;
+
+    UtPrintf("Begin Test Pin Address");
+
+    /* Test setup - register a double and a single buffered table */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetTableRegistry();
+    CFE_UtAssert_SUCCESS(
+        CFE_TBL_Register(&DblHandle, "UT_Table1", sizeof(UT_Table1_t), CFE_TBL_OPT_DBL_BUFFER, NULL));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&SnglHandle, "UT_Table2", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    RegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[DblHandle].RegIndex];
+
+    /* Test response to a null table pointer and bad handles */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(NULL, DblHandle), CFE_TBL_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, CFE_PLATFORM_TBL_MAX_NUM_HANDLES), CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_NULL(TblPtr);
+    UtAssert_INT32_EQ(CFE_TBL_UnpinAddress(CFE_PLATFORM_TBL_MAX_NUM_HANDLES), CFE_TBL_ERR_INVALID_HANDLE);
+
+    /* Test attempt to pin a single buffered table */
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, SnglHandle), CFE_TBL_ERR_NOT_DOUBLE_BUFFERED);
+    UtAssert_NULL(TblPtr);
+
+    /* Test attempt to pin an unowned table */
+    RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, DblHandle), CFE_TBL_ERR_UNREGISTERED);
+    RegRecPtr->OwnerAppId = UT_TBL_APPID_1;
+
+    /* Test pinning a table that has never been loaded, which still pins the buffer */
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress(&TblPtr, DblHandle), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_ADDRESS_EQ(TblPtr, RegRecPtr->Buffers[0].BufferPtr);
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[0], 1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_UnpinAddress(DblHandle));
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[0], 0);
+
+    /* Releasing a handle without a pin has no effect */
+    CFE_UtAssert_SUCCESS(CFE_TBL_UnpinAddress(DblHandle));
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[0], 0);
+
+    /* Test that the first pin after a load reports the update, and later pins do not */
+    TestTable1.TblElement1 = 1;
+    TestTable1.TblElement2 = 2;
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress((void **)&PinPtr, DblHandle), CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(PinPtr->TblElement1, 1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_PinAddress((void **)&PinPtr, DblHandle));
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[0], 1);
+
+    /* Test that an update is published while the active buffer is pinned */
+    TestTable1.TblElement1 = 3;
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    UtAssert_UINT32_EQ(RegRecPtr->ActiveBufferIndex, 1);
+    UtAssert_INT32_EQ(PinPtr->TblElement1, 1);
+
+    /* Test that the buffer pinned before the update cannot be loaded into */
+    UT_InitData();
+    TestTable1.TblElement1 = 5;
+    UtAssert_INT32_EQ(CFE_TBL_Load(DblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_INT32_EQ(PinPtr->TblElement1, 1);
+
+    /* Test that pinning again moves the pin to the new active buffer */
+    UtAssert_INT32_EQ(CFE_TBL_PinAddress((void **)&PinPtr, DblHandle), CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(PinPtr->TblElement1, 3);
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[0], 0);
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[1], 1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    UtAssert_UINT32_EQ(RegRecPtr->ActiveBufferIndex, 0);
+
+    /* Test that unregistering a table releases the pin held through the handle */
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(DblHandle));
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[0], 0);
+    UtAssert_UINT32_EQ(RegRecPtr->PinCount[1], 0);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(SnglHandle));
+}
+
 /*
 ** Test function for validating the table image for a specified table
 */
@@ -3256,6 +3353,7 @@ void Test_CFE_TBL_Internal(void)
     RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
     strncpy(RegRecPtr->Name, "ut_cfe_tbl.UT_Table3", sizeof(RegRecPtr->Name) - 1);
     RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = '\0';
+    CFE_TBL_AddRegistryName(AccessDescPtr->RegIndex);
     RegRecPtr->TableLoadedOnce                   = false;
     RegRecPtr->LoadInProgress                    = CFE_TBL_NO_LOAD_IN_PROGRESS;
     CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true));
@@ -3947,6 +4045,99 @@ void Test_CFE_TBL_Internal(void)
 #endif
 }
 
+/*
+** Test the Table Registry name index
+*/
+void Test_CFE_TBL_RegistryNameIndex(void)
+{
+    char   Names[3][CFE_TBL_MAX_FULL_NAME_LEN];
+    uint32 HomeSlot;
+    uint32 i;
+    uint32 j;
+
+    UtPrintf("Begin Test Registry Name Index");
+
+    UT_InitData();
+    UT_ResetTableRegistry();
+
+    /* Find three names with the same home slot in the index */
+    strncpy(Names[0], "ut_cfe_tbl.T0", sizeof(Names[0]) - 1);
+    Names[0][sizeof(Names[0]) - 1] = '\0';
+    HomeSlot                       = CFE_TBL_ComputeNameHash(Names[0]) % CFE_TBL_REG_NAME_SLOTS;
+    j                              = 1;
+    for (i = 1; j < 3; ++i)
+    {
+        snprintf(Names[j], sizeof(Names[j]), "ut_cfe_tbl.T%u", (unsigned int)i);
+        if ((CFE_TBL_ComputeNameHash(Names[j]) % CFE_TBL_REG_NAME_SLOTS) == HomeSlot)
+        {
+            ++j;
+        }
+    }
+
+    /* Colliding names are placed in the slots following the home slot */
+    for (i = 0; i < 3; ++i)
+    {
+        strncpy(CFE_TBL_Global.Registry[i].Name, Names[i], sizeof(CFE_TBL_Global.Registry[i].Name) - 1);
+        CFE_TBL_Global.Registry[i].OwnerAppId = UT_TBL_APPID_1;
+        CFE_TBL_AddRegistryName(i);
+    }
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[HomeSlot], 1);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[(HomeSlot + 1) % CFE_TBL_REG_NAME_SLOTS], 2);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[(HomeSlot + 2) % CFE_TBL_REG_NAME_SLOTS], 3);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[0]), 0);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[1]), 1);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[2]), 2);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.NotRegistered"), CFE_TBL_NOT_FOUND);
+
+    /* Adding an entry again keeps a single slot for it */
+    CFE_TBL_AddRegistryName(0);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[HomeSlot], 1);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[(HomeSlot + 3) % CFE_TBL_REG_NAME_SLOTS],
+                       CFE_TBL_REG_NAME_SLOT_EMPTY);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[0]), 0);
+
+    /* Removing an entry inside the probe run leaves a marker, the entries after it are still found */
+    CFE_TBL_RemoveRegistryName(1);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[(HomeSlot + 1) % CFE_TBL_REG_NAME_SLOTS],
+                       CFE_TBL_REG_NAME_SLOT_REMOVED);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[1]), CFE_TBL_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[2]), 2);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[0]), 0);
+
+    /* Removing an entry that is not in the index does nothing */
+    CFE_TBL_RemoveRegistryName(1);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[2]), 2);
+
+    /* Removed slots are reused */
+    CFE_TBL_AddRegistryName(1);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[(HomeSlot + 1) % CFE_TBL_REG_NAME_SLOTS], 2);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[1]), 1);
+
+    /* Removing the entry at the end of the run also empties the removed slots before it */
+    CFE_TBL_RemoveRegistryName(1);
+    CFE_TBL_RemoveRegistryName(2);
+    CFE_TBL_RemoveRegistryName(0);
+    for (i = 0; i < 4; ++i)
+    {
+        UtAssert_UINT32_EQ(CFE_TBL_Global.RegNameSlots[(HomeSlot + i) % CFE_TBL_REG_NAME_SLOTS],
+                           CFE_TBL_REG_NAME_SLOT_EMPTY);
+    }
+
+    /* Entries without an owner are not found */
+    CFE_TBL_AddRegistryName(0);
+    CFE_TBL_Global.Registry[0].OwnerAppId = CFE_TBL_NOT_OWNED;
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[0]), CFE_TBL_NOT_FOUND);
+
+    /* An index without empty slots ends the search after all slots */
+    for (i = 0; i < CFE_TBL_REG_NAME_SLOTS; ++i)
+    {
+        CFE_TBL_Global.RegNameSlots[i] = CFE_TBL_REG_NAME_SLOT_REMOVED;
+    }
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry(Names[0]), CFE_TBL_NOT_FOUND);
+
+    UT_ResetTableRegistry();
+}
+
 /*
 ** Test function executed when the contents of a table need to be validated
 */
@@ -532,6 +532,22 @@ void Test_CFE_TBL_GetAddresses(void);
 ******************************************************************************/
 void Test_CFE_TBL_ReleaseAddresses(void);
 
+/*****************************************************************************/
+/**
+** \brief Test function that pins the active buffer of a double buffered table
+**
+** \par Description
+**        This function tests pinning and releasing the active buffer of a
+**        double buffered table, and the handling of loads while it is pinned.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_PinAddress(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function for validating the table image for a specified table
@@ -663,6 +679,22 @@ void Test_CFE_TBL_TblMod(void);
 ******************************************************************************/
 void Test_CFE_TBL_Internal(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for the Table Registry name index
+**
+** \par Description
+**        This function tests adding, finding and removing Table Registry
+**        entries in the registry name index.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_RegistryNameIndex(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function executed when the contents of a table need to be
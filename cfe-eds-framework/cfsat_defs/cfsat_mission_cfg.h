@@ -44,11 +44,10 @@
 
 /** \name Checksum/CRC algorithm identifiers */
 /** \{ */
-#define CFE_MISSION_ES_CRC_8  1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
-#define CFE_MISSION_ES_CRC_16 2 /**< \brief CRC (16 bit additive - returns 32 bit total) */
-#define CFE_MISSION_ES_CRC_32                                                              \
-    3 /**< \brief CRC (32 bit additive - returns 32 bit total) (Currently not implemented) \
-       */
+#define CFE_MISSION_ES_CRC_8   1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
+#define CFE_MISSION_ES_CRC_16  2 /**< \brief CRC-16/ARC (16 bit - returns 32 bit total) */
+#define CFE_MISSION_ES_CRC_32  3 /**< \brief CRC-32/ISO-HDLC (as used by zlib, Ethernet) */
+#define CFE_MISSION_ES_CRC_32C 4 /**< \brief CRC-32C (Castagnoli, as used by iSCSI, ext4) */
 /** \} */
 
 /**
@@ -60,7 +59,8 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_MISSION_ES_CRC_16 is supported (see #CFE_MISSION_ES_CRC_16)
+**      Must be CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32 or CFE_MISSION_ES_CRC_32C.
+**      Changing this invalidates any CRCs previously stored in the CDS.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_MISSION_ES_CRC_16
 
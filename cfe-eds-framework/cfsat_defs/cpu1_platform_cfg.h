@@ -132,6 +132,56 @@
 */
 #define CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT 4
 
+/**
+**  \cfesbcfg Maximum Number of Buffers Returned by a Batch Receive
+**
+**  \par Description:
+**       Dictates the maximum number of buffers a single call to
+**       #CFE_SB_ReceiveBufferBatch can return, and how many buffers received
+**       that way from a pipe can be held at once.  This sizes an array of buffer
+**       descriptor pointers on the stack of the receiving task and in each pipe
+**       descriptor.  Requests for larger batches are limited to this value.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_BATCH 32
+
+/**
+**  \cfesbcfg Message Size Counted as a Large Copy
+**
+**  \par Description:
+**       Messages of at least this many bytes sent with #CFE_SB_TransmitMsg,
+**       which copies the message into an SB buffer, are counted in the SB
+**       housekeeping packet and reported once per application by event.
+**       Such messages are better sent with #CFE_SB_AllocateMessageBuffer and
+**       #CFE_SB_TransmitBuffer.  A value of 0 disables the check.
+**
+**  \par Limits
+**       This parameter has a lower limit of 0 and an upper limit of UINT_MAX.
+**
+*/
+#define CFE_PLATFORM_SB_LARGE_MSG_COPY_THRESHOLD 4096
+
+/**
+**  \cfesbcfg Depth of the Per-Task SB Buffer Caches
+**
+**  \par Description:
+**       Each task keeps up to this many freed SB buffers to reuse for its
+**       next allocations, rather than returning them to the SB memory pool.
+**       Half of a cache is refilled from, or drained to, a set of shared
+**       per-size free lists at once.  Each free list keeps up to twice this
+**       many buffers and returns the rest to the pool, and all the cached
+**       buffers are returned to the pool if it runs out of blocks.  The hit,
+**       miss, refill and drain counts are reported in the SB statistics packet.
+**
+**  \par Limits
+**       This parameter has a lower limit of 2 and an upper limit of 255.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_CACHE_DEPTH 8
+
 /**
 **  \cfesbcfg Size of the SB buffer memory pool
 **
@@ -929,6 +979,27 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Size of the Per-Task Performance Data Rings
+**
+**  \par Description:
+**       Each task records its performance entries in its own ring, so that
+**       logging an entry does not need a lock.  The rings are merged in time
+**       order into the performance data buffer when the log is written to a
+**       file.  Units are number of performance data entries per task.  The
+**       merged log covers the interval in which no task has overwritten an
+**       entry, so a task logging at a high rate bounds how far back the log
+**       reaches.  In START trigger mode a task's ring instead stops taking
+**       entries once it is full after the trigger, so a task logging at a
+**       high rate bounds how many of its entries follow the trigger.
+**
+**  \par Limits
+**       Must be a power of two.  There is a lower limit of 64 and an upper limit
+**       of #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE.  One ring is allocated for each
+**       of the OS_MAX_TASKS tasks plus one shared by callers outside of any task.
+*/
+#define CFE_PLATFORM_ES_PERF_TASK_RING_SIZE 1024
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
@@ -1047,6 +1118,35 @@
 */
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS 50
 
+/**
+**  \cfeescfg Define Performance Log Stream Packets per Background Cycle
+**
+**  \par Description:
+**       This parameter defines the maximum number of Performance Log Stream packets
+**       the ES background task sends every #CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY
+**       milliseconds while streaming is enabled.  Together they limit the rate of
+**       the stream.  Entries that tasks add faster than this rate are overwritten
+**       in the task rings and counted as lost in the stream telemetry.
+**
+**  \par Limits
+**       Must be at least 1.  Each packet holds up to CFE_MISSION_ES_PERF_STREAM_MAX_ENTRIES
+**       entries.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_PKTS_PER_CYCLE 4
+
+/**
+**  \cfeescfg Define Performance Log Stream Flush Delay
+**
+**  \par Description:
+**       This parameter defines the number of milliseconds a partly filled Performance
+**       Log Stream packet waits for more entries before it is sent.  A shorter delay
+**       gives the ground newer data at a low entry rate, at the cost of more packets.
+**
+**  \par Limits
+**       This parameter is a uint32, there are no further restrictions.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FLUSH_DELAY 1000
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
@@ -1264,6 +1364,21 @@
 */
 #define CFE_PLATFORM_ES_MAX_MEMORY_POOLS 10
 
+/**
+**  \cfeescfg Define Depth of the Per-Task Memory Pool Caches
+**
+**  \par Description:
+**       Number of freed blocks of mutex-protected memory pools that each task
+**       keeps for reuse.  Blocks in a task cache are handed out again by
+**       #CFE_ES_GetPoolBuf without taking the pool mutex.  A value of 0
+**       disables the caches.
+**
+**  \par Limits
+**       Must be 0 or greater.  Larger values trade pool memory held by idle
+**       tasks for fewer mutex operations.
+*/
+#define CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH 4
+
 /**
 **  \cfeescfg Define Default ES Memory Pool Block Sizes
 **
@@ -1440,6 +1555,145 @@
 */
 #define CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE CFE_EVS_MsgFormat_LONG
 
+/**
+**  \cfeevscfg Deferred Event Ring Size
+**
+**  \par Description:
+**       Number of events sent with CFE_EVS_SendDeferredEvent() that each
+**       application can have waiting to be formatted by the EVS task.  When
+**       an application's ring is full the event is formatted immediately
+**       in the caller's context, as with CFE_EVS_SendEvent().
+**
+**  \par Limits
+**       Must be a power of two and at least 2.  Each entry holds
+**       #CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS argument words,
+**       #CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE bytes of string arguments and
+**       a copy of the format string of up to #CFE_MISSION_EVS_MAX_MESSAGE_LENGTH
+**       bytes.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_RING_SIZE 16
+
+/**
+**  \cfeevscfg Maximum Number of Deferred Event Arguments
+**
+**  \par Description:
+**       Maximum number of conversions in the format string of an event sent
+**       with CFE_EVS_SendDeferredEvent().  Events with more arguments are
+**       formatted immediately.
+**
+**  \par Limits
+**       Must be between 1 and 255.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_MAX_ARGS 8
+
+/**
+**  \cfeevscfg Deferred Event String Argument Storage
+**
+**  \par Description:
+**       Bytes of storage in each deferred event for copies of "%s" arguments,
+**       including their terminators.  Events whose string arguments do not fit
+**       are formatted immediately.
+**
+**  \par Limits
+**       Must be at least 1.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_STRING_SIZE 64
+
+/**
+**  \cfeevscfg Deferred Event Drain Period
+**
+**  \par Description:
+**       Longest time in milliseconds that the EVS task waits for a command
+**       before formatting and sending pending deferred events.  The events
+**       keep the time stamp from when they were sent.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_DRAIN_PERIOD 100
+
+/**
+**  \cfeevscfg Output Port Queue Depth
+**
+**  \par Description:
+**       Number of events that can wait for the EVS port task to write them to
+**       the local event log and the enabled output ports.  The queue keeps the
+**       sending task from waiting on console or serial output.  A depth of 0
+**       disables the queue and the port task, and the sending task writes the
+**       log and the ports itself.
+**
+**  \par Limits
+**       Must be 0 or greater.  The queue is created as a local OSAL queue, so
+**       where the OS supports those it is not limited by the kernel message
+**       queue depth.
+*/
+#define CFE_PLATFORM_EVS_PORT_QUEUE_DEPTH 32
+
+/**
+**  \cfeevscfg Output Port Queue Drop Policy
+**
+**  \par Description:
+**       Event discarded when the output port queue is full.  Each discarded
+**       event increments the output port drop counter in housekeeping telemetry.
+**       Value of 0 discards the new event, 1 discards the oldest queued event.
+**
+**  \par Limits
+**       Must be 0 (Discard New) or 1 (Discard Oldest).
+*/
+#define CFE_PLATFORM_EVS_PORT_QUEUE_DROP_POLICY 0
+
+/**
+**  \cfeevscfg Output Port Task Priority
+**
+**  \par Description:
+**       Priority of the EVS child task that empties the output port queue.
+**       It should be lower than the priority of the applications whose events
+**       must not wait for output.
+**
+**  \par Limits
+**       Must be between 1 and 255.
+*/
+#define CFE_PLATFORM_EVS_PORT_TASK_PRIORITY 200
+
+/**
+**  \cfeevscfg Output Port Task Stack Size
+**
+**  \par Description:
+**       Stack size in bytes of the EVS child task that empties the output port
+**       queue.
+**
+**  \par Limits
+**       Must be at least 2048.
+*/
+#define CFE_PLATFORM_EVS_PORT_TASK_STACK_SIZE 4096
+
+/**
+**  \cfeevscfg Default Application Event Rate Limit
+**
+**  \par Description:
+**       Events per second that each application can send when it registers
+**       with EVS, after a burst of CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST
+**       events.  Events over the limit are discarded before they are formatted
+**       and counted in housekeeping telemetry.  A value of 0 sets no limit.
+**       The limit of an application can be changed by command.
+**
+**  \par Limits
+**       Must be between 0 and 65535.
+*/
+#define CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_RATE 0
+
+/**
+**  \cfeevscfg Default Application Event Burst
+**
+**  \par Description:
+**       Events that each application can send at once before the default
+**       application event rate limit applies.  Not used when the rate is 0.
+**
+**  \par Limits
+**       Must be between 1 and 65535.
+*/
+#define CFE_PLATFORM_EVS_DEFAULT_APP_EVENT_BURST 10
+
 /* Platform Configuration Parameters for Table Service (TBL) */
 
 /**
@@ -1708,4 +1962,21 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/**
+**  \cfeescfg Number of Startup Script Load Worker Tasks
+**
+**  \par Description:
+**       Number of tasks that load the modules of the apps in the startup script
+**       while the rest of the script is processed.  Libraries are still loaded
+**       one at a time as their line is reached, so every app can use the libraries
+**       listed before it, and the apps are started in script order once all
+**       modules are loaded.  A value of 0 loads and starts each app as its line
+**       is reached.
+**
+**  \par Limits
+**       Must be 0 or greater.  The worker tasks only exist during startup but use
+**       OSAL task slots while they run.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS 4
+
 #endif /* CPU1_PLATFORM_CFG_H */
@@ -102,7 +102,7 @@ SET(FT_INSTALL_SUBDIR "host/functional-test")
 SET(MISSION_CPUNAMES cpu1)
 
 SET(cpu1_PROCESSORID 1)
-SET(cpu1_APPLIST ci_lab kit_to kit_sch file_mgr file_xfer osk_c_demo) #!CFSAT-INSERT!
+SET(cpu1_APPLIST ci_lab kit_to kit_sch file_mgr file_xfer osk_c_demo shm_bridge) #!CFSAT-INSERT!
 ## mqtt_lib mqtt_gw pl_mgr pl_sim pl_sim_lib pi_iolib gpio_demo berry_imu
 ## HELLO SET(cpu1_APPLIST ci_lab to_lab sch_lab osk_c_fw osk_c_demo filemgr file_xfer hello)
 SET(cpu1_FILELIST cfe_es_startup.scr file_mgr_ini.json file_xfer_ini.json osk_c_demo_ini.json osk_c_hist_tbl.json kit_sch_ini.json kit_sch_msgtbl.json kit_sch_schtbl.json kit_to_ini.json kit_to_pkt_tbl.json) #!CFSAT-INSERT!
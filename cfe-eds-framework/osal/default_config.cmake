@@ -342,3 +342,11 @@ set(OSAL_CONFIG_MAX_CMD_LEN             1000
 set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
     CACHE STRING "Maximum depth of message queue"
 )
+
+# The size of the intermediate buffer used when a file copy cannot be
+# done by the operating system itself (see OS_FileCopyRange()).
+# The buffer is allocated for the duration of each copy call, so a
+# larger value reduces the number of read/write calls per copy.
+set(OSAL_CONFIG_FILE_COPY_BLOCK_SIZE    65536
+    CACHE STRING "Size of file copy buffer"
+)
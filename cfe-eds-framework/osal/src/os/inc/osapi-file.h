@@ -436,6 +436,37 @@ int32 OS_cp(const char *src, const char *dest);
  */
 int32 OS_mv(const char *src, const char *dest);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Copies data from one open file to another
+ *
+ * Copies up to nbytes from the current position of src_fd to the current
+ * position of dest_fd, and advances both positions by the number of bytes
+ * copied.  Fewer bytes are copied if the end of the source file is reached.
+ *
+ * Where the underlying OS supports it, the data is copied within the kernel
+ * and never passes through a user space buffer.  Otherwise it is copied
+ * through a buffer of #OS_FILE_COPY_BLOCK_SIZE bytes.
+ *
+ * To append one file to another, seek dest_fd to #OS_SEEK_END and call this
+ * until it returns zero.
+ *
+ * @param[in]  src_fd    The source file descriptor, must be a regular file
+ * @param[in]  dest_fd   The destination file descriptor, must be a regular file
+ * @param[in]  nbytes    The maximum number of bytes to copy @nonzero
+ *
+ * @note All OSAL error codes are negative int32 values.  Failure of this
+ * call can be checked by testing if the result is less than 0.
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if either file descriptor is a socket
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if either file descriptor passed in is invalid
+ * @retval 0 if at end of the source file
+ */
+int32 OS_FileCopyRange(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Obtain information about an open file
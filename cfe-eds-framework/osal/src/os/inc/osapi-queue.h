@@ -30,6 +30,22 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+/**
+ * @brief Requests OS_QueueCreate() to use an in-process queue implementation
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this indicates
+ * that the queue will only ever be accessed by tasks within the same process,
+ * so the implementation may use a bounded lock-free ring in process memory
+ * rather than an OS-provided message queue.  On implementations that support
+ * it, put and get operations on such a queue do not enter the kernel unless
+ * a reader actually has to block on an empty queue.
+ *
+ * @note A local queue holds exactly the requested depth, as with a normal queue.
+ * Implementations that do not provide a local queue mechanism ignore this flag
+ * and create a normal queue.
+ */
+#define OS_QUEUE_FLAG_LOCAL 0x01
+
 /** @brief OSAL queue properties */
 typedef struct
 {
@@ -54,7 +70,7 @@ typedef struct
  * @param[in]   queue_name the name of the new resource to create @nonnull
  * @param[in]   queue_depth the maximum depth of the queue
  * @param[in]   data_size the size of each entry in the queue @nonzero
- * @param[in]   flags options for the queue (reserved for future use, pass as 0)
+ * @param[in]   flags options for the queue, 0 or #OS_QUEUE_FLAG_LOCAL
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -112,6 +128,38 @@ int32 OS_QueueDelete(osal_id_t queue_id);
  */
 int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive a batch of messages on a message queue
+ *
+ * Waits up to the given timeout for the first message, same as OS_QueueGet(), then
+ * also takes any further messages that are already on the queue without blocking
+ * again, up to count in total.
+ *
+ * Message i is stored at offset (i * size) in the data buffer.  The length of each
+ * message is not returned, so this is intended for queues whose messages are all the
+ * same size, such as queues of pointers.
+ *
+ * @param[in]   queue_id     The object ID to operate on
+ * @param[out]  data         The buffer to store the received messages @nonnull
+ * @param[in]   size         The size of each message in the data buffer @nonzero
+ * @param[in]   count        The maximum number of messages to receive @nonzero
+ * @param[out]  count_copied Set to the number of messages received @nonnull
+ * @param[in]   timeout      The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the size or count is zero
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_QUEUE_INVALID_SIZE if the size is less than the maximum message size of the queue
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t size, uint32 count, uint32 *count_copied,
+                       int32 timeout);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Put a message on a message queue.
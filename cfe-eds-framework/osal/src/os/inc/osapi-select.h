@@ -37,14 +37,15 @@
  * related API calls.  It should not be modified directly by applications.
  *
  * Note: Math is to determine uint8 array size needed to represent
- *       single bit OS_MAX_NUM_OPEN_FILES objects, + 7 rounds up
- *       and 8 is the size of uint8.
+ *       single bit OS_MAX_NUM_OPEN_FILES (or OS_MAX_QUEUES) objects,
+ *       + 7 rounds up and 8 is the size of uint8.
  *
  * @sa OS_SelectFdZero(), OS_SelectFdAdd(), OS_SelectFdClear(), OS_SelectFdIsSet()
  */
 typedef struct
 {
     uint8 object_ids[(OS_MAX_NUM_OPEN_FILES + 7) / 8];
+    uint8 queue_ids[(OS_MAX_QUEUES + 7) / 8];
 } OS_FdSet;
 
 /**
@@ -81,6 +82,13 @@ typedef enum
  * file handle(s) to wait for.  On exit, these are set to the actual
  * file handle(s) that have activity.
  *
+ * In addition to stream IDs, the ReadSet may contain message queue IDs, in
+ * which case the queue is considered readable when it holds at least one
+ * message.  This allows a single task to wait on sockets and queues (e.g.
+ * a software bus pipe) together.  Queues are only valid in the ReadSet, and
+ * only on implementations that support it; others return
+ * #OS_ERR_OPERATION_NOT_SUPPORTED.
+ *
  * If the timeout occurs this returns an error code and all output sets
  * should be empty.
  *
@@ -100,6 +108,10 @@ typedef enum
  * @retval #OS_ERROR_TIMEOUT If no handles in the ReadSet or WriteSet became readable or writable within the timeout
  * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if a specified handle does not support select
  * @retval #OS_ERR_INVALID_ID if no valid handles were contained in the ReadSet/WriteSet
+ *
+ * @note A readable queue only indicates that a message was present when the
+ * call returned.  If more than one task gets from the same queue, the message
+ * may already be gone, so the queue should still be read with #OS_CHECK.
  */
 int32 OS_SelectMultiple(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
 
@@ -157,6 +169,8 @@ int32 OS_SelectFdZero(OS_FdSet *Set);
  *
  * After this call the set will contain the given OSAL ID
  *
+ * The ID may refer to a stream (file or socket) or a message queue.
+ *
  * @param[in,out] Set Pointer to OS_FdSet object to operate on @nonnull
  * @param[in] objid The handle ID to add to the set
  *
@@ -173,6 +187,8 @@ int32 OS_SelectFdAdd(OS_FdSet *Set, osal_id_t objid);
  *
  * After this call the set will no longer contain the given OSAL ID
  *
+ * The ID may refer to a stream (file or socket) or a message queue.
+ *
  * @param[in,out] Set Pointer to OS_FdSet object to operate on @nonnull
  * @param[in] objid The handle ID to remove from the set
  *
@@ -114,6 +114,20 @@ typedef struct
     OS_SockAddrData_t AddrData;     /**< @brief Abstract Address data */
 } OS_SockAddr_t;
 
+/**
+ * @brief Describes one datagram in a batched send or receive
+ *
+ * Used with OS_SocketRecvMulti() and OS_SocketSendMulti() to transfer
+ * several datagrams with a single call.
+ */
+typedef struct
+{
+    void *         Buffer;       /**< @brief Message data buffer */
+    size_t         BufferSize;   /**< @brief Size of message data (send) or maximum size of buffer (receive) */
+    size_t         ActualLength; /**< @brief Length of the message actually received (receive only) */
+    OS_SockAddr_t *RemoteAddr;   /**< @brief Destination (send) or source (receive, may be NULL) address */
+} OS_SockMsg_t;
+
 /**
  * @brief Encapsulates socket properties
  *
@@ -405,6 +419,56 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
  */
 int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads a batch of messages from a message-oriented (datagram) socket
+ *
+ * Waits up to the given timeout for the first message, then also collects any
+ * further messages that are already queued on the socket without blocking again,
+ * up to MsgCount in total.  The ActualLength of each filled entry is set to the
+ * size of the message received into it.
+ *
+ * Where the OS supports it this is a single system call for the whole batch.
+ * Fewer than MsgCount messages may be returned even if more are pending.
+ *
+ * @param[in]     sock_id    The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] MsgVec     Array of message descriptors to fill @nonnull
+ * @param[in]     MsgCount   Number of entries in MsgVec @nonzero
+ * @param[in]     timeout    The maximum amount of time to wait, or OS_PEND to wait forever
+ *
+ * @return Count of messages received or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if MsgVec or any buffer in it is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MsgCount or any buffer size is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a datagram socket
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the socket is not bound
+ */
+int32 OS_SocketRecvMulti(osal_id_t sock_id, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends a batch of messages on a message-oriented (datagram) socket
+ *
+ * Each entry in MsgVec is sent as a separate datagram to its own RemoteAddr,
+ * in order.  Like OS_SocketSendTo() this does not block; if the socket stops
+ * accepting messages part way through the batch, the count of messages
+ * already queued is returned and the caller may retry the remainder.
+ *
+ * Where the OS supports it this is a single system call for the whole batch.
+ *
+ * @param[in]   sock_id      The socket ID, which must be of the datagram type
+ * @param[in]   MsgVec       Array of messages to send @nonnull
+ * @param[in]   MsgCount     Number of entries in MsgVec @nonzero
+ *
+ * @return Count of messages sent or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if MsgVec or any buffer or address in it is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MsgCount or any buffer size is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a datagram socket
+ * @retval #OS_ERR_BAD_ADDRESS if a remote address is not valid for the socket
+ */
+int32 OS_SocketSendMulti(osal_id_t sock_id, const OS_SockMsg_t *MsgVec, uint32 MsgCount);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an OSAL ID from a given name
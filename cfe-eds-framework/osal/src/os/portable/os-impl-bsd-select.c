@@ -158,6 +158,29 @@ static void OS_FdSet_ConvertOut_Impl(fd_set *OS_set, OS_FdSet *OSAL_set)
     }
 } /* end OS_FdSet_ConvertOut_Impl */
 
+/*----------------------------------------------------------------
+ * Function: OS_FdSet_HasQueues_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Check if an OS_FdSet contains any queue IDs, which
+ *          cannot be passed to the POSIX select function.
+ *-----------------------------------------------------------------*/
+static bool OS_FdSet_HasQueues_Impl(const OS_FdSet *OSAL_set)
+{
+    size_t offset;
+
+    for (offset = 0; offset < sizeof(OSAL_set->queue_ids); ++offset)
+    {
+        if (OSAL_set->queue_ids[offset] != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+} /* end OS_FdSet_HasQueues_Impl */
+
 /*----------------------------------------------------------------
  * Function: OS_DoSelect
  *
@@ -337,6 +360,25 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
     int    maxfd;
     int32  return_code;
 
+#ifdef OS_IMPL_SELECT_EPOLL
+    /*
+     * Prefer epoll where available, as it has no FD_SETSIZE limit and can also
+     * wait on queues.  It declines sets it cannot handle, such as regular files.
+     */
+    return_code = OS_SelectMultipleEpoll_Impl(ReadSet, WriteSet, msecs);
+    if (return_code != OS_ERR_NOT_IMPLEMENTED)
+    {
+        return return_code;
+    }
+#endif
+
+    if ((ReadSet != NULL && OS_FdSet_HasQueues_Impl(ReadSet)) ||
+        (WriteSet != NULL && OS_FdSet_HasQueues_Impl(WriteSet)))
+    {
+        /* select() only works with file descriptors */
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
     FD_ZERO(&rd_set);
     FD_ZERO(&wr_set);
     maxfd = -1;
@@ -611,6 +611,200 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return os_result;
 } /* end OS_SocketSendTo_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout)
+{
+    int32                           return_code;
+    int                             os_result;
+    int                             waitflags;
+    uint32                          operation;
+    uint32                          count;
+    struct sockaddr *               sa;
+    socklen_t                       addrlen;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /*
+     * Only the first message is waited for, using the same method as
+     * OS_SocketRecvFrom_Impl().  The rest of the batch is whatever is
+     * already queued on the socket at that point.
+     */
+    operation = OS_STREAM_STATE_READABLE;
+    if (impl->selectable)
+    {
+        waitflags   = MSG_DONTWAIT;
+        return_code = OS_SelectSingle_Impl(token, &operation, timeout);
+    }
+    else
+    {
+        if (timeout == 0)
+        {
+            waitflags = MSG_DONTWAIT;
+        }
+        else
+        {
+            /* note timeout will not be honored if >0 */
+            waitflags = 0;
+        }
+        return_code = OS_SUCCESS;
+    }
+
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    if ((operation & OS_STREAM_STATE_READABLE) == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+#ifdef OS_IMPL_SOCKET_MULTI_MSG
+    /*
+     * Receive the whole batch in one call if the OS can.
+     * OS_ERR_NOT_IMPLEMENTED means it cannot, so fall back to recvfrom().
+     */
+    return_code = OS_SocketRecvMultiMsg_Impl(impl->fd, MsgVec, MsgCount, waitflags);
+    if (return_code != OS_ERR_NOT_IMPLEMENTED)
+    {
+        return return_code;
+    }
+#endif
+
+    for (count = 0; count < MsgCount; ++count)
+    {
+        if (MsgVec[count].RemoteAddr == NULL)
+        {
+            sa      = NULL;
+            addrlen = 0;
+        }
+        else
+        {
+            addrlen = OS_SOCKADDR_MAX_LEN;
+            sa      = (struct sockaddr *)&MsgVec[count].RemoteAddr->AddrData;
+        }
+
+        os_result = recvfrom(impl->fd, MsgVec[count].Buffer, MsgVec[count].BufferSize, waitflags, sa, &addrlen);
+        if (os_result < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                OS_DEBUG("recvfrom: %s\n", strerror(errno));
+                return_code = OS_ERROR;
+            }
+            else
+            {
+                return_code = OS_QUEUE_EMPTY;
+            }
+            break;
+        }
+
+        MsgVec[count].ActualLength = os_result;
+        if (MsgVec[count].RemoteAddr != NULL)
+        {
+            MsgVec[count].RemoteAddr->ActualLength = addrlen;
+        }
+
+        /* only the first message may block */
+        waitflags = MSG_DONTWAIT;
+    }
+
+    /* messages already received are returned even if a later recvfrom() failed */
+    if (count > 0)
+    {
+        return_code = count;
+    }
+
+    return return_code;
+} /* end OS_SocketRecvMulti_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendMulti_Impl(const OS_object_token_t *token, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+{
+    int32                           return_code;
+    int                             os_result;
+    uint32                          count;
+    socklen_t                       addrlen;
+    const struct sockaddr *         sa;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* Validate every address up front so that a bad one does not leave a partial batch */
+    for (count = 0; count < MsgCount; ++count)
+    {
+        sa = (const struct sockaddr *)&MsgVec[count].RemoteAddr->AddrData;
+        switch (sa->sa_family)
+        {
+            case AF_INET:
+                addrlen = sizeof(struct sockaddr_in);
+                break;
+#ifdef OS_NETWORK_SUPPORTS_IPV6
+            case AF_INET6:
+                addrlen = sizeof(struct sockaddr_in6);
+                break;
+#endif
+            default:
+                addrlen = 0;
+                break;
+        }
+
+        if (addrlen != MsgVec[count].RemoteAddr->ActualLength)
+        {
+            return OS_ERR_BAD_ADDRESS;
+        }
+    }
+
+#ifdef OS_IMPL_SOCKET_MULTI_MSG
+    /*
+     * Send the whole batch in one call if the OS can.
+     * OS_ERR_NOT_IMPLEMENTED means it cannot, so fall back to sendto().
+     */
+    return_code = OS_SocketSendMultiMsg_Impl(impl->fd, MsgVec, MsgCount);
+    if (return_code != OS_ERR_NOT_IMPLEMENTED)
+    {
+        return return_code;
+    }
+#endif
+
+    return_code = OS_SUCCESS;
+    for (count = 0; count < MsgCount; ++count)
+    {
+        sa        = (const struct sockaddr *)&MsgVec[count].RemoteAddr->AddrData;
+        os_result = sendto(impl->fd, MsgVec[count].Buffer, MsgVec[count].BufferSize, MSG_DONTWAIT, sa,
+                           MsgVec[count].RemoteAddr->ActualLength);
+        if (os_result < 0)
+        {
+            OS_DEBUG("sendto: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+            break;
+        }
+    }
+
+    /* the messages already sent are reported even if a later sendto() failed */
+    if (count > 0)
+    {
+        return_code = count;
+    }
+
+    return return_code;
+} /* end OS_SocketSendMulti_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketGetInfo_Impl
@@ -114,6 +114,26 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return OS_ERR_NOT_IMPLEMENTED;
 }
 
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendMulti_Impl(const OS_object_token_t *token, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*----------------------------------------------------------------
  * Implementation for no network configuration
  *
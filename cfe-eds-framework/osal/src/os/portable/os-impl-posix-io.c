@@ -41,7 +41,10 @@
  *   read()
  *   write()
  *   close()
+ *   malloc()
+ *   free()
  */
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
@@ -273,3 +276,96 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
 
     return (return_code);
 } /* end OS_GenericWrite_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyRange_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes)
+{
+    int32  return_code;
+    int32  rd_size;
+    int32  wr_size;
+    int32  wr_total;
+    size_t cp_total;
+    size_t block_size;
+    uint8 *copyblock;
+
+#ifdef OS_IMPL_FILE_COPY_OFFLOAD
+    /*
+     * Let the OS copy the data directly between the files if it can.
+     * OS_ERR_NOT_IMPLEMENTED means this pair of files cannot be handled
+     * this way, and the data must go through a buffer instead.
+     */
+    return_code = OS_FileCopyOffload_Impl(OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *src_token)->fd,
+                                          OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *dest_token)->fd, nbytes);
+    if (return_code != OS_ERR_NOT_IMPLEMENTED)
+    {
+        return return_code;
+    }
+#endif
+
+    block_size = OS_FILE_COPY_BLOCK_SIZE;
+    if (block_size > nbytes)
+    {
+        block_size = nbytes;
+    }
+
+    copyblock = malloc(block_size);
+    if (copyblock == NULL)
+    {
+        OS_DEBUG("malloc: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return_code = OS_SUCCESS;
+    cp_total    = 0;
+    while (cp_total < nbytes)
+    {
+        if (block_size > (nbytes - cp_total))
+        {
+            block_size = nbytes - cp_total;
+        }
+
+        rd_size = OS_GenericRead_Impl(src_token, copyblock, block_size, OS_PEND);
+        if (rd_size <= 0)
+        {
+            return_code = rd_size;
+            break;
+        }
+
+        wr_total = 0;
+        while (wr_total < rd_size)
+        {
+            wr_size = OS_GenericWrite_Impl(dest_token, &copyblock[wr_total], rd_size - wr_total, OS_PEND);
+            if (wr_size <= 0)
+            {
+                /* a regular file that accepts no data is out of space */
+                return_code = (wr_size < 0) ? wr_size : OS_ERROR;
+                break;
+            }
+            wr_total += wr_size;
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        cp_total += rd_size;
+    }
+
+    free(copyblock);
+
+    if (return_code == OS_SUCCESS)
+    {
+        /* nbytes is limited by the caller so the total fits in an int32 */
+        return_code = (int32)cp_total;
+    }
+
+    return return_code;
+} /* end OS_FileCopyRange_Impl */
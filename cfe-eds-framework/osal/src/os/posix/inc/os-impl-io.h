@@ -48,4 +48,23 @@ typedef struct
  */
 extern OS_impl_file_internal_record_t OS_impl_filehandle_table[OS_MAX_NUM_OPEN_FILES];
 
+/*
+ * Linux can copy file data inside the kernel (copy_file_range/sendfile),
+ * so OS_FileCopyRange_Impl tries that before copying through a buffer.
+ */
+#ifdef __linux__
+#define OS_IMPL_FILE_COPY_OFFLOAD
+
+/*----------------------------------------------------------------
+   Function: OS_FileCopyOffload_Impl
+
+    Purpose: Copy up to nbytes between two file descriptors within the kernel
+
+    Returns: Number of bytes copied (non-negative) on success,
+             OS_ERR_NOT_IMPLEMENTED if the kernel cannot copy between these
+             descriptors, or OS_ERROR on any other failure
+ ------------------------------------------------------------------*/
+int32 OS_FileCopyOffload_Impl(int src_fd, int dest_fd, size_t nbytes);
+#endif
+
 #endif /* OS_IMPL_IO_H */
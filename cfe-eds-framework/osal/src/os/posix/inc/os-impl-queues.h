@@ -29,15 +29,48 @@
 #define OS_IMPL_QUEUES_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <mqueue.h>
 
+/* in-process ring used for queues created with OS_QUEUE_FLAG_LOCAL */
+typedef struct OS_impl_queue_ring OS_impl_queue_ring_t;
+
 /* queues */
 typedef struct
 {
-    mqd_t id;
+    mqd_t                 id;
+    bool                  is_local; /**< queue was created with OS_QUEUE_FLAG_LOCAL */
+    OS_impl_queue_ring_t *ring;     /**< ring of a local queue */
+    uint32                users;    /**< tasks currently using "ring", which is only freed once this is zero */
+    uint32                closing;  /**< nonzero once the local queue is being deleted, "ring" takes no new users */
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
 extern OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
+/*----------------------------------------------------------------
+   Function: OS_Posix_QueueSelectBegin
+
+    Purpose: Prepare a queue to be waited on by OS_SelectMultiple()
+             Outputs a descriptor that becomes readable when a message is put,
+             and whether the queue already holds a message
+
+             Only one task should select on a given queue at a time.  A local
+             queue cannot be deleted until OS_Posix_QueueSelectEnd() is called.
+
+    Returns: OS_SUCCESS on success, OS_ERR_INVALID_ID if the queue is being
+             deleted, or other relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_Posix_QueueSelectBegin(osal_index_t local_id, int *fd, bool *ready);
+
+/*----------------------------------------------------------------
+   Function: OS_Posix_QueueSelectEnd
+
+    Purpose: Finish waiting on a queue started by OS_Posix_QueueSelectBegin()
+             "fd_ready" indicates whether the descriptor was reported readable
+
+    Returns: true if the queue holds a message
+ ------------------------------------------------------------------*/
+bool OS_Posix_QueueSelectEnd(osal_index_t local_id, bool fd_ready);
+
 #endif /* OS_IMPL_QUEUES_H */
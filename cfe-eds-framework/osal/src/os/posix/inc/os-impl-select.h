@@ -30,7 +30,32 @@
 
 #include "os-impl-io.h"
 
+#include "osapi-select.h"
+
 #include <sys/select.h>
 #include <sys/time.h>
 
+/*
+ * Linux provides epoll, which keeps the set of descriptors being waited on
+ * in the kernel between calls and can also wait on the descriptors used to
+ * signal message queues, so OS_SelectMultiple() uses it ahead of select().
+ */
+#ifdef __linux__
+#define OS_IMPL_SELECT_EPOLL
+
+/*----------------------------------------------------------------
+   Function: OS_SelectMultipleEpoll_Impl
+
+    Purpose: Wait for activity on the streams and queues in the sets using epoll
+             Registrations are kept per task, so a task waiting on the same
+             sets repeatedly does not need to modify the epoll set each time
+
+    Returns: OS_SUCCESS or OS_ERROR_TIMEOUT,
+             OS_ERR_NOT_IMPLEMENTED if epoll cannot be used for the given sets,
+             or other relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SelectMultipleEpoll_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+
+#endif
+
 #endif /* OS_IMPL_SELECT_H */
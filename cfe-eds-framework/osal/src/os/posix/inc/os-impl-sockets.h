@@ -29,6 +29,7 @@
 #define OS_IMPL_SOCKETS_H
 
 #include "os-impl-io.h"
+#include "osapi-sockets.h"
 
 #include <fcntl.h>
 #include <netinet/in.h>
@@ -49,4 +50,37 @@
  */
 #define OS_IMPL_SOCKET_FLAGS O_NONBLOCK
 
+/*
+ * Linux can move a batch of datagrams in one system call (recvmmsg/sendmmsg),
+ * so the batched socket calls try that before looping over recvfrom/sendto.
+ */
+#ifdef __linux__
+#define OS_IMPL_SOCKET_MULTI_MSG
+
+/*----------------------------------------------------------------
+   Function: OS_SocketRecvMultiMsg_Impl
+
+    Purpose: Receive a batch of datagrams on a socket using recvmmsg()
+             The first is received according to "waitflags", any others
+             only if already queued
+
+    Returns: Number of datagrams received on success,
+             OS_ERR_NOT_IMPLEMENTED if the kernel does not provide recvmmsg(),
+             or other relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvMultiMsg_Impl(int fd, OS_SockMsg_t *MsgVec, uint32 MsgCount, int waitflags);
+
+/*----------------------------------------------------------------
+   Function: OS_SocketSendMultiMsg_Impl
+
+    Purpose: Send a batch of datagrams on a socket using sendmmsg()
+             All remote addresses must have been validated by the caller
+
+    Returns: Number of datagrams sent on success,
+             OS_ERR_NOT_IMPLEMENTED if the kernel does not provide sendmmsg(),
+             or other relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendMultiMsg_Impl(int fd, const OS_SockMsg_t *MsgVec, uint32 MsgCount);
+#endif
+
 #endif /* OS_IMPL_SOCKETS_H */
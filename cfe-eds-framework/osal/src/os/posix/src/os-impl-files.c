@@ -29,6 +29,11 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+#ifdef __linux__
+/* syscall() is needed to call copy_file_range independent of the C library version */
+#define _DEFAULT_SOURCE
+#endif
+
 #include <fcntl.h>
 #include <dirent.h>
 #include <sys/stat.h>
@@ -39,6 +44,11 @@
 #include "os-impl-files.h"
 #include "os-shared-file.h"
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <sys/sendfile.h>
+#endif
+
 /****************************************************************************************
                                      GLOBALS
  ***************************************************************************************/
@@ -101,3 +111,52 @@ int32 OS_Posix_StreamAPI_Impl_Init(void)
 
     return OS_SUCCESS;
 } /* end OS_Posix_StreamAPI_Impl_Init */
+
+#ifdef OS_IMPL_FILE_COPY_OFFLOAD
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyOffload_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopyOffload_Impl(int src_fd, int dest_fd, size_t nbytes)
+{
+    ssize_t os_result;
+
+#ifdef SYS_copy_file_range
+    /*
+     * copy_file_range() can share or reflink the data on filesystems that
+     * support it.  It is refused for some file pairs, e.g. across filesystems
+     * of different types, in which case sendfile() is tried next.
+     */
+    os_result = syscall(SYS_copy_file_range, src_fd, NULL, dest_fd, NULL, nbytes, 0);
+    if (os_result >= 0)
+    {
+        return (int32)os_result;
+    }
+    if (errno != ENOSYS && errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP && errno != EBADF)
+    {
+        OS_DEBUG("copy_file_range: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+#endif
+
+    /* sendfile() still copies in the kernel, but page by page */
+    os_result = sendfile(dest_fd, src_fd, NULL, nbytes);
+    if (os_result >= 0)
+    {
+        return (int32)os_result;
+    }
+    if (errno != ENOSYS && errno != EINVAL && errno != EAGAIN)
+    {
+        OS_DEBUG("sendfile: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_FileCopyOffload_Impl */
+
+#endif /* OS_IMPL_FILE_COPY_OFFLOAD */
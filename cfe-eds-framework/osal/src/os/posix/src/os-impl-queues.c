@@ -29,6 +29,11 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+#ifdef __linux__
+/* syscall() is needed for the futex operations used by local queues */
+#define _DEFAULT_SOURCE
+#endif
+
 #include "os-posix.h"
 #include "bsp-impl.h"
 
@@ -36,9 +41,506 @@
 #include "os-shared-queue.h"
 #include "os-shared-idmap.h"
 
+/*
+ * Local (in-process) queues block using futexes, which are Linux-specific.
+ * On other POSIX systems the OS_QUEUE_FLAG_LOCAL flag is ignored and all
+ * queues are implemented with POSIX message queues.
+ */
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <linux/futex.h>
+#define OS_POSIX_LOCAL_QUEUE_SUPPORT
+#endif
+
+/*
+ * Size used to keep the producer and consumer positions of a local queue
+ * on separate cache lines, so producers and consumers do not false-share.
+ */
+#define OS_QUEUE_RING_CACHE_LINE 64
+
+/*
+ * Longest time a reader of a local queue blocks in the futex before checking
+ * for a pending cancellation request, see OS_Posix_QueueRingGet().
+ */
+#define OS_QUEUE_RING_CANCEL_POLL_MSEC 100
+
+/*
+ * Each slot in a local queue is a sequence number and stored message size,
+ * followed by the message data itself.
+ */
+typedef struct
+{
+    uint32 seq;
+    uint32 size;
+} OS_impl_queue_slot_t;
+
+/*
+ * Bounded multi-producer/multi-consumer ring of fixed size slots.
+ *
+ * Each slot carries a sequence number which indicates whether it is ready to
+ * be filled or ready to be consumed at a given position, so producers and
+ * consumers only need a single atomic compare-and-swap on their respective
+ * position counter to claim a slot.  Readers wait on "put_count" with a futex
+ * only when the ring is empty, and writers only make the wake system call
+ * when there is at least one reader waiting.
+ *
+ * A task waiting in OS_SelectMultiple() cannot wait on the futex, so for those
+ * writers also signal "notify_fd", an eventfd that is created the first time
+ * the queue is selected on, but again only while a selector is waiting.
+ *
+ * The number of slots is rounded up to a power of two, so when the requested
+ * depth is not one itself "depth" separately limits how many messages are held.
+ */
+struct OS_impl_queue_ring
+{
+    uint32  mask;
+    uint32  depth;
+    size_t  slot_size;
+    uint8 * slots;
+    uint32  waiters;
+    uint32  select_waiters;
+    int     notify_fd;
+    uint8   pad0[OS_QUEUE_RING_CACHE_LINE];
+    uint32  enqueue_pos;
+    uint8   pad1[OS_QUEUE_RING_CACHE_LINE];
+    uint32  dequeue_pos;
+    uint8   pad2[OS_QUEUE_RING_CACHE_LINE];
+    uint32  put_count;
+};
+
 /* Tables where the OS object information is stored */
 OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+
+/****************************************************************************************
+                                LOCAL QUEUE HELPERS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingSlot
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot in the ring for the given position
+ *
+ *-----------------------------------------------------------------*/
+static inline OS_impl_queue_slot_t *OS_Posix_QueueRingSlot(OS_impl_queue_ring_t *ring, uint32 pos)
+{
+    return (OS_impl_queue_slot_t *)(void *)&ring->slots[(pos & ring->mask) * ring->slot_size];
+} /* end OS_Posix_QueueRingSlot */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingCreate
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Allocates a ring with room for at least "depth" entries of "size" bytes
+ *
+ *-----------------------------------------------------------------*/
+static OS_impl_queue_ring_t *OS_Posix_QueueRingCreate(osal_blockcount_t depth, size_t size)
+{
+    OS_impl_queue_ring_t *ring;
+    OS_impl_queue_slot_t *slot;
+    uint32                capacity;
+    uint32                i;
+
+    /* capacity must be a power of two, and the slot sequence scheme requires at least two */
+    capacity = 2;
+    while (capacity < depth)
+    {
+        capacity <<= 1;
+    }
+
+    ring = malloc(sizeof(*ring));
+    if (ring == NULL)
+    {
+        return NULL;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->notify_fd = -1;
+    ring->mask      = capacity - 1;
+    ring->depth     = depth;
+    ring->slot_size = (sizeof(OS_impl_queue_slot_t) + size + sizeof(uint32) - 1) & ~(sizeof(uint32) - 1);
+    ring->slots     = malloc(capacity * ring->slot_size);
+    if (ring->slots == NULL)
+    {
+        free(ring);
+        return NULL;
+    }
+
+    for (i = 0; i < capacity; ++i)
+    {
+        slot       = OS_Posix_QueueRingSlot(ring, i);
+        slot->seq  = i;
+        slot->size = 0;
+    }
+
+    return ring;
+} /* end OS_Posix_QueueRingCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingPut
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Non-blocking put of a message into a local queue
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingPut(OS_impl_queue_ring_t *ring, const void *data, size_t size)
+{
+    OS_impl_queue_slot_t *slot;
+    uint32                pos;
+    int32                 diff;
+
+    pos = __atomic_load_n(&ring->enqueue_pos, __ATOMIC_RELAXED);
+    while (true)
+    {
+        slot = OS_Posix_QueueRingSlot(ring, pos);
+        diff = (int32)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0)
+        {
+            /*
+             * The slot sequence alone allows a full lap of the ring, which is more than
+             * requested unless the depth was a power of two.  The consumer position only
+             * ever advances, so a stale read here can only make the check more strict.
+             */
+            if (ring->depth <= ring->mask &&
+                (pos - __atomic_load_n(&ring->dequeue_pos, __ATOMIC_ACQUIRE)) >= ring->depth)
+            {
+                return OS_QUEUE_FULL;
+            }
+
+            /* slot is free at this position, try to claim it */
+            if (__atomic_compare_exchange_n(&ring->enqueue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* slot still holds an unconsumed message from the previous lap */
+            return OS_QUEUE_FULL;
+        }
+        else
+        {
+            /* another producer claimed this position first */
+            pos = __atomic_load_n(&ring->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(slot + 1, data, size);
+    slot->size = size;
+    __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+
+    /*
+     * Bump the futex word and only wake if a reader has indicated it is (or is about to be)
+     * waiting.  Both of these are sequentially consistent so that the reader either sees
+     * the new count or the writer sees the waiter.
+     */
+    __atomic_add_fetch(&ring->put_count, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ring->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        syscall(SYS_futex, &ring->put_count, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+    if (__atomic_load_n(&ring->select_waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        eventfd_write(ring->notify_fd, 1);
+    }
+
+    return OS_SUCCESS;
+} /* end OS_Posix_QueueRingPut */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingTryGet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Non-blocking get of a message from a local queue
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingTryGet(OS_impl_queue_ring_t *ring, void *data, size_t *size_copied)
+{
+    OS_impl_queue_slot_t *slot;
+    uint32                pos;
+    int32                 diff;
+
+    pos = __atomic_load_n(&ring->dequeue_pos, __ATOMIC_RELAXED);
+    while (true)
+    {
+        slot = OS_Posix_QueueRingSlot(ring, pos);
+        diff = (int32)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - (pos + 1));
+        if (diff == 0)
+        {
+            /* slot has been filled at this position, try to claim it */
+            if (__atomic_compare_exchange_n(&ring->dequeue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return OS_QUEUE_EMPTY;
+        }
+        else
+        {
+            /* another consumer claimed this position first */
+            pos = __atomic_load_n(&ring->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    /* the shared layer already checked that the buffer is at least the max message size */
+    *size_copied = slot->size;
+    memcpy(data, slot + 1, slot->size);
+
+    /* mark the slot as free for the producer on the next lap */
+    __atomic_store_n(&slot->seq, pos + ring->mask + 1, __ATOMIC_RELEASE);
+
+    return OS_SUCCESS;
+} /* end OS_Posix_QueueRingTryGet */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingWaitDone
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes the calling task from the set of waiters on a local queue.
+ *           Also used as a cleanup handler in case the task is deleted while waiting.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingWaitDone(void *arg)
+{
+    OS_impl_queue_ring_t *ring = arg;
+
+    __atomic_sub_fetch(&ring->waiters, 1, __ATOMIC_SEQ_CST);
+} /* end OS_Posix_QueueRingWaitDone */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingGet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Get a message from a local queue, blocking on a futex if empty
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingGet(OS_impl_queue_internal_record_t *impl, OS_impl_queue_ring_t *ring, void *data,
+                                   size_t *size_copied, int32 timeout)
+{
+    int32            return_code;
+    uint32           put_count;
+    struct timespec  deadline;
+    struct timespec  now;
+    struct timespec  remaining;
+    struct timespec *wait_time;
+    struct timespec  slice;
+    long             wait_status;
+
+    return_code = OS_Posix_QueueRingTryGet(ring, data, size_copied);
+    if (return_code != OS_QUEUE_EMPTY || timeout == OS_CHECK)
+    {
+        return return_code;
+    }
+
+    if (timeout == OS_PEND)
+    {
+        wait_time = NULL;
+    }
+    else
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout / 1000;
+        deadline.tv_nsec += (timeout % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_nsec -= 1000000000;
+            ++deadline.tv_sec;
+        }
+        wait_time = &remaining;
+    }
+
+    __atomic_add_fetch(&ring->waiters, 1, __ATOMIC_SEQ_CST);
+    pthread_cleanup_push(OS_Posix_QueueRingWaitDone, ring);
+    while (true)
+    {
+        /*
+         * Sample the futex word before re-checking the ring, so a put that happens
+         * between the check and the wait causes the wait to return immediately.
+         */
+        put_count   = __atomic_load_n(&ring->put_count, __ATOMIC_SEQ_CST);
+        return_code = OS_Posix_QueueRingTryGet(ring, data, size_copied);
+        if (return_code != OS_QUEUE_EMPTY)
+        {
+            break;
+        }
+
+        /* the queue is being deleted, which waits for this task to stop using the ring */
+        if (__atomic_load_n(&impl->closing, __ATOMIC_SEQ_CST) != 0)
+        {
+            return_code = OS_ERR_INVALID_ID;
+            break;
+        }
+
+        if (wait_time != NULL)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            remaining.tv_sec  = deadline.tv_sec - now.tv_sec;
+            remaining.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+            if (remaining.tv_nsec < 0)
+            {
+                remaining.tv_nsec += 1000000000;
+                --remaining.tv_sec;
+            }
+            if (remaining.tv_sec < 0)
+            {
+                return_code = OS_QUEUE_TIMEOUT;
+                break;
+            }
+        }
+
+        /*
+         * A raw futex syscall is not a cancellation point, but the message queue
+         * calls it replaces are, and OS_TaskDelete() relies on that.  Wait in
+         * bounded slices and test for a pending cancel between them, so the
+         * cleanup handlers above always run with the bookkeeping consistent.
+         */
+        slice.tv_sec  = 0;
+        slice.tv_nsec = OS_QUEUE_RING_CANCEL_POLL_MSEC * 1000000;
+        if (wait_time != NULL && remaining.tv_sec == 0 && remaining.tv_nsec < slice.tv_nsec)
+        {
+            slice = remaining;
+        }
+
+        wait_status = syscall(SYS_futex, &ring->put_count, FUTEX_WAIT_PRIVATE, put_count, &slice, NULL, 0);
+        pthread_testcancel();
+
+        if (wait_status < 0 && errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT)
+        {
+            return_code = OS_ERROR;
+            break;
+        }
+    }
+    pthread_cleanup_pop(1);
+
+    return return_code;
+} /* end OS_Posix_QueueRingGet */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingIsEmpty
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if there is a message to get from a local queue
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_Posix_QueueRingIsEmpty(OS_impl_queue_ring_t *ring)
+{
+    uint32 pos;
+
+    pos = __atomic_load_n(&ring->dequeue_pos, __ATOMIC_SEQ_CST);
+    return (__atomic_load_n(&OS_Posix_QueueRingSlot(ring, pos)->seq, __ATOMIC_ACQUIRE) != (pos + 1));
+} /* end OS_Posix_QueueRingIsEmpty */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingRelease
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases a ring obtained with OS_Posix_QueueRingAcquire(), waking
+ *           the deleting task if this was the last user.  The ring must not
+ *           be accessed after this returns.
+ *           Also used as a cleanup handler in case the task is deleted while waiting.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingRelease(void *arg)
+{
+    OS_impl_queue_internal_record_t *impl = arg;
+
+    if (__atomic_sub_fetch(&impl->users, 1, __ATOMIC_SEQ_CST) == 0 &&
+        __atomic_load_n(&impl->closing, __ATOMIC_SEQ_CST) != 0)
+    {
+        syscall(SYS_futex, &impl->users, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    }
+} /* end OS_Posix_QueueRingRelease */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingAcquire
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the ring of a local queue and prevents it from being freed
+ *           until OS_Posix_QueueRingRelease() is called.
+ *
+ *           Gets and puts do not hold the object lock, so this is what stops
+ *           OS_QueueDelete_Impl() from freeing the ring while another task is
+ *           still blocked on it or in the middle of an operation.  The user
+ *           count and the closing flag are both sequentially consistent, so
+ *           either the delete sees this user and waits for it, or this sees
+ *           the flag and backs off.
+ *
+ * returns: The ring, or NULL if the queue is being deleted
+ *
+ *-----------------------------------------------------------------*/
+static OS_impl_queue_ring_t *OS_Posix_QueueRingAcquire(OS_impl_queue_internal_record_t *impl)
+{
+    __atomic_add_fetch(&impl->users, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&impl->closing, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_QueueRingRelease(impl);
+        return NULL;
+    }
+
+    return impl->ring;
+} /* end OS_Posix_QueueRingAcquire */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingClose
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Stops new users of the ring of a local queue, wakes all tasks
+ *           blocked on it and waits for every user to release it, then frees it.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingClose(OS_impl_queue_internal_record_t *impl)
+{
+    OS_impl_queue_ring_t *ring = impl->ring;
+    uint32                users;
+
+    __atomic_store_n(&impl->closing, 1, __ATOMIC_SEQ_CST);
+
+    /* readers re-check the flag once woken, selectors see their descriptor become readable */
+    __atomic_add_fetch(&ring->put_count, 1, __ATOMIC_SEQ_CST);
+    syscall(SYS_futex, &ring->put_count, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    if (__atomic_load_n(&ring->notify_fd, __ATOMIC_ACQUIRE) >= 0)
+    {
+        eventfd_write(ring->notify_fd, 1);
+    }
+
+    while (true)
+    {
+        users = __atomic_load_n(&impl->users, __ATOMIC_SEQ_CST);
+        if (users == 0)
+        {
+            break;
+        }
+        syscall(SYS_futex, &impl->users, FUTEX_WAIT_PRIVATE, users, NULL, NULL, 0);
+    }
+
+    impl->ring = NULL;
+    if (ring->notify_fd >= 0)
+    {
+        close(ring->notify_fd);
+    }
+    free(ring->slots);
+    free(ring);
+} /* end OS_Posix_QueueRingClose */
+
+#endif /* OS_POSIX_LOCAL_QUEUE_SUPPORT */
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
@@ -93,6 +595,30 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
     queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
 
+    impl->ring     = NULL;
+    impl->is_local = false;
+    impl->users    = 0;
+    impl->closing  = 0;
+
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    if ((flags & OS_QUEUE_FLAG_LOCAL) != 0)
+    {
+        /*
+         * Local queues never leave the process, so there is no need for the
+         * kernel message queue or its depth limit.
+         */
+        impl->ring = OS_Posix_QueueRingCreate(queue->max_depth, queue->max_size);
+        if (impl->ring == NULL)
+        {
+            OS_DEBUG("OS_QueueCreate Error: cannot allocate local queue\n");
+            return OS_ERROR;
+        }
+
+        impl->is_local = true;
+        return OS_SUCCESS;
+    }
+#endif
+
     /* set queue attributes */
     memset(&queueAttr, 0, sizeof(queueAttr));
     queueAttr.mq_maxmsg  = queue->max_depth;
@@ -171,6 +697,14 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    if (impl->is_local)
+    {
+        OS_Posix_QueueRingClose(impl);
+        return OS_SUCCESS;
+    }
+#endif
+
     /* Try to delete and unlink the queue */
     if (mq_close(impl->id) != 0)
     {
@@ -202,6 +736,25 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    if (impl->is_local)
+    {
+        OS_impl_queue_ring_t *ring;
+
+        ring = OS_Posix_QueueRingAcquire(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        pthread_cleanup_push(OS_Posix_QueueRingRelease, impl);
+        return_code = OS_Posix_QueueRingGet(impl, ring, data, size_copied, timeout);
+        pthread_cleanup_pop(1);
+
+        return return_code;
+    }
+#endif
+
     /*
      ** Read the message queue for data
      */
@@ -284,6 +837,76 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return return_code;
 } /* end OS_QueueGet_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_QueueGetMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t size, uint32 count,
+                            uint32 *count_copied, int32 timeout)
+{
+    int32  return_code;
+    size_t size_copied;
+    uint8 *dest = data;
+    uint32 received;
+
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->is_local)
+    {
+        OS_impl_queue_ring_t *ring;
+
+        /* the whole batch is taken from the ring under a single use reference */
+        ring = OS_Posix_QueueRingAcquire(impl);
+        if (ring == NULL)
+        {
+            *count_copied = 0;
+            return OS_ERR_INVALID_ID;
+        }
+
+        received = 0;
+        pthread_cleanup_push(OS_Posix_QueueRingRelease, impl);
+        return_code = OS_Posix_QueueRingGet(impl, ring, dest, &size_copied, timeout);
+        if (return_code == OS_SUCCESS)
+        {
+            received = 1;
+            while (received < count &&
+                   OS_Posix_QueueRingTryGet(ring, &dest[received * size], &size_copied) == OS_SUCCESS)
+            {
+                ++received;
+            }
+        }
+        pthread_cleanup_pop(1);
+
+        *count_copied = received;
+
+        return return_code;
+    }
+#endif
+
+    received    = 0;
+    return_code = OS_QueueGet_Impl(token, dest, size, &size_copied, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        /* take the rest only if they are already there */
+        received = 1;
+        while (received < count &&
+               OS_QueueGet_Impl(token, &dest[received * size], size, &size_copied, OS_CHECK) == OS_SUCCESS)
+        {
+            ++received;
+        }
+    }
+
+    *count_copied = received;
+
+    return return_code;
+} /* end OS_QueueGetMulti_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_QueuePut_Impl
@@ -301,6 +924,24 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    if (impl->is_local)
+    {
+        OS_impl_queue_ring_t *ring;
+
+        ring = OS_Posix_QueueRingAcquire(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        return_code = OS_Posix_QueueRingPut(ring, data, size);
+        OS_Posix_QueueRingRelease(impl);
+
+        return return_code;
+    }
+#endif
+
     /*
      * NOTE - using a zero timeout here for the same reason that QueueGet does ---
      * checking the attributes and doing the actual send is non-atomic, and if
@@ -332,3 +973,111 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
     return return_code;
 
 } /* end OS_QueuePut_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueSelectBegin
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_QueueSelectBegin(osal_index_t local_id, int *fd, bool *ready)
+{
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = &OS_impl_queue_table[local_id];
+
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    if (impl->is_local)
+    {
+        OS_impl_queue_ring_t *ring;
+        int                   new_fd;
+        int                   expected_fd;
+
+        /* held until OS_Posix_QueueSelectEnd(), so the descriptor stays open while it is waited on */
+        ring = OS_Posix_QueueRingAcquire(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        if (__atomic_load_n(&ring->notify_fd, __ATOMIC_ACQUIRE) < 0)
+        {
+            new_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (new_fd < 0)
+            {
+                OS_DEBUG("eventfd: %s\n", strerror(errno));
+                OS_Posix_QueueRingRelease(impl);
+                return OS_ERROR;
+            }
+
+            expected_fd = -1;
+            if (!__atomic_compare_exchange_n(&ring->notify_fd, &expected_fd, new_fd, false, __ATOMIC_ACQ_REL,
+                                             __ATOMIC_ACQUIRE))
+            {
+                /* another task created it first */
+                close(new_fd);
+            }
+        }
+
+        /*
+         * Register as a waiter before checking the ring, so a put that happens
+         * after the check always signals the descriptor (see OS_Posix_QueueRingPut)
+         */
+        __atomic_add_fetch(&ring->select_waiters, 1, __ATOMIC_SEQ_CST);
+
+        *fd    = ring->notify_fd;
+        *ready = !OS_Posix_QueueRingIsEmpty(ring);
+        return OS_SUCCESS;
+    }
+#endif
+
+    /* on Linux a message queue descriptor is itself a file descriptor which is readable when not empty */
+    *fd    = (int)impl->id;
+    *ready = false;
+
+    return OS_SUCCESS;
+} /* end OS_Posix_QueueSelectBegin */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueSelectEnd
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool OS_Posix_QueueSelectEnd(osal_index_t local_id, bool fd_ready)
+{
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = &OS_impl_queue_table[local_id];
+
+#ifdef OS_POSIX_LOCAL_QUEUE_SUPPORT
+    if (impl->is_local)
+    {
+        OS_impl_queue_ring_t *ring;
+        eventfd_t             count;
+        bool                  ready;
+
+        /* still valid, the queue cannot be deleted until the reference from OS_Posix_QueueSelectBegin() is released */
+        ring = impl->ring;
+
+        __atomic_sub_fetch(&ring->select_waiters, 1, __ATOMIC_SEQ_CST);
+
+        if (fd_ready)
+        {
+            /* reset the descriptor, the ring itself is what indicates readiness */
+            eventfd_read(ring->notify_fd, &count);
+        }
+
+        ready = !OS_Posix_QueueRingIsEmpty(ring);
+        OS_Posix_QueueRingRelease(impl);
+
+        return ready;
+    }
+#endif
+
+    return fd_ready;
+} /* end OS_Posix_QueueSelectEnd */
@@ -0,0 +1,625 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-select.c
+ * \ingroup  posix
+ *
+ * epoll based implementation of OS_SelectMultiple(), used by the BSD
+ * select implementation where the OS provides it.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+
+#include "os-posix.h"
+#include "os-impl-select.h"
+#include "os-impl-queues.h"
+#include "os-shared-select.h"
+#include "os-shared-idmap.h"
+
+#ifdef OS_IMPL_SELECT_EPOLL
+
+#include <sys/epoll.h>
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Registration state of one stream or queue in the epoll set of a task
+ */
+typedef struct
+{
+    osal_id_t id;      /**< object the descriptor was registered for, undefined if none */
+    int       fd;      /**< descriptor that was registered */
+    uint32    events;  /**< epoll events currently registered, 0 if not registered */
+    bool      waiting; /**< queue has been prepared with OS_Posix_QueueSelectBegin() */
+    bool      ready;   /**< queue descriptor was reported readable */
+} OS_impl_select_entry_t;
+
+/*
+ * Each task that calls OS_SelectMultiple() gets its own epoll set, which
+ * stays registered between calls.  Streams are tagged with their table index
+ * in the epoll event data, and queues with their table index offset by
+ * OS_MAX_NUM_OPEN_FILES.
+ */
+typedef struct
+{
+    int                    epfd;
+    OS_impl_select_entry_t streams[OS_MAX_NUM_OPEN_FILES];
+    OS_impl_select_entry_t queues[OS_MAX_QUEUES];
+    struct epoll_event     events[OS_MAX_NUM_OPEN_FILES + OS_MAX_QUEUES];
+} OS_impl_select_cache_t;
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+static pthread_once_t OS_impl_select_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  OS_impl_select_key;
+static bool           OS_impl_select_key_valid;
+
+/****************************************************************************************
+                                LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectCacheDestroy
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases the epoll set of a task when it exits
+ *-----------------------------------------------------------------*/
+static void OS_Posix_SelectCacheDestroy(void *arg)
+{
+    OS_impl_select_cache_t *cache = arg;
+
+    close(cache->epfd);
+    free(cache);
+} /* end OS_Posix_SelectCacheDestroy */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectKeyInit
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Creates the thread-specific key for the per-task epoll sets
+ *-----------------------------------------------------------------*/
+static void OS_Posix_SelectKeyInit(void)
+{
+    OS_impl_select_key_valid = (pthread_key_create(&OS_impl_select_key, OS_Posix_SelectCacheDestroy) == 0);
+} /* end OS_Posix_SelectKeyInit */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectGetCache
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the epoll set of the calling task, creating it on first use
+ *
+ * returns: Pointer to the epoll set, or NULL if it could not be created
+ *-----------------------------------------------------------------*/
+static OS_impl_select_cache_t *OS_Posix_SelectGetCache(void)
+{
+    OS_impl_select_cache_t *cache;
+    uint32                  i;
+
+    pthread_once(&OS_impl_select_key_once, OS_Posix_SelectKeyInit);
+    if (!OS_impl_select_key_valid)
+    {
+        return NULL;
+    }
+
+    cache = pthread_getspecific(OS_impl_select_key);
+    if (cache != NULL)
+    {
+        return cache;
+    }
+
+    cache = malloc(sizeof(*cache));
+    if (cache == NULL)
+    {
+        return NULL;
+    }
+
+    memset(cache, 0, sizeof(*cache));
+    for (i = 0; i < OS_MAX_NUM_OPEN_FILES; ++i)
+    {
+        cache->streams[i].id = OS_OBJECT_ID_UNDEFINED;
+        cache->streams[i].fd = -1;
+    }
+    for (i = 0; i < OS_MAX_QUEUES; ++i)
+    {
+        cache->queues[i].id = OS_OBJECT_ID_UNDEFINED;
+        cache->queues[i].fd = -1;
+    }
+
+    cache->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (cache->epfd < 0)
+    {
+        OS_DEBUG("epoll_create1: %s\n", strerror(errno));
+        free(cache);
+        return NULL;
+    }
+
+    if (pthread_setspecific(OS_impl_select_key, cache) != 0)
+    {
+        OS_Posix_SelectCacheDestroy(cache);
+        return NULL;
+    }
+
+    return cache;
+} /* end OS_Posix_SelectGetCache */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectRegister
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Brings the registration of one stream or queue in the epoll set
+ *          up to date, only calling epoll_ctl() if something changed.
+ *
+ *          If the object registered before has since been deleted then the
+ *          kernel already dropped the registration when the descriptor was
+ *          closed, and the descriptor may now belong to another object, so
+ *          the entry is only forgotten.
+ *
+ * returns: OS_SUCCESS, OS_ERR_NOT_IMPLEMENTED if the descriptor cannot be
+ *          used with epoll, or OS_ERROR
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_SelectRegister(int epfd, OS_impl_select_entry_t *entry, osal_id_t active_id, int fd,
+                                     uint32 events, uint32 tag)
+{
+    struct epoll_event ev;
+    int                op;
+    int                os_status;
+
+    if (!OS_ObjectIdEqual(entry->id, active_id) || entry->fd != fd)
+    {
+        entry->id     = OS_OBJECT_ID_UNDEFINED;
+        entry->fd     = -1;
+        entry->events = 0;
+    }
+
+    if (events == entry->events)
+    {
+        return OS_SUCCESS;
+    }
+
+    if (events == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+    else if (entry->events == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else
+    {
+        op = EPOLL_CTL_MOD;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events   = events;
+    ev.data.u32 = tag;
+
+    os_status = epoll_ctl(epfd, op, fd, &ev);
+    if (os_status < 0 && op == EPOLL_CTL_ADD && errno == EEXIST)
+    {
+        /* still registered through a duplicate of the descriptor */
+        os_status = epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev);
+    }
+
+    if (os_status < 0 && op != EPOLL_CTL_DEL)
+    {
+        entry->id     = OS_OBJECT_ID_UNDEFINED;
+        entry->fd     = -1;
+        entry->events = 0;
+
+        /* EPERM indicates a descriptor such as a regular file which epoll does not support */
+        if (errno == EPERM)
+        {
+            return OS_ERR_NOT_IMPLEMENTED;
+        }
+
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    entry->id     = active_id;
+    entry->fd     = fd;
+    entry->events = events;
+
+    return OS_SUCCESS;
+} /* end OS_Posix_SelectRegister */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectQueuesDone
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finishes waiting on any queues still prepared for select.
+ *           Also used as a cleanup handler in case the task is deleted while waiting.
+ *-----------------------------------------------------------------*/
+static void OS_Posix_SelectQueuesDone(void *arg)
+{
+    OS_impl_select_cache_t *cache = arg;
+    osal_index_t            idx;
+
+    for (idx = 0; idx < OS_MAX_QUEUES; ++idx)
+    {
+        if (cache->queues[idx].waiting)
+        {
+            OS_Posix_QueueSelectEnd(idx, false);
+            cache->queues[idx].waiting = false;
+        }
+    }
+} /* end OS_Posix_SelectQueuesDone */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectIsSet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks a bit in one of the bitmaps of an OS_FdSet
+ *-----------------------------------------------------------------*/
+static inline bool OS_Posix_SelectIsSet(const uint8 *ids, osal_index_t idx)
+{
+    return ((ids[idx >> 3] >> (idx & 0x7)) & 0x1);
+} /* end OS_Posix_SelectIsSet */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectRegisterStreams
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Registers the streams in the sets with the epoll set of the task,
+ *           and unregisters any that are no longer in the sets.
+ *
+ * returns: OS_SUCCESS or relevant error code
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_SelectRegisterStreams(OS_impl_select_cache_t *cache, const OS_FdSet *ReadSet,
+                                            const OS_FdSet *WriteSet, uint32 *valid_count)
+{
+    osal_index_t idx;
+    uint32       events;
+    int          fd;
+    int32        return_code;
+
+    for (idx = 0; idx < OS_MAX_NUM_OPEN_FILES; ++idx)
+    {
+        events = 0;
+        fd     = OS_impl_filehandle_table[idx].fd;
+        if (ReadSet != NULL && OS_Posix_SelectIsSet(ReadSet->object_ids, idx))
+        {
+            events |= EPOLLIN;
+        }
+        if (WriteSet != NULL && OS_Posix_SelectIsSet(WriteSet->object_ids, idx))
+        {
+            events |= EPOLLOUT;
+        }
+
+        if (fd < 0)
+        {
+            /* not a valid handle, ignored the same as with select() */
+            events = 0;
+        }
+        else if (events != 0)
+        {
+            if (!OS_impl_filehandle_table[idx].selectable)
+            {
+                return OS_ERR_OPERATION_NOT_SUPPORTED;
+            }
+            ++(*valid_count);
+        }
+
+        return_code = OS_Posix_SelectRegister(cache->epfd, &cache->streams[idx], OS_global_stream_table[idx].active_id,
+                                              fd, events, idx);
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+    }
+
+    return OS_SUCCESS;
+} /* end OS_Posix_SelectRegisterStreams */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectBeginQueues
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Prepares the queues in the set to be waited on and registers
+ *           their descriptors with the epoll set of the task, and
+ *           unregisters any that are no longer in the set.
+ *
+ * returns: OS_SUCCESS or relevant error code
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_SelectBeginQueues(OS_impl_select_cache_t *cache, const OS_FdSet *ReadSet, uint32 *valid_count,
+                                        bool *any_ready)
+{
+    OS_impl_select_entry_t *entry;
+    osal_index_t            idx;
+    osal_id_t               active_id;
+    uint32                  events;
+    int                     fd;
+    bool                    ready;
+    int32                   return_code;
+
+    for (idx = 0; idx < OS_MAX_QUEUES; ++idx)
+    {
+        entry     = &cache->queues[idx];
+        active_id = OS_global_queue_table[idx].active_id;
+        fd        = entry->fd;
+        events    = 0;
+
+        if (ReadSet != NULL && OS_Posix_SelectIsSet(ReadSet->queue_ids, idx) && OS_ObjectIdDefined(active_id))
+        {
+            return_code = OS_Posix_QueueSelectBegin(idx, &fd, &ready);
+            if (return_code == OS_SUCCESS)
+            {
+                entry->waiting = true;
+                entry->ready   = false;
+                events         = EPOLLIN;
+                *any_ready |= ready;
+                ++(*valid_count);
+            }
+            else if (return_code != OS_ERR_INVALID_ID)
+            {
+                return return_code;
+            }
+
+            /* otherwise the queue is being deleted, ignored the same as an invalid handle */
+        }
+
+        return_code = OS_Posix_SelectRegister(cache->epfd, entry, active_id, fd, events, OS_MAX_NUM_OPEN_FILES + idx);
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+    }
+
+    return OS_SUCCESS;
+} /* end OS_Posix_SelectBeginQueues */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_SelectWait
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits on the epoll set of the task, retrying if interrupted
+ *
+ * returns: Number of ready events, or -1 on error
+ *-----------------------------------------------------------------*/
+static int OS_Posix_SelectWait(OS_impl_select_cache_t *cache, int32 msecs, const struct timespec *ts_end)
+{
+    struct timespec ts_now;
+    int             timeout;
+    int             os_status;
+
+    do
+    {
+        if (msecs <= 0)
+        {
+            timeout = msecs;
+        }
+        else
+        {
+            clock_gettime(CLOCK_MONOTONIC, &ts_now);
+
+            /* round up so the wait does not end just short of the deadline */
+            timeout = ((ts_end->tv_sec - ts_now.tv_sec) * 1000) +
+                      ((ts_end->tv_nsec - ts_now.tv_nsec + 999999) / 1000000);
+            if (timeout < 0)
+            {
+                timeout = 0;
+            }
+        }
+
+        os_status = epoll_wait(cache->epfd, cache->events, OS_MAX_NUM_OPEN_FILES + OS_MAX_QUEUES, timeout);
+    } while (os_status < 0 && errno == EINTR);
+
+    return os_status;
+} /* end OS_Posix_SelectWait */
+
+/****************************************************************************************
+                                SELECT API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectMultipleEpoll_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectMultipleEpoll_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+{
+    OS_impl_select_cache_t *cache;
+    OS_FdSet                rd_out;
+    OS_FdSet                wr_out;
+    struct timespec         ts_now;
+    struct timespec         ts_end;
+    osal_index_t            idx;
+    size_t                  offset;
+    uint32                  stream_count;
+    uint32                  valid_count;
+    uint32                  ready_count;
+    uint32                  tag;
+    uint32                  revents;
+    bool                    any_ready;
+    int                     os_status;
+    int                     i;
+    int32                   return_code;
+
+    /* queues can only be waited on for readability */
+    if (WriteSet != NULL)
+    {
+        for (offset = 0; offset < sizeof(WriteSet->queue_ids); ++offset)
+        {
+            if (WriteSet->queue_ids[offset] != 0)
+            {
+                return OS_ERR_OPERATION_NOT_SUPPORTED;
+            }
+        }
+    }
+
+    cache = OS_Posix_SelectGetCache();
+    if (cache == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    stream_count = 0;
+    return_code  = OS_Posix_SelectRegisterStreams(cache, ReadSet, WriteSet, &stream_count);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    if (msecs > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts_now);
+        ts_end.tv_sec  = ts_now.tv_sec + (msecs / 1000);
+        ts_end.tv_nsec = ts_now.tv_nsec + (1000000 * (msecs % 1000));
+        if (ts_end.tv_nsec >= 1000000000)
+        {
+            ++ts_end.tv_sec;
+            ts_end.tv_nsec -= 1000000000;
+        }
+    }
+    else
+    {
+        /* Zero for consistency and to avoid possible confusion if not cleared */
+        memset(&ts_end, 0, sizeof(ts_end));
+    }
+
+    /*
+     * Waking on a queue descriptor does not guarantee that a message is still
+     * there by the time the queue is checked, so keep waiting until something
+     * is actually ready or the timeout expires.
+     */
+    while (true)
+    {
+        valid_count = stream_count;
+        any_ready   = false;
+        return_code = OS_Posix_SelectBeginQueues(cache, ReadSet, &valid_count, &any_ready);
+        if (return_code != OS_SUCCESS)
+        {
+            OS_Posix_SelectQueuesDone(cache);
+            break;
+        }
+
+        if (valid_count == 0)
+        {
+            /*
+             * This return code will be used if the set(s) were
+             * both empty/NULL or otherwise did not contain valid filehandles.
+             */
+            return_code = OS_ERR_INVALID_ID;
+            break;
+        }
+
+        pthread_cleanup_push(OS_Posix_SelectQueuesDone, cache);
+        os_status = OS_Posix_SelectWait(cache, any_ready ? 0 : msecs, &ts_end);
+        pthread_cleanup_pop(0);
+
+        memset(&rd_out, 0, sizeof(rd_out));
+        memset(&wr_out, 0, sizeof(wr_out));
+        ready_count = 0;
+
+        for (i = 0; i < os_status; ++i)
+        {
+            tag     = cache->events[i].data.u32;
+            revents = cache->events[i].events;
+            if (tag < OS_MAX_NUM_OPEN_FILES)
+            {
+                /* like select(), an error or hangup counts as both readable and writable */
+                if ((cache->streams[tag].events & EPOLLIN) != 0 && (revents & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0)
+                {
+                    rd_out.object_ids[tag >> 3] |= 1 << (tag & 0x7);
+                    ++ready_count;
+                }
+                if ((cache->streams[tag].events & EPOLLOUT) != 0 &&
+                    (revents & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0)
+                {
+                    wr_out.object_ids[tag >> 3] |= 1 << (tag & 0x7);
+                    ++ready_count;
+                }
+            }
+            else if ((tag - OS_MAX_NUM_OPEN_FILES) < OS_MAX_QUEUES)
+            {
+                cache->queues[tag - OS_MAX_NUM_OPEN_FILES].ready = true;
+            }
+        }
+
+        for (idx = 0; idx < OS_MAX_QUEUES; ++idx)
+        {
+            if (cache->queues[idx].waiting)
+            {
+                if (OS_Posix_QueueSelectEnd(idx, cache->queues[idx].ready))
+                {
+                    rd_out.queue_ids[idx >> 3] |= 1 << (idx & 0x7);
+                    ++ready_count;
+                }
+                cache->queues[idx].waiting = false;
+            }
+        }
+
+        if (ready_count > 0)
+        {
+            if (ReadSet != NULL)
+            {
+                *ReadSet = rd_out;
+            }
+            if (WriteSet != NULL)
+            {
+                *WriteSet = wr_out;
+            }
+            return_code = OS_SUCCESS;
+            break;
+        }
+
+        if (os_status < 0)
+        {
+            OS_DEBUG("epoll_wait: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        if (msecs == 0)
+        {
+            return_code = OS_ERROR_TIMEOUT;
+            break;
+        }
+
+        if (msecs > 0)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &ts_now);
+            if (ts_now.tv_sec > ts_end.tv_sec || (ts_now.tv_sec == ts_end.tv_sec && ts_now.tv_nsec >= ts_end.tv_nsec))
+            {
+                return_code = OS_ERROR_TIMEOUT;
+                break;
+            }
+        }
+    }
+
+    return return_code;
+} /* end OS_SelectMultipleEpoll_Impl */
+
+#endif /* OS_IMPL_SELECT_EPOLL */
@@ -0,0 +1,188 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-sockets.c
+ * \ingroup  posix
+ *
+ * Batched datagram calls used by the BSD socket implementation
+ * where the OS provides them.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#ifdef __linux__
+/* recvmmsg() and sendmmsg() are GNU extensions */
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <errno.h>
+
+#include "os-posix.h"
+#include "os-impl-sockets.h"
+
+#ifdef OS_IMPL_SOCKET_MULTI_MSG
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Upper bound on the datagrams handled per recvmmsg()/sendmmsg() call,
+ * as the message headers are kept on the stack.
+ */
+#define OS_IMPL_SOCKET_MMSG_MAX 32
+
+/****************************************************************************************
+                                 IMPLEMENTATION
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvMultiMsg_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvMultiMsg_Impl(int fd, OS_SockMsg_t *MsgVec, uint32 MsgCount, int waitflags)
+{
+    struct mmsghdr msgs[OS_IMPL_SOCKET_MMSG_MAX];
+    struct iovec   iov[OS_IMPL_SOCKET_MMSG_MAX];
+    uint32         i;
+    int            os_result;
+
+    if (MsgCount > OS_IMPL_SOCKET_MMSG_MAX)
+    {
+        MsgCount = OS_IMPL_SOCKET_MMSG_MAX;
+    }
+
+    memset(msgs, 0, sizeof(msgs[0]) * MsgCount);
+    for (i = 0; i < MsgCount; ++i)
+    {
+        iov[i].iov_base            = MsgVec[i].Buffer;
+        iov[i].iov_len             = MsgVec[i].BufferSize;
+        msgs[i].msg_hdr.msg_iov    = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        if (MsgVec[i].RemoteAddr != NULL)
+        {
+            msgs[i].msg_hdr.msg_name    = &MsgVec[i].RemoteAddr->AddrData;
+            msgs[i].msg_hdr.msg_namelen = OS_SOCKADDR_MAX_LEN;
+        }
+    }
+
+    /* MSG_WAITFORONE: after the first datagram, do not block for the rest */
+    os_result = recvmmsg(fd, msgs, MsgCount, waitflags | MSG_WAITFORONE, NULL);
+    if (os_result < 0)
+    {
+        if (errno == ENOSYS)
+        {
+            return OS_ERR_NOT_IMPLEMENTED;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return OS_QUEUE_EMPTY;
+        }
+
+        OS_DEBUG("recvmmsg: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    for (i = 0; i < (uint32)os_result; ++i)
+    {
+        MsgVec[i].ActualLength = msgs[i].msg_len;
+        if (MsgVec[i].RemoteAddr != NULL)
+        {
+            MsgVec[i].RemoteAddr->ActualLength = msgs[i].msg_hdr.msg_namelen;
+        }
+    }
+
+    return os_result;
+} /* end OS_SocketRecvMultiMsg_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendMultiMsg_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendMultiMsg_Impl(int fd, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+{
+    struct mmsghdr msgs[OS_IMPL_SOCKET_MMSG_MAX];
+    struct iovec   iov[OS_IMPL_SOCKET_MMSG_MAX];
+    uint32         total;
+    uint32         chunk;
+    uint32         i;
+    int            os_result;
+
+    total = 0;
+    while (total < MsgCount)
+    {
+        chunk = MsgCount - total;
+        if (chunk > OS_IMPL_SOCKET_MMSG_MAX)
+        {
+            chunk = OS_IMPL_SOCKET_MMSG_MAX;
+        }
+
+        memset(msgs, 0, sizeof(msgs[0]) * chunk);
+        for (i = 0; i < chunk; ++i)
+        {
+            iov[i].iov_base             = MsgVec[total + i].Buffer;
+            iov[i].iov_len              = MsgVec[total + i].BufferSize;
+            msgs[i].msg_hdr.msg_iov     = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+            msgs[i].msg_hdr.msg_name    = (void *)&MsgVec[total + i].RemoteAddr->AddrData;
+            msgs[i].msg_hdr.msg_namelen = MsgVec[total + i].RemoteAddr->ActualLength;
+        }
+
+        os_result = sendmmsg(fd, msgs, chunk, MSG_DONTWAIT);
+        if (os_result < 0)
+        {
+            if (total > 0)
+            {
+                /* report the part of the batch that was sent */
+                break;
+            }
+            if (errno == ENOSYS)
+            {
+                return OS_ERR_NOT_IMPLEMENTED;
+            }
+
+            OS_DEBUG("sendmmsg: %s\n", strerror(errno));
+            return OS_ERROR;
+        }
+
+        total += os_result;
+        if ((uint32)os_result < chunk)
+        {
+            /* socket buffer is full, the caller may retry the rest */
+            break;
+        }
+    }
+
+    return total;
+} /* end OS_SocketSendMultiMsg_Impl */
+
+#endif /* OS_IMPL_SOCKET_MULTI_MSG */
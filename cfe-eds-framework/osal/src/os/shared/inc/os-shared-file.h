@@ -111,6 +111,16 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
  ------------------------------------------------------------------*/
 int32 OS_GenericClose_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+   Function: OS_FileCopyRange_Impl
+
+    Purpose: Copy up to nbytes from the current position of one file
+             descriptor to the current position of another
+
+    Returns: Number of bytes copied (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes);
+
 /*----------------------------------------------------------------
    Function: OS_FileOpen_Impl
 
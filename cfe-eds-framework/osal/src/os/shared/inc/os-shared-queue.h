@@ -88,6 +88,19 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied, int32 timeout);
 
+/*----------------------------------------------------------------
+   Function: OS_QueueGetMulti_Impl
+
+    Purpose: Receive up to "count" messages on a message queue, "size" bytes apart.
+             The calling task will be blocked until the first message is available,
+             any others are only taken if they are already on the queue
+
+    Returns: OS_SUCCESS if at least one message was received, or relevant error code
+             as for OS_QueueGet_Impl() otherwise.  "count_copied" is always set.
+ ------------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t size, uint32 count,
+                            uint32 *count_copied, int32 timeout);
+
 /*----------------------------------------------------------------
    Function: OS_QueuePut_Impl
 
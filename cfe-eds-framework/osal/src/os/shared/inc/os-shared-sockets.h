@@ -119,6 +119,29 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
                            const OS_SockAddr_t *RemoteAddr);
 
+/*----------------------------------------------------------------
+   Function: OS_SocketRecvMulti_Impl
+
+    Purpose: Receives up to "MsgCount" datagrams from the specified socket
+             (must be of the DATAGRAM type) into the buffers given in "MsgVec"
+             Will wait up to "timeout" milliseconds for the first datagram
+             (zero to poll, negative to wait forever), later ones are only
+             taken if already queued
+
+    Returns: Number of datagrams received on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout);
+
+/*----------------------------------------------------------------
+   Function: OS_SocketSendMulti_Impl
+
+    Purpose: Sends up to "MsgCount" datagrams from the specified socket
+             (must be of the DATAGRAM type), each to its own remote address
+
+    Returns: Number of datagrams sent on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendMulti_Impl(const OS_object_token_t *token, const OS_SockMsg_t *MsgVec, uint32 MsgCount);
+
 /*----------------------------------------------------------------
 
    Function: OS_SocketGetInfo_Impl
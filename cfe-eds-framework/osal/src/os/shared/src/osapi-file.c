@@ -67,12 +67,11 @@ enum
 OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
 
 /*
- * OS_cp copyblock size - in theory could be adjusted
- * to match page size for performance so providing a unique
- * define here.  Given a requirement/request could be transitioned
- * to a configuration parameter
+ * OS_cp copy size - the maximum number of bytes requested from
+ * OS_FileCopyRange() per call.  The copy itself is done by the
+ * implementation, which decides how to move the data.
  */
-#define OS_CP_BLOCK_SIZE 512
+#define OS_CP_BLOCK_SIZE 0x40000000
 
 /*----------------------------------------------------------------
  *
@@ -423,12 +422,9 @@ int32 OS_rename(const char *old, const char *new)
 int32 OS_cp(const char *src, const char *dest)
 {
     int32     return_code;
-    int32     rd_size;
-    int32     wr_size;
-    int32     wr_total;
+    int32     cp_size;
     osal_id_t file1;
     osal_id_t file2;
-    uint8     copyblock[OS_CP_BLOCK_SIZE];
 
     /* Check Parameters */
     OS_CHECK_POINTER(src);
@@ -444,27 +440,15 @@ int32 OS_cp(const char *src, const char *dest)
 
     while (return_code == OS_SUCCESS)
     {
-        rd_size = OS_read(file1, copyblock, sizeof(copyblock));
-        if (rd_size < 0)
+        cp_size = OS_FileCopyRange(file1, file2, OS_CP_BLOCK_SIZE);
+        if (cp_size < 0)
         {
-            return_code = rd_size;
-            break;
+            return_code = cp_size;
         }
-        if (rd_size == 0)
+        else if (cp_size == 0)
         {
             break;
         }
-        wr_total = 0;
-        while (wr_total < rd_size)
-        {
-            wr_size = OS_write(file2, &copyblock[wr_total], rd_size - wr_total);
-            if (wr_size < 0)
-            {
-                return_code = wr_size;
-                break;
-            }
-            wr_total += wr_size;
-        }
     }
 
     if (OS_ObjectIdDefined(file1))
@@ -480,6 +464,49 @@ int32 OS_cp(const char *src, const char *dest)
 
 } /* end OS_cp */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyRange
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopyRange(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+{
+    OS_object_token_t src_token;
+    OS_object_token_t dest_token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_SIZE(nbytes);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, src_fd, &src_token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, dest_fd, &dest_token);
+        if (return_code == OS_SUCCESS)
+        {
+            /* The copy is only defined for files, not sockets */
+            if (OS_OBJECT_TABLE_GET(OS_stream_table, src_token)->socket_domain != OS_SocketDomain_INVALID ||
+                OS_OBJECT_TABLE_GET(OS_stream_table, dest_token)->socket_domain != OS_SocketDomain_INVALID)
+            {
+                return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+            }
+            else
+            {
+                return_code = OS_FileCopyRange_Impl(&src_token, &dest_token, nbytes);
+            }
+
+            OS_ObjectIdRelease(&dest_token);
+        }
+
+        OS_ObjectIdRelease(&src_token);
+    }
+
+    return return_code;
+} /* end OS_FileCopyRange */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_mv
@@ -190,6 +190,48 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
     return return_code;
 } /* end OS_QueueGet */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_QueueGetMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t size, uint32 count, uint32 *count_copied,
+                       int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(count_copied);
+    OS_CHECK_SIZE(size);
+    OS_CHECK_SIZE(count);
+
+    *count_copied = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size < queue->max_size)
+        {
+            /* Each message must fit in its part of the buffer */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueGetMulti_Impl(&token, data, size, count, count_copied, timeout);
+        }
+    }
+
+    return return_code;
+} /* end OS_QueueGetMulti */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_QueuePut
@@ -50,6 +50,32 @@
  *********************************************************************************
  */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectFdLocate
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Determines which bitmap of an OS_FdSet holds the given ID,
+ *           and the bit index of the ID within that bitmap.
+ *
+ *           Message queues are tracked separately from streams, anything
+ *           else is looked up as a stream.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_SelectFdLocate(osal_id_t objid, osal_objtype_t *objtype, osal_index_t *local_id)
+{
+    if (OS_IdentifyObject(objid) == OS_OBJECT_TYPE_OS_QUEUE)
+    {
+        *objtype = OS_OBJECT_TYPE_OS_QUEUE;
+    }
+    else
+    {
+        *objtype = OS_OBJECT_TYPE_OS_STREAM;
+    }
+
+    return OS_ObjectIdToArrayIndex(*objtype, objid, local_id);
+} /* end OS_SelectFdLocate */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SelectSingle
@@ -132,21 +158,32 @@ int32 OS_SelectFdZero(OS_FdSet *Set)
  *-----------------------------------------------------------------*/
 int32 OS_SelectFdAdd(OS_FdSet *Set, osal_id_t objid)
 {
-    int32        return_code;
-    osal_index_t local_id;
+    int32          return_code;
+    osal_index_t   local_id;
+    osal_objtype_t objtype;
+    uint8 *        ids;
 
     /* check parameters */
     OS_CHECK_POINTER(Set);
 
-    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+    return_code = OS_SelectFdLocate(objid, &objtype, &local_id);
     if (return_code == OS_SUCCESS)
     {
+        if (objtype == OS_OBJECT_TYPE_OS_QUEUE)
+        {
+            ids = Set->queue_ids;
+        }
+        else
+        {
+            ids = Set->object_ids;
+        }
+
         /*
-         * Sets the bit in the uint8 object_ids array that corresponds
+         * Sets the bit in the uint8 ids array that corresponds
          * to the local_id where local_id >> 3 determines the array element,
          * and the mask/shift sets the bit within that element.
          */
-        Set->object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+        ids[local_id >> 3] |= 1 << (local_id & 0x7);
     }
 
     return return_code;
@@ -162,21 +199,32 @@ int32 OS_SelectFdAdd(OS_FdSet *Set, osal_id_t objid)
  *-----------------------------------------------------------------*/
 int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid)
 {
-    int32        return_code;
-    osal_index_t local_id;
+    int32          return_code;
+    osal_index_t   local_id;
+    osal_objtype_t objtype;
+    uint8 *        ids;
 
     /* check parameters */
     OS_CHECK_POINTER(Set);
 
-    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+    return_code = OS_SelectFdLocate(objid, &objtype, &local_id);
     if (return_code == OS_SUCCESS)
     {
+        if (objtype == OS_OBJECT_TYPE_OS_QUEUE)
+        {
+            ids = Set->queue_ids;
+        }
+        else
+        {
+            ids = Set->object_ids;
+        }
+
         /*
-         * Clears the bit in the uint8 object_ids array that corresponds
+         * Clears the bit in the uint8 ids array that corresponds
          * to the local_id where local_id >> 3 determines the array element,
          * and the mask/shift clears the bit within that element.
          */
-        Set->object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+        ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
     }
 
     return return_code;
@@ -192,22 +240,33 @@ int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid)
  *-----------------------------------------------------------------*/
 bool OS_SelectFdIsSet(const OS_FdSet *Set, osal_id_t objid)
 {
-    int32        return_code;
-    osal_index_t local_id;
+    int32          return_code;
+    osal_index_t   local_id;
+    osal_objtype_t objtype;
+    const uint8 *  ids;
 
     /* check parameters */
     BUGCHECK(Set != NULL, false);
 
-    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+    return_code = OS_SelectFdLocate(objid, &objtype, &local_id);
     if (return_code != OS_SUCCESS)
     {
         return false;
     }
 
+    if (objtype == OS_OBJECT_TYPE_OS_QUEUE)
+    {
+        ids = Set->queue_ids;
+    }
+    else
+    {
+        ids = Set->object_ids;
+    }
+
     /*
-     * Returns boolean for if the bit in the uint8 object_ids array that corresponds
+     * Returns boolean for if the bit in the uint8 ids array that corresponds
      * to the local_id is set where local_id >> 3 determines the array element,
      * and the mask/shift checks the bit within that element.
      */
-    return ((Set->object_ids[local_id >> 3] >> (local_id & 0x7)) & 0x1);
+    return ((ids[local_id >> 3] >> (local_id & 0x7)) & 0x1);
 } /* end OS_SelectFdIsSet */
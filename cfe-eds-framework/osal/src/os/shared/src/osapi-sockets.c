@@ -485,6 +485,104 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return return_code;
 } /* end OS_SocketSendTo */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvMulti(osal_id_t sock_id, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+    uint32                       i;
+
+    /*
+     * Check parameters
+     *
+     * As with OS_SocketRecvFrom(), each "RemoteAddr" may validly be null.
+     */
+    OS_CHECK_POINTER(MsgVec);
+    OS_CHECK_SIZE(MsgCount);
+    for (i = 0; i < MsgCount; ++i)
+    {
+        OS_CHECK_POINTER(MsgVec[i].Buffer);
+        OS_CHECK_SIZE(MsgVec[i].BufferSize);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else if ((stream->stream_state & OS_STREAM_STATE_BOUND) == 0)
+        {
+            /* Socket needs to be bound first */
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            return_code = OS_SocketRecvMulti_Impl(&token, MsgVec, MsgCount, timeout);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SocketRecvMulti */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendMulti(osal_id_t sock_id, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+    uint32                       i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(MsgVec);
+    OS_CHECK_SIZE(MsgCount);
+    for (i = 0; i < MsgCount; ++i)
+    {
+        OS_CHECK_POINTER(MsgVec[i].Buffer);
+        OS_CHECK_SIZE(MsgVec[i].BufferSize);
+        OS_CHECK_POINTER(MsgVec[i].RemoteAddr);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_SocketSendMulti_Impl(&token, MsgVec, MsgCount);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SocketSendMulti */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketGetIdByName
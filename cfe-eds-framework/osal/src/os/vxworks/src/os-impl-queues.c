@@ -182,6 +182,40 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return return_code;
 } /* end OS_QueueGet_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_QueueGetMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t size, uint32 count,
+                            uint32 *count_copied, int32 timeout)
+{
+    int32  return_code;
+    size_t size_copied;
+    uint8 *dest = data;
+    uint32 received;
+
+    received    = 0;
+    return_code = OS_QueueGet_Impl(token, dest, size, &size_copied, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        /* take the rest only if they are already there */
+        received = 1;
+        while (received < count &&
+               OS_QueueGet_Impl(token, &dest[received * size], size, &size_copied, OS_CHECK) == OS_SUCCESS)
+        {
+            ++received;
+        }
+    }
+
+    *count_copied = received;
+
+    return return_code;
+} /* end OS_QueueGetMulti_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_QueuePut_Impl
@@ -239,6 +239,10 @@ void TestDatagramNetworkApi(void)
     uint16           PortNum;
     OS_socket_prop_t prop;
     OS_SockAddr_t    l_addr;
+    OS_SockAddr_t    m_addr[3];
+    uint32           MultiBuf[3];
+    OS_SockMsg_t     MultiMsg[3];
+    uint32           i;
 
     if (!networkImplemented)
     {
@@ -278,6 +282,20 @@ void TestDatagramNetworkApi(void)
     UtAssert_INT32_EQ(OS_SocketSendTo(p2_socket_id, &Buf2, 0, &l_addr), OS_ERR_INVALID_SIZE);
     UtAssert_INT32_EQ(OS_SocketSendTo(p2_socket_id, &Buf2, sizeof(Buf2), NULL), OS_INVALID_POINTER);
 
+    /* OS_SocketRecvMulti / OS_SocketSendMulti */
+    memset(MultiMsg, 0, sizeof(MultiMsg));
+    MultiMsg[0].Buffer     = &Buf2;
+    MultiMsg[0].BufferSize = sizeof(Buf2);
+    MultiMsg[0].RemoteAddr = &l_addr;
+    UtAssert_INT32_EQ(OS_SocketRecvMulti(invalid_fd, MultiMsg, 1, UT_TIMEOUT), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_SocketRecvMulti(regular_file_id, MultiMsg, 1, UT_TIMEOUT), OS_ERR_INCORRECT_OBJ_TYPE);
+    UtAssert_INT32_EQ(OS_SocketRecvMulti(p2_socket_id, NULL, 1, UT_TIMEOUT), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketRecvMulti(p2_socket_id, MultiMsg, 0, UT_TIMEOUT), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketSendMulti(invalid_fd, MultiMsg, 1), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_SocketSendMulti(regular_file_id, MultiMsg, 1), OS_ERR_INCORRECT_OBJ_TYPE);
+    UtAssert_INT32_EQ(OS_SocketSendMulti(p2_socket_id, NULL, 1), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendMulti(p2_socket_id, MultiMsg, 0), OS_ERR_INVALID_SIZE);
+
     /* OS_SocketGetInfo */
     UtAssert_INT32_EQ(OS_SocketGetInfo(OS_OBJECT_ID_UNDEFINED, &prop), OS_ERR_INVALID_ID);
     UtAssert_INT32_EQ(OS_SocketGetInfo(invalid_fd, &prop), OS_ERR_INVALID_ID);
@@ -324,6 +342,38 @@ void TestDatagramNetworkApi(void)
     UtAssert_True(strcmp(AddrBuffer3, AddrBuffer4) == 0, "AddrBuffer3 (%s) == AddrBuffer4 (%s)", AddrBuffer3,
                   AddrBuffer4);
 
+    /*
+     * Send a batch of messages from peer1 to peer2 and receive them as a batch
+     */
+    for (i = 0; i < 3; ++i)
+    {
+        MultiBuf[i]            = 300 + i;
+        MultiMsg[i].Buffer     = &MultiBuf[i];
+        MultiMsg[i].BufferSize = sizeof(MultiBuf[i]);
+        MultiMsg[i].RemoteAddr = &p2_addr;
+    }
+    UtAssert_INT32_EQ(OS_SocketSendMulti(p1_socket_id, MultiMsg, 3), 3);
+
+    for (i = 0; i < 3; ++i)
+    {
+        MultiBuf[i]              = 0;
+        MultiMsg[i].ActualLength = 0;
+        MultiMsg[i].RemoteAddr   = &m_addr[i];
+    }
+
+    /* all three are queued on the loopback by now, so one call should return them all */
+    UtAssert_INT32_EQ(OS_SocketRecvMulti(p2_socket_id, MultiMsg, 3, UT_TIMEOUT), 3);
+    for (i = 0; i < 3; ++i)
+    {
+        UtAssert_UINT32_EQ(MultiMsg[i].ActualLength, sizeof(MultiBuf[i]));
+        UtAssert_UINT32_EQ(MultiBuf[i], 300 + i);
+        UtAssert_INT32_EQ(OS_SocketAddrToString(AddrBuffer2, sizeof(AddrBuffer2), &m_addr[i]), OS_SUCCESS);
+        UtAssert_STRINGBUF_EQ(AddrBuffer1, sizeof(AddrBuffer1), AddrBuffer2, sizeof(AddrBuffer2));
+    }
+
+    /* nothing else is pending */
+    UtAssert_INT32_EQ(OS_SocketRecvMulti(p2_socket_id, MultiMsg, 3, 0), OS_ERROR_TIMEOUT);
+
     /* Get port from incoming address and verify */
     UtAssert_INT32_EQ(OS_SocketAddrGetPort(&PortNum, &p2_addr), OS_SUCCESS);
     UtAssert_True(PortNum == 9998, "PortNum (%u) == 9998", (unsigned int)PortNum);
@@ -22,6 +22,7 @@
 ** Queue read timeout test
 */
 #include <stdio.h>
+#include <string.h>
 #include "common_types.h"
 #include "osapi.h"
 #include "utassert.h"
@@ -50,7 +51,10 @@ uint32    task_1_timeouts;
 uint32    task_1_messages;
 uint32    task_2_stack[TASK_2_STACK_SIZE];
 osal_id_t task_2_id;
+int32     task_2_status;
+bool      task_2_done;
 osal_id_t msgq_id;
+uint32    msgq_flags;
 
 uint32    timer_counter;
 osal_id_t timer_id;
@@ -202,7 +206,7 @@ void QueueMessageSetup(void)
     task_1_messages = 0;
     task_1_timeouts = 0;
 
-    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_DEPTH), OSAL_SIZE_C(MSGQ_SIZE), 0);
+    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_DEPTH), OSAL_SIZE_C(MSGQ_SIZE), msgq_flags);
     UtAssert_True(status == OS_SUCCESS, "MsgQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(msgq_id), (int)status);
 
     /*
@@ -240,6 +244,119 @@ void QueueMessageSetup(void)
     }
 }
 
+void QueueLocalMessageSetup(void)
+{
+    /* Same as the message test, but using an in-process queue */
+    msgq_flags = OS_QUEUE_FLAG_LOCAL;
+    QueueMessageSetup();
+    msgq_flags = 0;
+}
+
+void QueueLocalDepthCheck(void)
+{
+    int32  status;
+    uint32 Data;
+    size_t data_size;
+    int    i;
+
+    /* the depth is not a power of two, so the queue must stop short of its internal capacity */
+    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_TOTAL), OSAL_SIZE_C(MSGQ_SIZE),
+                            OS_QUEUE_FLAG_LOCAL);
+    UtAssert_True(status == OS_SUCCESS, "MsgQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(msgq_id), (int)status);
+
+    for (i = 0; i < MSGQ_TOTAL; i++)
+    {
+        Data   = i;
+        status = OS_QueuePut(msgq_id, (void *)&Data, sizeof(Data), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS Queue Put Rc=%d", (int)status);
+    }
+
+    status = OS_QueuePut(msgq_id, (void *)&Data, sizeof(Data), 0);
+    UtAssert_True(status == OS_QUEUE_FULL, "OS Queue Put when full Rc=%d", (int)status);
+
+    status = OS_QueueGet(msgq_id, (void *)&Data, OSAL_SIZE_C(MSGQ_SIZE), &data_size, OS_CHECK);
+    UtAssert_True(status == OS_SUCCESS && Data == 0, "OS Queue Get Rc=%d Data=%u", (int)status, (unsigned int)Data);
+
+    status = OS_QueuePut(msgq_id, (void *)&Data, sizeof(Data), 0);
+    UtAssert_True(status == OS_SUCCESS, "OS Queue Put after get Rc=%d", (int)status);
+    status = OS_QueuePut(msgq_id, (void *)&Data, sizeof(Data), 0);
+    UtAssert_True(status == OS_QUEUE_FULL, "OS Queue Put when full again Rc=%d", (int)status);
+
+    status = OS_QueueDelete(msgq_id);
+    UtAssert_True(status == OS_SUCCESS, "Queue 1 delete Rc=%d", (int)status);
+}
+
+void QueueLocalMultiCheck(void)
+{
+    int32  status;
+    uint32 Data[MSGQ_TOTAL];
+    uint32 count;
+    int    i;
+
+    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_TOTAL), OSAL_SIZE_C(MSGQ_SIZE),
+                            OS_QUEUE_FLAG_LOCAL);
+    UtAssert_True(status == OS_SUCCESS, "MsgQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(msgq_id), (int)status);
+
+    status = OS_QueueGetMulti(msgq_id, Data, OSAL_SIZE_C(MSGQ_SIZE), MSGQ_TOTAL, &count, OS_CHECK);
+    UtAssert_True(status == OS_QUEUE_EMPTY && count == 0, "OS Queue Get Multi when empty Rc=%d", (int)status);
+
+    for (i = 0; i < 3; i++)
+    {
+        Data[0] = i;
+        status  = OS_QueuePut(msgq_id, (void *)&Data[0], sizeof(Data[0]), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS Queue Put Rc=%d", (int)status);
+    }
+
+    memset(Data, 0xFF, sizeof(Data));
+    status = OS_QueueGetMulti(msgq_id, Data, OSAL_SIZE_C(MSGQ_SIZE), MSGQ_TOTAL, &count, OS_CHECK);
+    UtAssert_True(status == OS_SUCCESS && count == 3, "OS Queue Get Multi Rc=%d Count=%u", (int)status,
+                  (unsigned int)count);
+    for (i = 0; i < 3; i++)
+    {
+        UtAssert_True(Data[i] == i, "Message %d Data=%u", i, (unsigned int)Data[i]);
+    }
+
+    status = OS_QueueDelete(msgq_id);
+    UtAssert_True(status == OS_SUCCESS, "Queue 1 delete Rc=%d", (int)status);
+}
+
+void task_2(void)
+{
+    uint32 data_received;
+    size_t data_size;
+
+    task_2_status = OS_QueueGet(msgq_id, (void *)&data_received, OSAL_SIZE_C(MSGQ_SIZE), &data_size, OS_PEND);
+    task_2_done   = true;
+}
+
+void QueueLocalDeleteCheck(void)
+{
+    int32 status;
+
+    task_2_done = false;
+
+    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_DEPTH), OSAL_SIZE_C(MSGQ_SIZE),
+                            OS_QUEUE_FLAG_LOCAL);
+    UtAssert_True(status == OS_SUCCESS, "MsgQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(msgq_id), (int)status);
+
+    status = OS_TaskCreate(&task_2_id, "Task 2", task_2, OSAL_STACKPTR_C(task_2_stack), sizeof(task_2_stack),
+                           OSAL_PRIORITY_C(TASK_2_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Task 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_2_id), (int)status);
+
+    /* let the task block on the empty queue, then delete the queue from under it */
+    OS_TaskDelay(100);
+    UtAssert_True(!task_2_done, "Task 2 is waiting on the queue");
+
+    status = OS_QueueDelete(msgq_id);
+    UtAssert_True(status == OS_SUCCESS, "Queue 1 delete Rc=%d", (int)status);
+
+    OS_TaskDelay(100);
+    UtAssert_True(task_2_done, "Task 2 returned from the queue get");
+    UtAssert_True(task_2_status == OS_ERR_INVALID_ID, "Task 2 queue get Rc=%d", (int)task_2_status);
+
+    OS_TaskDelete(task_2_id);
+}
+
 void UtTest_Setup(void)
 {
     if (OS_API_Init() != OS_SUCCESS)
@@ -255,4 +372,8 @@ void UtTest_Setup(void)
      */
     UtTest_Add(QueueTimeoutCheck, QueueTimeoutSetup, NULL, "QueueTimeoutTest");
     UtTest_Add(QueueMessageCheck, QueueMessageSetup, NULL, "QueueMessageCheck");
+    UtTest_Add(QueueMessageCheck, QueueLocalMessageSetup, NULL, "QueueLocalMessageCheck");
+    UtTest_Add(QueueLocalDepthCheck, NULL, NULL, "QueueLocalDepthCheck");
+    UtTest_Add(QueueLocalMultiCheck, NULL, NULL, "QueueLocalMultiCheck");
+    UtTest_Add(QueueLocalDeleteCheck, NULL, NULL, "QueueLocalDeleteCheck");
 }
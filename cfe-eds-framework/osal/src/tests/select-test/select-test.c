@@ -56,6 +56,7 @@ osal_id_t s2_socket_id;
 osal_id_t c1_socket_id;
 osal_id_t c2_socket_id;
 osal_id_t bin_sem_id;
+osal_id_t queue_id;
 bool      networkImplemented = true;
 
 char filldata[16834];
@@ -188,6 +189,22 @@ void Server_Fn2(void)
 
 } /* end Server_Fn */
 
+void QueuePut_Fn(void)
+{
+    uint32 data = 0x5A5A5A5A;
+
+    /* Wait a bit so the main task is already blocked in select */
+    OS_TaskDelay(50);
+    UtAssert_INT32_EQ(OS_QueuePut(queue_id, &data, sizeof(data), 0), OS_SUCCESS);
+}
+
+void QueueDelete_Fn(void)
+{
+    /* Wait a bit so the main task is already blocked in select */
+    OS_TaskDelay(50);
+    UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
+}
+
 void Setup_Single(void)
 {
     BinSemSetup();
@@ -410,6 +427,113 @@ void TestSelectMultipleWrite(void)
     UtAssert_INT32_EQ(OS_SelectFdIsSet(&WriteSet, c2_socket_id), true);
 }
 
+void TestSelectMultipleQueue(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectMultiple(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+     * with a queue in the read set, for both kinds of queues
+     */
+    OS_FdSet  ReadSet;
+    osal_id_t task_id;
+    uint32    flags;
+    uint32    data;
+    size_t    size_copied;
+    int32     status;
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    for (flags = 0; flags <= OS_QUEUE_FLAG_LOCAL; flags += OS_QUEUE_FLAG_LOCAL)
+    {
+        UtAssert_INT32_EQ(OS_QueueCreate(&queue_id, "SelectQueue", 4, sizeof(data), flags), OS_SUCCESS);
+
+        OS_SelectFdZero(&ReadSet);
+        OS_SelectFdAdd(&ReadSet, c1_socket_id);
+        OS_SelectFdAdd(&ReadSet, queue_id);
+        UtAssert_True(OS_SelectFdIsSet(&ReadSet, queue_id), "OS_SelectFdIsSet(queue_id)");
+
+        /* Nothing is ready, server1 is waiting on Sem and the queue is empty */
+        status = OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT);
+        if (status == OS_ERR_OPERATION_NOT_SUPPORTED)
+        {
+            UtAssert_NA("Selecting on queues not supported");
+            UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
+            break;
+        }
+        UtAssert_INT32_EQ(status, OS_ERROR_TIMEOUT);
+
+        /* A message put while blocked in select wakes it up */
+        UtAssert_INT32_EQ(OS_TaskCreate(&task_id, "QueuePut", QueuePut_Fn, OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(16384), OSAL_PRIORITY_C(50), 0),
+                          OS_SUCCESS);
+
+        OS_SelectFdZero(&ReadSet);
+        OS_SelectFdAdd(&ReadSet, c1_socket_id);
+        OS_SelectFdAdd(&ReadSet, queue_id);
+        UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, c1_socket_id), false);
+        UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, queue_id), true);
+
+        /* Still readable until the message is taken */
+        OS_SelectFdZero(&ReadSet);
+        OS_SelectFdAdd(&ReadSet, queue_id);
+        UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, 0), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, queue_id), true);
+
+        UtAssert_INT32_EQ(OS_QueueGet(queue_id, &data, sizeof(data), &size_copied, OS_CHECK), OS_SUCCESS);
+        UtAssert_UINT32_EQ(data, 0x5A5A5A5A);
+
+        OS_SelectFdZero(&ReadSet);
+        OS_SelectFdAdd(&ReadSet, queue_id);
+        UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, 0), OS_ERROR_TIMEOUT);
+
+        OS_TaskDelay(10);
+        OS_TaskDelete(task_id);
+        UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
+    }
+
+    /* Let server1 finish */
+    UtAssert_INT32_EQ(OS_BinSemGive(bin_sem_id), OS_SUCCESS);
+}
+
+void TestSelectQueueDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectMultiple(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+     * with a local queue that is deleted by another task while selected on
+     */
+    OS_FdSet  ReadSet;
+    osal_id_t task_id;
+    int32     status;
+
+    UtAssert_INT32_EQ(OS_QueueCreate(&queue_id, "SelectQueue", 4, sizeof(uint32), OS_QUEUE_FLAG_LOCAL), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_id, "QueueDelete", QueueDelete_Fn, OSAL_TASK_STACK_ALLOCATE,
+                                    OSAL_SIZE_C(16384), OSAL_PRIORITY_C(50), 0),
+                      OS_SUCCESS);
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    status = OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT);
+    if (status == OS_ERR_OPERATION_NOT_SUPPORTED)
+    {
+        UtAssert_NA("Selecting on queues not supported");
+        OS_TaskDelay(100);
+    }
+    else
+    {
+        /* the delete wakes the select up, and with nothing else in the set there is nothing left to wait on */
+        UtAssert_INT32_EQ(status, OS_ERR_INVALID_ID);
+    }
+
+    OS_TaskDelay(10);
+    OS_TaskDelete(task_id);
+}
+
 void UtTest_Setup(void)
 {
     if (OS_API_Init() != OS_SUCCESS)
@@ -428,4 +552,6 @@ void UtTest_Setup(void)
     UtTest_Add(TestSelectMultipleRead, Setup_Multi, Teardown_Multi, "TestSelectMultipleRead");
     UtTest_Add(TestSelectSingleWrite, Setup_Single, Teardown_Single, "TestSelectSingleWrite");
     UtTest_Add(TestSelectMultipleWrite, Setup_Multi, Teardown_Multi, "TestSelectMultipleWrite");
+    UtTest_Add(TestSelectMultipleQueue, Setup_Single, Teardown_Single, "TestSelectMultipleQueue");
+    UtTest_Add(TestSelectQueueDelete, NULL, NULL, "TestSelectQueueDelete");
 }
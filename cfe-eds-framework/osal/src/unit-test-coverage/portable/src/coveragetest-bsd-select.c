@@ -155,6 +155,13 @@ void Test_OS_SelectMultiple_Impl(void)
     UT_SetDeferredRetcode(UT_KEY(OCS_select), 1, 0);
     OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, 1), OS_ERROR_TIMEOUT);
 
+    /* Queues cannot be used with select() */
+    memset(&ReadSet, 0, sizeof(ReadSet));
+    memset(&WriteSet, 0, sizeof(WriteSet));
+    ReadSet.queue_ids[0] = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, 0), OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (NULL, &ReadSet, 0), OS_ERR_OPERATION_NOT_SUPPORTED);
+
     /* Test where the FD set is empty */
     memset(&ReadSet, 0, sizeof(ReadSet));
     memset(&WriteSet, 0, sizeof(WriteSet));
@@ -165,11 +172,13 @@ void Test_OS_SelectMultiple_Impl(void)
     UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
     memset(&ReadSet, 0xff, sizeof(ReadSet));
     memset(&WriteSet, 0, sizeof(WriteSet));
+    memset(ReadSet.queue_ids, 0, sizeof(ReadSet.queue_ids));
     OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, 0), OS_ERR_OPERATION_NOT_SUPPORTED);
 
     /* Test cases where the FD exceeds FD_SETSIZE in the write set */
     memset(&ReadSet, 0, sizeof(ReadSet));
     memset(&WriteSet, 0xff, sizeof(WriteSet));
+    memset(WriteSet.queue_ids, 0, sizeof(WriteSet.queue_ids));
     OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, 0), OS_ERR_OPERATION_NOT_SUPPORTED);
 
     /* Test cases where additional bits are set in the OS_FdSet */
@@ -177,6 +186,8 @@ void Test_OS_SelectMultiple_Impl(void)
     UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
     memset(&ReadSet, 0xff, sizeof(ReadSet));
     memset(&WriteSet, 0xff, sizeof(WriteSet));
+    memset(ReadSet.queue_ids, 0, sizeof(ReadSet.queue_ids));
+    memset(WriteSet.queue_ids, 0, sizeof(WriteSet.queue_ids));
     OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, 0), OS_ERR_OPERATION_NOT_SUPPORTED);
 
     /*
@@ -340,6 +340,90 @@ void Test_OS_SocketSendTo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo_Impl, (&token, buffer, sizeof(buffer), &addr), OS_SUCCESS);
 }
 
+void Test_OS_SocketRecvMulti_Impl(void)
+{
+    OS_object_token_t token = {0};
+    uint8             buffer[2][UT_BUFFER_SIZE];
+    OS_SockAddr_t     addr = {0};
+    OS_SockMsg_t      msg[2];
+    int32             selectflags;
+
+    /* Set up token and messages, second one without RemoteAddr */
+    token.obj_idx = UT_INDEX_0;
+    memset(msg, 0, sizeof(msg));
+    msg[0].Buffer     = buffer[0];
+    msg[0].BufferSize = sizeof(buffer[0]);
+    msg[0].RemoteAddr = &addr;
+    msg[1].Buffer     = buffer[1];
+    msg[1].BufferSize = sizeof(buffer[1]);
+
+    /* Selectable, fail OS_SelectSingle_Impl */
+    OS_impl_filehandle_table[0].selectable = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, UT_ERR_UNIQUE);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti_Impl, (&token, msg, 2, 0), UT_ERR_UNIQUE);
+
+    /* Timeout by clearing select flags with hook */
+    selectflags = 0;
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, &selectflags);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti_Impl, (&token, msg, 2, 0), OS_ERROR_TIMEOUT);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+
+    /* Not selectable, 0 timeout, EAGAIN error on first recvfrom */
+    OS_impl_filehandle_table[0].selectable = false;
+    OCS_errno                              = OCS_EAGAIN;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti_Impl, (&token, msg, 2, 0), OS_QUEUE_EMPTY);
+
+    /* With timeout, other error on first recvfrom */
+    OCS_errno = 0;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti_Impl, (&token, msg, 2, 1), OS_ERROR);
+
+    /* Only one message queued, that one is still returned */
+    OCS_errno = OCS_EWOULDBLOCK;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 2, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti_Impl, (&token, msg, 2, 1), 1);
+
+    /* Full batch */
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti_Impl, (&token, msg, 2, 0), 2);
+}
+
+void Test_OS_SocketSendMulti_Impl(void)
+{
+    OS_object_token_t    token = {0};
+    uint8                buffer[UT_BUFFER_SIZE];
+    OS_SockAddr_t        addr = {0};
+    struct OCS_sockaddr *sa   = (struct OCS_sockaddr *)&addr.AddrData;
+    OS_SockMsg_t         msg[2];
+
+    /* Set up token and messages */
+    token.obj_idx = UT_INDEX_0;
+    memset(msg, 0, sizeof(msg));
+    msg[0].Buffer     = buffer;
+    msg[0].BufferSize = sizeof(buffer);
+    msg[0].RemoteAddr = &addr;
+    msg[1]            = msg[0];
+
+    /* Bad address length */
+    sa->sa_family     = -1;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti_Impl, (&token, msg, 2), OS_ERR_BAD_ADDRESS);
+
+    /* AF_INET, failed first sendto */
+    sa->sa_family = OCS_AF_INET;
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti_Impl, (&token, msg, 2), OS_ERROR);
+
+    /* Failed second sendto, first is still reported */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 2, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti_Impl, (&token, msg, 2), 1);
+
+    /* AF_INET6, success */
+    sa->sa_family     = OCS_AF_INET6;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in6);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti_Impl, (&token, msg, 2), 2);
+}
+
 void Test_OS_SocketGetInfo_Impl(void)
 {
     OSAPI_TEST_FUNCTION_RC(OS_SocketGetInfo_Impl, (NULL, NULL), OS_SUCCESS);
@@ -490,6 +574,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketAccept_Impl);
     ADD_TEST(OS_SocketRecvFrom_Impl);
     ADD_TEST(OS_SocketSendTo_Impl);
+    ADD_TEST(OS_SocketRecvMulti_Impl);
+    ADD_TEST(OS_SocketSendMulti_Impl);
     ADD_TEST(OS_SocketGetInfo_Impl);
     ADD_TEST(OS_SocketAddrInit_Impl);
     ADD_TEST(OS_SocketAddrToString_Impl);
@@ -185,6 +185,56 @@ void Test_OS_GenericWrite_Impl(void)
     UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
 }
 
+void Test_OS_FileCopyRange_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token,
+     *                             size_t nbytes)
+     */
+    char              SrcData[]                 = "ABCDEFGHIJKLM";
+    char              DestData[sizeof(SrcData)] = {0};
+    uint32            HeapBuf[1024];
+    OS_object_token_t src_token;
+    OS_object_token_t dest_token;
+
+    memset(&src_token, 0, sizeof(src_token));
+    memset(&dest_token, 0, sizeof(dest_token));
+    dest_token.obj_idx = UT_INDEX_1;
+
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), HeapBuf, sizeof(HeapBuf), false);
+
+    UT_SetDataBuffer(UT_KEY(OCS_read), SrcData, sizeof(SrcData), false);
+    UT_SetDataBuffer(UT_KEY(OCS_write), DestData, sizeof(DestData), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange_Impl, (&src_token, &dest_token, sizeof(SrcData)), sizeof(SrcData));
+    UtAssert_MemCmp(SrcData, DestData, sizeof(SrcData), "copied data valid");
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    /* end of file */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_read), 0);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange_Impl, (&src_token, &dest_token, sizeof(SrcData)), 0);
+
+    /* read() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_read), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange_Impl, (&src_token, &dest_token, sizeof(SrcData)), OS_ERROR);
+
+    /* write() failure */
+    UT_ResetState(UT_KEY(OCS_read));
+    UT_SetDataBuffer(UT_KEY(OCS_read), SrcData, sizeof(SrcData), false);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_write), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange_Impl, (&src_token, &dest_token, sizeof(SrcData)), OS_ERROR);
+
+    /* write() accepts no data */
+    UT_ResetState(UT_KEY(OCS_read));
+    UT_SetDataBuffer(UT_KEY(OCS_read), SrcData, sizeof(SrcData), false);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_write), 0);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange_Impl, (&src_token, &dest_token, sizeof(SrcData)), OS_ERROR);
+
+    /* malloc() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_malloc), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange_Impl, (&src_token, &dest_token, sizeof(SrcData)), OS_ERROR);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -220,4 +270,5 @@ void UtTest_Setup(void)
     ADD_TEST(OS_GenericSeek_Impl);
     ADD_TEST(OS_GenericRead_Impl);
     ADD_TEST(OS_GenericWrite_Impl);
+    ADD_TEST(OS_FileCopyRange_Impl);
 }
@@ -258,28 +258,46 @@ void Test_OS_cp(void)
      * Test Case For:
      * int32 OS_cp (const char *src, const char *dest)
      */
-    char ReadBuf[]                 = "cpcpcpcp";
-    char WriteBuf[sizeof(ReadBuf)] = "";
-
     OSAPI_TEST_FUNCTION_RC(OS_cp(NULL, "/cf/file2"), OS_INVALID_POINTER);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", NULL), OS_INVALID_POINTER);
 
     /* setup to make internal copy loop execute at least once */
-    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
-    UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), WriteBuf, sizeof(WriteBuf), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_FileCopyRange_Impl), 1, 8);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileCopyRange_Impl, 2);
 
-    UT_SetDeferredRetcode(UT_KEY(OS_GenericRead_Impl), 1, -444);
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileCopyRange_Impl), -444);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), -444);
 
-    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_GenericWrite_Impl), -555);
-    OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), -555);
-
     UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), -666);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), -666);
 }
 
+void Test_OS_FileCopyRange(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileCopyRange(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+     */
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileCopyRange_Impl), 16);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 16), 16);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, OSAL_SIZE_C(0)), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, OSAL_SIZE_C(UINT32_MAX)), OS_ERR_INVALID_SIZE);
+
+    /* sockets are not files */
+    OS_stream_table[2].socket_domain = OS_SocketDomain_INET;
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 16), OS_ERR_INCORRECT_OBJ_TYPE);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_2, UT_OBJID_1, 16), OS_ERR_INCORRECT_OBJ_TYPE);
+    OS_stream_table[2].socket_domain = OS_SocketDomain_INVALID;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 16), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 16), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 7);
+}
+
 void Test_OS_mv(void)
 {
     /*
@@ -413,6 +431,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
+    ADD_TEST(OS_FileCopyRange);
     ADD_TEST(OS_mv);
     ADD_TEST(OS_FDGetInfo);
     ADD_TEST(OS_FileOpenCheck);
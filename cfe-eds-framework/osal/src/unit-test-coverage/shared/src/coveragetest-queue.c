@@ -112,6 +112,34 @@ void Test_OS_QueueGet(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, 0), OS_ERROR);
 }
 
+void Test_OS_QueueGetMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t size, uint32 count, uint32 *count_copied,
+     *                        int32 timeout)
+     */
+    uint32 count;
+    char   Buf[2][4];
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), 2, &count, 0), OS_SUCCESS);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, NULL, sizeof(Buf[0]), 2, &count, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), 2, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, OSAL_SIZE_C(0), 2, &count, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), 0, &count, 0), OS_ERR_INVALID_SIZE);
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]) + 10;
+    count                      = 5;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), 2, &count, 0), OS_QUEUE_INVALID_SIZE);
+    UtAssert_UINT32_EQ(count, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), 2, &count, 0), OS_ERROR);
+}
+
 void Test_OS_QueuePut(void)
 {
     /*
@@ -204,6 +232,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueCreate);
     ADD_TEST(OS_QueueDelete);
     ADD_TEST(OS_QueueGet);
+    ADD_TEST(OS_QueueGetMulti);
     ADD_TEST(OS_QueuePut);
     ADD_TEST(OS_QueueGetIdByName);
     ADD_TEST(OS_QueueGetInfo);
@@ -111,6 +111,21 @@ void Test_OS_SelectFdAddClearOps(void)
     UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex));
     UtAssert_True(OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(1) == true");
     UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_2), "OS_SelectFdIsSet(2) == false");
+
+    /* Queue IDs are kept separately from stream IDs */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdZero(&UtSet), OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdAdd(&UtSet, UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(queue 1) == true");
+    UtAssert_True(UtSet.queue_ids[0] != 0, "queue_ids[0] (%u) != 0", (unsigned int)UtSet.queue_ids[0]);
+    UtAssert_True(UtSet.object_ids[0] == 0, "object_ids[0] (%u) == 0", (unsigned int)UtSet.object_ids[0]);
+
+    UT_ClearDefaultReturnValue(UT_KEY(OS_IdentifyObject));
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(stream 1) == false");
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdClear(&UtSet, UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(queue 1) == false");
 }
 
 /* Osapi_Test_Setup
@@ -409,6 +409,125 @@ void Test_OS_SocketSendTo(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo(UT_OBJID_1, &Buf, sizeof(Buf), &Addr), OS_ERR_INVALID_ID);
 }
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketRecvMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketRecvMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketRecvMulti(osal_id_t sock_id, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout)
+     */
+    char          Buf[2];
+    OS_SockAddr_t Addr;
+    OS_SockMsg_t  Msg[2];
+    osal_index_t  idbuf;
+
+    memset(&Addr, 0, sizeof(Addr));
+    memset(Msg, 0, sizeof(Msg));
+    Msg[0].Buffer     = &Buf[0];
+    Msg[0].BufferSize = 1;
+    Msg[0].RemoteAddr = &Addr;
+    Msg[1].Buffer     = &Buf[1];
+    Msg[1].BufferSize = 1;
+
+    idbuf = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketRecvMulti_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 2, 0), 2);
+    UT_ResetState(UT_KEY(OS_SocketRecvMulti_Impl));
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, NULL, 2, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 0, 0), OS_ERR_INVALID_SIZE);
+
+    /* Each entry is validated */
+    Msg[1].Buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 2, 0), OS_INVALID_POINTER);
+    Msg[1].Buffer     = &Buf[1];
+    Msg[1].BufferSize = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 2, 0), OS_ERR_INVALID_SIZE);
+    Msg[1].BufferSize = 1;
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 2, 0), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    /*
+     * Should fail if not bound
+     */
+    OS_stream_table[1].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[1].stream_state = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 2, 0), OS_ERR_INCORRECT_OBJ_STATE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvMulti(UT_OBJID_1, Msg, 2, 0), OS_ERR_INVALID_ID);
+}
+
+/*****************************************************************************
+ *
+ * Test case for OS_SocketSendMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketSendMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketSendMulti(osal_id_t sock_id, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+     */
+    char          Buf[2] = {'A', 'B'};
+    OS_SockAddr_t Addr;
+    OS_SockMsg_t  Msg[2];
+    osal_index_t  idbuf;
+
+    memset(&Addr, 0, sizeof(Addr));
+    memset(Msg, 0, sizeof(Msg));
+    Msg[0].Buffer     = &Buf[0];
+    Msg[0].BufferSize = 1;
+    Msg[0].RemoteAddr = &Addr;
+    Msg[1].Buffer     = &Buf[1];
+    Msg[1].BufferSize = 1;
+    Msg[1].RemoteAddr = &Addr;
+
+    idbuf = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketSendMulti_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 2), 2);
+    UT_ResetState(UT_KEY(OS_SocketSendMulti_Impl));
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, NULL, 2), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 0), OS_ERR_INVALID_SIZE);
+
+    /* Each entry is validated, and must have a destination */
+    Msg[1].RemoteAddr = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 2), OS_INVALID_POINTER);
+    Msg[1].RemoteAddr = &Addr;
+    Msg[1].Buffer     = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 2), OS_INVALID_POINTER);
+    Msg[1].Buffer     = &Buf[1];
+    Msg[1].BufferSize = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 2), OS_ERR_INVALID_SIZE);
+    Msg[1].BufferSize = 1;
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 2), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendMulti(UT_OBJID_1, Msg, 2), OS_ERR_INVALID_ID);
+}
+
 /*****************************************************************************
  *
  * Test case for OS_SocketGetIdByName()
@@ -525,6 +644,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketConnect);
     ADD_TEST(OS_SocketRecvFrom);
     ADD_TEST(OS_SocketSendTo);
+    ADD_TEST(OS_SocketRecvMulti);
+    ADD_TEST(OS_SocketSendMulti);
     ADD_TEST(OS_SocketShutdown);
     ADD_TEST(OS_SocketGetIdByName);
     ADD_TEST(OS_SocketGetInfo);
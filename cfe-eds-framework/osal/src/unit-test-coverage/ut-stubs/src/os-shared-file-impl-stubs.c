@@ -47,6 +47,24 @@ int32 OS_FileChmod_Impl(const char *local_path, uint32 access_mode)
     return UT_GenStub_GetReturnValue(OS_FileChmod_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileCopyRange_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileCopyRange_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, const OS_object_token_t *, src_token);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, const OS_object_token_t *, dest_token);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, size_t, nbytes);
+
+    UT_GenStub_Execute(OS_FileCopyRange_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileCopyRange_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpen_Impl()
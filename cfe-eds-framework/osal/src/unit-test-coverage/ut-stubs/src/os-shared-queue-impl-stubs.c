@@ -97,6 +97,28 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return UT_GenStub_GetReturnValue(OS_QueueGet_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t size, uint32 count,
+                            uint32 *count_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut_Impl()
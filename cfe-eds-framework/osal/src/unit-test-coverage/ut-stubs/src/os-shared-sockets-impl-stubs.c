@@ -234,6 +234,43 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
     return UT_GenStub_GetReturnValue(OS_SocketRecvFrom_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketRecvMulti_Impl, OS_SockMsg_t *, MsgVec);
+    UT_GenStub_AddParam(OS_SocketRecvMulti_Impl, uint32, MsgCount);
+    UT_GenStub_AddParam(OS_SocketRecvMulti_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvMulti_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendMulti_Impl(const OS_object_token_t *token, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketSendMulti_Impl, const OS_SockMsg_t *, MsgVec);
+    UT_GenStub_AddParam(OS_SocketSendMulti_Impl, uint32, MsgCount);
+
+    UT_GenStub_Execute(OS_SocketSendMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo_Impl()
@@ -95,6 +95,33 @@ void Test_OS_QueueGet_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet_Impl(&token, &Data, sizeof(Data), &ActSz, OS_CHECK), OS_ERROR);
 }
 
+void Test_OS_QueueGetMulti_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t size, uint32 count,
+     *                             uint32 *count_copied, int32 timeout)
+     */
+    char              Data[3][16];
+    uint32            Count;
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti_Impl(&token, Data, sizeof(Data[0]), 3, &Count, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(Count, 3);
+
+    /* the rest of the batch stops at an empty queue */
+    UT_SetDeferredRetcode(UT_KEY(OCS_msgQReceive), 2, OCS_ERROR);
+    OCS_errno = OCS_S_objLib_OBJ_UNAVAILABLE;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti_Impl(&token, Data, sizeof(Data[0]), 3, &Count, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(Count, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OCS_msgQReceive), 1, OCS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti_Impl(&token, Data, sizeof(Data[0]), 3, &Count, OS_CHECK),
+                           OS_QUEUE_EMPTY);
+    UtAssert_UINT32_EQ(Count, 0);
+    OCS_errno = 0;
+}
+
 void Test_OS_QueuePut_Impl(void)
 {
     /*
@@ -162,6 +189,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueCreate_Impl);
     ADD_TEST(OS_QueueDelete_Impl);
     ADD_TEST(OS_QueueGet_Impl);
+    ADD_TEST(OS_QueueGetMulti_Impl);
     ADD_TEST(OS_QueuePut_Impl);
     ADD_TEST(OS_QueueGetInfo_Impl);
 }
@@ -1253,6 +1253,93 @@ void UT_os_copyfile_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileCopyRange(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+** Purpose: Copies data from the current position of one open file to the current
+**          position of another
+** Parameters: src_fd - the file descriptor to copy from
+**             dest_fd - the file descriptor to copy to
+**             nbytes - the maximum number of bytes to copy
+** Returns: OS_ERR_INVALID_ID if a file descriptor passed in is invalid
+**          OS_ERR_INVALID_SIZE if nbytes is zero
+**          OS_ERROR if the OS call failed
+**          The number of bytes copied if succeeded
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Invalid-size-arg condition
+**   1) Call this routine with a zero size as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_SIZE
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Write a known string to a file and reopen it
+**   2) Call this routine to copy part of the file into a second file
+**   3) Expect the returned value to be the requested size
+**   4) Call this routine again to append the rest of the file
+**   5) Expect the returned value to be the remaining size, then 0 at end of file
+**   6) Read back the second file and expect it to match the string
+**--------------------------------------------------------------------------------*/
+void UT_os_copyfilerange_test()
+{
+    size_t expected_len;
+    size_t first_len;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-file-desc-arg */
+
+    UT_RETVAL(OS_FileCopyRange(UT_OBJID_INCORRECT, UT_OBJID_INCORRECT, 1), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #3 Nominal */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/CpRange_Src.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/CpRange_Dst.txt", g_mntName);
+
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+        strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+        expected_len = strlen(g_writeBuff);
+        first_len    = 8;
+
+        UT_RETVAL(OS_write(g_fDescs[0], g_writeBuff, expected_len), expected_len);
+        UT_SETUP(OS_lseek(g_fDescs[0], 0, OS_SEEK_SET));
+
+        if (UT_SETUP(OS_OpenCreate(&g_fDescs[1], g_fNames[1], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                   OS_READ_WRITE)))
+        {
+            /*-----------------------------------------------------*/
+            /* #2 Invalid-size-arg */
+
+            UT_RETVAL(OS_FileCopyRange(g_fDescs[0], g_fDescs[1], 0), OS_ERR_INVALID_SIZE);
+
+            UT_RETVAL(OS_FileCopyRange(g_fDescs[0], g_fDescs[1], first_len), first_len);
+            UT_RETVAL(OS_FileCopyRange(g_fDescs[0], g_fDescs[1], sizeof(g_writeBuff)), expected_len - first_len);
+
+            /* confirm that copy returns 0 at end of file */
+            UT_RETVAL(OS_FileCopyRange(g_fDescs[0], g_fDescs[1], sizeof(g_writeBuff)), 0);
+
+            UT_SETUP(OS_lseek(g_fDescs[1], 0, OS_SEEK_SET));
+            memset(g_readBuff, '\0', sizeof(g_readBuff));
+            UT_RETVAL(OS_read(g_fDescs[1], g_readBuff, sizeof(g_readBuff)), expected_len);
+            UtAssert_StrCmp(g_readBuff, g_writeBuff, "%s == %s", g_readBuff, g_writeBuff);
+
+            UT_TEARDOWN(OS_close(g_fDescs[1]));
+            UT_TEARDOWN(OS_remove(g_fNames[1]));
+        }
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_mv(const char *src, const char *dest)
 ** Purpose: Moves the given file to a new specified file
@@ -165,6 +165,7 @@ void UtTest_Setup(void)
         UtTest_Add(UT_os_removefile_test, NULL, NULL, "OS_remove");
         UtTest_Add(UT_os_renamefile_test, NULL, NULL, "OS_rename");
         UtTest_Add(UT_os_copyfile_test, NULL, NULL, "OS_cp");
+        UtTest_Add(UT_os_copyfilerange_test, NULL, NULL, "OS_FileCopyRange");
         UtTest_Add(UT_os_movefile_test, NULL, NULL, "OS_mv");
 
         UtTest_Add(UT_os_outputtofile_test, NULL, NULL, "OS_ShellOutputToFile");
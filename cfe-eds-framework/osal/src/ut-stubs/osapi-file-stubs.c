@@ -84,6 +84,24 @@ int32 OS_FDGetInfo(osal_id_t filedes, OS_file_prop_t *fd_prop)
     return UT_GenStub_GetReturnValue(OS_FDGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileCopyRange()
+ * ----------------------------------------------------
+ */
+int32 OS_FileCopyRange(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileCopyRange, int32);
+
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_id_t, src_fd);
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_id_t, dest_fd);
+    UT_GenStub_AddParam(OS_FileCopyRange, size_t, nbytes);
+
+    UT_GenStub_Execute(OS_FileCopyRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileCopyRange, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpenCheck()
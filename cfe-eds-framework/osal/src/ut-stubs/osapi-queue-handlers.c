@@ -99,6 +99,37 @@ void UT_DefaultHandler_OS_QueueGet(void *UserObj, UT_EntryKey_t FuncKey, const U
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t queue_id     = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    void *    data         = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t    size         = UT_Hook_GetArgValueByName(Context, "size", size_t);
+    uint32    count        = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    uint32 *  count_copied = UT_Hook_GetArgValueByName(Context, "count_copied", uint32 *);
+    int32     status;
+
+    /* Takes messages from the same data buffer that the OS_QueuePut handler fills */
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        *count_copied = UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), data, size * count) / size;
+        if (*count_copied == 0)
+        {
+            status = OS_QUEUE_EMPTY;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+    else
+    {
+        *count_copied = 0;
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_QueuePut' stub
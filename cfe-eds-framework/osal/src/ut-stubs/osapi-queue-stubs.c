@@ -32,6 +32,7 @@ extern void UT_DefaultHandler_OS_QueueDelete(void *, UT_EntryKey_t, const UT_Stu
 extern void UT_DefaultHandler_OS_QueueGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_QueueGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_QueueGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_QueueGetMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_QueuePut(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -125,6 +126,28 @@ int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t size, uint32 count, uint32 *count_copied,
+                       int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMulti, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMulti, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetMulti, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetMulti, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetMulti, uint32, count);
+    UT_GenStub_AddParam(OS_QueueGetMulti, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMulti, Basic, UT_DefaultHandler_OS_QueueGetMulti);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMulti, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut()
@@ -88,6 +88,57 @@ void UT_DefaultHandler_OS_SocketRecvFrom(void *UserObj, UT_EntryKey_t FuncKey, c
     UT_Stub_SetReturnValue(FuncKey, status);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketRecvMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketRecvMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_SockMsg_t *MsgVec = UT_Hook_GetArgValueByName(Context, "MsgVec", OS_SockMsg_t *);
+    int32         status;
+
+    /* by default a single message is received, in the first entry */
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = 1;
+    }
+
+    if (status > 0)
+    {
+        MsgVec[0].ActualLength =
+            UT_Stub_CopyToLocal(UT_KEY(OS_SocketRecvMulti), MsgVec[0].Buffer, MsgVec[0].BufferSize);
+
+        /* If CopyToLocal returns zero, just generate fill data and pretend it was read */
+        if (MsgVec[0].ActualLength == 0)
+        {
+            memset(MsgVec[0].Buffer, 0, MsgVec[0].BufferSize);
+            MsgVec[0].ActualLength = MsgVec[0].BufferSize;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketSendMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketSendMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 MsgCount = UT_Hook_GetArgValueByName(Context, "MsgCount", uint32);
+    int32  status;
+
+    /* by default every message is sent */
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = MsgCount;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_SocketSendTo' stub
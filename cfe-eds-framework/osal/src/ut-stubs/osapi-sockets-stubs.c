@@ -35,6 +35,8 @@ extern void UT_DefaultHandler_OS_SocketGetIdByName(void *, UT_EntryKey_t, const
 extern void UT_DefaultHandler_OS_SocketGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_SocketOpen(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_SocketRecvFrom(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_SocketRecvMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_SocketSendMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_SocketSendTo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -249,6 +251,43 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
     return UT_GenStub_GetReturnValue(OS_SocketRecvFrom, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvMulti(osal_id_t sock_id, OS_SockMsg_t *MsgVec, uint32 MsgCount, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketRecvMulti, OS_SockMsg_t *, MsgVec);
+    UT_GenStub_AddParam(OS_SocketRecvMulti, uint32, MsgCount);
+    UT_GenStub_AddParam(OS_SocketRecvMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvMulti, Basic, UT_DefaultHandler_OS_SocketRecvMulti);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendMulti(osal_id_t sock_id, const OS_SockMsg_t *MsgVec, uint32 MsgCount)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketSendMulti, const OS_SockMsg_t *, MsgVec);
+    UT_GenStub_AddParam(OS_SocketSendMulti, uint32, MsgCount);
+
+    UT_GenStub_Execute(OS_SocketSendMulti, Basic, UT_DefaultHandler_OS_SocketSendMulti);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendMulti, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo()
@@ -125,6 +125,9 @@ for _,instance in ipairs(SEDS.highlevel_interfaces) do
   end
 end
 
+-- Keep the complete set of Message Ids for the software bus routing map generator
+SEDS.cfe_sb_msgid_table = msgid_table
+
 for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   local first_intf = 1 + #total_intfs
   local hdrout = SEDS.output_open(SEDS.to_filename("interface.h", ds.name),ds.xml_filename)
@@ -0,0 +1,205 @@
+--
+-- LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+--
+-- Copyright (c) 2020 United States Government as represented by
+-- the Administrator of the National Aeronautics and Space Administration.
+-- All Rights Reserved.
+--
+-- Licensed under the Apache License, Version 2.0 (the "License");
+-- you may not use this file except in compliance with the License.
+-- You may obtain a copy of the License at
+--
+--    http://www.apache.org/licenses/LICENSE-2.0
+--
+-- Unless required by applicable law or agreed to in writing, software
+-- distributed under the License is distributed on an "AS IS" BASIS,
+-- WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+-- See the License for the specific language governing permissions and
+-- limitations under the License.
+--
+
+
+-- -------------------------------------------------------------------------
+-- Generate a perfect hash of the software bus Message Ids
+--
+-- The dispatch table script collects every Message Id that any interface
+-- in the mission can use.  Since the complete set is known at build time,
+-- a collision-free hash can be computed here so the software bus routing
+-- map (see cfe_sbr_map_phash.c) finds a route with a single probe and
+-- needs only as many slots as the mission has Message Ids.
+--
+-- The hash uses the "hash and displace" method:
+--   slot = H(MsgId, Multiplier, Bits) XOR Disp[H(MsgId, DispMultiplier, DispBits)]
+-- where H(x,m,b) is the upper b bits of the 32 bit product x*m.
+--
+-- The key table holds the Message Id that owns each slot, so a lookup can
+-- tell a mission Message Id from any other value.  Unused slots hold a
+-- value that does not hash to that slot.
+-- -------------------------------------------------------------------------
+
+local global_sym_prefix = SEDS.get_define("MISSION_NAME")
+global_sym_prefix = global_sym_prefix and string.upper(global_sym_prefix) or "EDS"
+
+-- The Message Ids in the table are EDS objects, the hash is computed on the value
+local msgid_list = {}
+local msgid_seen = {}
+for msgid in pairs(SEDS.cfe_sb_msgid_table or {}) do
+  local value = math.tointeger(msgid.Value)
+  if (not msgid_seen[value]) then
+    msgid_seen[value] = true
+    msgid_list[1 + #msgid_list] = value
+  end
+end
+table.sort(msgid_list)
+
+-- -----------------------------------------------------
+-- helper function to compute the multiplicative hash
+-- this must match CFE_SBR_MsgIdPerfectHash() in the SBR module
+-- -----------------------------------------------------
+local function mulhash(value, multiplier, bits)
+  return ((value * multiplier) & 0xFFFFFFFF) >> (32 - bits)
+end
+
+-- -----------------------------------------------------
+-- helper function to attempt a hash with the given parameters
+-- returns the slot and displacement tables, or nil if not possible
+-- -----------------------------------------------------
+local function try_build(params)
+  local size = 1 << params.bits
+  local buckets = {}
+  local bucket_order = {}
+  local slots = {}
+  local disp = {}
+
+  for _,msgid in ipairs(msgid_list) do
+    local b = mulhash(msgid, params.disp_multiplier, params.disp_bits)
+    if (not buckets[b]) then
+      buckets[b] = {}
+      bucket_order[1 + #bucket_order] = b
+    end
+    buckets[b][1 + #buckets[b]] = msgid
+  end
+
+  -- Place the largest buckets first, while the most slots are free
+  table.sort(bucket_order, function(a,b)
+    if (#buckets[a] ~= #buckets[b]) then
+      return #buckets[a] > #buckets[b]
+    end
+    return a < b
+  end)
+
+  for _,b in ipairs(bucket_order) do
+    local placed
+    for d = 0,size-1 do
+      local taken = {}
+      placed = true
+      for _,msgid in ipairs(buckets[b]) do
+        local s = mulhash(msgid, params.multiplier, params.bits) ~ d
+        if (slots[s] or taken[s]) then
+          placed = false
+          break
+        end
+        taken[s] = msgid
+      end
+      if (placed) then
+        for s,msgid in pairs(taken) do
+          slots[s] = msgid
+        end
+        disp[b] = d
+        break
+      end
+    end
+    if (not placed) then
+      return nil
+    end
+  end
+
+  return slots, disp
+end
+
+-- Start with the smallest power of 2 that holds every Message Id and grow
+-- the table only if no multipliers are found.  The candidate multipliers
+-- come from a fixed sequence so the output is the same on every build.
+local params = { bits = 1 }
+while ((1 << params.bits) < #msgid_list) do
+  params.bits = 1 + params.bits
+end
+
+local slots, disp
+local candidate = 0x9E3779B1
+while (not slots) do
+  params.disp_bits = (params.bits > 1) and (params.bits - 1) or 1
+  for attempt = 1,64 do
+    params.disp_multiplier = candidate
+    candidate = ((candidate * 1664525 + 1013904223) & 0xFFFFFFFF) | 1
+    params.multiplier = candidate
+    candidate = ((candidate * 1664525 + 1013904223) & 0xFFFFFFFF) | 1
+    slots, disp = try_build(params)
+    if (slots) then
+      break
+    end
+  end
+  if (not slots) then
+    params.bits = 1 + params.bits
+    if (params.bits > 16) then
+      error("Unable to compute a perfect hash of the Message Ids")
+    end
+  end
+end
+
+-- Fill the unused slots with a value that does not hash to the slot
+local key_list = {}
+for s = 0,(1 << params.bits)-1 do
+  local key = slots[s]
+  if (not key) then
+    key = 0
+    while ((mulhash(key, params.multiplier, params.bits) ~
+      (disp[mulhash(key, params.disp_multiplier, params.disp_bits)] or 0)) == s) do
+      key = 1 + key
+    end
+  end
+  key_list[1 + s] = string.format("0x%08x", key)
+end
+
+local disp_list = {}
+for b = 0,(1 << params.disp_bits)-1 do
+  disp_list[1 + b] = tostring(disp[b] or 0)
+end
+
+-- -----------------------------------------------------
+-- helper function to write a table initializer macro
+-- -----------------------------------------------------
+local function write_table_macro(hdrout, name, values)
+  hdrout:write(string.format("#define %s \\", name))
+  hdrout:write("{ \\")
+  for i = 1,#values,8 do
+    hdrout:write(string.format("    %s, \\", table.concat(values, ", ", i, math.min(i + 7, #values))))
+  end
+  hdrout:write("}")
+end
+
+local hdrout = SEDS.output_open(SEDS.to_filename("msgid_phash.h"))
+
+hdrout:section_marker("Software Bus Message Id Perfect Hash")
+hdrout:add_documentation(string.format("Number of Message Ids in the mission (%d slots)", 1 << params.bits))
+hdrout:write(string.format("#define %-50s %d", global_sym_prefix .. "_MSGID_PHASH_KEY_COUNT", #msgid_list))
+hdrout:add_documentation("Number of bits in the slot index, the table has 2^bits slots")
+hdrout:write(string.format("#define %-50s %d", global_sym_prefix .. "_MSGID_PHASH_BITS", params.bits))
+hdrout:add_documentation("Number of bits in the displacement index")
+hdrout:write(string.format("#define %-50s %d", global_sym_prefix .. "_MSGID_PHASH_DISP_BITS", params.disp_bits))
+hdrout:add_documentation("Multiplier for the slot hash")
+hdrout:write(string.format("#define %-50s 0x%08xU", global_sym_prefix .. "_MSGID_PHASH_MULTIPLIER", params.multiplier))
+hdrout:add_documentation("Multiplier for the displacement hash")
+hdrout:write(string.format("#define %-50s 0x%08xU", global_sym_prefix .. "_MSGID_PHASH_DISP_MULTIPLIER",
+  params.disp_multiplier))
+hdrout:add_whitespace(1)
+
+hdrout:add_documentation("Initializer for the Message Id owning each slot")
+write_table_macro(hdrout, global_sym_prefix .. "_MSGID_PHASH_KEY_TABLE_INIT", key_list)
+hdrout:add_whitespace(1)
+
+hdrout:add_documentation("Initializer for the slot displacement of each displacement index")
+write_table_macro(hdrout, global_sym_prefix .. "_MSGID_PHASH_DISP_TABLE_INIT", disp_list)
+hdrout:add_whitespace(1)
+
+SEDS.output_close(hdrout)
@@ -0,0 +1,328 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     shm_bridge_interface.c
+ * \ingroup  testexecutive
+ *
+ * Test executive interface to a target on the same host via the SHM_BRIDGE
+ * application, which exchanges messages through rings in /dev/shm instead
+ * of the UDP sockets used by CI_LAB/TO_LAB.  Messages are the same EDS packed
+ * encoding in both cases, so test scripts can use either interface.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h> /* memset() */
+#include <errno.h>
+#include <time.h>
+
+#include <lua.h>
+#include <lualib.h>
+#include <lauxlib.h>
+
+#include "edslib_displaydb.h"
+
+#include "testexec.h"
+#include "shm_bridge_client.h"
+#include "shm_bridge_events.h"
+
+/*
+ * The bridge drains the uplink ring from its own task, so a full ring only
+ * means it is momentarily behind.  Retry every millisecond for up to a second.
+ */
+#define SHM_BRIDGE_UPLINK_RETRY_LIMIT   1000
+
+typedef struct
+{
+    ShmBridge_Client_t Client;
+} TestIntf_SHM_BRIDGE_Connection_t;
+
+static int TestIntf_SHM_BRIDGE_Backoff(uint32_t *Tries)
+{
+    static const struct timespec RetryDelay = { 0, 1000000 };
+
+    if (*Tries >= SHM_BRIDGE_UPLINK_RETRY_LIMIT)
+    {
+        return 0;
+    }
+
+    ++(*Tries);
+    clock_nanosleep(CLOCK_MONOTONIC, 0, &RetryDelay, NULL);
+    return 1;
+}
+
+static int TestIntf_SHM_BRIDGE_Send(lua_State *lua)
+{
+    TestIntf_SHM_BRIDGE_Connection_t *Conn = luaL_checkudata(lua, 1, "TestIntf_SHM_BRIDGE_Connection");
+    const char *Data = luaL_checkstring(lua, 2);
+    uint32_t DataLength = lua_rawlen(lua, 2);
+    uint32_t Tries = 0;
+    int Status;
+
+    printf("%s():\n",__func__);
+    EdsLib_Generate_Hexdump(stdout, (const uint8_t*)Data, 0, DataLength);
+    printf("\n");
+
+    do
+    {
+        Status = ShmBridge_ClientSend(&Conn->Client, Data, DataLength);
+    }
+    while (Status == SHM_BRIDGE_RING_FULL && TestIntf_SHM_BRIDGE_Backoff(&Tries));
+
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return luaL_error(lua, "Failed to send %d bytes to SHM_BRIDGE: status %d", (int)DataLength, Status);
+    }
+
+    return 0;
+}
+
+static int TestIntf_SHM_BRIDGE_Wait(lua_State *lua)
+{
+    TestIntf_SHM_BRIDGE_Connection_t *Conn = luaL_checkudata(lua, 1, "TestIntf_SHM_BRIDGE_Connection");
+    int32_t Timeout = luaL_optinteger(lua, 2, -1);
+
+    /* Returns as soon as the bridge commits a frame, the caller re-polls either way */
+    ShmBridge_RingWait(&Conn->Client.Downlink, Timeout);
+    lua_pushboolean(lua, 1);
+
+    return 1;
+}
+
+static int TestIntf_SHM_BRIDGE_Poll(lua_State *lua)
+{
+    TestIntf_SHM_BRIDGE_Connection_t *Conn = luaL_checkudata(lua, 1, "TestIntf_SHM_BRIDGE_Connection");
+    const void *Data;
+    uint32_t Length;
+    uint16_t Type;
+    int Status;
+
+    while (1)
+    {
+        Status = ShmBridge_RingPeek(&Conn->Client.Downlink, &Type, &Data, &Length);
+        if (Status == SHM_BRIDGE_RING_INVALID)
+        {
+            printf("%s(): downlink ring is corrupt, resynchronizing\n", __func__);
+            ShmBridge_RingFlush(&Conn->Client.Downlink);
+        }
+
+        if (Status != SHM_BRIDGE_RING_SUCCESS)
+        {
+            return 0;
+        }
+
+        if (Type == SHM_BRIDGE_FRAME_MESSAGE)
+        {
+            break;
+        }
+
+        ShmBridge_RingRelease(&Conn->Client.Downlink);
+    }
+
+    lua_pushstring(lua, "Message");
+    lua_pushlstring(lua, Data, Length);
+    ShmBridge_RingRelease(&Conn->Client.Downlink);
+
+    return 2;
+}
+
+static int TestIntf_SHM_BRIDGE_CheckSubscribeEvent(lua_State *lua)
+{
+    const char *AppName;
+
+    lua_settop(lua, 1);
+    luaL_checkudata(lua, 1, "EdsLib_Object");
+
+    lua_getfield(lua, 1, "Payload");
+    lua_getfield(lua, 2, "PacketID");
+    lua_getfield(lua, 3, "AppName");
+    lua_call(lua, 0, 1);
+    AppName = lua_tostring(lua, -1);
+    if (AppName == NULL || strcmp(AppName, "SHM_BRIDGE") != 0)
+    {
+        return 0;
+    }
+
+    lua_getfield(lua, 3, "EventID");
+    lua_call(lua, 0, 1);
+
+    if (lua_compare(lua, lua_upvalueindex(1), -1, LUA_OPEQ))
+    {
+        printf("%s(): TRUE\n", __func__);
+        lua_settop(lua, 1);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int TestIntf_SHM_BRIDGE_DoSubscription(lua_State *lua)
+{
+    TestIntf_SHM_BRIDGE_Connection_t *Conn = luaL_checkudata(lua, 1, "TestIntf_SHM_BRIDGE_Connection");
+    uint32_t MsgId = luaL_checkinteger(lua, 2);
+    int IsSubscribe = lua_toboolean(lua, lua_upvalueindex(1));
+    uint16_t BufLimit = 0;
+    uint32_t Tries = 0;
+    int Status;
+
+    lua_settop(lua, 3);
+
+    /* The only user-specified attribute that applies is the pipe depth limit */
+    if (lua_istable(lua, 3))
+    {
+        lua_getfield(lua, 3, "BufLimit");
+        if (lua_isnumber(lua, -1))
+        {
+            BufLimit = lua_tointeger(lua, -1);
+        }
+        lua_pop(lua, 1);
+    }
+
+    do
+    {
+        if (IsSubscribe)
+        {
+            Status = ShmBridge_ClientSubscribe(&Conn->Client, MsgId, BufLimit);
+        }
+        else
+        {
+            Status = ShmBridge_ClientUnsubscribe(&Conn->Client, MsgId);
+        }
+    }
+    while (Status == SHM_BRIDGE_RING_FULL && TestIntf_SHM_BRIDGE_Backoff(&Tries));
+
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return luaL_error(lua, "Failed to send subscription request to SHM_BRIDGE: status %d", Status);
+    }
+
+    /*
+     * The request is applied asynchronously by the bridge, so delay until it takes effect.
+     * Return a wait table value that specifies to wait for CFE_EVS EVENTMSG
+     * further specify a callback function that looks specifically for the SHM_BRIDGE event
+     */
+    lua_getuservalue(lua, 1);                               /* top@ 4 */
+    lua_newtable(lua);                                      /* top@ 5 */
+    lua_newtable(lua);                                      /* top@ 6 */
+    lua_getfield(lua, 4, "EventIntf");
+    lua_setfield(lua, 6, "Interface");
+
+    if (IsSubscribe)
+    {
+        lua_pushinteger(lua, SHM_BRIDGE_SUBSCRIBE_INF_EID);
+    }
+    else
+    {
+        lua_pushinteger(lua, SHM_BRIDGE_UNSUBSCRIBE_INF_EID);
+    }
+
+    lua_pushcclosure(lua, TestIntf_SHM_BRIDGE_CheckSubscribeEvent, 1);
+    lua_setfield(lua, 6, "Callback");
+    lua_rawseti(lua, 5, 1);
+    lua_pushinteger(lua, 5000);
+
+    return 2;
+}
+
+static int TestIntf_SHM_BRIDGE_Destroy(lua_State *lua)
+{
+    TestIntf_SHM_BRIDGE_Connection_t *Conn = luaL_checkudata(lua, 1, "TestIntf_SHM_BRIDGE_Connection");
+
+    ShmBridge_ClientDisconnect(&Conn->Client);
+
+    return 0;
+}
+
+int TestIntf_SHM_BRIDGE_Create(lua_State *lua)
+{
+    uint32_t TargetNum = luaL_checkinteger(lua, 1);
+    TestIntf_SHM_BRIDGE_Connection_t *Conn;
+    int Status;
+
+    /*
+     * Always adjust the stack to the same level so absolute refs can be used.
+     */
+    lua_settop(lua, 1);
+
+    /* index 2 -- this is the object that will be returned */
+    Conn = lua_newuserdata(lua, sizeof(TestIntf_SHM_BRIDGE_Connection_t));
+    if (luaL_newmetatable(lua, "TestIntf_SHM_BRIDGE_Connection"))
+    {
+        lua_newtable(lua);
+
+        lua_pushcfunction(lua, TestIntf_SHM_BRIDGE_Send);
+        lua_setfield(lua, -2, "Send");
+        lua_pushcfunction(lua, TestIntf_SHM_BRIDGE_Wait);
+        lua_setfield(lua, -2, "Wait");
+        lua_pushcfunction(lua, TestIntf_SHM_BRIDGE_Poll);
+        lua_setfield(lua, -2, "Poll");
+
+        lua_pushboolean(lua, 1);
+        lua_pushcclosure(lua, TestIntf_SHM_BRIDGE_DoSubscription, 1);
+        lua_setfield(lua, -2, "Subscribe");
+        lua_pushboolean(lua, 0);
+        lua_pushcclosure(lua, TestIntf_SHM_BRIDGE_DoSubscription, 1);
+        lua_setfield(lua, -2, "Unsubscribe");
+
+        lua_setfield(lua, -2, "__index");
+
+        lua_pushcfunction(lua, TestIntf_SHM_BRIDGE_Destroy);
+        lua_setfield(lua, -2, "__gc");
+    }
+    lua_setmetatable(lua, -2);
+
+    memset(Conn, 0, sizeof(*Conn));
+
+    /* The target creates the rings, so it must already be running */
+    Status = ShmBridge_ClientConnect(&Conn->Client, TargetNum);
+    if (Status != SHM_BRIDGE_RING_SUCCESS)
+    {
+        return luaL_error(lua, "Cannot attach to SHM_BRIDGE of CPU %d: %s", (int)TargetNum,
+                (Status == SHM_BRIDGE_RING_ERROR) ? strerror(errno) : "ring is not valid");
+    }
+
+    if (ShmBridge_ClientGetFormat(&Conn->Client) != SHM_BRIDGE_FORMAT_PACKED)
+    {
+        return luaL_error(lua, "SHM_BRIDGE of CPU %d is not configured for EDS packed frames", (int)TargetNum);
+    }
+
+    /*
+     * Save the CFE_EVS "EVENT_MSG" interface object in the uservalue table,
+     * it is needed to check for subscription events.
+     */
+    lua_newtable(lua);                          /* top@ 3 */
+    lua_getglobal(lua, "EdsDB");                /* top@ 4 */
+    lua_getfield(lua, 4, "GetInterface");       /* top@ 5 */
+    lua_pushstring(lua, "CFE_EVS/Application/EVENT_MSG");   /* top@ 6 */
+    lua_call(lua, 1, 1);                        /* Call GetInterface("CFE_EVS/Application/EVENT_MSG") - result@ 5 */
+    if (lua_type(lua, -1) != LUA_TUSERDATA)
+    {
+        return luaL_error(lua, "Unknown interface \'CFE_EVS/Application/EVENT_MSG\'");
+    }
+    lua_setfield(lua, 3, "EventIntf");          /* top@ 4 */
+    lua_pop(lua, 1);                            /* top@ 3 */
+    lua_setuservalue(lua, 2);                   /* Set the table as the uservalue for the returned object - top@ 2 */
+
+    /* Stack top should be back at 2 (the connection object) */
+
+    return 1;
+} /* end TestIntf_SHM_BRIDGE_Create */
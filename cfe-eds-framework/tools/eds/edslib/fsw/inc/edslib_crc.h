@@ -0,0 +1,140 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_crc.h
+ * \ingroup  fsw
+ *
+ * General purpose CRC engine.
+ *
+ * These routines are used by the EDS error control fields and are also
+ * exported for use by other software (e.g. CFE_ES_CalculateCRC()), so
+ * there is a single optimized implementation of each algorithm.
+ *
+ * All algorithms are implemented using slice-by-8 lookup tables.  Where the
+ * processor provides CRC instructions these are selected at runtime:
+ *
+ *  - x86 with SSE4.2: "crc32" instruction for CRC-32C
+ *  - x86 with PCLMULQDQ: carry-less multiply folding for CRC-32
+ *  - ARMv8 with the CRC extension: "crc32x/crc32cx" for CRC-32 and CRC-32C
+ *
+ * The 32 bit algorithms follow the common convention where the pre- and
+ * post- inversion is done internally, so the initial value is 0 and the
+ * result of a previous call may be passed in to continue the calculation
+ * over non-contiguous blocks.  The 16 bit algorithms do not have a final
+ * XOR, so the value is simply the CRC shift register.
+ */
+
+#ifndef _EDSLIB_CRC_H_
+#define _EDSLIB_CRC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Acceleration flags, as returned by EdsLib_CRC_GetAcceleration()
+ */
+#define EDSLIB_CRC_ACCEL_CRC32C     0x01    /**< CRC-32C uses a CPU instruction */
+#define EDSLIB_CRC_ACCEL_CRC32      0x02    /**< CRC-32 uses a CPU instruction */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Compute CRC-32/ISO-HDLC (as used by Ethernet, zlib, PNG, etc)
+ *
+ * Polynomial: 0x04C11DB7, Initialization: 0xFFFFFFFF,
+ * Reflect Input/Output: true, XorOut: 0xFFFFFFFF
+ *
+ * @param Crc       Initial value (0) or result of a previous call
+ * @param Buffer    Data to compute the CRC over
+ * @param Length    Size of the data in bytes
+ * @returns Updated CRC value
+ */
+uint32_t EdsLib_CRC32_Update(uint32_t Crc, const void *Buffer, size_t Length);
+
+/**
+ * Compute CRC-32C (Castagnoli, as used by iSCSI, SCTP, ext4, etc)
+ *
+ * Polynomial: 0x1EDC6F41, Initialization: 0xFFFFFFFF,
+ * Reflect Input/Output: true, XorOut: 0xFFFFFFFF
+ *
+ * @param Crc       Initial value (0) or result of a previous call
+ * @param Buffer    Data to compute the CRC over
+ * @param Length    Size of the data in bytes
+ * @returns Updated CRC value
+ */
+uint32_t EdsLib_CRC32C_Update(uint32_t Crc, const void *Buffer, size_t Length);
+
+/**
+ * Compute CRC-16/ARC
+ *
+ * Polynomial: 0x8005, Reflect Input/Output: true, XorOut: 0x0000
+ *
+ * The standard initial value for this algorithm is 0x0000.
+ *
+ * @param Crc       Initial value or result of a previous call
+ * @param Buffer    Data to compute the CRC over
+ * @param Length    Size of the data in bytes
+ * @returns Updated CRC value
+ */
+uint16_t EdsLib_CRC16_ARC_Update(uint16_t Crc, const void *Buffer, size_t Length);
+
+/**
+ * Compute CRC-16/CCITT
+ *
+ * Polynomial: 0x1021, Reflect Input/Output: false, XorOut: 0x0000
+ *
+ * The initial value for the CRC-16/CCITT-FALSE variant used by EDS
+ * error control fields is 0xFFFF.
+ *
+ * @param Crc       Initial value or result of a previous call
+ * @param Buffer    Data to compute the CRC over
+ * @param Length    Size of the data in bytes
+ * @returns Updated CRC value
+ */
+uint16_t EdsLib_CRC16_CCITT_Update(uint16_t Crc, const void *Buffer, size_t Length);
+
+/**
+ * Get the set of CRC algorithms which are currently using CPU instructions
+ *
+ * @returns Bitmask of EDSLIB_CRC_ACCEL_* flags
+ */
+uint32_t EdsLib_CRC_GetAcceleration(void);
+
+/**
+ * Limit the CRC algorithms which may use CPU instructions
+ *
+ * Acceleration is only used where the CPU supports it; this only
+ * restricts it further.  This is intended for test and benchmarking,
+ * so the accelerated and table-driven implementations can be compared.
+ *
+ * @param Mask      Bitmask of EDSLIB_CRC_ACCEL_* flags to permit
+ */
+void EdsLib_CRC_SetAcceleration(uint32_t Mask);
+
+#ifdef __cplusplus
+}   /* extern "C" */
+#endif
+
+#endif  /* _EDSLIB_CRC_H_ */
+
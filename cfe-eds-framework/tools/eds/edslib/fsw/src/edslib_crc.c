@@ -0,0 +1,456 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_crc.c
+ * \ingroup  fsw
+ *
+ * Implementation of the general purpose CRC engine.
+ *
+ * The portable implementation of every algorithm is slice-by-8: each
+ * iteration consumes 8 input bytes using 8 independent table lookups,
+ * rather than 8 dependent lookups with the classic byte-at-a-time table.
+ *
+ * CPU instructions are used for CRC-32C and CRC-32 where available.  On
+ * x86 these are not part of the baseline instruction set, so the kernels
+ * are compiled with function-specific target attributes and only called
+ * after checking CPUID at runtime.  On ARM the CRC extension is selected
+ * at compile time (e.g. -march=armv8-a+crc) so no runtime check is needed.
+ *
+ * Defining EDSLIB_CRC_NO_ACCEL at build time disables all CPU specific
+ * code and uses only the tables.
+ */
+
+#include <string.h>
+#include "edslib_crc.h"
+#include "edslib_crc_tables.h"
+
+#if !defined(EDSLIB_CRC_NO_ACCEL) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EDSLIB_CRC_X86_ACCEL
+#include <cpuid.h>
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#elif !defined(EDSLIB_CRC_NO_ACCEL) && defined(__ARM_FEATURE_CRC32)
+#define EDSLIB_CRC_ARM_ACCEL
+#include <arm_acle.h>
+#endif
+
+/*
+ * Indicates EdsLib_CRC_AccelFlags has not been set yet
+ */
+#define EDSLIB_CRC_ACCEL_UNKNOWN    0x80000000
+
+/*
+ * Algorithms currently using CPU instructions, detected on first use.
+ *
+ * If multiple threads do the first CRC concurrently, each will do the
+ * detection and store the same value, so no locking is required.
+ */
+static uint32_t EdsLib_CRC_AccelFlags = EDSLIB_CRC_ACCEL_UNKNOWN;
+
+
+/*******************************************************
+ * PORTABLE (TABLE DRIVEN) IMPLEMENTATIONS
+ *******************************************************/
+
+/*
+ * Slice-by-8 for 32 bit reflected algorithms (CRC-32 and CRC-32C)
+ * Operates on the CRC register value; the caller handles inversion.
+ */
+static uint32_t EdsLib_CRC_Reflected32(const uint32_t Table[8][256], uint32_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    uint32_t Word;
+
+    while (Length >= 8)
+    {
+        Word = Crc ^ ((uint32_t)Ptr[0] | ((uint32_t)Ptr[1] << 8) |
+                ((uint32_t)Ptr[2] << 16) | ((uint32_t)Ptr[3] << 24));
+        Crc = Table[7][Word & 0xFF] ^ Table[6][(Word >> 8) & 0xFF] ^
+                Table[5][(Word >> 16) & 0xFF] ^ Table[4][Word >> 24] ^
+                Table[3][Ptr[4]] ^ Table[2][Ptr[5]] ^
+                Table[1][Ptr[6]] ^ Table[0][Ptr[7]];
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Crc = (Crc >> 8) ^ Table[0][(Crc ^ *Ptr) & 0xFF];
+        ++Ptr;
+        --Length;
+    }
+
+    return Crc;
+}
+
+/*
+ * Slice-by-8 for 16 bit reflected algorithms (CRC-16/ARC)
+ */
+static uint16_t EdsLib_CRC_Reflected16(const uint16_t Table[8][256], uint16_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    uint32_t Word;
+
+    while (Length >= 8)
+    {
+        Word = Crc ^ ((uint32_t)Ptr[0] | ((uint32_t)Ptr[1] << 8));
+        Crc = Table[7][Word & 0xFF] ^ Table[6][Word >> 8] ^
+                Table[5][Ptr[2]] ^ Table[4][Ptr[3]] ^
+                Table[3][Ptr[4]] ^ Table[2][Ptr[5]] ^
+                Table[1][Ptr[6]] ^ Table[0][Ptr[7]];
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Crc = (Crc >> 8) ^ Table[0][(Crc ^ *Ptr) & 0xFF];
+        ++Ptr;
+        --Length;
+    }
+
+    return Crc;
+}
+
+/*
+ * Slice-by-8 for 16 bit non-reflected algorithms (CRC-16/CCITT)
+ */
+static uint16_t EdsLib_CRC_Normal16(const uint16_t Table[8][256], uint16_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    uint32_t Word;
+
+    while (Length >= 8)
+    {
+        Word = Crc ^ (((uint32_t)Ptr[0] << 8) | (uint32_t)Ptr[1]);
+        Crc = Table[7][Word >> 8] ^ Table[6][Word & 0xFF] ^
+                Table[5][Ptr[2]] ^ Table[4][Ptr[3]] ^
+                Table[3][Ptr[4]] ^ Table[2][Ptr[5]] ^
+                Table[1][Ptr[6]] ^ Table[0][Ptr[7]];
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Crc = (uint16_t)(Crc << 8) ^ Table[0][((Crc >> 8) ^ *Ptr) & 0xFF];
+        ++Ptr;
+        --Length;
+    }
+
+    return Crc;
+}
+
+
+/*******************************************************
+ * CPU SPECIFIC IMPLEMENTATIONS
+ *******************************************************/
+
+#if defined(EDSLIB_CRC_X86_ACCEL)
+
+static uint32_t EdsLib_CRC_Detect(void)
+{
+    unsigned int Eax;
+    unsigned int Ebx;
+    unsigned int Ecx;
+    unsigned int Edx;
+    uint32_t Flags;
+
+    Flags = 0;
+    if (__get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx))
+    {
+        if ((Ecx & bit_SSE4_2) != 0)
+        {
+            Flags |= EDSLIB_CRC_ACCEL_CRC32C;
+        }
+        if ((Ecx & bit_PCLMUL) != 0 && (Ecx & bit_SSE4_1) != 0)
+        {
+            Flags |= EDSLIB_CRC_ACCEL_CRC32;
+        }
+    }
+
+    return Flags;
+}
+
+/*
+ * CRC-32C using the SSE4.2 "crc32" instruction, which implements
+ * exactly this polynomial in the reflected domain.
+ */
+__attribute__((target("sse4.2")))
+static uint32_t EdsLib_CRC32C_Accel(uint32_t Crc, const uint8_t *Ptr, size_t Length)
+{
+#ifdef __x86_64__
+    uint64_t Crc64;
+    uint64_t Word64;
+
+    Crc64 = Crc;
+    while (Length >= 8)
+    {
+        memcpy(&Word64, Ptr, sizeof(Word64));
+        Crc64 = _mm_crc32_u64(Crc64, Word64);
+        Ptr += 8;
+        Length -= 8;
+    }
+    Crc = (uint32_t)Crc64;
+#else
+    uint32_t Word32;
+
+    while (Length >= 4)
+    {
+        memcpy(&Word32, Ptr, sizeof(Word32));
+        Crc = _mm_crc32_u32(Crc, Word32);
+        Ptr += 4;
+        Length -= 4;
+    }
+#endif
+
+    while (Length > 0)
+    {
+        Crc = _mm_crc32_u8(Crc, *Ptr);
+        ++Ptr;
+        --Length;
+    }
+
+    return Crc;
+}
+
+/*
+ * CRC-32 folding using PCLMULQDQ, per the Intel white paper "Fast CRC
+ * Computation for Generic Polynomials Using PCLMULQDQ Instruction".  The
+ * constants are the bit-reflected k1..k5 values for the CRC-32 polynomial
+ * and the Barrett reduction constants given at the end of that paper.
+ *
+ * Length must be at least 64 and a multiple of 16.
+ */
+__attribute__((target("sse4.1,pclmul")))
+static uint32_t EdsLib_CRC32_Fold(uint32_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    const __m128i K1K2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i K3K4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i K5K0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i Poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i Mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i X1, X2, X3, X4;
+    __m128i Y1, Y2, Y3, Y4;
+
+    X1 = _mm_loadu_si128((const __m128i *)(Ptr + 0x00));
+    X2 = _mm_loadu_si128((const __m128i *)(Ptr + 0x10));
+    X3 = _mm_loadu_si128((const __m128i *)(Ptr + 0x20));
+    X4 = _mm_loadu_si128((const __m128i *)(Ptr + 0x30));
+    X1 = _mm_xor_si128(X1, _mm_cvtsi32_si128((int)Crc));
+    Ptr += 64;
+    Length -= 64;
+
+    /* Fold 4 x 128 bits in parallel */
+    while (Length >= 64)
+    {
+        Y1 = _mm_clmulepi64_si128(X1, K1K2, 0x00);
+        Y2 = _mm_clmulepi64_si128(X2, K1K2, 0x00);
+        Y3 = _mm_clmulepi64_si128(X3, K1K2, 0x00);
+        Y4 = _mm_clmulepi64_si128(X4, K1K2, 0x00);
+
+        X1 = _mm_clmulepi64_si128(X1, K1K2, 0x11);
+        X2 = _mm_clmulepi64_si128(X2, K1K2, 0x11);
+        X3 = _mm_clmulepi64_si128(X3, K1K2, 0x11);
+        X4 = _mm_clmulepi64_si128(X4, K1K2, 0x11);
+
+        X1 = _mm_xor_si128(_mm_xor_si128(X1, Y1), _mm_loadu_si128((const __m128i *)(Ptr + 0x00)));
+        X2 = _mm_xor_si128(_mm_xor_si128(X2, Y2), _mm_loadu_si128((const __m128i *)(Ptr + 0x10)));
+        X3 = _mm_xor_si128(_mm_xor_si128(X3, Y3), _mm_loadu_si128((const __m128i *)(Ptr + 0x20)));
+        X4 = _mm_xor_si128(_mm_xor_si128(X4, Y4), _mm_loadu_si128((const __m128i *)(Ptr + 0x30)));
+
+        Ptr += 64;
+        Length -= 64;
+    }
+
+    /* Fold the 4 lanes into one 128 bit value */
+    Y1 = _mm_clmulepi64_si128(X1, K3K4, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, K3K4, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X2), Y1);
+
+    Y1 = _mm_clmulepi64_si128(X1, K3K4, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, K3K4, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X3), Y1);
+
+    Y1 = _mm_clmulepi64_si128(X1, K3K4, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, K3K4, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X4), Y1);
+
+    /* Fold any remaining 128 bit blocks */
+    while (Length >= 16)
+    {
+        Y1 = _mm_clmulepi64_si128(X1, K3K4, 0x00);
+        X1 = _mm_clmulepi64_si128(X1, K3K4, 0x11);
+        X1 = _mm_xor_si128(_mm_xor_si128(X1, _mm_loadu_si128((const __m128i *)Ptr)), Y1);
+
+        Ptr += 16;
+        Length -= 16;
+    }
+
+    /* Fold 128 bits to 64 bits */
+    X2 = _mm_clmulepi64_si128(X1, K3K4, 0x10);
+    X1 = _mm_xor_si128(_mm_srli_si128(X1, 8), X2);
+
+    X2 = _mm_srli_si128(X1, 4);
+    X1 = _mm_and_si128(X1, Mask32);
+    X1 = _mm_clmulepi64_si128(X1, K5K0, 0x00);
+    X1 = _mm_xor_si128(X1, X2);
+
+    /* Barrett reduction to 32 bits */
+    X2 = _mm_and_si128(X1, Mask32);
+    X2 = _mm_clmulepi64_si128(X2, Poly, 0x10);
+    X2 = _mm_and_si128(X2, Mask32);
+    X2 = _mm_clmulepi64_si128(X2, Poly, 0x00);
+    X1 = _mm_xor_si128(X1, X2);
+
+    return (uint32_t)_mm_extract_epi32(X1, 1);
+}
+
+static uint32_t EdsLib_CRC32_Accel(uint32_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    size_t FoldLength;
+
+    if (Length >= 64)
+    {
+        FoldLength = Length & ~(size_t)15;
+        Crc = EdsLib_CRC32_Fold(Crc, Ptr, FoldLength);
+        Ptr += FoldLength;
+        Length -= FoldLength;
+    }
+
+    return EdsLib_CRC_Reflected32(EDSLIB_CRC32_TABLE, Crc, Ptr, Length);
+}
+
+#elif defined(EDSLIB_CRC_ARM_ACCEL)
+
+static uint32_t EdsLib_CRC_Detect(void)
+{
+    return EDSLIB_CRC_ACCEL_CRC32C | EDSLIB_CRC_ACCEL_CRC32;
+}
+
+static uint32_t EdsLib_CRC32C_Accel(uint32_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    uint64_t Word64;
+
+    while (Length >= 8)
+    {
+        memcpy(&Word64, Ptr, sizeof(Word64));
+        Crc = __crc32cd(Crc, Word64);
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Crc = __crc32cb(Crc, *Ptr);
+        ++Ptr;
+        --Length;
+    }
+
+    return Crc;
+}
+
+static uint32_t EdsLib_CRC32_Accel(uint32_t Crc, const uint8_t *Ptr, size_t Length)
+{
+    uint64_t Word64;
+
+    while (Length >= 8)
+    {
+        memcpy(&Word64, Ptr, sizeof(Word64));
+        Crc = __crc32d(Crc, Word64);
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Crc = __crc32b(Crc, *Ptr);
+        ++Ptr;
+        --Length;
+    }
+
+    return Crc;
+}
+
+#else
+
+static uint32_t EdsLib_CRC_Detect(void)
+{
+    return 0;
+}
+
+#endif
+
+
+/*******************************************************
+ * PUBLIC API
+ *******************************************************/
+
+uint32_t EdsLib_CRC_GetAcceleration(void)
+{
+    uint32_t Flags;
+
+    Flags = EdsLib_CRC_AccelFlags;
+    if (Flags == EDSLIB_CRC_ACCEL_UNKNOWN)
+    {
+        Flags = EdsLib_CRC_Detect();
+        EdsLib_CRC_AccelFlags = Flags;
+    }
+
+    return Flags;
+}
+
+void EdsLib_CRC_SetAcceleration(uint32_t Mask)
+{
+    EdsLib_CRC_AccelFlags = EdsLib_CRC_Detect() & Mask;
+}
+
+uint32_t EdsLib_CRC32_Update(uint32_t Crc, const void *Buffer, size_t Length)
+{
+#if defined(EDSLIB_CRC_X86_ACCEL) || defined(EDSLIB_CRC_ARM_ACCEL)
+    if ((EdsLib_CRC_GetAcceleration() & EDSLIB_CRC_ACCEL_CRC32) != 0)
+    {
+        return ~EdsLib_CRC32_Accel(~Crc, Buffer, Length);
+    }
+#endif
+
+    return ~EdsLib_CRC_Reflected32(EDSLIB_CRC32_TABLE, ~Crc, Buffer, Length);
+}
+
+uint32_t EdsLib_CRC32C_Update(uint32_t Crc, const void *Buffer, size_t Length)
+{
+#if defined(EDSLIB_CRC_X86_ACCEL) || defined(EDSLIB_CRC_ARM_ACCEL)
+    if ((EdsLib_CRC_GetAcceleration() & EDSLIB_CRC_ACCEL_CRC32C) != 0)
+    {
+        return ~EdsLib_CRC32C_Accel(~Crc, Buffer, Length);
+    }
+#endif
+
+    return ~EdsLib_CRC_Reflected32(EDSLIB_CRC32C_TABLE, ~Crc, Buffer, Length);
+}
+
+uint16_t EdsLib_CRC16_ARC_Update(uint16_t Crc, const void *Buffer, size_t Length)
+{
+    return EdsLib_CRC_Reflected16(EDSLIB_CRC16_ARC_TABLE, Crc, Buffer, Length);
+}
+
+uint16_t EdsLib_CRC16_CCITT_Update(uint16_t Crc, const void *Buffer, size_t Length)
+{
+    return EdsLib_CRC_Normal16(EDSLIB_CRC16_CCITT_TABLE, Crc, Buffer, Length);
+}
@@ -35,6 +35,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include "edslib_internal.h"
+#include "edslib_crc.h"
 
 /*
  * CRC Algorithm: CRC-16/CCITT-FALSE
@@ -63,6 +64,7 @@ static uintmax_t EdsLib_ErrorControlAlgorithm_ZERO(const void *Base, uint32_t Si
 static uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM_LONGITUDINAL(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 static uintmax_t EdsLib_ErrorControlAlgorithm_CRC16_CCITT(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 static uintmax_t EdsLib_ErrorControlAlgorithm_CRC8(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
+static uintmax_t EdsLib_ErrorControlAlgorithm_CRC32(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 static uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 
 
@@ -73,11 +75,10 @@ static const EdsLib_ErrorControlImpl_t EDSLIB_ERRCTL_DISPATCH[EdsLib_ErrorContro
         [EdsLib_ErrorControlType_CHECKSUM_LONGITUDINAL] = EdsLib_ErrorControlAlgorithm_CHECKSUM_LONGITUDINAL,
         [EdsLib_ErrorControlType_CRC8] = EdsLib_ErrorControlAlgorithm_CRC8,
         [EdsLib_ErrorControlType_CRC16_CCITT] = EdsLib_ErrorControlAlgorithm_CRC16_CCITT,
-        [EdsLib_ErrorControlType_CRC32] = EdsLib_ErrorControlAlgorithm_ZERO /* placeholder; not implemented yet */
+        [EdsLib_ErrorControlType_CRC32] = EdsLib_ErrorControlAlgorithm_CRC32
 };
 
 
-static uint16_t EDSLIB_CRC16_CCITT_TABLE[256];
 static uint8_t  EDSLIB_CRC8_TABLE[256];
 
 
@@ -85,6 +86,7 @@ static uint8_t  EDSLIB_CRC8_TABLE[256];
  * This function serves two purposes:
  *  1) A place to put initialization code for all error control algorithms, such
  *     as generating a lookup table for CRCs or whatever else needs to be done
+ *     (the CRC16 and CRC32 tables are constant, see edslib_crc.c)
  *  2) Something is called during initialization to ensure that this compilation unit
  *     is included in the link.  In general the algorithms in here are only referenced
  *     by dynamically loaded code, so having this init function ensures that this code
@@ -94,12 +96,10 @@ void EdsLib_ErrorControl_Initialize(void)
 {
     uint16_t i;
     uint16_t bit;
-    uint32_t crc16_shiftreg;
     uint32_t crc8_shiftreg;
 
     for (i = 0; i < 256; ++i)
     {
-        crc16_shiftreg = i << 8;
         crc8_shiftreg = 0;
 
         for (bit = 0; bit < 8; ++bit)
@@ -112,12 +112,7 @@ void EdsLib_ErrorControl_Initialize(void)
 
         for (bit = 0; bit < 8; ++bit)
         {
-            crc16_shiftreg <<= 1;
             crc8_shiftreg <<= 1;
-            if (crc16_shiftreg & 0x10000)
-            {
-                crc16_shiftreg ^= EDSLIB_CRC16_CCITT_POLY;
-            }
             if (crc8_shiftreg & 0x100)
             {
                 crc8_shiftreg ^= EDSLIB_CRC8_POLY;
@@ -132,8 +127,6 @@ void EdsLib_ErrorControl_Initialize(void)
                 EDSLIB_CRC8_TABLE[i] |= 0x80 >> bit;
             }
         }
-
-        EDSLIB_CRC16_CCITT_TABLE[i] = crc16_shiftreg & 0xFFFF;
     }
 }
 
@@ -211,8 +204,9 @@ uintmax_t EdsLib_ErrorControlAlgorithm_CRC16_CCITT(const void *Base, uint32_t To
         NextBitPos = CurrBitPos + 8;
         if (CurrShift == 0 && NextBitPos <= BreakpointBitPos)
         {
-            crc = EDSLIB_CRC16_CCITT_TABLE[(byte ^ (crc >> 8)) & 0xff] ^
-                    (crc << 8);
+            /* All whole bytes up to the breakpoint can be done in one call */
+            NextBitPos = CurrBitPos + ((BreakpointBitPos - CurrBitPos) & ~UINT32_C(7));
+            crc = EdsLib_CRC16_CCITT_Update(crc, &SrcPtr[CurrBitPos >> 3], (NextBitPos - CurrBitPos) >> 3);
         }
         else
         {
@@ -316,6 +310,43 @@ uintmax_t EdsLib_ErrorControlAlgorithm_CRC8(const void *Base, uint32_t TotalBitS
     return crc;
 }
 
+/*
+ * CRC-32/ISO-HDLC, excluding the error control field itself.
+ *
+ * Unlike the CRC16/CRC8 implementations, this only operates on whole bytes.
+ * Any byte that contains part of the error control field is excluded.
+ */
+uintmax_t EdsLib_ErrorControlAlgorithm_CRC32(const void *Base, uint32_t TotalBitSize, uint32_t ErrCtlBitPos)
+{
+    const uint8_t *SrcPtr;
+    uint32_t TotalByte;
+    uint32_t FieldStartByte;
+    uint32_t FieldEndByte;
+    uint32_t crc;
+
+    SrcPtr = Base;
+    TotalByte = (TotalBitSize + 7) >> 3;
+    if (ErrCtlBitPos < TotalBitSize)
+    {
+        FieldStartByte = ErrCtlBitPos >> 3;
+        FieldEndByte = (ErrCtlBitPos >> 3) + 4 + ((ErrCtlBitPos & 0x7) != 0);
+        if (FieldEndByte > TotalByte)
+        {
+            FieldEndByte = TotalByte;
+        }
+    }
+    else
+    {
+        FieldStartByte = TotalByte;
+        FieldEndByte = TotalByte;
+    }
+
+    crc = EdsLib_CRC32_Update(0, SrcPtr, FieldStartByte);
+    crc = EdsLib_CRC32_Update(crc, &SrcPtr[FieldEndByte], TotalByte - FieldEndByte);
+
+    return crc;
+}
+
 uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM(const void *Base, uint32_t TotalBitSize, uint32_t ErrCtlBitPos)
 {
     const uint8_t *SrcPtr;
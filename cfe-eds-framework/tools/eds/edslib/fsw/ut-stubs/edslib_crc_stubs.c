@@ -0,0 +1,126 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in edslib_crc header
+ */
+
+#include "edslib_crc.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_CRC16_ARC_Update()
+ * ----------------------------------------------------
+ */
+uint16_t EdsLib_CRC16_ARC_Update(uint16_t Crc, const void *Buffer, size_t Length)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_CRC16_ARC_Update, uint16_t);
+
+    UT_GenStub_AddParam(EdsLib_CRC16_ARC_Update, uint16_t, Crc);
+    UT_GenStub_AddParam(EdsLib_CRC16_ARC_Update, const void *, Buffer);
+    UT_GenStub_AddParam(EdsLib_CRC16_ARC_Update, size_t, Length);
+
+    UT_GenStub_Execute(EdsLib_CRC16_ARC_Update, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_CRC16_ARC_Update, uint16_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_CRC16_CCITT_Update()
+ * ----------------------------------------------------
+ */
+uint16_t EdsLib_CRC16_CCITT_Update(uint16_t Crc, const void *Buffer, size_t Length)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_CRC16_CCITT_Update, uint16_t);
+
+    UT_GenStub_AddParam(EdsLib_CRC16_CCITT_Update, uint16_t, Crc);
+    UT_GenStub_AddParam(EdsLib_CRC16_CCITT_Update, const void *, Buffer);
+    UT_GenStub_AddParam(EdsLib_CRC16_CCITT_Update, size_t, Length);
+
+    UT_GenStub_Execute(EdsLib_CRC16_CCITT_Update, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_CRC16_CCITT_Update, uint16_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_CRC32C_Update()
+ * ----------------------------------------------------
+ */
+uint32_t EdsLib_CRC32C_Update(uint32_t Crc, const void *Buffer, size_t Length)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_CRC32C_Update, uint32_t);
+
+    UT_GenStub_AddParam(EdsLib_CRC32C_Update, uint32_t, Crc);
+    UT_GenStub_AddParam(EdsLib_CRC32C_Update, const void *, Buffer);
+    UT_GenStub_AddParam(EdsLib_CRC32C_Update, size_t, Length);
+
+    UT_GenStub_Execute(EdsLib_CRC32C_Update, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_CRC32C_Update, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_CRC32_Update()
+ * ----------------------------------------------------
+ */
+uint32_t EdsLib_CRC32_Update(uint32_t Crc, const void *Buffer, size_t Length)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_CRC32_Update, uint32_t);
+
+    UT_GenStub_AddParam(EdsLib_CRC32_Update, uint32_t, Crc);
+    UT_GenStub_AddParam(EdsLib_CRC32_Update, const void *, Buffer);
+    UT_GenStub_AddParam(EdsLib_CRC32_Update, size_t, Length);
+
+    UT_GenStub_Execute(EdsLib_CRC32_Update, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_CRC32_Update, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_CRC_GetAcceleration()
+ * ----------------------------------------------------
+ */
+uint32_t EdsLib_CRC_GetAcceleration(void)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_CRC_GetAcceleration, uint32_t);
+
+    UT_GenStub_Execute(EdsLib_CRC_GetAcceleration, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_CRC_GetAcceleration, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_CRC_SetAcceleration()
+ * ----------------------------------------------------
+ */
+void EdsLib_CRC_SetAcceleration(uint32_t Mask)
+{
+    UT_GenStub_AddParam(EdsLib_CRC_SetAcceleration, uint32_t, Mask);
+
+    UT_GenStub_Execute(EdsLib_CRC_SetAcceleration, Basic, NULL);
+}
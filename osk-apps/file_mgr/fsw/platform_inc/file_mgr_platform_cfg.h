@@ -62,5 +62,6 @@
 #define FILE_MGR_DIR_LIST_PKT_ENTRIES     20
 //TODO: Remove after EDS finalized: #define FILE_MGR_FILESYS_TBL_VOL_CNT       8
 #define FILE_MGR_TASK_FILE_BLOCK_SIZE   2048  /* Chunk of file to work with for one iteration of a task like computing a CRC */
+#define FILE_MGR_TASK_FILE_COPY_SIZE    (1024*1024)  /* Chunk of file copied by OSAL for one iteration of a task like concatenating files */
 
 #endif /* _file_mgr_platform_cfg_ */
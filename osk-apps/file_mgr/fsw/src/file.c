@@ -841,8 +841,7 @@ static bool ConcatenateFiles(const char *SrcFile1, const char *SrcFile2, const c
    os_err_name_t OsErrStr;
    osal_id_t     SourceFileHandle;
    osal_id_t     TargetFileHandle;
-   int32         BytesRead;
-   int32         BytesWritten;
+   int32         BytesCopied;
       
    char    EventErrStr[256] = "\0";
    uint16  TaskBlockCnt = 0;
@@ -859,7 +858,7 @@ static bool ConcatenateFiles(const char *SrcFile1, const char *SrcFile2, const c
       if (SysStatus == OS_SUCCESS)
       {
    
-         SysStatus = OS_OpenCreate(&TargetFileHandle, SrcFile2, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+         SysStatus = OS_OpenCreate(&TargetFileHandle, TargetFile, OS_FILE_FLAG_NONE, OS_WRITE_ONLY);
    
          if (SysStatus == OS_SUCCESS)
          {
@@ -869,36 +868,27 @@ static bool ConcatenateFiles(const char *SrcFile1, const char *SrcFile2, const c
             while (PerformingCatenation)
             {
                
-               BytesRead = OS_read(SourceFileHandle, File->FileTaskBuf, FILE_MGR_TASK_FILE_BLOCK_SIZE);
-               if (BytesRead == 0)
+               /* OSAL copies the data in the kernel when the OS supports it */
+               BytesCopied = OS_FileCopyRange(SourceFileHandle, TargetFileHandle, FILE_MGR_TASK_FILE_COPY_SIZE);
+               if (BytesCopied == 0)
                {
                
                   PerformingCatenation = false;
                   ConcatenatedFiles    = true;
                
                }
-               else if (BytesRead < 0)
+               else if (BytesCopied < 0)
                {
                   
                   PerformingCatenation = false;
 
-                  sprintf(EventErrStr,"Concatenate file cmd error: File read error. OS_read status = %d", BytesRead);
+                  OS_GetErrorName(BytesCopied, &OsErrStr);
+                  sprintf(EventErrStr,"Concatenate file cmd error: File copy error. OS_FileCopyRange status %s", OsErrStr);
 
                }
                else
                {
                   
-                  BytesWritten = OS_write(TargetFileHandle, File->FileTaskBuf, BytesRead);
-
-                  if (BytesWritten != BytesRead)
-                  {
-
-                     PerformingCatenation = false;
-                     sprintf(EventErrStr,"Concatenate file cmd error: File read/write error. BytesRead %d  not equal to BytesWritten %d",
-                             BytesRead, BytesWritten);
-                  
-                  }
-           
                   CHILDMGR_PauseTask(&TaskBlockCnt, INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_CNT), 
                                      INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY),
                                      INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID));
@@ -913,7 +903,7 @@ static bool ConcatenateFiles(const char *SrcFile1, const char *SrcFile2, const c
          else
          {
             OS_GetErrorName(SysStatus,&OsErrStr);         
-            sprintf(EventErrStr,"Concatenate file cmd error: Error opening target file %s. Open status %s", SrcFile2, OsErrStr);
+            sprintf(EventErrStr,"Concatenate file cmd error: Error opening target file %s. Open status %s", TargetFile, OsErrStr);
             
          } /* End if  failed to open target file */
          
@@ -79,9 +79,9 @@ void FOTP_Constructor(FOTP_Class_t* FotpPtr, INITBL_Class_t* IniTbl)
                 CFE_SB_ValueToMsgId(INITBL_GetIntConfig(Fotp->IniTbl, CFG_FILE_XFER_FOTP_START_TRANSFER_TLM_TOPICID)),
                 sizeof(FILE_XFER_FotpStartTransferTlm_t));
 
-   CFE_MSG_Init(CFE_MSG_PTR(Fotp->DataSegmentPkt.TelemetryHeader),
-               CFE_SB_ValueToMsgId(INITBL_GetIntConfig(Fotp->IniTbl, CFG_FILE_XFER_FOTP_DATA_SEGMENT_TLM_TOPICID)),
-               sizeof(FILE_XFER_FotpDataSegmentTlm_t));
+   PKTPUB_Constructor(&Fotp->DataSegmentPub,
+                      CFE_SB_ValueToMsgId(INITBL_GetIntConfig(Fotp->IniTbl, CFG_FILE_XFER_FOTP_DATA_SEGMENT_TLM_TOPICID)),
+                      sizeof(FILE_XFER_FotpDataSegmentTlm_t));
 
    CFE_MSG_Init(CFE_MSG_PTR(Fotp->FinishTransferPkt.TelemetryHeader),
                 CFE_SB_ValueToMsgId(INITBL_GetIntConfig(Fotp->IniTbl, CFG_FILE_XFER_FOTP_FINISH_TRANSFER_TLM_TOPICID)),
@@ -431,6 +431,8 @@ static void DestructorCallback(void)
       OS_close(Fotp->FileHandle);
    }
    
+   PKTPUB_Destructor(&Fotp->DataSegmentPub);
+   
 } /* End DestructorCallback() */
 
 
@@ -444,11 +446,18 @@ static void DestructorCallback(void)
 **   2. NextDataSegmentId, FileTransferByteCnt, and FileRunningCrc are based on
 **      successful telemetry packet send. If the send fails then the stats are
 **      not updated.
+**   3. Data segments are read directly into a zero copy buffer. The segment
+**      length is saved before the send since the buffer belongs to the
+**      software bus after a successful send. A failed send leaves the segment
+**      in the buffer for the retry. If no buffer is available the transfer
+**      waits until the next execution cycle.
 **   TODO - Replace DataSegmentsSent logic with a TO semaphore handshake
 */
 static SendDataSegmentState_t SendDataSegments(void)
 {
    
+   FILE_XFER_FotpDataSegmentTlm_t* DataSegmentPkt;
+   uint16  SegmentLen;
    uint16  DataSegmentsSent = 0;
    uint16  FileBytesRead;
    uint32  RemainingBytes;
@@ -462,32 +471,40 @@ static SendDataSegmentState_t SendDataSegments(void)
       while (ContinueSend)
       {
          
-         Fotp->DataSegmentPkt.Payload.Id = Fotp->NextDataSegmentId;
+         DataSegmentPkt = (FILE_XFER_FotpDataSegmentTlm_t*)PKTPUB_GetMsgPtr(&Fotp->DataSegmentPub);
+         if (DataSegmentPkt == NULL)
+         {
+            ContinueSend = false;
+            continue;
+         }
+         
+         DataSegmentPkt->Payload.Id = Fotp->NextDataSegmentId;
          
          RemainingBytes = Fotp->FileLen - Fotp->FileTransferByteCnt;
          if (RemainingBytes <= Fotp->DataSegmentLen)
          {
-            Fotp->DataSegmentPkt.Payload.Len = RemainingBytes;
+            DataSegmentPkt->Payload.Len = RemainingBytes;
             Fotp->LastDataSegment = true;
          }
          else
          {
-            Fotp->DataSegmentPkt.Payload.Len = Fotp->DataSegmentLen;
+            DataSegmentPkt->Payload.Len = Fotp->DataSegmentLen;
          }
+         SegmentLen = DataSegmentPkt->Payload.Len;
          
-         memset(Fotp->DataSegmentPkt.Payload.Data, 0, FOTP_DATA_SEG_MAX_LEN);
-         FileBytesRead = OS_read(Fotp->FileHandle, Fotp->DataSegmentPkt.Payload.Data, Fotp->DataSegmentPkt.Payload.Len);
+         memset(DataSegmentPkt->Payload.Data, 0, FOTP_DATA_SEG_MAX_LEN);
+         FileBytesRead = OS_read(Fotp->FileHandle, DataSegmentPkt->Payload.Data, SegmentLen);
          
-         if (FileBytesRead == Fotp->DataSegmentPkt.Payload.Len)
+         if (FileBytesRead == SegmentLen)
          {
-            Fotp->FileRunningCrc = CRC_32c(Fotp->FileRunningCrc, (const uint8 *)Fotp->DataSegmentPkt.Payload.Data, FileBytesRead);
-            //TODO - Always send full packet: CFE_SB_SetUserDataLength((CFE_MSG_Message_t *)&Fotp->DataSegmentPkt, (FOTP_DATA_SEGMENT_NON_DATA_TLM_LEN + Fotp->DataSegmentPkt.Payload.Len));
+            Fotp->FileRunningCrc = CRC_32c(Fotp->FileRunningCrc, (const uint8 *)DataSegmentPkt->Payload.Data, FileBytesRead);
+            //TODO - Always send full packet: CFE_SB_SetUserDataLength((CFE_MSG_Message_t *)DataSegmentPkt, (FOTP_DATA_SEGMENT_NON_DATA_TLM_LEN + SegmentLen));
           
             if (SendFileTransferTlm(FOTP_SEND_DATA))
             {
                Fotp->PrevSendDataSegmentFailed = false;
                Fotp->NextDataSegmentId++;
-               Fotp->FileTransferByteCnt += Fotp->DataSegmentPkt.Payload.Len;
+               Fotp->FileTransferByteCnt += SegmentLen;
                if (Fotp->LastDataSegment)
                {
                   CloseFile    = true;
@@ -514,7 +531,7 @@ static SendDataSegmentState_t SendDataSegments(void)
            SendDataSegmentState = SEND_DATA_SEGMENT_ABORTED;
            CFE_EVS_SendEvent(FOTP_SEND_DATA_SEGMENT_ERR_EID, CFE_EVS_EventType_ERROR, 
                              "File transfer aborted: Error reading data from file %s. Attempted %d bytes, read %d",
-                             Fotp->SrcFilename, Fotp->DataSegmentPkt.Payload.Len, FileBytesRead);
+                             Fotp->SrcFilename, SegmentLen, FileBytesRead);
          }
          
       } /* End while send DataSegment */
@@ -528,12 +545,15 @@ static SendDataSegmentState_t SendDataSegments(void)
       ** desirable but the logic is short a function seems cumbersome at best.     
       */
       
+      DataSegmentPkt = (FILE_XFER_FotpDataSegmentTlm_t*)PKTPUB_GetMsgPtr(&Fotp->DataSegmentPub);
+      SegmentLen = (DataSegmentPkt == NULL) ? 0 : DataSegmentPkt->Payload.Len;
+      
       if (SendFileTransferTlm(FOTP_SEND_DATA))
       {
          
          Fotp->PrevSendDataSegmentFailed = false;
          Fotp->NextDataSegmentId++;
-         Fotp->FileTransferByteCnt += Fotp->DataSegmentPkt.Payload.Len;
+         Fotp->FileTransferByteCnt += SegmentLen;
          if (Fotp->LastDataSegment)
          {
             CloseFile = true;
@@ -576,6 +596,7 @@ static bool SendFileTransferTlm(FOTP_FileTransferState_t FileTransferState)
    
    CFE_MSG_TelemetryHeader_t *TlmHeader = NULL;
    int32 SbStatus;
+   bool  SendDataSegment = false;
    bool  RetStatus = false;
    
    switch (Fotp->FileTransferState)
@@ -587,8 +608,8 @@ static bool SendFileTransferTlm(FOTP_FileTransferState_t FileTransferState)
          break;
          
       case FOTP_SEND_DATA:
-         /* Segment ID is loaded prior to this call */
-         TlmHeader = &Fotp->DataSegmentPkt.TelemetryHeader;
+         /* Data segment is loaded in the publisher's buffer prior to this call */
+         SendDataSegment = true;
          break;
          
       case FOTP_FINISH:
@@ -603,7 +624,14 @@ static bool SendFileTransferTlm(FOTP_FileTransferState_t FileTransferState)
 
    } /* End state switch */
    
-   if (TlmHeader != NULL)
+   if (SendDataSegment)
+   {
+      
+      /* The publisher reports its own errors */
+      RetStatus = PKTPUB_Publish(&Fotp->DataSegmentPub, true);
+      
+   }
+   else if (TlmHeader != NULL)
    {
    
       CFE_SB_TimeStampMsg(CFE_MSG_PTR(*TlmHeader));
@@ -202,7 +202,7 @@ typedef struct
    */
    
    FILE_XFER_FotpStartTransferTlm_t   StartTransferPkt;
-   FILE_XFER_FotpDataSegmentTlm_t     DataSegmentPkt;
+   PKTPUB_Class_t                     DataSegmentPub;    /* Data segments are filled in zero copy buffers */
    FILE_XFER_FotpFinishTransferTlm_t  FinishTransferPkt;
 
    /*
@@ -47,6 +47,7 @@ static void    MinorFrameCallback(uint32 TimerId);
 static uint32  GetCurrentSlotNumber(void);
 static uint32  GetMETSlotNumber(void);
 static int32   ProcessSlot(void);
+static void    ActivityError(SCHTBL_Entry_t *TblEntry, int32 Activity, int32 MsgSendStatus);
 static bool    SendTblEntryTlm(uint16 SchTblIndex, uint16 MsgTblIndex, bool UseSchTblIndex);
 
 /**********************/
@@ -1158,6 +1159,24 @@ static void MinorFrameCallback(uint32 TimerId)
 } /* End MinorFrameCallback() */
 
 
+/******************************************************************************
+** Function: ActivityError
+**
+** Disable an entry with an invalid message: Bad index or didn't send properly
+*/
+static void ActivityError(SCHTBL_Entry_t *TblEntry, int32 Activity, int32 MsgSendStatus)
+{
+
+   TblEntry->Enabled = false;
+   Scheduler->ScheduleActivityFailureCount++;
+
+   CFE_EVS_SendEvent(SCHEDULER_PACKET_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
+                     "Activity error: slot = %d, entry = %d, err = 0x%08X",
+                     Scheduler->NextSlotNumber, Activity, MsgSendStatus);
+
+} /* End ActivityError() */
+
+
 /******************************************************************************
 ** Function: ProcessSlot
 **
@@ -1171,12 +1190,20 @@ static int32 ProcessSlot(void)
    uint32 Remainder;
    SCHTBL_Entry_t *TblEntry;
    uint16 *MsgBufPtr;
-   int32  MsgSendStatus;
    MSGTBL_CmdMsg_t *CmdMsg;
+   uint16 MsgCnt;
+   uint16 i;
+   int32  MsgActivity[SCHTBL_ACTIVITIES_PER_SLOT];
+   const CFE_MSG_Message_t *MsgPtr[SCHTBL_ACTIVITIES_PER_SLOT];
+   CFE_Status_t MsgStatus[SCHTBL_ACTIVITIES_PER_SLOT];
 
    SlotIndex = Scheduler->NextSlotNumber * SCHTBL_ACTIVITIES_PER_SLOT;
+   MsgCnt    = 0;
 
-   /* Process each enabled entry in the schedule table slot */
+   /* 
+   ** Collect the messages for each enabled entry in the schedule table slot 
+   ** so they can be sent with one SB call
+   */
    for (Activity = 0; Activity < SCHTBL_ACTIVITIES_PER_SLOT; Activity++)
    {
    
@@ -1191,7 +1218,6 @@ static int32 ProcessSlot(void)
 
             CFE_EVS_SendEvent(SCHEDULER_DEBUG_EID, CFE_EVS_EventType_DEBUG,"Scheduler ProcessSlot(): slot %d, entry %d, msgid %d", Scheduler->NextSlotNumber, Activity, TblEntry->MsgTblIndex);
              
-            MsgSendStatus = CFE_SB_NO_MESSAGE;  /* use any non-success error code */
             if (TblEntry->MsgTblIndex < MSGTBL_MAX_ENTRIES)
             {
             
@@ -1202,28 +1228,17 @@ static int32 ProcessSlot(void)
                                  TblEntry->MsgTblIndex, MsgBufPtr[0], MsgBufPtr[0]);
             
                CmdMsg = &Scheduler->MsgTbl.Cmd.Msg[TblEntry->MsgTblIndex];
-               MsgSendStatus = CFE_SB_TransmitMsg(CFE_MSG_PTR(CmdMsg->Header), true);
+               MsgActivity[MsgCnt] = Activity;
+               MsgPtr[MsgCnt]      = CFE_MSG_PTR(CmdMsg->Header);
+               MsgCnt++;
 
             } /* End if valid EntryId */
-
-            if (MsgSendStatus == CFE_SUCCESS)
+            else
             {
                
-               Scheduler->ScheduleActivitySuccessCount++;
+               ActivityError(TblEntry, Activity, CFE_SB_NO_MESSAGE);  /* use any non-success error code */
             
             }
-            else 
-            {
-               
-               /* Disable entry with invalid message: Bad index or didn't send properly */
-               TblEntry->Enabled = false;
-               Scheduler->ScheduleActivityFailureCount++;
-
-               CFE_EVS_SendEvent(SCHEDULER_PACKET_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
-                                 "Activity error: slot = %d, entry = %d, err = 0x%08X",
-                                 Scheduler->NextSlotNumber, Activity, MsgSendStatus);
-            
-            } /* End if msg send error */
          
          } /* End if offset met */
 
@@ -1231,6 +1246,31 @@ static int32 ProcessSlot(void)
 
    } /* Entries per slot loop */
 
+   if (MsgCnt > 0)
+   {
+   
+      CFE_SB_TransmitMsgBatch(MsgPtr, MsgCnt, true, MsgStatus);
+      
+      for (i = 0; i < MsgCnt; i++)
+      {
+
+         if (MsgStatus[i] == CFE_SUCCESS)
+         {
+            
+            Scheduler->ScheduleActivitySuccessCount++;
+         
+         }
+         else 
+         {
+            
+            TblEntry = &Scheduler->SchTbl.Data.Entry[SlotIndex+MsgActivity[i]];
+            ActivityError(TblEntry, MsgActivity[i], MsgStatus[i]);
+         
+         }
+      } /* End batch status loop */
+      
+   } /* End if messages to send */
+
    /*
    ** Process ground commands in the slot reserved for time synch
    ** Ground commands should only be processed at the end of the schedule table
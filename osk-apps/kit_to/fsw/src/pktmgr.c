@@ -60,6 +60,7 @@ static void  FlushTlmPipe(void);
 static bool  LoadPktTbl(PKTTBL_Data_t* NewTbl);
 static int32 PackEdsOutputMessage(void *DestBuffer, const CFE_MSG_Message_t *SrcBuffer, 
                                   size_t SrcBufferSize, size_t *EdsDataSize);
+static void  SendTlmBatch(uint16 NumMsgs);
 static int32 SubscribeNewPkt(PKTTBL_Pkt_t *NewPkt);
 
 /**********************/
@@ -67,8 +68,9 @@ static int32 SubscribeNewPkt(PKTTBL_Pkt_t *NewPkt);
 /**********************/
 
 static PKTMGR_Class_t*  PktMgr = NULL;
-static CFE_HDR_TelemetryHeader_PackedBuffer_t SocketBuffer;
-static uint16 SocketBufferLen = sizeof(SocketBuffer);
+static CFE_HDR_TelemetryHeader_PackedBuffer_t SocketBuffer[PKTMGR_TLM_SEND_BATCH_SIZE];
+static uint16 SocketBufferLen = sizeof(SocketBuffer[0]);
+static OS_SockMsg_t SocketMsg[PKTMGR_TLM_SEND_BATCH_SIZE];
 
 /******************************************************************************
 ** Function: PKTMGR_Constructor
@@ -251,16 +253,19 @@ void PKTMGR_InitStats(uint16 OutputTlmInterval, uint16 InitDelay)
 uint16 PKTMGR_OutputTelemetry(void)
 {
 
-   int     SocketStatus;
    int32   SbStatus;
    uint16  NumPktsOutput  = 0;
+   uint16  NumPktsPending = 0;
    uint32  NumBytesOutput = 0;
    size_t  EdsDataSize;
+   size_t  NumPktsRcvd;
+   size_t  i;
    
    CFE_MSG_ApId_t   AppId;
    CFE_MSG_Size_t   MsgLen;
    OS_SockAddr_t    SocketAddr;
    CFE_SB_Buffer_t  *SbBufPtr;
+   CFE_SB_Buffer_t  *SbBufPtrs[PKTMGR_TLM_PIPE_BATCH_SIZE];
 
 
    OS_SocketAddrInit(&SocketAddr, OS_SocketDomain_INET);
@@ -268,17 +273,23 @@ uint16 PKTMGR_OutputTelemetry(void)
    OS_SocketAddrSetPort(&SocketAddr, PktMgr->TlmUdpPort);
     
    /*
-   ** CFE_SB_RcvMsg returns CFE_SUCCESS when it gets a packet, otherwise
-   ** no packet was received
+   ** CFE_SB_ReceiveBufferBatch returns CFE_SUCCESS when it gets at least one
+   ** packet, otherwise the pipe is empty. The received SB buffers belong to
+   ** this app until they are released, which is done once each batch has been
+   ** packed into SocketBuffer. Packets are sent PKTMGR_TLM_SEND_BATCH_SIZE at
+   ** a time.
    */
    do
    {
 
-      SbStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, PktMgr->TlmPipe, CFE_SB_POLL);
+      SbStatus = CFE_SB_ReceiveBufferBatch(SbBufPtrs, PKTMGR_TLM_PIPE_BATCH_SIZE, &NumPktsRcvd,
+                                           PktMgr->TlmPipe, CFE_SB_POLL);
  
-      if ( (SbStatus == CFE_SUCCESS) && (PktMgr->SuppressSend == false) )
+      for (i=0; (i < NumPktsRcvd) && (PktMgr->SuppressSend == false); i++)
       {
           
+         SbBufPtr = SbBufPtrs[i];
+         
          if(PktMgr->DownlinkOn)
          {
             
@@ -288,11 +299,12 @@ uint16 PKTMGR_OutputTelemetry(void)
             if (!PktUtil_IsPacketFiltered(&SbBufPtr->Msg, &(PktMgr->PktTbl.Data.Pkt[AppId].Filter)))
             {
             
-               SbStatus = PackEdsOutputMessage(SocketBuffer, &SbBufPtr->Msg, SocketBufferLen, &EdsDataSize);
-               
-               if (SbStatus == CFE_SUCCESS)
+               if (PackEdsOutputMessage(SocketBuffer[NumPktsPending], &SbBufPtr->Msg, SocketBufferLen, &EdsDataSize) == CFE_SUCCESS)
                {
-                  SocketStatus = OS_SocketSendTo(PktMgr->TlmSockId, SocketBuffer, EdsDataSize, &SocketAddr);
+                  SocketMsg[NumPktsPending].Buffer     = SocketBuffer[NumPktsPending];
+                  SocketMsg[NumPktsPending].BufferSize = EdsDataSize;
+                  SocketMsg[NumPktsPending].RemoteAddr = &SocketAddr;
+                  ++NumPktsPending;
           
                   ++NumPktsOutput;
                   NumBytesOutput += MsgLen;
@@ -300,24 +312,25 @@ uint16 PKTMGR_OutputTelemetry(void)
                
             } /* End if packet is not filtered */
          } /* End if downlink enabled */
-         else
-         {
-            SocketStatus = 0;
-         } 
          
-         if (SocketStatus < 0)
+         if (NumPktsPending == PKTMGR_TLM_SEND_BATCH_SIZE)
          {
-             
-            CFE_EVS_SendEvent(PKTMGR_SOCKET_SEND_ERR_EID,CFE_EVS_EventType_ERROR,
-                              "Error sending packet on socket %s, port %d, status %d. Tlm output suppressed\n",
-                              PktMgr->TlmDestIp, PktMgr->TlmUdpPort, SocketStatus);
-            PktMgr->SuppressSend = true;
+            SendTlmBatch(NumPktsPending);
+            NumPktsPending = 0;
          }
 
-      } /* End if SB received msg and output enabled */
+      } /* End packet batch loop */
+
+      /* Release every received buffer, including any skipped by SuppressSend */
+      CFE_SB_ReleaseBufferBatch(SbBufPtrs, NumPktsRcvd, PktMgr->TlmPipe);
 
    } while(SbStatus == CFE_SUCCESS);
 
+   if ((NumPktsPending > 0) && (PktMgr->SuppressSend == false))
+   {
+      SendTlmBatch(NumPktsPending);
+   }
+
    ComputeStats(NumPktsOutput, NumBytesOutput);
 
    return NumPktsOutput;
@@ -657,12 +670,16 @@ static void DestructorCallback(void)
 static void FlushTlmPipe(void)
 {
 
-   int32 SbStatus;
-   CFE_SB_Buffer_t  *SbBufPtr;
+   int32  SbStatus;
+   size_t NumPktsRcvd;
+   CFE_SB_Buffer_t  *SbBufPtrs[PKTMGR_TLM_PIPE_BATCH_SIZE];
 
    do
    {
-      SbStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, PktMgr->TlmPipe, CFE_SB_POLL);
+      SbStatus = CFE_SB_ReceiveBufferBatch(SbBufPtrs, PKTMGR_TLM_PIPE_BATCH_SIZE, &NumPktsRcvd,
+                                           PktMgr->TlmPipe, CFE_SB_POLL);
+
+      CFE_SB_ReleaseBufferBatch(SbBufPtrs, NumPktsRcvd, PktMgr->TlmPipe);
 
    } while(SbStatus == CFE_SUCCESS);
 
@@ -784,6 +801,35 @@ static int32 PackEdsOutputMessage(void *DestBuffer, const CFE_MSG_Message_t *Src
 }
 
 
+/******************************************************************************
+** Function: SendTlmBatch
+**
+** Send the first NumMsgs packets queued in SocketMsg.
+**
+** Notes:
+**   1. A short count only means the socket buffer is full and the rest of the
+**      batch is dropped like any other lost datagram. Only an error suppresses
+**      further output.
+*/
+static void SendTlmBatch(uint16 NumMsgs)
+{
+
+   int32 SocketStatus;
+   
+   SocketStatus = OS_SocketSendMulti(PktMgr->TlmSockId, SocketMsg, NumMsgs);
+   
+   if (SocketStatus < 0)
+   {
+       
+      CFE_EVS_SendEvent(PKTMGR_SOCKET_SEND_ERR_EID,CFE_EVS_EventType_ERROR,
+                        "Error sending packet on socket %s, port %d, status %d. Tlm output suppressed\n",
+                        PktMgr->TlmDestIp, PktMgr->TlmUdpPort, (int)SocketStatus);
+      PktMgr->SuppressSend = true;
+   }
+
+} /* End SendTlmBatch() */
+
+
 /******************************************************************************
 ** Function: SubscribeNewPkt
 **
@@ -49,6 +49,9 @@
 
 #define PKTMGR_IP_STR_LEN  16
 
+#define PKTMGR_TLM_PIPE_BATCH_SIZE  32  /* Max packets read from the telemetry pipe per SB call */
+#define PKTMGR_TLM_SEND_BATCH_SIZE   8  /* Max packed packets sent per socket call            */
+
 
 /*
 ** Event Message IDs
@@ -63,6 +63,7 @@
 #include "cjson.h"
 #include "staterep.h"
 #include "pktutil.h"
+#include "pktpub.h"
 #include "childmgr.h"
 #include "crc.h"
 
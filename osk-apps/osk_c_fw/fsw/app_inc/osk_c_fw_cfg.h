@@ -67,6 +67,7 @@
 #define CMDMGR_BASE_EID           10 
 #define TBLMGR_BASE_EID           20
 #define JSON_BASE_EID             30
+#define PKTPUB_BASE_EID           40
 #define CHILDMGR_BASE_EID         50
 #define STATEREP_BASE_EID         70
 #define CJSON_BASE_EID            80
@@ -0,0 +1,153 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Publish a telemetry packet using software bus zero copy buffers.
+**
+**  Notes:
+**    1. CFE_SB_TransmitMsg() copies the entire message into a software bus
+**       buffer. For large packets that are sent often the app should fill
+**       the packet directly in a software bus buffer and transmit the buffer.
+**       This object manages the buffers so the app doesn't have to.
+**    2. Two buffers are allocated for each packet. The app fills one while
+**       the other is ready to be filled. PKTPUB_Publish() transmits the
+**       filled buffer, swaps to the other one, and allocates a replacement
+**       so a transient pool allocation failure doesn't stall the app.
+**    3. A buffer is given to the software bus when it is published so the
+**       app must fill the entire packet after each publish. The message
+**       header is initialized when a buffer is allocated.
+**    4. If a publish fails the app still owns the buffer and its contents
+**       are preserved so the app can retry the publish.
+**    5. PKTPUB_Constructor() must be called prior to any other PKTPUB_
+**       functions.
+**
+**  References:
+**    1. OpenSatKit Object-based Application Developer's Guide.
+**    2. cFS Application Developer's Guide.
+**
+*/
+
+#ifndef _pktpub_
+#define _pktpub_
+
+/*
+** Includes
+*/
+
+#include "osk_c_fw_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+#define PKTPUB_BUF_CNT  2
+
+/*
+** Event Message IDs
+*/
+
+#define PKTPUB_ALLOC_BUF_ERR_EID  (PKTPUB_BASE_EID + 0)
+#define PKTPUB_SEND_BUF_ERR_EID   (PKTPUB_BASE_EID + 1)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Packet Publisher Class
+*/
+
+typedef struct
+{
+
+   CFE_SB_MsgId_t    MsgId;
+   size_t            MsgLen;
+
+   uint16            FillIdx;               /* Index of the buffer being filled by the app */
+   CFE_SB_Buffer_t*  Buf[PKTPUB_BUF_CNT];   /* NULL if not allocated                       */
+
+   uint32            PublishCnt;
+   uint32            AllocErrCnt;
+   uint32            SendErrCnt;
+
+} PKTPUB_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: PKTPUB_Constructor
+**
+** Initialize a packet publisher and allocate its buffers.
+**
+** Notes:
+**   1. This function must be called prior to any other PKTPUB_ functions.
+**   2. Returns false if no buffers could be allocated. The object is still
+**      valid and allocation will be retried by PKTPUB_Publish().
+**
+*/
+bool PKTPUB_Constructor(PKTPUB_Class_t*  PktPub,
+                        CFE_SB_MsgId_t   MsgId,
+                        size_t           MsgLen);
+
+
+/******************************************************************************
+** Function: PKTPUB_Destructor
+**
+** Release any buffers that have not been published.
+**
+** Notes:
+**   1. Typically called from the app's delete handler. The software bus
+**      also releases an app's buffers when the app is deleted.
+**
+*/
+void PKTPUB_Destructor(PKTPUB_Class_t* PktPub);
+
+
+/******************************************************************************
+** Function: PKTPUB_GetMsgPtr
+**
+** Return a pointer to the message the app should fill.
+**
+** Notes:
+**   1. Returns NULL if no buffer is available. The pointer is only valid
+**      until the next successful PKTPUB_Publish().
+**
+*/
+CFE_MSG_Message_t* PKTPUB_GetMsgPtr(PKTPUB_Class_t* PktPub);
+
+
+/******************************************************************************
+** Function: PKTPUB_Publish
+**
+** Time stamp and transmit the filled message without copying it.
+**
+** Notes:
+**   1. Returns true if the message was sent. Ownership of the buffer passes
+**      to the software bus and the app must get a new message pointer.
+**   2. Returns false if there was no buffer or the send failed. In the
+**      latter case the buffer contents are preserved for a retry.
+**
+*/
+bool PKTPUB_Publish(PKTPUB_Class_t* PktPub, bool IncrementSeqCnt);
+
+
+#endif /* _pktpub_ */
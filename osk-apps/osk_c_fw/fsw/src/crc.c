@@ -16,9 +16,8 @@
 **    Provide utilities that compute CRCs.
 **
 **  Notes:
-**    1. See https://stackoverflow.com/questions/27939882/fast-crc-algorithm
-**    2. Th efollowing algorithm was suggessted in a comment as potentially more
-**       efficient:  crc = (crc >> 1) ^ (POLY & (0 - (crc & 1)));
+**    1. The CRC is computed by cFE ES which uses slice-by-8 tables or the
+**       CPU CRC instructions when available.
 **
 **  References:
 **    1. OpenSatKit Object-based Application Developer's Guide.
@@ -31,24 +30,10 @@
 ** Includes
 */
 
-#include <stddef.h>
-#include <stdint.h>
-
+#include "cfe.h"
 #include "crc.h"
 
 
-/***********************/
-/** Macro Definitions **/
-/***********************/
-
-
-/* CRC-32C (iSCSI) polynomial in reversed bit order. */
-#define POLY 0x82f63b78
-
-/* CRC-32 (Ethernet, ZIP, etc.) polynomial in reversed bit order. */
-/* #define POLY 0xedb88320 */
-
-
 /******************************************************************************
 ** Function: CRC_32c
 **
@@ -57,21 +42,7 @@
 uint32 CRC_32c(uint32 Crc, const uint8 *Buf, size_t BufLen)
 {        
 
-   int k;
-
-   Crc = ~Crc;
-   
-   while (BufLen--)
-   {
-   
-      Crc ^= *Buf++;
-      for (k = 0; k < 8; k++)
-         Crc = Crc & 1 ? (Crc >> 1) ^ POLY : Crc >> 1;
-   }
-   
-   return ~Crc;
-
+   return CFE_ES_CalculateCRC(Buf, BufLen, Crc, CFE_MISSION_ES_CRC_32C);
 
 } /* End CRC_32c() */
 
-
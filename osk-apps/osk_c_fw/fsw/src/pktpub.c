@@ -0,0 +1,190 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Publish a telemetry packet using software bus zero copy buffers.
+**
+**  Notes:
+**    1. See pktpub.h for details.
+**
+**  References:
+**    1. OpenSatKit Object-based Application Developer's Guide.
+**    2. cFS Application Developer's Guide.
+**
+*/
+
+
+/*
+** Includes
+*/
+
+#include "pktpub.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool AllocBuffers(PKTPUB_Class_t* PktPub);
+
+
+/******************************************************************************
+** Function: PKTPUB_Constructor
+**
+*/
+bool PKTPUB_Constructor(PKTPUB_Class_t*  PktPub,
+                        CFE_SB_MsgId_t   MsgId,
+                        size_t           MsgLen)
+{
+
+   CFE_PSP_MemSet(PktPub, 0, sizeof(PKTPUB_Class_t));
+
+   PktPub->MsgId  = MsgId;
+   PktPub->MsgLen = MsgLen;
+
+   return AllocBuffers(PktPub);
+
+} /* End PKTPUB_Constructor() */
+
+
+/******************************************************************************
+** Function: PKTPUB_Destructor
+**
+*/
+void PKTPUB_Destructor(PKTPUB_Class_t* PktPub)
+{
+
+   uint16 i;
+
+   for (i=0; i < PKTPUB_BUF_CNT; i++)
+   {
+      if (PktPub->Buf[i] != NULL)
+      {
+         CFE_SB_ReleaseMessageBuffer(PktPub->Buf[i]);
+         PktPub->Buf[i] = NULL;
+      }
+   }
+
+} /* End PKTPUB_Destructor() */
+
+
+/******************************************************************************
+** Function: PKTPUB_GetMsgPtr
+**
+** Notes:
+**   1. If the fill buffer couldn't be replaced after the last publish then
+**      switch to the spare.
+*/
+CFE_MSG_Message_t* PKTPUB_GetMsgPtr(PKTPUB_Class_t* PktPub)
+{
+
+   uint16 i;
+
+   for (i=0; i < PKTPUB_BUF_CNT && PktPub->Buf[PktPub->FillIdx] == NULL; i++)
+   {
+      PktPub->FillIdx = (PktPub->FillIdx + 1) % PKTPUB_BUF_CNT;
+   }
+
+   return (PktPub->Buf[PktPub->FillIdx] == NULL) ? NULL : &PktPub->Buf[PktPub->FillIdx]->Msg;
+
+} /* End PKTPUB_GetMsgPtr() */
+
+
+/******************************************************************************
+** Function: PKTPUB_Publish
+**
+** Notes:
+**   1. The consumed buffer is replaced after the send so the allocation is
+**      not between the app filling the packet and the packet being sent.
+*/
+bool PKTPUB_Publish(PKTPUB_Class_t* PktPub, bool IncrementSeqCnt)
+{
+
+   CFE_SB_Buffer_t* BufPtr = PktPub->Buf[PktPub->FillIdx];
+   int32 SbStatus;
+   bool  RetStatus = false;
+
+   if (BufPtr != NULL)
+   {
+
+      CFE_SB_TimeStampMsg(&BufPtr->Msg);
+      SbStatus = CFE_SB_TransmitBuffer(BufPtr, IncrementSeqCnt);
+
+      if (SbStatus == CFE_SUCCESS)
+      {
+         PktPub->Buf[PktPub->FillIdx] = NULL;
+         PktPub->FillIdx = (PktPub->FillIdx + 1) % PKTPUB_BUF_CNT;
+         PktPub->PublishCnt++;
+         RetStatus = true;
+      }
+      else
+      {
+         PktPub->SendErrCnt++;
+         CFE_EVS_SendEvent(PKTPUB_SEND_BUF_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error transmitting buffer for message 0x%04X. Status=0x%08X",
+                           (unsigned int)CFE_SB_MsgIdToValue(PktPub->MsgId), (unsigned int)SbStatus);
+      }
+
+   } /* End if have a buffer */
+
+   AllocBuffers(PktPub);
+
+   return RetStatus;
+
+} /* End PKTPUB_Publish() */
+
+
+/******************************************************************************
+** Function: AllocBuffers
+**
+** Allocate and initialize any buffers that are not allocated. Returns true
+** if at least one buffer is available.
+**
+** Notes:
+**   1. The event should be filtered by the app since a depleted pool would
+**      cause it to be sent on every publish.
+*/
+static bool AllocBuffers(PKTPUB_Class_t* PktPub)
+{
+
+   uint16 i;
+   bool   BufAvailable = false;
+
+   for (i=0; i < PKTPUB_BUF_CNT; i++)
+   {
+      if (PktPub->Buf[i] == NULL)
+      {
+         PktPub->Buf[i] = CFE_SB_AllocateMessageBuffer(PktPub->MsgLen);
+         if (PktPub->Buf[i] != NULL)
+         {
+            CFE_MSG_Init(&PktPub->Buf[i]->Msg, PktPub->MsgId, PktPub->MsgLen);
+         }
+         else
+         {
+            PktPub->AllocErrCnt++;
+            CFE_EVS_SendEvent(PKTPUB_ALLOC_BUF_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error allocating %lu byte buffer for message 0x%04X",
+                              (unsigned long)PktPub->MsgLen, (unsigned int)CFE_SB_MsgIdToValue(PktPub->MsgId));
+         }
+      }
+
+      if (PktPub->Buf[i] != NULL)
+      {
+         BufAvailable = true;
+      }
+   }
+
+   return BufAvailable;
+
+} /* End AllocBuffers() */